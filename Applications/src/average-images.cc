@@ -24,6 +24,7 @@
 
 #include "mirtk/Matrix.h"
 #include "mirtk/GenericImage.h"
+#include "mirtk/ImageReader.h"
 #include "mirtk/VoxelFunction.h"
 #include "mirtk/InterpolateImageFunction.h"
 
@@ -79,6 +80,18 @@ void PrintHelp(const char* name)
   cout << "                             Output background value zero by default or minimum average intensity minus 1. (default: 0)" << endl;
   cout << "  -interp <mode>             Interpolation mode, e.g., NN, Linear, BSpline, Cubic, Sinc. (default: Linear)" << endl;
   cout << "  -label <value>             Segmentation label of which to create an average probability map." << endl;
+  cout << "  -mean                      Compute voxel-wise weighted mean of input intensities. (default)" << endl;
+  cout << "  -median                    Compute voxel-wise weighted median of input intensities. Input values" << endl;
+  cout << "                             equal to the :option:`-padding` value are excluded." << endl;
+  cout << "  -trimmed-mean <percent>    Compute voxel-wise weighted mean of input intensities excluding the given" << endl;
+  cout << "                             percentage of the total weight of the lowest and highest values." << endl;
+  cout << "                             Input values equal to the :option:`-padding` value are excluded." << endl;
+  cout << "  -memory <MB>               Maximum size in megabytes of the average image, the input images which are" << endl;
+  cout << "                             resampled concurrently, their cached displacements, and the buffer of" << endl;
+  cout << "                             resampled input values. When this memory is too small for the entire" << endl;
+  cout << "                             average image, the average is computed for one slab of slices at a time" << endl;
+  cout << "                             and the input images are read once for each slab. (default: 2048)" << endl;
+  cout << "  -batch <n>                 Number of input images which are read and resampled concurrently. (default: 16)" << endl;
   PrintCommonOptions(cout);
   cout << endl;
 }
@@ -96,6 +109,14 @@ typedef GenericInterpolateImageFunction<InputImage> InputImageFunction;
 typedef float                     OutputType;
 typedef GenericImage<OutputType>  OutputImage;
 
+// Enumeration of voxel-wise statistics
+enum AverageStatistic
+{
+  Average_Mean,       ///< Weighted mean
+  Average_Median,     ///< Weighted median
+  Average_TrimmedMean ///< Weighted mean excluding lowest and highest values
+};
+
 // =============================================================================
 // Auxiliary functions
 // =============================================================================
@@ -215,7 +236,20 @@ void Read(const string &image_name, const string    &imdof_name,
 #endif // HAVE_MIRTK_Transformation
 
 // -----------------------------------------------------------------------------
-struct AddVoxelValueToAverage : public VoxelFunction
+/// Get attributes of a slab of slices of the average image domain
+ImageAttributes SlabAttributes(const ImageAttributes &fov, int k1, int k2)
+{
+  ImageAttributes slab = fov;
+  slab._z = k2 - k1;
+  const double offset = (k1 + .5 * (slab._z - 1) - .5 * (fov._z - 1)) * fov._dz;
+  slab._xorigin += offset * fov._zaxis[0];
+  slab._yorigin += offset * fov._zaxis[1];
+  slab._zorigin += offset * fov._zaxis[2];
+  return slab;
+}
+
+// -----------------------------------------------------------------------------
+struct ResampleVoxelValue : public VoxelFunction
 {
   OutputImage        *_Average;
   InputImageFunction *_Image;
@@ -228,7 +262,7 @@ struct AddVoxelValueToAverage : public VoxelFunction
     bool                  _Invert;
   #endif
 
-  void operator()(int i, int j, int k, int, OutputType *avg)
+  void operator()(int i, int j, int k, int, OutputType *value)
   {
     double x = i, y = j, z = k;
     _Average->ImageToWorld(x, y, z);
@@ -246,51 +280,224 @@ struct AddVoxelValueToAverage : public VoxelFunction
     _Image->Input()->WorldToImage(x, y, z);
     if (_Label > 0) {
       if (static_cast<int>(_Image->Evaluate(x, y, z)) == _Label) {
-        *avg += static_cast<OutputType>(_Weight);
-      }
-    } else {
-      const OutputType bg = static_cast<OutputType>(_Average->GetBackgroundValueAsDouble());
-      if ((IsNaN(bg) && IsNaN(*avg)) || (*avg == bg)) {
-        *avg = static_cast<OutputType>(_Weight * _Image->Evaluate(x, y, z));
+        *value = static_cast<OutputType>(_Weight);
       } else {
-        *avg += static_cast<OutputType>(_Weight * _Image->Evaluate(x, y, z));
+        *value = OutputType(0);
       }
+    } else {
+      *value = static_cast<OutputType>(_Weight * _Image->Evaluate(x, y, z));
     }
   }
 };
 
 // -----------------------------------------------------------------------------
-void Add(OutputImage &average, InputImage &image, int label = -1,
-         #ifdef HAVE_MIRTK_Transformation
-           Transformation   *transformation = NULL,
-           bool              invert         = false,
-         #endif // HAVE_MIRTK_Transformation
-         OutputType        weight         = 1.0,
-         InterpolationMode interpolation  = Interpolation_Linear)
+/// Resample (transformed) input image on (slab of) average image domain
+void Resample(OutputImage &values, InputImage &image, int label = -1,
+              #ifdef HAVE_MIRTK_Transformation
+                Transformation   *transformation = NULL,
+                bool              invert         = false,
+              #endif // HAVE_MIRTK_Transformation
+              OutputType        weight         = 1.0,
+              InterpolationMode interpolation  = Interpolation_Linear)
 {
   if (label > 0) interpolation = Interpolation_NN;
-  AddVoxelValueToAverage add;
+  ResampleVoxelValue eval;
   #ifdef HAVE_MIRTK_Transformation
     GenericImage<double> disp;
     if (transformation && transformation->RequiresCachingOfDisplacements()) {
-      disp.Initialize(average.Attributes(), 3);
+      disp.Initialize(values.Attributes(), 3);
       // Note: Input transformation is from image to average!
       if (invert) transformation->Displacement(disp);
       else        transformation->InverseDisplacement(disp);
     }
-    add._Transformation = transformation;
-    add._Displacement   = (disp.IsEmpty() ? NULL : &disp);
-    add._Invert         = invert;
+    eval._Transformation = transformation;
+    eval._Displacement   = (disp.IsEmpty() ? NULL : &disp);
+    eval._Invert         = invert;
   #endif // HAVE_MIRTK_Transformation
-  add._Average = &average;
-  add._Weight  = weight;
-  add._Label   = label;
-  add._Image   = InputImageFunction::New(interpolation, &image);
-  add._Image->Initialize();
-  ParallelForEachVoxel(average.Attributes(), average, add);
-  delete add._Image;
+  eval._Average = &values;
+  eval._Weight  = weight;
+  eval._Label   = label;
+  eval._Image   = InputImageFunction::New(interpolation, &image);
+  eval._Image->Initialize();
+  ParallelForEachVoxel(values.Attributes(), values, eval);
+  delete eval._Image;
 }
 
+// -----------------------------------------------------------------------------
+/// Read input images concurrently and get their (mapped) field-of-view
+struct GetFieldOfView
+{
+  const Array<string>    *_ImageName;
+  #ifdef HAVE_MIRTK_Transformation
+    const Array<string>  *_DofName;
+    const Array<bool>    *_DofInvert;
+  #endif
+  ImageAttributes        *_Attributes;
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    InputImage image;
+    #ifdef HAVE_MIRTK_Transformation
+      Transformation *imdof = NULL;
+    #endif
+    for (int n = re.begin(); n != re.end(); ++n) {
+      #ifdef HAVE_MIRTK_Transformation
+        Read((*_ImageName)[n], (*_DofName)[n], image, imdof, (*_DofInvert)[n]);
+        Delete(imdof);
+      #else // HAVE_MIRTK_Transformation
+        image.Read((*_ImageName)[n].c_str());
+      #endif // HAVE_MIRTK_Transformation
+      _Attributes[n] = image.Attributes();
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Read batch of input images concurrently and resample them on slab of average
+/// image domain, where the values of the n-th image of the batch are stored in
+/// the n-th block of the output buffer
+struct ResampleImages
+{
+  const Array<string>     *_ImageName;
+  #ifdef HAVE_MIRTK_Transformation
+    const Array<string>   *_DofName;
+    const Array<bool>     *_DofInvert;
+  #endif
+  const Array<OutputType> *_Weight;
+  const InputImage        *_Sequence;
+  ImageAttributes          _Slab;
+  OutputType              *_Values;
+  int                      _Offset;
+  int                      _Label;
+  InterpolationMode        _Interpolation;
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    InputImage image;
+    const int  nvox = _Slab.NumberOfSpatialPoints();
+    #ifdef HAVE_MIRTK_Transformation
+      Transformation *imdof = NULL;
+    #endif
+    for (int n = re.begin(); n != re.end(); ++n) {
+      if (_Sequence) {
+        _Sequence->GetFrame(image, n);
+      } else {
+        #ifdef HAVE_MIRTK_Transformation
+          Read((*_ImageName)[n], (*_DofName)[n], image, imdof, (*_DofInvert)[n]);
+        #else // HAVE_MIRTK_Transformation
+          image.Read((*_ImageName)[n].c_str());
+        #endif // HAVE_MIRTK_Transformation
+      }
+      OutputImage values(_Slab, _Values + static_cast<size_t>(n - _Offset) * nvox);
+      Resample(values, image, _Label,
+               #ifdef HAVE_MIRTK_Transformation
+                 imdof, imdof && (*_DofInvert)[n],
+               #endif
+               _Weight ? (*_Weight)[n] : OutputType(1), _Interpolation);
+      #ifdef HAVE_MIRTK_Transformation
+        Delete(imdof);
+      #endif
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Add resampled and weighted values of batch of input images to sum
+struct AddValuesToAverage
+{
+  OutputType       *_Average;
+  const OutputType *_Values;
+  int               _NumberOfValues;
+  int               _NumberOfVoxels;
+  OutputType        _Background;
+  bool              _Label;
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    const bool bgnan = IsNaN(_Background);
+    for (int idx = re.begin(); idx != re.end(); ++idx) {
+      OutputType       &avg = _Average[idx];
+      const OutputType *v   = _Values + idx;
+      for (int n = 0; n < _NumberOfValues; ++n, v += _NumberOfVoxels) {
+        if (!_Label && ((bgnan && IsNaN(avg)) || avg == _Background)) {
+          avg = *v;
+        } else {
+          avg += *v;
+        }
+      }
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Compare weighted samples by their value
+inline bool CompareSampleValues(const Pair<OutputType, OutputType> &a,
+                                const Pair<OutputType, OutputType> &b)
+{
+  return a.first < b.first;
+}
+
+// -----------------------------------------------------------------------------
+/// Evaluate weighted median or trimmed mean of resampled input values
+struct EvaluateRobustAverage
+{
+  OutputType              *_Average;
+  const OutputType        *_Values;
+  const Array<OutputType> *_Weight;
+  int                      _NumberOfVoxels;
+  OutputType               _Padding;
+  AverageStatistic         _Statistic;
+  double                   _Trim;
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    const int n = static_cast<int>(_Weight->size());
+    Array<Pair<OutputType, OutputType> > samples;
+    samples.reserve(n);
+    for (int idx = re.begin(); idx != re.end(); ++idx) {
+      // Collect valid samples
+      double wsum = .0;
+      samples.clear();
+      const OutputType *v = _Values + idx;
+      for (int i = 0; i < n; ++i, v += _NumberOfVoxels) {
+        if (IsNaN(*v) || *v == _Padding || (*_Weight)[i] <= OutputType(0)) continue;
+        samples.push_back(MakePair(*v, (*_Weight)[i]));
+        wsum += (*_Weight)[i];
+      }
+      if (samples.empty()) {
+        _Average[idx] = _Padding;
+        continue;
+      }
+      sort(samples.begin(), samples.end(), CompareSampleValues);
+      if (_Statistic == Average_Median) {
+        // First value at which cumulative weight reaches half of total weight
+        double c = .0;
+        size_t i = 0;
+        while (i < samples.size() - 1 && (c += samples[i].second) < .5 * wsum) ++i;
+        _Average[idx] = samples[i].first;
+      } else {
+        // Mean of values within [trim, 1 - trim] fraction of total weight,
+        // where samples at the boundaries contribute with partial weight
+        const double lower = _Trim * wsum, upper = (1. - _Trim) * wsum;
+        double c = .0, w, sum = .0, norm = .0;
+        for (size_t i = 0; i < samples.size(); ++i) {
+          w  = min(c + samples[i].second, upper) - max(c, lower);
+          c += samples[i].second;
+          if (w > .0) {
+            sum  += w * samples[i].first;
+            norm += w;
+          }
+        }
+        if (norm > .0) {
+          _Average[idx] = static_cast<OutputType>(sum / norm);
+        } else {
+          _Average[idx] = samples[samples.size() / 2].first;
+        }
+      }
+    }
+  }
+};
+
 // =============================================================================
 // Main
 // =============================================================================
@@ -298,13 +505,12 @@ void Add(OutputImage &average, InputImage &image, int label = -1,
 // -----------------------------------------------------------------------------
 int main(int argc, char **argv)
 {
-  InputImage        sequence, image;
+  InputImage        sequence;
   Array<string>     image_name;
   Array<OutputType> image_weight;
   int               nimages;
 
   #ifdef HAVE_MIRTK_Transformation
-    Transformation *imdof = NULL;
     Array<string>   imdof_name;
     Array<bool>     imdof_invert;
   #endif // HAVE_MIRTK_Transformation
@@ -367,6 +573,10 @@ int main(int argc, char **argv)
   bool               voxelwise       = false;
   int                label           = -1;
   int                margin          = -1;
+  AverageStatistic   statistic       = Average_Mean;
+  double             trim            = .0;
+  double             memory          = 2048.0;
+  int                batch           = 16;
   double             dx = .0, dy = .0, dz = .0;
 
   for (ARGUMENTS_AFTER(nposarg)) {
@@ -386,10 +596,28 @@ int main(int argc, char **argv)
     else if (OPTION("-margin"))    PARSE_ARGUMENT(margin);
     else if (OPTION("-label"))     PARSE_ARGUMENT(label);
     else if (OPTION("-interp"))    PARSE_ARGUMENT(interpolation);
+    else if (OPTION("-mean"))      statistic = Average_Mean;
+    else if (OPTION("-median"))    statistic = Average_Median;
+    else if (OPTION("-trimmed-mean")) {
+      statistic = Average_TrimmedMean;
+      PARSE_ARGUMENT(trim);
+    }
+    else if (OPTION("-memory"))    PARSE_ARGUMENT(memory);
+    else if (OPTION("-batch"))     PARSE_ARGUMENT(batch);
     else HANDLE_COMMON_OR_UNKNOWN_OPTION();
   }
 
   if (label > 0 && IsNaN(padding)) padding = .0;
+  if (label > 0 && statistic != Average_Mean) {
+    FatalError("Options -median and -trimmed-mean cannot be used with -label!");
+  }
+  if (trim < .0 || trim >= 50.0) {
+    FatalError("Invalid -trimmed-mean percentage, must be in [0, 50)!");
+  }
+  if (memory <= .0) {
+    FatalError("Invalid -memory argument, must be positive!");
+  }
+  if (batch < 1) batch = 1;
 
   // ---------------------------------------------------------------------------
   // Collect (further) input image meta-data...
@@ -403,6 +631,11 @@ int main(int argc, char **argv)
       if (verbose) cout << endl;
       FatalError("Input sequence contains only one temporal frame!");
     }
+    image_weight.resize(nimages, 1.0);
+    #ifdef HAVE_MIRTK_Transformation
+      imdof_name  .resize(nimages);
+      imdof_invert.resize(nimages);
+    #endif // HAVE_MIRTK_Transformation
     if (verbose) cout << " done\n" << endl;
   }
 
@@ -445,19 +678,26 @@ int main(int argc, char **argv)
     GreyImage reference(reference_name);
     fov = reference.Attributes();
   } else {
-    Array<ImageAttributes> attr;
-    for (int n = 0; n < nimages; ++n) {
+    Array<ImageAttributes> attr(nimages);
+    if (sequence.IsEmpty()) {
+      GetFieldOfView read;
+      read._ImageName  = &image_name;
       #ifdef HAVE_MIRTK_Transformation
-        Read(image_name[n], imdof_name[n], image, imdof, imdof_invert[n]);
-        Delete(imdof);
-      #else // HAVE_MIRTK_Transformation
-        image.Read(image_name[n].c_str());
-      #endif // HAVE_MIRTK_Transformation
-      if (image.T() > 1) {
+        read._DofName    = &imdof_name;
+        read._DofInvert  = &imdof_invert;
+      #endif
+      read._Attributes = attr.data();
+      parallel_for(blocked_range<int>(0, nimages), read);
+    } else {
+      for (int n = 0; n < nimages; ++n) attr[n] = sequence.Attributes();
+      for (int n = 0; n < nimages; ++n) attr[n]._t = 1;
+    }
+    for (int n = 0; n < nimages; ++n) {
+      if (attr[n]._t > 1) {
         if (verbose) cout << " failed" << endl;
         FatalError("Image " << (n+1) << " has four dimensions!");
       }
-      attr.push_back(OrthogonalFieldOfView(image.Attributes()));
+      attr[n] = OrthogonalFieldOfView(attr[n]);
     }
     fov = OverallFieldOfView(attr);
   }
@@ -481,41 +721,106 @@ int main(int argc, char **argv)
   OutputImage average(fov);
   average = static_cast<OutputType>(padding);
   average.PutBackgroundValueAsDouble(padding);
-  for (int n = 0; n < nimages; ++n) {
-    if (sequence.IsEmpty()) {
+
+  // Resampled values of all images are needed to compute robust statistics,
+  // whereas the values of each batch of images are added to the sum otherwise
+  if (batch > nimages) batch = nimages;
+  const int nvalues = (statistic == Average_Mean ? batch : nimages);
+
+  // Size of largest input image, of which one is read for each image of a batch
+  double max_input_voxels = .0;
+  if (sequence.IsEmpty()) {
+    for (int n = 0; n < nimages; ++n) {
+      unique_ptr<ImageReader> reader(ImageReader::New(image_name[n].c_str()));
+      max_input_voxels = max(max_input_voxels, static_cast<double>(reader->Attributes().NumberOfPoints()));
+    }
+  } else {
+    max_input_voxels = static_cast<double>(sequence.NumberOfSpatialVoxels());
+  }
+
+  // Whether displacements of a transformation may have to be cached for
+  // each image of a batch, which requires three values per slab voxel
+  bool cache_displacements = false;
+  #ifdef HAVE_MIRTK_Transformation
+    for (int n = 0; n < nimages; ++n) {
+      if (!imdof_name[n].empty()) cache_displacements = true;
+    }
+  #endif // HAVE_MIRTK_Transformation
+
+  // Choose number of slices of each slab such that the total size of the
+  // average image, input sequence or batch of input images, displacements,
+  // and resampled values does not exceed the -memory limit
+  const int    nvox_slice  = fov._x * fov._y;
+  const double max_bytes   = memory * 1024.0 * 1024.0;
+  const double fixed_bytes = static_cast<double>(fov.NumberOfPoints()) * sizeof(OutputType)
+                           + static_cast<double>(sequence.NumberOfVoxels()) * sizeof(InputType)
+                           + max_input_voxels * batch * sizeof(InputType);
+  const double slice_bytes = static_cast<double>(nvox_slice)
+                           * (nvalues * sizeof(OutputType) + (cache_displacements ? 3 * batch * sizeof(double) : 0));
+  const int    nslices     = max(1, min(fov._z, static_cast<int>((max_bytes - fixed_bytes) / slice_bytes)));
+  const int    nslabs      = (fov._z + nslices - 1) / nslices;
+  if (verbose && fixed_bytes + nslices * slice_bytes > max_bytes) {
+    cout << "Warning: Memory required for slabs of one slice exceeds the -memory limit" << endl;
+  }
+  Array<OutputType> values(static_cast<size_t>(nslices) * nvox_slice * nvalues);
+
+  ResampleImages resample;
+  resample._ImageName     = &image_name;
+  #ifdef HAVE_MIRTK_Transformation
+    resample._DofName       = &imdof_name;
+    resample._DofInvert     = &imdof_invert;
+  #endif
+  resample._Weight        = (statistic == Average_Mean ? &image_weight : NULL);
+  resample._Sequence      = (sequence.IsEmpty() ? NULL : &sequence);
+  resample._Values        = values.data();
+  resample._Label         = label;
+  resample._Interpolation = interpolation;
+
+  for (int s = 0; s < nslabs; ++s) {
+    const int k1 = s * nslices;
+    const int k2 = min(k1 + nslices, fov._z);
+    resample._Slab = SlabAttributes(fov, k1, k2);
+    const int nvox = resample._Slab.NumberOfSpatialPoints();
+    OutputType * const avg = average.Data(0, 0, k1);
+    if (verbose && nslabs > 1) {
+      cout << "Process slab " << setw(3) << (s+1) << " out of " << nslabs << endl;
+    }
+    for (int n1 = 0; n1 < nimages; n1 += batch) {
+      const int n2 = min(n1 + batch, nimages);
       if (verbose) {
-        cout << "Add image " << setw(3) << (n+1) << " out of " << nimages << "... ";
+        cout << "Add " << (sequence.IsEmpty() ? "images " : "frames ") << setw(3) << (n1+1);
+        if (n2 - n1 > 1) cout << "-" << n2;
+        cout << " out of " << nimages << "... ";
         cout.flush();
       }
-      #ifdef HAVE_MIRTK_Transformation
-        Read(image_name[n], imdof_name[n], image, imdof, imdof_invert[n]);
-      #else // HAVE_MIRTK_Transformation
-        image.Read(image_name[n].c_str());
-      #endif // HAVE_MIRTK_Transformation
-    } else {
-      if (verbose) {
-        cout << "Add frame " << setw(3) << (n+1) << " out of " << nimages << "... ";
-        cout.flush();
+      resample._Offset = (statistic == Average_Mean ? n1 : 0);
+      parallel_for(blocked_range<int>(n1, n2, 1), resample);
+      if (statistic == Average_Mean) {
+        AddValuesToAverage add;
+        add._Average        = avg;
+        add._Values         = values.data();
+        add._NumberOfValues = n2 - n1;
+        add._NumberOfVoxels = nvox;
+        add._Background     = static_cast<OutputType>(padding);
+        add._Label          = (label > 0);
+        parallel_for(blocked_range<int>(0, nvox), add);
       }
-      sequence.GetFrame(image, n);
-      #ifdef HAVE_MIRTK_Transformation
-        imdof = NULL;
-      #endif
+      if (verbose) cout << " done" << endl;
+    }
+    if (statistic != Average_Mean) {
+      EvaluateRobustAverage eval;
+      eval._Average        = avg;
+      eval._Values         = values.data();
+      eval._Weight         = &image_weight;
+      eval._NumberOfVoxels = nvox;
+      eval._Padding        = static_cast<OutputType>(padding);
+      eval._Statistic      = statistic;
+      eval._Trim           = trim / 100.0;
+      parallel_for(blocked_range<int>(0, nvox), eval);
     }
-
-    Add(average, image, label, 
-        #ifdef HAVE_MIRTK_Transformation
-          imdof, imdof_invert[n],
-        #endif
-        image_weight[n], interpolation);
-
-    #ifdef HAVE_MIRTK_Transformation
-      Delete(imdof);
-    #endif
-
-    if (verbose) cout << " done" << endl;
   }
-  if (wsum > .0) average /= wsum;
+  values.clear();
+  if (statistic == Average_Mean && wsum > .0) average /= wsum;
 
   // Crop/pad average image
   if (margin >= 0) average.CropPad(margin);
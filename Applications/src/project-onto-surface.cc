@@ -27,6 +27,8 @@
 #include "mirtk/NearestNeighborInterpolateImageFunction.h"
 #include "mirtk/LinearInterpolateImageFunction.h"
 #include "mirtk/EuclideanDistanceTransform.h"
+#include "mirtk/PointSetUtils.h"
+#include "mirtk/BoundingVolumeHierarchy.h"
 
 #include "mirtk/Vtk.h"
 
@@ -442,6 +444,61 @@ void LabelCortex(vtkPolyData *surface, const LabelImage &labels, int nsteps = 10
   delete[] pweights;
 }
 
+// -----------------------------------------------------------------------------
+/// Get center points and (smoothed) normals of surface cells
+void GetCellCentersAndNormals(vtkPolyData *surface, Array<double> &centers, Array<double> &normals)
+{
+  vtkSmartPointer<vtkPolyData> mesh = ComputeCellNormals(surface);
+  vtkDataArray *cell_normals = mesh->GetCellData()->GetNormals();
+
+  const int ncells = static_cast<int>(mesh->GetNumberOfCells());
+  centers.resize(3 * ncells);
+  normals.resize(3 * ncells);
+
+  vtkCell *cell;
+  int      subId;
+  double   pcoords[3];
+  double  *pweights = new double[mesh->GetMaxCellSize()];
+
+  for (int cellId = 0; cellId < ncells; ++cellId) {
+    cell  = mesh->GetCell(cellId);
+    subId = cell->GetParametricCenter(pcoords);
+    cell->EvaluateLocation(subId, pcoords, centers.data() + 3 * cellId, pweights);
+    cell_normals->GetTuple(cellId, normals.data() + 3 * cellId);
+  }
+
+  delete[] pweights;
+}
+
+// -----------------------------------------------------------------------------
+/// Find first intersections of line segments with a surface
+///
+/// When the surface is a triangulated mesh, the line segments are intersected
+/// with the surface in parallel using a bounding volume hierarchy. Otherwise,
+/// the intersections are found one at a time using a vtkModifiedBSPTree.
+void IntersectWithLines(vtkPolyData *surface, int n, double *p1, double *p2,
+                        double tol, double *t, double *x, int *cellIds)
+{
+  if (IsTriangularMesh(surface)) {
+    BoundingVolumeHierarchy bvh;
+    bvh.Initialize(surface);
+    bvh.IntersectWithLines(n, p1, p2, tol, t, x, cellIds);
+  } else {
+    int       subId;
+    double    pcoords[3];
+    vtkIdType cellId;
+    vtkSmartPointer<vtkModifiedBSPTree> locator = vtkSmartPointer<vtkModifiedBSPTree>::New();
+    locator->SetDataSet(surface);
+    locator->BuildLocator();
+    for (int i = 0; i < n; ++i) {
+      if (locator->IntersectWithLine(p1 + 3 * i, p2 + 3 * i, tol, t[i], x + 3 * i, pcoords, subId, cellId) == 0) {
+        cellId = -1;
+      }
+      cellIds[i] = static_cast<int>(cellId);
+    }
+  }
+}
+
 // -----------------------------------------------------------------------------
 /// Consistently label WM/cGM and cGM/CSF surfaces simultaneously
 void LabelCortex(vtkPolyData *white_surface, vtkPolyData *pial_surface,
@@ -472,41 +529,43 @@ void LabelCortex(vtkPolyData *white_surface, vtkPolyData *pial_surface,
   Matrix R = labels.Attributes().GetWorldToImageOrientation();
   Vector d(3);
 
-  const int max_cell_size = max(white_surface->GetMaxCellSize(),
-                                pial_surface ->GetMaxCellSize());
-
-  vtkCell *cell;
-  int      subId;
-  double   pcoords[3], p1[3], p2[3], p[3], n[3], t;
-  double  *pweights = new double[max_cell_size];
-  CountMap hist;
-  LabelType label;
-  vtkIdType whiteCellId, pialCellId;
-
-  vtkSmartPointer<vtkPolyData> mesh = ComputeCellNormals(white_surface);
-  vtkDataArray *normals = mesh->GetCellData()->GetNormals();
-
-  vtkSmartPointer<vtkModifiedBSPTree> locator = vtkSmartPointer<vtkModifiedBSPTree>::New();
-  locator->SetDataSet(pial_surface);
-  locator->BuildLocator();
+  double        p1[3], n[3], t;
+  const double *p;
+  CountMap      hist;
+  LabelType     label;
+  int           whiteCellId, pialCellId;
+  int           ncells;
+
+  Array<double> centers, normals, ends, coords, points;
+  Array<int>    cellIds;
+
+  // Find intersections of white surface normals with pial surface
+  GetCellCentersAndNormals(white_surface, centers, normals);
+  ncells = static_cast<int>(centers.size() / 3);
+  ends   .resize(3 * ncells);
+  coords .resize(ncells);
+  points .resize(3 * ncells);
+  cellIds.resize(ncells);
+  for (int i = 0; i < 3 * ncells; ++i) {
+    ends[i] = centers[i] + 5.0 * normals[i];
+  }
+  IntersectWithLines(pial_surface, ncells, centers.data(), ends.data(), .05,
+                     coords.data(), points.data(), cellIds.data());
 
-  for (whiteCellId = 0; whiteCellId < mesh->GetNumberOfCells(); ++whiteCellId) {
+  for (whiteCellId = 0; whiteCellId < ncells; ++whiteCellId) {
     // Get cell center and normal
-    cell  = mesh->GetCell(whiteCellId);
-    subId = cell->GetParametricCenter(pcoords);
-    cell->EvaluateLocation(subId, pcoords, p1, pweights);
-    normals->GetTuple(whiteCellId, n);
-    // Find intersection with pial surface
-    p2[0] = p1[0] + 5.0 * n[0];
-    p2[1] = p1[1] + 5.0 * n[1];
-    p2[2] = p1[2] + 5.0 * n[2];
-    if (locator->IntersectWithLine(p1, p2, .05, t, p, pcoords, subId, pialCellId) == 0) {
+    memcpy(p1, centers.data() + 3 * whiteCellId, 3 * sizeof(double));
+    memcpy(n,  normals.data() + 3 * whiteCellId, 3 * sizeof(double));
+    // Intersection with pial surface
+    pialCellId = cellIds[whiteCellId];
+    if (pialCellId == -1) {
       t = 2.5 / nsamples;
     } else {
+      p = points.data() + 3 * whiteCellId;
       n[0] = p[0] - p1[0];
       n[1] = p[1] - p1[1];
       n[2] = p[2] - p1[2];
-      t /= (nsamples - 1);
+      t = coords[whiteCellId] / (nsamples - 1);
     }
     // Convert to voxel units and scale direction vector
     labels.WorldToImage(p1[0], p1[1], p1[2]);
@@ -534,30 +593,33 @@ void LabelCortex(vtkPolyData *white_surface, vtkPolyData *pial_surface,
     }
   }
 
-  mesh    = ComputeCellNormals(pial_surface);
-  normals = mesh->GetCellData()->GetNormals();
-
-  locator = vtkSmartPointer<vtkModifiedBSPTree>::New();
-  locator->SetDataSet(white_surface);
-  locator->BuildLocator();
+  // Find intersections of inverted pial surface normals with white surface
+  GetCellCentersAndNormals(pial_surface, centers, normals);
+  ncells = static_cast<int>(centers.size() / 3);
+  ends   .resize(3 * ncells);
+  coords .resize(ncells);
+  points .resize(3 * ncells);
+  cellIds.resize(ncells);
+  for (int i = 0; i < 3 * ncells; ++i) {
+    ends[i] = centers[i] - 10.0 * normals[i];
+  }
+  IntersectWithLines(white_surface, ncells, centers.data(), ends.data(), .05,
+                     coords.data(), points.data(), cellIds.data());
 
-  for (vtkIdType pialCellId = 0; pialCellId < mesh->GetNumberOfCells(); ++pialCellId) {
+  for (pialCellId = 0; pialCellId < ncells; ++pialCellId) {
     // Get cell center and normal
-    cell  = mesh->GetCell(pialCellId);
-    subId = cell->GetParametricCenter(pcoords);
-    cell->EvaluateLocation(subId, pcoords, p1, pweights);
-    normals->GetTuple(pialCellId, n);
-    // Find intersection with pial surface
-    p2[0] = p1[0] - 10.0 * n[0];
-    p2[1] = p1[1] - 10.0 * n[1];
-    p2[2] = p1[2] - 10.0 * n[2];
-    if (locator->IntersectWithLine(p1, p2, .05, t, p, pcoords, subId, whiteCellId) == 0) {
+    memcpy(p1, centers.data() + 3 * pialCellId, 3 * sizeof(double));
+    memcpy(n,  normals.data() + 3 * pialCellId, 3 * sizeof(double));
+    // Intersection with white surface
+    whiteCellId = cellIds[pialCellId];
+    if (whiteCellId == -1) {
       t = 5.0 / nsamples;
     } else {
+      p = points.data() + 3 * pialCellId;
       n[0] = p[0] - p1[0];
       n[1] = p[1] - p1[1];
       n[2] = p[2] - p1[2];
-      t /= (nsamples - 1);
+      t = coords[pialCellId] / (nsamples - 1);
     }
     // Convert to voxel units and scale direction vector
     labels.WorldToImage(p1[0], p1[1], p1[2]);
@@ -594,7 +656,6 @@ void LabelCortex(vtkPolyData *white_surface, vtkPolyData *pial_surface,
 
   white_surface->GetCellData()->AddArray(white_labels);
   pial_surface ->GetCellData()->AddArray(pial_labels);
-  delete[] pweights;
 }
 
 // -----------------------------------------------------------------------------
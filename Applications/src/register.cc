@@ -959,22 +959,13 @@ int main(int argc, char **argv)
     registration.Write(parout_name);
   }
 
-#ifdef HAVE_TBB
-  tbb::tick_count start_time = tbb::tick_count::now();
-#else
-  clock_t start_time = clock();
-#endif
+  // Wall clock time, also when multi-threading is not based on TBB
+  const double start_time = Profiler::Now();
 
   registration.Run();
 
   if (verbose) {
-    double elapsed_time;
-#ifdef HAVE_TBB
-    elapsed_time = (tbb::tick_count::now() - start_time).seconds();
-#else
-    elapsed_time = static_cast<double>(clock() - start_time)
-                 / static_cast<double>(CLOCKS_PER_SEC);
-#endif
+    const double elapsed_time = Profiler::Now() - start_time;
     int m = ifloor(elapsed_time / 60.0);
     int s = iround(elapsed_time - m * 60);
     if (s == 60) m += 1, s = 0;
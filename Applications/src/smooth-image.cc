@@ -61,6 +61,9 @@ void PrintHelp(const char *name)
   cout << "  -x       Blur image in x dimension." << endl;
   cout << "  -y       Blur image in y dimension." << endl;
   cout << "  -z       Blur image in z dimension." << endl;
+  cout << "  -recursive [<sigma>]" << endl;
+  cout << "           Approximate Gaussian by recursive filter when its standard deviation" << endl;
+  cout << "           in voxel units is at least the given value. (default: off, 3 if no argument)" << endl;
   cout << "  -short   Set data type of output to short integers." << endl;
   cout << "  -float   Set data type of output to floating point." << endl;
   PrintCommonOptions(cout);
@@ -80,6 +83,7 @@ int main(int argc, char *argv[])
   const char *input_name  = POSARG(1);
   const char *output_name = POSARG(2);
   double      sigma       = 1.0;
+  double      recursive   = .0;
 
   if (NUM_POSARGS == 3) {
     if (!FromString(POSARG(3), sigma)) {
@@ -102,6 +106,10 @@ int main(int argc, char *argv[])
   for (ALL_OPTIONS) {
     if      (OPTION("-short")) data_type = MIRTK_VOXEL_SHORT;
     else if (OPTION("-float")) data_type = MIRTK_VOXEL_FLOAT;
+    else if (OPTION("-recursive")) {
+      if (HAS_ARGUMENT) PARSE_ARGUMENT(recursive);
+      else recursive = 3.0;
+    }
     else HANDLE_COMMON_OPTION();
   }
 
@@ -118,30 +126,35 @@ int main(int argc, char *argv[])
     if (OPTION("-3D")) {
       default_blurring = false;
       GaussianBlurring<RealPixel> blur(sigma);
+      blur.RecursiveSigma(recursive);
       blur.Input (&input);
       blur.Output(&input);
       blur.Run();
     } else if (OPTION("-4D")) {
       default_blurring = false;
       GaussianBlurring4D<RealPixel> blur(sigma);
+      blur.RecursiveSigma(recursive);
       blur.Input (&input);
       blur.Output(&input);
       blur.Run();
     } else if (OPTION("-x") || OPTION("-X")) {
       default_blurring = false;
       GaussianBlurring<RealPixel> blur(sigma);
+      blur.RecursiveSigma(recursive);
       blur.Input (&input);
       blur.Output(&input);
       blur.RunX();
     } else if (OPTION("-y") || OPTION("-Y")) {
       default_blurring = false;
       GaussianBlurring<RealPixel> blur(sigma);
+      blur.RecursiveSigma(recursive);
       blur.Input (&input);
       blur.Output(&input);
       blur.RunY();
     } else if (OPTION("-z") || OPTION("-Z")) {
       default_blurring = false;
       GaussianBlurring<RealPixel> blur(sigma);
+      blur.RecursiveSigma(recursive);
       blur.Input (&input);
       blur.Output(&input);
       blur.RunZ();
@@ -153,6 +166,7 @@ int main(int argc, char *argv[])
   // Default blurring if no blurring option given
   if (default_blurring) {
     GaussianBlurring<RealPixel> blur(sigma);
+    blur.RecursiveSigma(recursive);
     blur.Input (&input);
     blur.Output(&input);
     blur.Run();
@@ -68,7 +68,7 @@ basis_project (
   DOC_DIR     Documentation
   MODULES_DIR Modules
   TOOLS_DIR   Applications
-  OTHER_DIRS  CMake
+  OTHER_DIRS  CMake Benchmarks
 
   MODULE_DIRS
     Packages/Deformable
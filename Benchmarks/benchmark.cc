@@ -0,0 +1,581 @@
+/*
+ * Medical Image Registration ToolKit (MIRTK)
+ *
+ * Copyright 2026 Imperial College London
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mirtk/Common.h"
+#include "mirtk/Options.h"
+
+#include "mirtk/NumericsConfig.h"
+#include "mirtk/TransformationConfig.h"
+#include "mirtk/RegistrationConfig.h"
+
+#include "mirtk/Math.h"
+#include "mirtk/Parallel.h"
+#include "mirtk/GenericImage.h"
+#include "mirtk/InterpolateImageFunction.h"
+#include "mirtk/GaussianBlurring.h"
+#include "mirtk/BSplineFreeFormTransformation3D.h"
+#include "mirtk/RegisteredImage.h"
+#include "mirtk/NormalizedMutualImageInformation.h"
+#include "mirtk/GenericRegistrationFilter.h"
+
+#ifdef HAVE_MIRTK_PointSet
+#  include "mirtk/PointLocator.h"
+#  include "vtkSmartPointer.h"
+#  include "vtkPoints.h"
+#  include "vtkPolyData.h"
+#endif
+
+#include <chrono>
+
+using namespace mirtk;
+
+
+// =============================================================================
+// Help
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+void PrintHelp(const char *name)
+{
+  cout << endl;
+  cout << "Usage: " << name << " [options]" << endl;
+  cout << endl;
+  cout << "Description:" << endl;
+  cout << "  Runs micro- and macro-benchmarks of core library functions on synthetic" << endl;
+  cout << "  input data and reports the measured run times as JSON. Each benchmark is" << endl;
+  cout << "  executed with each of the given numbers of threads, where the throughput" << endl;
+  cout << "  is given as number of processed voxels (or points) per second and the" << endl;
+  cout << "  speedup relative to the first number of threads." << endl;
+  cout << endl;
+  cout << "  The JSON outputs of two runs, e.g., of a release candidate and the previous" << endl;
+  cout << "  release, can be compared with the compare-benchmarks.py script." << endl;
+  cout << endl;
+  cout << "Options:" << endl;
+  cout << "  -list              List names of available benchmarks and exit." << endl;
+  cout << "  -run <name>...     Names of benchmarks to run. (default: all)" << endl;
+  cout << "  -size <n>          Size of synthetic images in each dimension. (default: 128)" << endl;
+  cout << "  -repetitions <n>   Number of times each benchmark is run with each number" << endl;
+  cout << "                     of threads. The minimum run time is reported. (default: 3)" << endl;
+  cout << "  -scaling <n>...    Numbers of threads to use. (default: powers of two up to" << endl;
+  cout << "                     the number of available hardware threads)" << endl;
+  cout << "  -output <file>     Write JSON output to named file. (default: standard output)" << endl;
+  PrintCommonOptions(cout);
+  cout << endl;
+}
+
+// =============================================================================
+// Auxiliaries
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+/// Get number of available hardware threads
+int MaxNumberOfThreads()
+{
+  return task_scheduler_init::default_num_threads();
+}
+
+// -----------------------------------------------------------------------------
+/// Set maximum number of threads used by parallel_for and parallel_reduce
+void SetNumberOfThreads(int n)
+{
+  tbb_scheduler.reset();
+  tbb_scheduler.reset(new task_scheduler_init(n));
+}
+
+// -----------------------------------------------------------------------------
+/// Get current time in seconds
+double Now()
+{
+  using namespace std::chrono;
+  return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+// -----------------------------------------------------------------------------
+/// Initialize synthetic image with smoothly varying intensities and noise
+void MakeImage(RealImage &image, const ImageAttributes &attr, double shift = .0, unsigned int seed = 0)
+{
+  image.Initialize(attr);
+  srand(seed);
+  const double f = 2.0 * pi / attr._x;
+  for (int k = 0; k < attr._z; ++k)
+  for (int j = 0; j < attr._y; ++j)
+  for (int i = 0; i < attr._x; ++i) {
+    const double x = i + shift, y = j + .5 * shift, z = k;
+    const double noise = (rand() % 1000) / 100.0;
+    image(i, j, k) = static_cast<RealPixel>(100.0 + 50.0 * sin(2.0 * f * x) * cos(3.0 * f * y)
+                                                  + 30.0 * sin(f * (x + y + z)) + noise);
+  }
+}
+
+// -----------------------------------------------------------------------------
+/// Initialize free-form deformation with smoothly varying displacements
+void MakeFFD(BSplineFreeFormTransformation3D &ffd, const ImageAttributes &attr, double ds)
+{
+  ffd.Initialize(attr, ds, ds, ds);
+  const double f = 2.0 * pi / ffd.X();
+  for (int k = 0; k < ffd.Z(); ++k)
+  for (int j = 0; j < ffd.Y(); ++j)
+  for (int i = 0; i < ffd.X(); ++i) {
+    ffd.Put(i, j, k, 2.0 * sin(f * j), 2.0 * cos(f * k), 1.5 * sin(f * i));
+  }
+}
+
+// =============================================================================
+// Benchmarks
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+/// Base class of benchmarks
+class Benchmark
+{
+public:
+
+  /// Destructor
+  virtual ~Benchmark() {}
+
+  /// Name of benchmark
+  virtual const char *Name() const = 0;
+
+  /// Initialize synthetic input data of given size
+  virtual void Initialize(int n) = 0;
+
+  /// Run benchmark once
+  virtual void Run() = 0;
+
+  /// Number of voxels (or points) processed by each run
+  virtual double NumberOfVoxels() const = 0;
+};
+
+// -----------------------------------------------------------------------------
+/// Evaluation of dense FFD displacement field
+class FFDDisplacementBenchmark : public Benchmark
+{
+  BSplineFreeFormTransformation3D _FFD;
+  GenericImage<double>            _Displacement;
+
+public:
+
+  const char *Name() const { return "ffd-displacement"; }
+
+  void Initialize(int n)
+  {
+    ImageAttributes attr(n, n, n);
+    MakeFFD(_FFD, attr, 4.0);
+    _Displacement.Initialize(attr, 3);
+  }
+
+  void Run()
+  {
+    _FFD.Displacement(_Displacement);
+  }
+
+  double NumberOfVoxels() const
+  {
+    return _Displacement.NumberOfSpatialVoxels();
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Evaluate interpolator at each voxel of output image shifted by sub-voxel offset
+struct EvaluateInterpolator
+{
+  const InterpolateImageFunction *_Interpolator;
+  RealImage                      *_Output;
+
+  void operator ()(const blocked_range3d<int> &re) const
+  {
+    for (int k = re.pages().begin(); k != re.pages().end(); ++k)
+    for (int j = re.rows ().begin(); j != re.rows ().end(); ++j)
+    for (int i = re.cols ().begin(); i != re.cols ().end(); ++i) {
+      _Output->Put(i, j, k, static_cast<RealPixel>(_Interpolator->Evaluate(i + .37, j + .41, k + .29)));
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Interpolation of image values at non-grid points
+class InterpolationBenchmark : public Benchmark
+{
+  enum InterpolationMode                _Mode;
+  string                                _Name;
+  RealImage                             _Input;
+  RealImage                             _Output;
+  unique_ptr<InterpolateImageFunction> _Interpolator;
+
+public:
+
+  InterpolationBenchmark(enum InterpolationMode mode, const char *name)
+  :
+    _Mode(mode), _Name(string("interpolation-") + name)
+  {}
+
+  const char *Name() const { return _Name.c_str(); }
+
+  void Initialize(int n)
+  {
+    ImageAttributes attr(n, n, n);
+    MakeImage(_Input, attr);
+    _Output.Initialize(attr);
+    _Interpolator.reset(InterpolateImageFunction::New(_Mode, &_Input));
+    _Interpolator->Initialize();
+  }
+
+  void Run()
+  {
+    EvaluateInterpolator eval;
+    eval._Interpolator = _Interpolator.get();
+    eval._Output       = &_Output;
+    parallel_for(blocked_range3d<int>(0, _Output.Z(), 0, _Output.Y(), 0, _Output.X()), eval);
+  }
+
+  double NumberOfVoxels() const
+  {
+    return _Output.NumberOfSpatialVoxels();
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Gaussian blurring of 3D image
+class GaussianBlurringBenchmark : public Benchmark
+{
+  RealImage _Input;
+  RealImage _Output;
+
+public:
+
+  const char *Name() const { return "gaussian-blurring"; }
+
+  void Initialize(int n)
+  {
+    MakeImage(_Input, ImageAttributes(n, n, n));
+  }
+
+  void Run()
+  {
+    GaussianBlurring<RealPixel> blur(2.0);
+    blur.Input (&_Input);
+    blur.Output(&_Output);
+    blur.Run();
+  }
+
+  double NumberOfVoxels() const
+  {
+    return _Input.NumberOfSpatialVoxels();
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Fill of joint histogram of normalized mutual information
+class JointHistogramBenchmark : public Benchmark
+{
+  RealImage                         _Target;
+  RealImage                         _Source;
+  RegisteredImage                   _RegisteredTarget;
+  RegisteredImage                   _RegisteredSource;
+  NormalizedMutualImageInformation  _Similarity;
+
+public:
+
+  const char *Name() const { return "joint-histogram"; }
+
+  void Initialize(int n)
+  {
+    ImageAttributes attr(n, n, n);
+    MakeImage(_Target, attr, .0, 1);
+    MakeImage(_Source, attr, 3.0, 2);
+    _RegisteredTarget.InputImage(&_Target);
+    _RegisteredSource.InputImage(&_Source);
+    _Similarity.Target(&_RegisteredTarget);
+    _Similarity.Source(&_RegisteredSource);
+    _Similarity.Domain(attr);
+    _Similarity.NumberOfTargetBins(64);
+    _Similarity.NumberOfSourceBins(64);
+    _Similarity.Initialize();
+    _Similarity.Update(false);
+  }
+
+  void Run()
+  {
+    _Similarity.Update(false);
+  }
+
+  double NumberOfVoxels() const
+  {
+    return _Target.NumberOfSpatialVoxels();
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Update of image deformed by FFD
+class RegisteredImageBenchmark : public Benchmark
+{
+  RealImage                       _Input;
+  BSplineFreeFormTransformation3D _FFD;
+  RegisteredImage                 _Image;
+
+public:
+
+  const char *Name() const { return "registered-image-update"; }
+
+  void Initialize(int n)
+  {
+    ImageAttributes attr(n, n, n);
+    MakeImage(_Input, attr);
+    MakeFFD(_FFD, attr, 4.0);
+    _Image.InputImage(&_Input);
+    _Image.Transformation(&_FFD);
+    _Image.InterpolationMode(Interpolation_Linear);
+    _Image.Initialize(attr);
+  }
+
+  void Run()
+  {
+    _Image.Update(true, true, false, true);
+  }
+
+  double NumberOfVoxels() const
+  {
+    return _Input.NumberOfSpatialVoxels();
+  }
+};
+
+#ifdef HAVE_MIRTK_PointSet
+
+// -----------------------------------------------------------------------------
+/// Closest point search
+class PointLocationBenchmark : public Benchmark
+{
+  vtkSmartPointer<vtkPolyData> _Points;
+  vtkSmartPointer<vtkPolyData> _Queries;
+  unique_ptr<PointLocator>     _Locator;
+
+  static vtkSmartPointer<vtkPolyData> MakePoints(int n, double size, unsigned int seed)
+  {
+    srand(seed);
+    vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
+    points->SetNumberOfPoints(n);
+    for (int i = 0; i < n; ++i) {
+      points->SetPoint(i, size * (rand() % 10000) / 10000.0,
+                          size * (rand() % 10000) / 10000.0,
+                          size * (rand() % 10000) / 10000.0);
+    }
+    vtkSmartPointer<vtkPolyData> dataset = vtkSmartPointer<vtkPolyData>::New();
+    dataset->SetPoints(points);
+    return dataset;
+  }
+
+public:
+
+  const char *Name() const { return "point-location"; }
+
+  void Initialize(int n)
+  {
+    const int npoints = n * n * n / 8;
+    _Points  = MakePoints(npoints, n, 1);
+    _Queries = MakePoints(npoints, n, 2);
+    _Locator.reset(PointLocator::New(_Points));
+  }
+
+  void Run()
+  {
+    _Locator->FindClosestPoint(_Queries);
+  }
+
+  double NumberOfVoxels() const
+  {
+    return static_cast<double>(_Queries->GetNumberOfPoints());
+  }
+};
+
+#endif // HAVE_MIRTK_PointSet
+
+// -----------------------------------------------------------------------------
+/// Multi-resolution FFD registration of synthetic images
+class RegistrationBenchmark : public Benchmark
+{
+  RealImage _Target;
+  RealImage _Source;
+
+public:
+
+  const char *Name() const { return "registration"; }
+
+  void Initialize(int n)
+  {
+    ImageAttributes attr(n, n, n);
+    MakeImage(_Target, attr, .0, 1);
+    MakeImage(_Source, attr, 2.0, 2);
+  }
+
+  void Run()
+  {
+    istringstream params("Transformation model = FFD\n"
+                         "Energy function = SIM[Image dissimilarity](I1, I2 o T) + 0.001 BE[Bending energy](T)\n"
+                         "Image (dis-)similarity measure = NMI\n"
+                         "No. of resolution levels = 2\n"
+                         "Maximum no. of iterations = 10\n"
+                         "Control point spacing [mm] = 8\n");
+    GenericRegistrationFilter registration;
+    registration.Read(params);
+    registration.Input(&_Target, &_Source);
+    Transformation *dofout = NULL;
+    registration.Output(&dofout);
+    registration.Run();
+    delete dofout;
+  }
+
+  double NumberOfVoxels() const
+  {
+    return _Target.NumberOfSpatialVoxels();
+  }
+};
+
+// =============================================================================
+// Main
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  EXPECTS_POSARGS(0);
+
+  InitializeNumericsLibrary();
+  InitializeTransformationLibrary();
+  InitializeRegistrationLibrary();
+
+  // Available benchmarks
+  Array<Benchmark *> benchmarks;
+  benchmarks.push_back(new FFDDisplacementBenchmark());
+  benchmarks.push_back(new InterpolationBenchmark(Interpolation_Linear, "linear"));
+  benchmarks.push_back(new InterpolationBenchmark(Interpolation_FastCubicBSpline, "cubic-bspline"));
+  benchmarks.push_back(new GaussianBlurringBenchmark());
+  benchmarks.push_back(new JointHistogramBenchmark());
+  benchmarks.push_back(new RegisteredImageBenchmark());
+#ifdef HAVE_MIRTK_PointSet
+  benchmarks.push_back(new PointLocationBenchmark());
+#endif
+  benchmarks.push_back(new RegistrationBenchmark());
+
+  // Parse options
+  const char    *output_name = NULL;
+  Array<string>  names;
+  Array<int>     threads;
+  int            size        = 128;
+  int            repetitions = 3;
+
+  for (ALL_OPTIONS) {
+    if (OPTION("-list")) {
+      for (size_t i = 0; i < benchmarks.size(); ++i) {
+        cout << benchmarks[i]->Name() << endl;
+      }
+      exit(0);
+    }
+    else if (OPTION("-run")) {
+      do {
+        names.push_back(ARGUMENT);
+      } while (HAS_ARGUMENT);
+    }
+    else if (OPTION("-scaling")) {
+      do {
+        int n;
+        PARSE_ARGUMENT(n);
+        if (n < 1) FatalError("Number of threads must be positive!");
+        threads.push_back(n);
+      } while (HAS_ARGUMENT);
+    }
+    else if (OPTION("-size"))        PARSE_ARGUMENT(size);
+    else if (OPTION("-repetitions")) PARSE_ARGUMENT(repetitions);
+    else if (OPTION("-output"))      output_name = ARGUMENT;
+    else HANDLE_COMMON_OR_UNKNOWN_OPTION();
+  }
+
+  if (size < 8)        FatalError("Size of synthetic images must be at least 8!");
+  if (repetitions < 1) FatalError("Number of repetitions must be positive!");
+
+  for (size_t n = 0; n < names.size(); ++n) {
+    size_t i = 0;
+    while (i < benchmarks.size() && names[n] != benchmarks[i]->Name()) ++i;
+    if (i == benchmarks.size()) FatalError("Unknown benchmark: " << names[n]);
+  }
+
+  const int max_threads = MaxNumberOfThreads();
+  if (threads.empty()) {
+    for (int n = 1; n < max_threads; n *= 2) threads.push_back(n);
+    threads.push_back(max_threads);
+  }
+
+  // Open output file
+  ofstream ofs;
+  if (output_name) {
+    ofs.open(output_name);
+    if (!ofs) FatalError("Failed to open output file " << output_name);
+  }
+  ostream &out = (output_name ? static_cast<ostream &>(ofs) : cout);
+  out.precision(6);
+
+  // Run benchmarks
+  out << "{\n";
+  out << "  \"size\": " << size << ",\n";
+  out << "  \"repetitions\": " << repetitions << ",\n";
+  out << "  \"max_threads\": " << max_threads << ",\n";
+  out << "  \"benchmarks\": [";
+  bool first = true;
+  for (size_t i = 0; i < benchmarks.size(); ++i) {
+    Benchmark *benchmark = benchmarks[i];
+    if (!names.empty() && find(names.begin(), names.end(), string(benchmark->Name())) == names.end()) {
+      continue;
+    }
+    if (verbose) cerr << "Running " << benchmark->Name() << "..." << endl;
+    SetNumberOfThreads(max_threads);
+    benchmark->Initialize(size);
+    const double nvoxels = benchmark->NumberOfVoxels();
+    out << (first ? "" : ",") << "\n    {\n";
+    out << "      \"name\": \"" << benchmark->Name() << "\",\n";
+    out << "      \"voxels\": " << static_cast<long long>(nvoxels) << ",\n";
+    out << "      \"results\": [";
+    double reference = .0;
+    for (size_t t = 0; t < threads.size(); ++t) {
+      SetNumberOfThreads(threads[t]);
+      double time = numeric_limits<double>::infinity(), mean = .0;
+      for (int r = 0; r < repetitions; ++r) {
+        const double start = Now();
+        benchmark->Run();
+        const double elapsed = Now() - start;
+        time  = min(time, elapsed);
+        mean += elapsed;
+      }
+      mean /= repetitions;
+      if (t == 0) reference = time;
+      if (verbose) {
+        cerr << "  threads = " << threads[t] << ", time = " << time << " s" << endl;
+      }
+      out << (t == 0 ? "" : ",") << "\n        {";
+      out << " \"threads\": " << threads[t] << ",";
+      out << " \"time\": " << time << ",";
+      out << " \"mean_time\": " << mean << ",";
+      out << " \"voxels_per_second\": " << (time > .0 ? nvoxels / time : .0) << ",";
+      out << " \"speedup\": " << (time > .0 ? reference / time : .0) << " }";
+    }
+    out << "\n      ]\n    }";
+    first = false;
+  }
+  out << "\n  ]\n}\n";
+
+  for (size_t i = 0; i < benchmarks.size(); ++i) delete benchmarks[i];
+  return 0;
+}
@@ -0,0 +1,76 @@
+#!/usr/bin/env python
+
+# ============================================================================
+# Medical Image Registration ToolKit (MIRTK)
+#
+# Copyright 2013-2016 Imperial College London
+# Copyright 2013-2016 Andreas Schuh
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+
+"""
+Usage: compare-benchmarks <baseline> <current> [<tolerance>]
+
+Compares the throughput of each benchmark and number of threads reported by
+two runs of the MIRTK benchmark program and reports performance regressions.
+
+Arguments:
+  baseline    JSON output of benchmark program for reference, e.g., last release.
+  current     JSON output of benchmark program to be compared to the baseline.
+  tolerance   Maximum relative decrease of throughput in percent which is not
+              considered a performance regression. (default: 10)
+
+Exit status:
+  0 if no performance regression was detected, 1 otherwise.
+
+"""
+from __future__ import absolute_import, print_function, unicode_literals
+
+import sys
+import json
+
+
+def throughput(results):
+    """Get dictionary of voxels per second for each benchmark and number of threads."""
+    values = {}
+    for benchmark in results['benchmarks']:
+        for result in benchmark['results']:
+            values[(benchmark['name'], result['threads'])] = result['voxels_per_second']
+    return values
+
+
+if __name__ == '__main__':
+    if len(sys.argv) < 3 or len(sys.argv) > 4:
+        print(__doc__)
+        sys.exit(1)
+    with open(sys.argv[1]) as f:
+        baseline = json.load(f)
+    with open(sys.argv[2]) as f:
+        current = json.load(f)
+    tolerance = float(sys.argv[3]) if len(sys.argv) == 4 else 10.0
+    if baseline['size'] != current['size']:
+        print('Warning: Benchmarks were run with different image size', file=sys.stderr)
+    reference = throughput(baseline)
+    regression = False
+    print('{:<32} {:>8} {:>14} {:>14} {:>9}'.format('Benchmark', 'Threads', 'Baseline', 'Current', 'Change'))
+    for key, value in sorted(throughput(current).items()):
+        if key not in reference or reference[key] <= 0:
+            continue
+        change = 100.0 * (value - reference[key]) / reference[key]
+        status = ''
+        if change < -tolerance:
+            status = ' REGRESSION'
+            regression = True
+        print('{:<32} {:>8} {:>14.4g} {:>14.4g} {:>+8.1f}%{}'.format(key[0], key[1], reference[key], value, change, status))
+    sys.exit(1 if regression else 0)
@@ -57,6 +57,10 @@ set(MIRTK_WITH_PROFILING_DEFAULT ON)
 # Testing is yet very limited, hence mark this option as advanced for now
 mark_as_advanced(BUILD_TESTING)
 
+# By default, do not build benchmarks of core library functions
+option(BUILD_BENCHMARKS "Build benchmarks of core library functions" OFF)
+mark_as_advanced(BUILD_BENCHMARKS)
+
 # Always use/find VTK when anyway required by one of the enabled modules
 if (MODULE_PointSet)
   if (NOT WITH_VTK)
@@ -24,6 +24,7 @@
 #include "mirtk/CommonExport.h"
 
 #include "mirtk/Object.h"
+#include "mirtk/Array.h"
 
 
 namespace mirtk {
@@ -34,18 +35,47 @@ namespace mirtk {
  *
  * This class defines and implements functions for reading compressed file
  * streams. The file streams can be either uncompressed or compressed.
+ *
+ * Compressed files which consist of independently compressed blocks in the
+ * BGZF format, such as the files written by Cofstream, are indexed when opened.
+ * Large reads from such files decompress the blocks in parallel. Other gzip
+ * files are decompressed in chunks, which are byte swapped as they arrive.
  */
 
 class Cifstream : public Object
 {
   mirtkObjectMacro(Cifstream);
 
+  /// Independently compressed block (gzip member) of a BGZF file
+  struct Block
+  {
+    long _Offset;   ///< Offset of compressed block in file
+    long _Position; ///< Offset of uncompressed block data in stream
+    int  _Size;     ///< Size of compressed block including gzip header and footer
+    int  _Length;   ///< Size of uncompressed block data
+  };
+
   /// File pointer to potentially compressed file
   void *_File;
 
+  /// File pointer used to read compressed blocks of BGZF file
+  void *_BlockFile;
+
+  /// Blocks of BGZF file, empty if file is not in BGZF format
+  Array<Block> _Blocks;
+
+  /// Stream position after last block-wise read, -1 when _File is up-to-date
+  long _Position;
+
   /// Flag indicating whether file bytes are swapped
   mirtkPublicAttributeMacro(bool, Swapped);
 
+  /// Index blocks of compressed file if it is in BGZF format
+  void IndexBlocks(const char *);
+
+  /// Read data by decompressing blocks of BGZF file in parallel
+  bool ReadBlocks(char *, long, long, int);
+
 public:
 
   /// Constructor
@@ -55,7 +85,12 @@ public:
   ~Cifstream();
 
   /// Read n data as array (possibly compressed) from offset
-  bool Read(char *, long, long);
+  ///
+  /// \param[out] mem   Output data.
+  /// \param[in]  start Offset of data in stream or -1 to read from current position.
+  /// \param[in]  num   Number of bytes to read.
+  /// \param[in]  swap  Size of data elements whose bytes are swapped, zero if none.
+  bool Read(char *mem, long start, long num, int swap = 0);
 
   /// Read n data as array of char (possibly compressed) from offset
   bool ReadAsChar(char *, long, long = -1);
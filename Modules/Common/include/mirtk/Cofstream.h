@@ -24,6 +24,7 @@
 #include "mirtk/CommonExport.h"
 
 #include "mirtk/Object.h"
+#include "mirtk/Array.h"
 
 
 namespace mirtk {
@@ -33,20 +34,33 @@ namespace mirtk {
  * Class for writing (compressed) file streams.
  *
  * This class defines and implements functions for writing compressed file
- * streams. At the moment only the writing of uncompressed file streams is
- * supported.
+ * streams. Files with extension .gz are written in the blocked gzip (BGZF)
+ * format, i.e., as a series of independently compressed gzip members of at most
+ * 64 KiB, which can be read by any gzip decompressor. The blocks of each batch
+ * of buffered data are compressed in parallel. Only forward seeks are supported
+ * when writing a compressed file, where skipped bytes are filled with zeros.
  */
 
 class Cofstream : public Object
 {
   mirtkObjectMacro(Cofstream);
 
-  /// File pointer to uncompressed file
+  /// File pointer to output file
   FILE *_File;
 
-  /// File pointer to compressed file
 #if MIRTK_Common_WITH_ZLIB
-  void *_ZFile;
+  /// Uncompressed data which has not yet been written to compressed file
+  Array<char> _Buffer;
+
+  /// Number of uncompressed bytes written to compressed file stream
+  long _Length;
+
+  /// Append data to buffer, where the buffered data is compressed and written
+  /// whenever the buffer holds one batch of blocks, or zeros if data is NULL
+  bool Append(const char *, long);
+
+  /// Compress and write buffered data, including last partial block if requested
+  bool Flush(bool = false);
 #endif
 
   /// Flag whether file is compressed
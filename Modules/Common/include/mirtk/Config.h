@@ -36,6 +36,13 @@
 /// 0: single-precision 1: double-precision
 #define MIRTK_USE_FLOAT_BY_DEFAULT 0
 
+/// Precision of registered images, cached displacements, and image similarity
+/// gradients used by the registration filters
+/// 0: double-precision 1: single-precision
+#ifndef MIRTK_USE_FLOAT_FOR_REGISTRATION
+#  define MIRTK_USE_FLOAT_FOR_REGISTRATION 0
+#endif
+
 // ===========================================================================
 // CUDA
 // ===========================================================================
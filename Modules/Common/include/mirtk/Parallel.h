@@ -23,6 +23,7 @@
 #include "mirtk/CommonExport.h"
 
 #include "mirtk/Stream.h"
+#include "mirtk/Array.h"
 
 #include <memory>
 
@@ -44,6 +45,11 @@
 #    undef MIRTK_UNDEF_NOMINMAX
 #    undef NOMINMAX
 #  endif
+#else
+#  include <atomic>
+#  include <exception>
+#  include <functional>
+#  include <mutex>
 #endif
 
 
@@ -63,6 +69,12 @@ MIRTK_Common_EXPORT extern int debug_gpu;
 /// Debugging level of TBB code
 MIRTK_Common_EXPORT extern int tbb_debug;
 
+/// Whether voxel reductions use parallel_deterministic_reduce
+///
+/// When enabled, the results of voxel reductions executed by ParallelForEachVoxel
+/// do not depend on the number of threads nor on the scheduling of the tasks.
+MIRTK_Common_EXPORT extern bool deterministic_reduction;
+
 // =============================================================================
 // Command help
 // =============================================================================
@@ -77,7 +89,7 @@ void ParseParallelOption(int &, int &, char *[]);
 void PrintParallelOptions(ostream &);
 
 // =============================================================================
-// Multi-threading support using Intel's TBB
+// Multi-threading support using Intel's TBB or C++11 threads
 // =============================================================================
 
 // -----------------------------------------------------------------------------
@@ -104,46 +116,125 @@ using tbb::concurrent_queue;
 using tbb::mutex;
 using tbb::split;
 
-// A task scheduler is created/terminated automatically by TBB since
-// version 2.2. It is recommended by Intel not to instantiate any task
-// scheduler manually. However, in order to support the -threads option
-// which can be used to limit the number of threads, a global task scheduler
-// instance is created and the -threads argument passed on to its initialize
-// method by ParseParallelOption. There should be no task scheduler created/
-// terminated in any of the IRTK libraries functions and classes.
-MIRTK_Common_EXPORT extern std::unique_ptr<task_scheduler_init> tbb_scheduler;
-
 
 // -----------------------------------------------------------------------------
-// Otherwise, use dummy implementations of TBB classes/functions which allows
-// developers to write parallelizable code as if TBB was available and yet
-// executes the code serially due to the lack of TBB (or WITH_TBB set to OFF).
-// This avoids code duplication and unnecessary conditional code compilation.
+// Otherwise, use a portable implementation of the used TBB classes/functions
+// based on C++11 threads. It allows developers to write parallelizable code
+// as if TBB was available, and yet executes this code concurrently even when
+// TBB is not available (or WITH_TBB set to OFF). Ranges are split recursively
+// into subranges, which are executed as tasks by a pool of worker threads.
+// Each worker thread has its own double-ended task queue. New tasks are pushed
+// to the back of this queue and executed in LIFO order by the worker itself,
+// while idle threads steal the oldest, i.e., largest, tasks from its front.
 #else // HAVE_TBB
 
 
 /// Dummy type used to distinguish split constructor from copy constructor
 struct split {};
 
+/// Mutual exclusion of concurrent threads
+class mutex
+{
+  std::mutex _Mutex;
+
+public:
+
+  /// Lock which is released when it goes out of scope
+  class scoped_lock
+  {
+    std::mutex *_Mutex;
+
+    scoped_lock(const scoped_lock &);
+    void operator =(const scoped_lock &);
+
+  public:
+
+    scoped_lock() : _Mutex(nullptr) {}
+    scoped_lock(mutex &m) : _Mutex(&m._Mutex) { _Mutex->lock(); }
+    ~scoped_lock() { release(); }
+
+    void acquire(mutex &m)
+    {
+      release();
+      _Mutex = &m._Mutex;
+      _Mutex->lock();
+    }
+
+    void release()
+    {
+      if (_Mutex) _Mutex->unlock();
+      _Mutex = nullptr;
+    }
+  };
+
+  void lock()     { _Mutex.lock(); }
+  bool try_lock() { return _Mutex.try_lock(); }
+  void unlock()   { _Mutex.unlock(); }
+};
+
 /// Helper for initialization of task scheduler
-class task_scheduler_init
+///
+/// Sets the maximum number of threads used by parallel_for and parallel_reduce.
+/// The number of threads must not be changed while parallel loops are executed.
+class MIRTK_Common_EXPORT task_scheduler_init
 {
+  int _Id;
+
+  task_scheduler_init(const task_scheduler_init &);
+  void operator =(const task_scheduler_init &);
+
 public:
-  task_scheduler_init(int) {}
-  void terminate() {}
+
+  /// Use number of hardware threads
+  static const int automatic = -1;
+
+  /// Defer initialization of task scheduler until initialize() is called
+  static const int deferred = -2;
+
+  task_scheduler_init(int n = automatic) : _Id(0) { if (n != deferred) initialize(n); }
+  ~task_scheduler_init() { terminate(); }
+
+  /// Set maximum number of threads
+  void initialize(int n = automatic);
+
+  /// Restore default number of threads unless re-initialized by another instance
+  void terminate();
+
+  /// Whether this instance set the current number of threads
+  bool is_active() const;
+
+  /// Number of hardware threads
+  static int default_num_threads();
 };
 
 /// One-dimensional range
 template <typename T>
 class blocked_range
 {
-  T _lbound;
-  T _ubound;
+  T      _lbound;
+  T      _ubound;
+  size_t _grainsize;
+
 public:
-  blocked_range(T l, T u)         : _lbound(l), _ubound(u) {}
-  blocked_range(T l, T u, size_t) : _lbound(l), _ubound(u) {}
-  T begin() const { return _lbound; }
-  T end()   const { return _ubound; }
+
+  blocked_range(T l, T u, size_t g = 1) : _lbound(l), _ubound(u), _grainsize(g) {}
+
+  /// Split constructor, the new range is the upper half of r
+  blocked_range(blocked_range &r, split)
+  :
+    _lbound(r._lbound + (r._ubound - r._lbound) / 2u),
+    _ubound(r._ubound),
+    _grainsize(r._grainsize)
+  {
+    r._ubound = _lbound;
+  }
+
+  T      begin()        const { return _lbound; }
+  T      end()          const { return _ubound; }
+  size_t size()         const { return static_cast<size_t>(_ubound - _lbound); }
+  size_t grainsize()    const { return _grainsize; }
+  bool   empty()        const { return !(_lbound < _ubound); }
+  bool   is_divisible() const { return _grainsize < size(); }
 };
 
 /// Two-dimensional range
@@ -163,16 +254,32 @@ public:
   {
   }
 
-  blocked_range2d(T rl, T ru, size_t,
-                  T cl, T cu, size_t)
+  blocked_range2d(T rl, T ru, size_t rg,
+                  T cl, T cu, size_t cg)
   :
-    _rows (rl, ru),
-    _cols (cl, cu)
+    _rows (rl, ru, rg),
+    _cols (cl, cu, cg)
   {
   }
 
+  /// Split constructor, splits the relatively larger dimension of r
+  blocked_range2d(blocked_range2d &r, split)
+  :
+    _rows(r._rows),
+    _cols(r._cols)
+  {
+    if (_rows.size() * double(_cols.grainsize()) < _cols.size() * double(_rows.grainsize())) {
+      _cols = blocked_range<T>(r._cols, split());
+    } else {
+      _rows = blocked_range<T>(r._rows, split());
+    }
+  }
+
   const blocked_range<T> &rows() const { return _rows; }
   const blocked_range<T> &cols() const { return _cols; }
+
+  bool empty()        const { return _rows.empty() || _cols.empty(); }
+  bool is_divisible() const { return _rows.is_divisible() || _cols.is_divisible(); }
 };
 
 /// Three-dimensional range
@@ -195,36 +302,244 @@ public:
   {
   }
 
-  blocked_range3d(T pl, T pu, size_t,
-                  T rl, T ru, size_t,
-                  T cl, T cu, size_t)
+  blocked_range3d(T pl, T pu, size_t pg,
+                  T rl, T ru, size_t rg,
+                  T cl, T cu, size_t cg)
   :
-    _pages(pl, pu),
-    _rows (rl, ru),
-    _cols (cl, cu)
+    _pages(pl, pu, pg),
+    _rows (rl, ru, rg),
+    _cols (cl, cu, cg)
   {
   }
 
+  /// Split constructor, splits the relatively largest dimension of r
+  blocked_range3d(blocked_range3d &r, split)
+  :
+    _pages(r._pages),
+    _rows (r._rows),
+    _cols (r._cols)
+  {
+    if (_pages.size() * double(_rows.grainsize()) < _rows.size() * double(_pages.grainsize())) {
+      if (_rows.size() * double(_cols.grainsize()) < _cols.size() * double(_rows.grainsize())) {
+        _cols = blocked_range<T>(r._cols, split());
+      } else {
+        _rows = blocked_range<T>(r._rows, split());
+      }
+    } else {
+      if (_pages.size() * double(_cols.grainsize()) < _cols.size() * double(_pages.grainsize())) {
+        _cols = blocked_range<T>(r._cols, split());
+      } else {
+        _pages = blocked_range<T>(r._pages, split());
+      }
+    }
+  }
+
   const blocked_range<T> &pages() const { return _pages; }
   const blocked_range<T> &rows() const { return _rows; }
   const blocked_range<T> &cols() const { return _cols; }
+
+  bool empty()        const { return _pages.empty() || _rows.empty() || _cols.empty(); }
+  bool is_divisible() const { return _pages.is_divisible() || _rows.is_divisible() || _cols.is_divisible(); }
+};
+
+namespace ParallelUtils {
+
+
+/// Get maximum number of threads used by parallel_for and parallel_reduce
+MIRTK_Common_EXPORT int NumberOfThreads();
+
+/// Maximum depth of recursive range splitting
+///
+/// The number of subranges is at most 2^depth, i.e., four times the number
+/// of threads such that idle threads can steal work from busy threads.
+MIRTK_Common_EXPORT int MaxSplitDepth();
+
+/// Group of tasks executed concurrently by the threads of the thread pool
+///
+/// A thread which waits for the tasks of a group to finish executes pending
+/// tasks itself, including those of other groups. This avoids deadlocks when
+/// parallel loops are nested and keeps the waiting thread busy.
+class MIRTK_Common_EXPORT TaskGroup
+{
+  std::atomic<int>   _Pending;
+  std::exception_ptr _Exception;
+  std::mutex         _Mutex;
+
+  TaskGroup(const TaskGroup &);
+  void operator =(const TaskGroup &);
+
+  friend class ThreadPool;
+
+  /// Wait for tasks to finish without rethrowing exceptions
+  void Join();
+
+public:
+
+  TaskGroup() : _Pending(0) {}
+  ~TaskGroup() { Join(); }
+
+  /// Add task to queue of current thread
+  void Run(std::function<void()> task);
+
+  /// Wait for tasks to finish and rethrow first exception thrown by a task
+  void Wait();
 };
 
-/// parallel_for dummy template function which executes the body serially
+/// Execute body for recursively split subranges concurrently
 template <class Range, class Body>
-void parallel_for(const Range &range, const Body &body) {
-  body(range);
+void ParallelFor(const Range &range, const Body &body, int depth)
+{
+  if (depth > 0 && range.is_divisible()) {
+    Range lower(range);
+    Range upper(lower, split());
+    TaskGroup group;
+    group.Run([&upper, &body, depth]() { ParallelFor(upper, body, depth - 1); });
+    ParallelFor(lower, body, depth - 1);
+    group.Wait();
+  } else {
+    Body copy(body);
+    copy(range);
+  }
 }
 
-/// parallel_reduce dummy template function which executes the body serially
+/// Reduce results of bodies for recursively split subranges
 template <class Range, class Body>
-void parallel_reduce(const Range &range, Body &body) {
-  body(range);
+void ParallelReduce(const Range &range, Body &body, int depth)
+{
+  if (depth > 0 && range.is_divisible()) {
+    Range lower(range);
+    Range upper(lower, split());
+    Body  other(body, split());
+    TaskGroup group;
+    group.Run([&upper, &other, depth]() { ParallelReduce(upper, other, depth - 1); });
+    ParallelReduce(lower, body, depth - 1);
+    group.Wait();
+    body.join(other);
+  } else {
+    body(range);
+  }
+}
+
+
+} // namespace ParallelUtils
+
+/// Execute body for subranges of the given range concurrently
+///
+/// Like TBB, a copy of the body is made for each subrange.
+template <class Range, class Body>
+void parallel_for(const Range &range, const Body &body)
+{
+  if (ParallelUtils::NumberOfThreads() > 1) {
+    ParallelUtils::ParallelFor(range, body, ParallelUtils::MaxSplitDepth());
+  } else {
+    body(range);
+  }
+}
+
+/// Execute body for subranges of the given range concurrently and reduce results
+///
+/// Like TBB, the body must have a split constructor Body(Body &, split) and
+/// a join(Body &) member function which merges the result of the body for the
+/// subsequent subrange into the body for the preceding subrange.
+template <class Range, class Body>
+void parallel_reduce(const Range &range, Body &body)
+{
+  if (ParallelUtils::NumberOfThreads() > 1) {
+    ParallelUtils::ParallelReduce(range, body, ParallelUtils::MaxSplitDepth());
+  } else {
+    body(range);
+  }
 }
 
 
 #endif // HAVE_TBB
 
+// A task scheduler is created/terminated automatically by TBB since
+// version 2.2. It is recommended by Intel not to instantiate any task
+// scheduler manually. However, in order to support the -threads option
+// which can be used to limit the number of threads, a global task scheduler
+// instance is created and the -threads argument passed on to its initialize
+// method by ParseParallelOption. There should be no task scheduler created/
+// terminated in any of the IRTK libraries functions and classes.
+MIRTK_Common_EXPORT extern std::unique_ptr<task_scheduler_init> tbb_scheduler;
+
+// =============================================================================
+// Deterministic parallel reduction
+// =============================================================================
+
+namespace ParallelUtils {
+
+
+/// Body of parallel_for used by parallel_deterministic_reduce
+template <class Range, class Body>
+struct DeterministicReduceBody
+{
+  const Range *_Ranges;
+  Body * const *_Bodies;
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    for (int i = re.begin(); i != re.end(); ++i) (*_Bodies[i])(_Ranges[i]);
+  }
+};
+
+
+} // namespace ParallelUtils
+
+/// Parallel reduction whose result does not depend on the number of threads
+///
+/// Unlike parallel_reduce, where the partitioning of the range and the order
+/// in which partial results are joined depends on the task scheduling, the
+/// range is split recursively into at most 2^depth blocks regardless of the
+/// number of threads. The blocks are reduced concurrently by separate bodies,
+/// which are then joined in a fixed pairwise order. Floating point sums are
+/// therefore reproducible, at the cost of up to 2^depth - 1 body splits.
+///
+/// The body must have a split constructor Body(Body &, split) and a join(Body &)
+/// member function as required by parallel_reduce.
+///
+/// \note Calls must be qualified as mirtk::parallel_deterministic_reduce. When
+///       built with TBB, the range types are TBB types and argument-dependent
+///       lookup would otherwise also find tbb::parallel_deterministic_reduce.
+template <class Range, class Body>
+void parallel_deterministic_reduce(const Range &range, Body &body, int depth = 6)
+{
+  // Split range into blocks, where the order of blocks matches the range order
+  Array<Range> ranges(1, range);
+  for (int level = 0; level < depth; ++level) {
+    Array<Range> subranges;
+    subranges.reserve(2 * ranges.size());
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      subranges.push_back(ranges[i]);
+      if (subranges.back().is_divisible()) {
+        subranges.push_back(Range(subranges.back(), split()));
+      }
+    }
+    if (subranges.size() == ranges.size()) break;
+    ranges.swap(subranges);
+  }
+  const int n = static_cast<int>(ranges.size());
+  if (n == 1) {
+    body(range);
+    return;
+  }
+  // Reduce blocks concurrently
+  Array<Body *> bodies(n);
+  bodies[0] = &body;
+  for (int i = 1; i < n; ++i) bodies[i] = new Body(body, split());
+  ParallelUtils::DeterministicReduceBody<Range, Body> reduce;
+  reduce._Ranges = ranges.data();
+  reduce._Bodies = bodies.data();
+  parallel_for(blocked_range<int>(0, n, 1), reduce);
+  // Join results of blocks in fixed pairwise order
+  for (int step = 1; step < n; step *= 2) {
+    for (int i = 0; i + step < n; i += 2 * step) {
+      bodies[i]->join(*bodies[i + step]);
+    }
+  }
+  for (int i = 1; i < n; ++i) delete bodies[i];
+}
+
 
 } // namespace mirtk
 
@@ -23,20 +23,10 @@
 #include "mirtk/CommonExport.h"
 
 #include "mirtk/Stream.h"
+#include "mirtk/String.h"
+#include "mirtk/Array.h"
 
-#include <ctime>
-#ifdef HAVE_TBB
-// TBB includes windows header which defines min/max macros otherwise
-#  ifndef NOMINMAX
-#    define NOMINMAX
-#    define MIRTK_UNDEF_NOMINMAX
-#  endif
-#  include <tbb/tick_count.h>
-#  ifdef MIRTK_UNDEF_NOMINMAX
-#    undef MIRTK_UNDEF_NOMINMAX
-#    undef NOMINMAX
-#  endif
-#endif
+#include <mutex>
 
 
 namespace mirtk {
@@ -74,6 +64,206 @@ void ParseProfilingOption(int &, int &, char *[]);
 /// Print profiling command-line options
 void PrintProfilingOptions(ostream &);
 
+// =============================================================================
+// Profiling of named zones
+// =============================================================================
+
+/**
+ * Hierarchical, thread-aware profiler of named code zones
+ *
+ * When enabled at runtime, each thread records the start and end time of the
+ * zones it executes into its own buffer. The nesting of zones is reconstructed
+ * afterwards from the containment of the time intervals of each thread, from
+ * which the number of calls, the inclusive and exclusive time of each zone,
+ * and the busy time of each thread are derived. The recorded intervals can
+ * further be exported in the trace event format of the Chrome browser
+ * (chrome://tracing) for a timeline view of the execution.
+ *
+ * @code
+ * void Function()
+ * {
+ *   MIRTK_PROFILE_ZONE("example zone");
+ *   // do some work here
+ * }
+ * @endcode
+ *
+ * @sa ProfilingZone, MIRTK_PROFILE_ZONE
+ */
+class Profiler
+{
+  // ---------------------------------------------------------------------------
+  // Types
+public:
+
+  /// Recorded execution of a named zone
+  struct Event
+  {
+    string _Name;  ///< Name of zone
+    double _Start; ///< Start time in seconds since start of profiler
+    double _End;   ///< End time in seconds since start of profiler
+  };
+
+  /// Events recorded by one thread
+  struct ThreadEvents
+  {
+    int          _Thread; ///< Sequential thread ID
+    Array<Event> _Events; ///< Recorded events
+  };
+
+  // ---------------------------------------------------------------------------
+  // Singleton
+private:
+
+  /// Constructor
+  Profiler();
+
+  /// Destructor
+  ~Profiler();
+
+  /// Copy constructor. Intentionally not implemented.
+  Profiler(const Profiler &);
+
+  /// Assignment operator. Intentionally not implemented.
+  void operator =(const Profiler &);
+
+public:
+
+  /// Singleton instance
+  static Profiler &Instance();
+
+  // ---------------------------------------------------------------------------
+  // Attributes
+private:
+
+  /// Whether recording of zones is enabled
+  bool _Enabled;
+
+  /// Start time of profiler
+  double _Epoch;
+
+  /// Events recorded by each thread
+  Array<ThreadEvents *> _Threads;
+
+  /// Mutex for registration of thread buffers
+  std::mutex _Mutex;
+
+  /// Get events buffer of calling thread
+  ThreadEvents *Buffer();
+
+public:
+
+  /// Whether recording of zones is enabled
+  static bool Enabled();
+
+  /// Enable/disable recording of zones
+  static void Enable(bool = true);
+
+  /// Current wall clock time in seconds since start of profiler
+  static double Now();
+
+  // ---------------------------------------------------------------------------
+  // Recording
+public:
+
+  /// Record execution of named zone by calling thread
+  ///
+  /// \param[in] name  Name of zone.
+  /// \param[in] start Start time as returned by Now().
+  /// \param[in] end   End time as returned by Now().
+  void Record(const string &name, double start, double end);
+
+  /// Discard all recorded events
+  ///
+  /// \attention Must not be called while other threads are recording events.
+  void Clear();
+
+  // ---------------------------------------------------------------------------
+  // Output
+public:
+
+  /// Print summary table of recorded zones and busy time of each thread
+  void PrintSummary(ostream &) const;
+
+  /// Write recorded events in Chrome trace event format
+  ///
+  /// \returns Whether output file was written successfully.
+  bool WriteTrace(const char *) const;
+
+  /// Write trace and print summary at program exit
+  ///
+  /// \param[in] fname Name of trace output file.
+  static void WriteAtExit(const char *fname);
+
+};
+
+// -----------------------------------------------------------------------------
+/// Records execution of enclosing scope as named zone when profiler is enabled
+class ProfilingZone
+{
+  string _Name;  ///< Name of zone, empty if profiler disabled
+  double _Start; ///< Start time of zone
+
+  /// Copy constructor. Intentionally not implemented.
+  ProfilingZone(const ProfilingZone &);
+
+  /// Assignment operator. Intentionally not implemented.
+  void operator =(const ProfilingZone &);
+
+public:
+
+  /// Construct zone which is not started yet
+  ProfilingZone()
+  :
+    _Start(.0)
+  {}
+
+  /// Start zone
+  explicit ProfilingZone(const string &name)
+  :
+    _Start(.0)
+  {
+    Start(name);
+  }
+
+  /// Start zone if profiler is enabled
+  void Start(const string &name)
+  {
+    if (Profiler::Enabled()) {
+      _Name  = name;
+      _Start = Profiler::Now();
+    }
+  }
+
+  /// End zone
+  ~ProfilingZone()
+  {
+    if (!_Name.empty()) {
+      Profiler::Instance().Record(_Name, _Start, Profiler::Now());
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Record execution of enclosing scope as named zone
+///
+/// The name argument can be a stream expression as with MIRTK_DEBUG_TIMING.
+/// It is only evaluated when the profiler is enabled at runtime, e.g., using
+/// the -profile <file> command-line option.
+///
+/// @code
+/// {
+///   MIRTK_PROFILE_ZONE("level " << level);
+///   // do some work here
+/// }
+/// @endcode
+#define MIRTK_PROFILE_ZONE(name)                                               \
+  mirtk::ProfilingZone _mirtk_profile_zone;                                    \
+  if (mirtk::Profiler::Enabled()) {                                            \
+    ostringstream _mirtk_profile_zone_name;                                    \
+    _mirtk_profile_zone_name << name;                                          \
+    _mirtk_profile_zone.Start(_mirtk_profile_zone_name.str());                 \
+  }
+
 // =============================================================================
 // CPU Profiling
 // =============================================================================
@@ -95,11 +285,7 @@ void PrintElapsedTime(const char *, double, TimeUnit = TIME_IN_SECONDS);
 ///
 /// @sa MIRTK_END_TIMING
 #ifdef MIRTK_WITH_PROFILING
-#  ifdef HAVE_TBB
-#    define MIRTK_START_TIMING()   tbb::tick_count t_start = tbb::tick_count::now()
-#  else
-#    define MIRTK_START_TIMING()   clock_t t_start = clock()
-#  endif
+#  define MIRTK_START_TIMING()   double t_start = mirtk::Profiler::Now()
 #else
 #  define MIRTK_START_TIMING()   do {} while (false)
 #endif
@@ -120,11 +306,7 @@ void PrintElapsedTime(const char *, double, TimeUnit = TIME_IN_SECONDS);
 ///
 /// @sa MIRTK_END_TIMING
 #ifdef MIRTK_WITH_PROFILING
-#  ifdef HAVE_TBB
-#    define MIRTK_RESET_TIMING()   t_start = tbb::tick_count::now()
-#  else
-#    define MIRTK_RESET_TIMING()   t_start = clock()
-#  endif
+#  define MIRTK_RESET_TIMING()   t_start = mirtk::Profiler::Now()
 #else
 #  define MIRTK_RESET_TIMING()   do {} while (false)
 #endif
@@ -146,24 +328,16 @@ void PrintElapsedTime(const char *, double, TimeUnit = TIME_IN_SECONDS);
 ///
 /// @sa MIRTK_START_TIMING
 #ifdef MIRTK_WITH_PROFILING
-#  ifdef HAVE_TBB
-#    define MIRTK_END_TIMING(section)                                          \
-       do {                                                                    \
-         ostringstream oss;                                                    \
-         oss << section;                                                       \
-         PrintElapsedTime(oss.str().c_str(),                                   \
-                          (tbb::tick_count::now() - t_start).seconds());       \
-       } while (false)
-#  else
-#    define MIRTK_END_TIMING(section)                                          \
-       do {                                                                    \
-         ostringstream oss;                                                    \
-         oss << section;                                                       \
-         PrintElapsedTime(oss.str().c_str(),                                   \
-                          static_cast<double>(clock() - t_start)               \
-                        / static_cast<double>(CLOCKS_PER_SEC));                \
-       } while (false)
-#  endif
+#  define MIRTK_END_TIMING(section)                                            \
+     do {                                                                      \
+       const double t_end = mirtk::Profiler::Now();                            \
+       ostringstream oss;                                                      \
+       oss << section;                                                         \
+       PrintElapsedTime(oss.str().c_str(), t_end - t_start);                   \
+       if (mirtk::Profiler::Enabled()) {                                       \
+         mirtk::Profiler::Instance().Record(oss.str(), t_start, t_end);        \
+       }                                                                       \
+     } while (false)
 #else
 #  define MIRTK_END_TIMING(section)   do {} while (false)
 #endif
@@ -194,32 +368,25 @@ void PrintElapsedTime(const char *, double, TimeUnit = TIME_IN_SECONDS);
 ///
 /// @note Whether or not the execution time is actually being measured and
 ///       printed to screen is decided at runtime depending on the global
-///       variable debug_time.
+///       variable debug_time. When the Profiler is enabled, the section is
+///       further recorded as named zone regardless of the debugging level.
 ///
 /// @sa MIRTK_START_TIMING
 #ifdef MIRTK_WITH_PROFILING
-#  ifdef HAVE_TBB
-#    define MIRTK_DEBUG_TIMING(level, section)                                 \
-       do {                                                                    \
+#  define MIRTK_DEBUG_TIMING(level, section)                                   \
+     do {                                                                      \
+       if (debug_time >= level || mirtk::Profiler::Enabled()) {                \
+         const double t_end = mirtk::Profiler::Now();                          \
+         ostringstream oss;                                                    \
+         oss << section;                                                       \
          if (debug_time >= level) {                                            \
-           ostringstream oss;                                                  \
-           oss << section;                                                     \
-           PrintElapsedTime(oss.str().c_str(),                                 \
-                            (tbb::tick_count::now() - t_start).seconds());     \
+           PrintElapsedTime(oss.str().c_str(), t_end - t_start);               \
          }                                                                     \
-       } while (false)
-#  else
-#    define MIRTK_DEBUG_TIMING(level, section)                                 \
-       do {                                                                    \
-         if (debug_time >= level) {                                            \
-           ostringstream oss;                                                  \
-           oss << section;                                                     \
-           PrintElapsedTime(oss.str().c_str(),                                 \
-                            static_cast<double>(clock() - t_start)             \
-                          / static_cast<double>(CLOCKS_PER_SEC));              \
+         if (mirtk::Profiler::Enabled()) {                                     \
+           mirtk::Profiler::Instance().Record(oss.str(), t_start, t_end);      \
          }                                                                     \
-       } while (false)
-#  endif
+       }                                                                       \
+     } while (false)
 #else
 #  define MIRTK_DEBUG_TIMING(level, section)   do {} while (false)
 #endif
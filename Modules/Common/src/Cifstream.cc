@@ -22,21 +22,148 @@
 #include "mirtk/Config.h"       // WINDOWS
 #include "mirtk/CommonConfig.h" // MIRTK_Common_WITH_ZLIB
 #include "mirtk/Memory.h"       // swap16, swap32
+#include "mirtk/Math.h"
+#include "mirtk/Algorithm.h"
+#include "mirtk/Parallel.h"
 
 #if MIRTK_Common_WITH_ZLIB
 #  include <zlib.h>
-#else
-#  include <cstdio>
 #endif
+#include <cstdio>
 
 
 namespace mirtk {
 
 
+// =============================================================================
+// Auxiliary functions and functors
+// =============================================================================
+
+namespace CifstreamUtils {
+
+
+/// Number of bytes decompressed at once before these are byte swapped
+const long ChunkSize = 4 * 1024 * 1024;
+
+/// Minimum number of bytes for which BGZF blocks are decompressed in parallel
+const long MinBlockReadSize = 256 * 1024;
+
+// -----------------------------------------------------------------------------
+/// Swap bytes of data elements of given size
+inline void SwapBytes(char *data, long num, int size)
+{
+  switch (size) {
+    case 2: swap16(data, data, num / 2); break;
+    case 4: swap32(data, data, num / 4); break;
+    case 8: swap64(data, data, num / 8); break;
+    default: break;
+  }
+}
+
+// -----------------------------------------------------------------------------
+/// Swap bytes of data elements of given size in parallel
+struct ParallelSwapBytes
+{
+  char *_Data;
+  int   _Size;
+
+  void operator ()(const blocked_range<long> &re) const
+  {
+    SwapBytes(_Data + re.begin() * _Size, (re.end() - re.begin()) * _Size, _Size);
+  }
+};
+
+#if MIRTK_Common_WITH_ZLIB
+
+// -----------------------------------------------------------------------------
+/// Read little endian unsigned integer of given number of bytes
+inline unsigned long ReadLittleEndian(const unsigned char *p, int n)
+{
+  unsigned long value = 0;
+  for (int i = n - 1; i >= 0; --i) value = (value << 8) | p[i];
+  return value;
+}
+
+// -----------------------------------------------------------------------------
+/// Check if gzip member header is the one of a BGZF block
+inline bool IsBlockHeader(const unsigned char h[18])
+{
+  return h[0] == 31 && h[1] == 139 && h[2] == 8 && h[3] == 4 &&
+         h[10] == 6 && h[11] == 0 && h[12] == 'B' && h[13] == 'C' &&
+         h[14] == 2 && h[15] == 0;
+}
+
+// -----------------------------------------------------------------------------
+/// Decompress BGZF blocks which overlap with the requested stream range
+template <class Block>
+struct InflateBlocks
+{
+  const Block         *_Blocks;
+  const unsigned char *_Input;  ///< Compressed data starting at first block
+  long                 _Offset; ///< File offset of first block
+  char                *_Output; ///< Output data
+  long                 _Start;  ///< Stream position of first output byte
+  long                 _End;    ///< Stream position after last output byte
+  char                *_Status; ///< Whether block was decompressed successfully
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    Array<unsigned char> tmp;
+    for (int b = re.begin(); b != re.end(); ++b) {
+      const Block         &block = _Blocks[b];
+      const unsigned char *data  = _Input + (block._Offset - _Offset);
+      const long begin = block._Position;
+      const long end   = block._Position + block._Length;
+      // Decompress block directly into output buffer if it is fully contained
+      unsigned char *out;
+      if (_Start <= begin && end <= _End) {
+        out = reinterpret_cast<unsigned char *>(_Output + (begin - _Start));
+      } else {
+        tmp.resize(block._Length);
+        out = tmp.data();
+      }
+      z_stream zs;
+      memset(&zs, 0, sizeof(zs));
+      _Status[b] = 0;
+      if (inflateInit2(&zs, -15) != Z_OK) continue;
+      zs.next_in   = const_cast<unsigned char *>(data + 18);
+      zs.avail_in  = static_cast<uInt>(block._Size - 26);
+      zs.next_out  = out;
+      zs.avail_out = static_cast<uInt>(block._Length);
+      const int ret = inflate(&zs, Z_FINISH);
+      const bool ok = (ret == Z_STREAM_END && zs.total_out == static_cast<uLong>(block._Length));
+      inflateEnd(&zs);
+      if (!ok) continue;
+      const unsigned long crc = ReadLittleEndian(data + block._Size - 8, 4);
+      if (crc32(0L, out, static_cast<uInt>(block._Length)) != crc) continue;
+      // Copy overlapping part of partially requested block
+      if (out == tmp.data()) {
+        const long i1 = max(begin, _Start);
+        const long i2 = min(end,   _End);
+        memcpy(_Output + (i1 - _Start), tmp.data() + (i1 - begin), i2 - i1);
+      }
+      _Status[b] = 1;
+    }
+  }
+};
+
+#endif // MIRTK_Common_WITH_ZLIB
+
+
+} // namespace CifstreamUtils
+
+using namespace CifstreamUtils;
+
+// =============================================================================
+// Construction/Destruction
+// =============================================================================
+
 // -----------------------------------------------------------------------------
 Cifstream::Cifstream(const char *fname)
 :
   _File(nullptr),
+  _BlockFile(nullptr),
+  _Position(-1),
   _Swapped(GetByteOrder() == LittleEndian)
 {
   if (fname) Open(fname);
@@ -51,8 +178,12 @@ Cifstream::~Cifstream()
 // -----------------------------------------------------------------------------
 void Cifstream::Open(const char *fname)
 {
+  Close();
   #if MIRTK_Common_WITH_ZLIB
     _File = gzopen(fname, "rb");
+    #if ZLIB_VERNUM >= 0x1240
+      if (_File != nullptr) gzbuffer(reinterpret_cast<gzFile>(_File), 128 * 1024);
+    #endif
   #elif defined(WINDOWS)
     FILE *fp;
     errno_t err = fopen_s(&fp, fname, "rb");
@@ -65,6 +196,54 @@ void Cifstream::Open(const char *fname)
     cerr << "Cifstream::Open: Cannot open file " << fname << endl;
     exit(1);
   }
+  IndexBlocks(fname);
+}
+
+// -----------------------------------------------------------------------------
+void Cifstream::IndexBlocks(const char *fname)
+{
+  _Blocks.clear();
+  _Position = -1;
+  if (_BlockFile != nullptr) {
+    fclose(reinterpret_cast<FILE *>(_BlockFile));
+    _BlockFile = nullptr;
+  }
+#if MIRTK_Common_WITH_ZLIB
+  FILE *fp;
+  #ifdef WINDOWS
+    if (fopen_s(&fp, fname, "rb") != 0) fp = nullptr;
+  #else
+    fp = fopen(fname, "rb");
+  #endif
+  if (fp == nullptr) return;
+  Block         block;
+  unsigned char header[18], footer[4];
+  long          offset = 0, position = 0;
+  while (fread(header, 1, 18, fp) == 18) {
+    if (!IsBlockHeader(header)) {
+      _Blocks.clear();
+      break;
+    }
+    block._Offset   = offset;
+    block._Position = position;
+    block._Size     = static_cast<int>(ReadLittleEndian(header + 16, 2)) + 1;
+    if (block._Size < 26 ||
+        fseek(fp, offset + block._Size - 4, SEEK_SET) != 0 ||
+        fread(footer, 1, 4, fp) != 4) {
+      _Blocks.clear();
+      break;
+    }
+    block._Length = static_cast<int>(ReadLittleEndian(footer, 4));
+    if (block._Length > 0) _Blocks.push_back(block);
+    offset   += block._Size;
+    position += block._Length;
+  }
+  if (_Blocks.empty()) {
+    fclose(fp);
+  } else {
+    _BlockFile = fp;
+  }
+#endif // MIRTK_Common_WITH_ZLIB
 }
 
 // -----------------------------------------------------------------------------
@@ -78,6 +257,12 @@ void Cifstream::Close()
     #endif
     _File = nullptr;
   }
+  if (_BlockFile != nullptr) {
+    fclose(reinterpret_cast<FILE *>(_BlockFile));
+    _BlockFile = nullptr;
+  }
+  _Blocks.clear();
+  _Position = -1;
 }
 
 // -----------------------------------------------------------------------------
@@ -95,6 +280,7 @@ void Cifstream::IsSwapped(int swapped)
 // -----------------------------------------------------------------------------
 long Cifstream::Tell() const
 {
+  if (_Position != -1) return _Position;
 #if MIRTK_Common_WITH_ZLIB
   return gztell(reinterpret_cast<gzFile>(_File));
 #else
@@ -105,6 +291,7 @@ long Cifstream::Tell() const
 // -----------------------------------------------------------------------------
 void Cifstream::Seek(long offset)
 {
+  _Position = -1;
 #if MIRTK_Common_WITH_ZLIB
   gzseek(reinterpret_cast<gzFile>(_File), offset, SEEK_SET);
 #else
@@ -112,17 +299,92 @@ void Cifstream::Seek(long offset)
 #endif
 }
 
+// =============================================================================
+// Read data
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+bool Cifstream::ReadBlocks(char *mem, long start, long num, int swap)
+{
+#if MIRTK_Common_WITH_ZLIB
+  if (start == -1) start = Tell();
+  const long end = start + num;
+  // Find blocks which overlap with the requested range
+  struct CompareBlockPosition
+  {
+    bool operator ()(long position, const Block &block) const
+    {
+      return position < block._Position;
+    }
+  };
+  Array<Block>::const_iterator first, last;
+  first = upper_bound(_Blocks.begin(), _Blocks.end(), start,   CompareBlockPosition());
+  last  = upper_bound(_Blocks.begin(), _Blocks.end(), end - 1, CompareBlockPosition());
+  if (first == _Blocks.begin()) return false;
+  --first, --last;
+  if (end > last->_Position + last->_Length) return false;
+  // Read compressed data of these blocks
+  FILE *fp = reinterpret_cast<FILE *>(_BlockFile);
+  const long offset = first->_Offset;
+  const long nbytes = last->_Offset + last->_Size - offset;
+  Array<unsigned char> input(nbytes);
+  if (fseek(fp, offset, SEEK_SET) != 0) return false;
+  if (fread(input.data(), 1, nbytes, fp) != static_cast<size_t>(nbytes)) return false;
+  // Decompress blocks in parallel
+  const int b1 = static_cast<int>(first - _Blocks.begin());
+  const int b2 = static_cast<int>(last  - _Blocks.begin()) + 1;
+  Array<char> status(_Blocks.size(), 0);
+  InflateBlocks<Block> inflate;
+  inflate._Blocks = _Blocks.data();
+  inflate._Input  = input.data();
+  inflate._Offset = offset;
+  inflate._Output = mem;
+  inflate._Start  = start;
+  inflate._End    = end;
+  inflate._Status = status.data();
+  parallel_for(blocked_range<int>(b1, b2), inflate);
+  for (int b = b1; b < b2; ++b) {
+    if (!status[b]) return false;
+  }
+  // Swap bytes in parallel
+  if (swap > 1) {
+    ParallelSwapBytes body;
+    body._Data = mem;
+    body._Size = swap;
+    parallel_for(blocked_range<long>(0, num / swap, ChunkSize / swap), body);
+  }
+  // Defer seek of gzip stream until next read which does not use the blocks
+  _Position = end;
+  return true;
+#else
+  return false;
+#endif // MIRTK_Common_WITH_ZLIB
+}
+
 // -----------------------------------------------------------------------------
-bool Cifstream::Read(char *mem, long start, long num)
+bool Cifstream::Read(char *mem, long start, long num, int swap)
 {
+  if (!_Blocks.empty() && num >= MinBlockReadSize) {
+    if (ReadBlocks(mem, start, num, swap)) return true;
+  }
+  if (start == -1) start = _Position;
+  _Position = -1;
 #if MIRTK_Common_WITH_ZLIB
   gzFile fp = reinterpret_cast<gzFile>(_File);
   if (start != -1) gzseek(fp, start, SEEK_SET);
-  return (gzread(fp, mem, num) == num);
+  // Swap bytes of each decompressed chunk while it is still in the cache
+  for (long pos = 0, n; pos < num; pos += n) {
+    n = min(ChunkSize, num - pos);
+    if (gzread(fp, mem + pos, static_cast<unsigned int>(n)) != n) return false;
+    SwapBytes(mem + pos, n, swap);
+  }
+  return true;
 #else
   FILE * fp = reinterpret_cast<FILE *>(_File);
   if (start != -1) fseek(fp, start, SEEK_SET);
-  return (fread(mem, num, 1, fp) == 1);
+  if (fread(mem, num, 1, fp) != 1) return false;
+  SwapBytes(mem, num, swap);
+  return true;
 #endif
 }
 
@@ -141,54 +403,45 @@ bool Cifstream::ReadAsUChar(unsigned char *data, long length, long offset)
 // -----------------------------------------------------------------------------
 bool Cifstream::ReadAsShort(short *data, long length, long offset)
 {
-  if (!Read((char *)data, offset, length * sizeof(short))) return false;
-  if (_Swapped) swap16((char *)data, (char *)data, length);
-  return true;
+  return Read((char *)data, offset, length * sizeof(short), _Swapped ? sizeof(short) : 0);
 }
 
 // -----------------------------------------------------------------------------
 bool Cifstream::ReadAsUShort(unsigned short *data, long length, long offset)
 {
-  if (!Read((char *)data, offset, length * sizeof(unsigned short))) return false;
-  if (_Swapped) swap16((char *)data, (char *)data, length);
-  return true;
+  return Read((char *)data, offset, length * sizeof(unsigned short), _Swapped ? sizeof(unsigned short) : 0);
 }
 
 // -----------------------------------------------------------------------------
 bool Cifstream::ReadAsInt(int *data, long length, long offset)
 {
-  if (!Read((char *)data, offset, length * sizeof(int))) return false;
-  if (_Swapped) swap32((char *)data, (char *)data, length);
-  return true;
+  return Read((char *)data, offset, length * sizeof(int), _Swapped ? sizeof(int) : 0);
 }
 
 // -----------------------------------------------------------------------------
 bool Cifstream::ReadAsUInt(unsigned int *data, long length, long offset)
 {
-  if (!Read((char *)data, offset, length * sizeof(unsigned int))) return false;
-  if (_Swapped) swap32((char *)data, (char *)data, length);
-  return true;
+  return Read((char *)data, offset, length * sizeof(unsigned int), _Swapped ? sizeof(unsigned int) : 0);
 }
 
 // -----------------------------------------------------------------------------
 bool Cifstream::ReadAsFloat(float *data, long length, long offset)
 {
-  if (!Read((char *)data, offset, length * sizeof(float))) return false;
-  if (_Swapped) swap32((char *)data, (char *)data, length);
-  return true;
+  return Read((char *)data, offset, length * sizeof(float), _Swapped ? sizeof(float) : 0);
 }
 
 // -----------------------------------------------------------------------------
 bool Cifstream::ReadAsDouble(double *data, long length, long offset)
 {
-  if (!Read((char *)data, offset, length * sizeof(double))) return false;
-  if (_Swapped) swap64((char *)data, (char *)data, length);
-  return true;
+  return Read((char *)data, offset, length * sizeof(double), _Swapped ? sizeof(double) : 0);
 }
 
 // -----------------------------------------------------------------------------
 bool Cifstream::ReadAsString(char *data, long length, long offset)
 {
+  if (offset == -1) offset = _Position;
+  _Position = -1;
+
   // Read string
 #if MIRTK_Common_WITH_ZLIB
   gzFile fp = reinterpret_cast<gzFile>(_File);
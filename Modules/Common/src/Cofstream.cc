@@ -22,6 +22,9 @@
 #include "mirtk/Config.h"       // WINDOWS
 #include "mirtk/CommonConfig.h" // MIRTK_Common_WITH_ZLIB
 #include "mirtk/Memory.h"       // swap16, swap32
+#include "mirtk/Math.h"
+#include "mirtk/Algorithm.h"
+#include "mirtk/Parallel.h"
 
 #if MIRTK_Common_WITH_ZLIB
 #  include <zlib.h>
@@ -31,12 +34,107 @@
 namespace mirtk {
 
 
+// =============================================================================
+// Auxiliary functions and functors
+// =============================================================================
+
+#if MIRTK_Common_WITH_ZLIB
+
+namespace CofstreamUtils {
+
+
+/// Maximum number of uncompressed bytes per BGZF block
+const long BlockSize = 65280;
+
+/// Maximum size of compressed BGZF block including gzip header and footer
+const long MaxBlockSize = 65536;
+
+/// Number of BGZF blocks which are compressed in parallel
+const long BatchSize = 256;
+
+/// Empty BGZF block which marks the end of the file
+const unsigned char EndOfFileBlock[28] = {
+  0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x00,
+  0x42, 0x43, 0x02, 0x00, 0x1b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+// -----------------------------------------------------------------------------
+/// Write unsigned integer of given number of bytes in little endian byte order
+inline void WriteLittleEndian(unsigned char *p, unsigned long value, int n)
+{
+  for (int i = 0; i < n; ++i, value >>= 8) p[i] = static_cast<unsigned char>(value & 0xff);
+}
+
+// -----------------------------------------------------------------------------
+/// Raw deflate data, returns size of compressed data or zero on failure
+inline long Deflate(unsigned char *out, long size, const char *data, long num, int level)
+{
+  z_stream zs;
+  memset(&zs, 0, sizeof(zs));
+  if (deflateInit2(&zs, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK) return 0;
+  zs.next_in   = reinterpret_cast<Bytef *>(const_cast<char *>(data));
+  zs.avail_in  = static_cast<uInt>(num);
+  zs.next_out  = out;
+  zs.avail_out = static_cast<uInt>(size);
+  const int ret = deflate(&zs, Z_FINISH);
+  const long n  = static_cast<long>(zs.total_out);
+  deflateEnd(&zs);
+  return (ret == Z_STREAM_END ? n : 0);
+}
+
+// -----------------------------------------------------------------------------
+/// Compress BGZF blocks in parallel
+struct DeflateBlocks
+{
+  const char    *_Data;   ///< Uncompressed data
+  long           _Length; ///< Number of uncompressed bytes
+  unsigned char *_Output; ///< Output slots of size MaxBlockSize
+  long          *_Size;   ///< Size of compressed blocks, zero on failure
+
+  void operator ()(const blocked_range<long> &re) const
+  {
+    for (long b = re.begin(); b != re.end(); ++b) {
+      const char    *data = _Data + b * BlockSize;
+      const long     num  = min(BlockSize, _Length - b * BlockSize);
+      unsigned char *out  = _Output + b * MaxBlockSize;
+      // Compress data, storing it uncompressed if it does not fit into a block
+      long n = Deflate(out + 18, MaxBlockSize - 26, data, num, Z_DEFAULT_COMPRESSION);
+      if (n == 0) n = Deflate(out + 18, MaxBlockSize - 26, data, num, Z_NO_COMPRESSION);
+      if (n == 0) {
+        _Size[b] = 0;
+        continue;
+      }
+      const long size = n + 26;
+      // gzip header with BGZF extra field containing the block size
+      memcpy(out, EndOfFileBlock, 16);
+      WriteLittleEndian(out + 16, static_cast<unsigned long>(size - 1), 2);
+      // gzip footer with CRC-32 and size of uncompressed data
+      const unsigned long crc = crc32(0L, reinterpret_cast<const Bytef *>(data), static_cast<uInt>(num));
+      WriteLittleEndian(out + size - 8, crc, 4);
+      WriteLittleEndian(out + size - 4, static_cast<unsigned long>(num), 4);
+      _Size[b] = size;
+    }
+  }
+};
+
+
+} // namespace CofstreamUtils
+
+using namespace CofstreamUtils;
+
+#endif // MIRTK_Common_WITH_ZLIB
+
+// =============================================================================
+// Construction/Destruction
+// =============================================================================
+
 // -----------------------------------------------------------------------------
 Cofstream::Cofstream(const char *fname)
 :
   _File(nullptr),
   #if MIRTK_Common_WITH_ZLIB
-    _ZFile(nullptr),
+    _Length(0),
   #endif
   _Compressed(false),
   _Swapped(GetByteOrder() == LittleEndian)
@@ -61,40 +159,41 @@ void Cofstream::Open(const char *fname)
   }
   if (len > 3 && (strncmp(fname + len-3, ".gz", 3) == 0 || strncmp(fname + len-3, ".GZ", 3) == 0)) {
     #if MIRTK_Common_WITH_ZLIB
-      gzFile fp = gzopen(fname, "wb");
-      if (fp == nullptr) {
-        cerr << "Cofstream::Open: Cannot open file " << fname << endl;
-        exit(1);
-      }
-      _ZFile = fp;
+      _Buffer.clear();
+      _Buffer.reserve(BatchSize * BlockSize);
+      _Length = 0;
       _Compressed = true;
     #else // MIRTK_Common_WITH_ZLIB
       cerr << "Cofstream::Open: Cannot write compressed file when Common module not built WITH_ZLIB" << endl;
       exit(1);
     #endif // MIRTK_Common_WITH_ZLIB
   } else {
-    #ifdef WINDOWS
-      errno_t err = fopen_s(&_File, fname, "wb");
-      if (err != 0) _File = nullptr;
-    #else
-      _File = fopen(fname, "wb");
-    #endif
-    if (_File == nullptr) {
-      cerr << "Cofstream::Open: Cannot open file " << fname << endl;
-      exit(1);
-    }
     _Compressed = false;
   }
+  #ifdef WINDOWS
+    errno_t err = fopen_s(&_File, fname, "wb");
+    if (err != 0) _File = nullptr;
+  #else
+    _File = fopen(fname, "wb");
+  #endif
+  if (_File == nullptr) {
+    cerr << "Cofstream::Open: Cannot open file " << fname << endl;
+    exit(1);
+  }
 }
 
 // -----------------------------------------------------------------------------
 void Cofstream::Close()
 {
   #if MIRTK_Common_WITH_ZLIB
-    if (_ZFile != nullptr) {
-      gzclose(reinterpret_cast<gzFile>(_ZFile));
-      _ZFile = nullptr;
+    if (_File != nullptr && _Compressed) {
+      if (!Flush(true) || fwrite(EndOfFileBlock, sizeof(EndOfFileBlock), 1, _File) != 1) {
+        cerr << "Cofstream::Close: Failed to write compressed data" << endl;
+        exit(1);
+      }
     }
+    _Buffer.clear();
+    _Length = 0;
   #endif // MIRTK_Common_WITH_ZLIB
   if (_File != nullptr) {
     fclose(_File);
@@ -102,6 +201,56 @@ void Cofstream::Close()
   }
 }
 
+// =============================================================================
+// Write data
+// =============================================================================
+
+#if MIRTK_Common_WITH_ZLIB
+
+// -----------------------------------------------------------------------------
+bool Cofstream::Append(const char *data, long length)
+{
+  const long capacity = BatchSize * BlockSize;
+  while (length > 0) {
+    const long n = min(length, capacity - static_cast<long>(_Buffer.size()));
+    if (data) {
+      _Buffer.insert(_Buffer.end(), data, data + n);
+      data += n;
+    } else {
+      _Buffer.resize(_Buffer.size() + n, '\0');
+    }
+    length -= n;
+    if (static_cast<long>(_Buffer.size()) == capacity && !Flush()) return false;
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+bool Cofstream::Flush(bool all)
+{
+  long num = static_cast<long>(_Buffer.size());
+  if (!all) num -= num % BlockSize;
+  if (num <= 0) return true;
+  const long nblocks = (num + BlockSize - 1) / BlockSize;
+  Array<unsigned char> output(nblocks * MaxBlockSize);
+  Array<long>          size(nblocks);
+  DeflateBlocks deflate;
+  deflate._Data   = _Buffer.data();
+  deflate._Length = num;
+  deflate._Output = output.data();
+  deflate._Size   = size.data();
+  parallel_for(blocked_range<long>(0, nblocks), deflate);
+  for (long b = 0; b < nblocks; ++b) {
+    if (size[b] == 0) return false;
+    if (fwrite(output.data() + b * MaxBlockSize, size[b], 1, _File) != 1) return false;
+  }
+  _Buffer.erase(_Buffer.begin(), _Buffer.begin() + num);
+  _Length += num;
+  return true;
+}
+
+#endif // MIRTK_Common_WITH_ZLIB
+
 // -----------------------------------------------------------------------------
 int Cofstream::IsCompressed() const
 {
@@ -131,16 +280,16 @@ bool Cofstream::Write(const char *data, long offset, long length)
 {
   #if MIRTK_Common_WITH_ZLIB
     if (_Compressed) {
-      gzFile fp = reinterpret_cast<gzFile>(_ZFile);
       if (offset != -1) {
-        if (gztell(fp) > offset) {
+        const long pos = _Length + static_cast<long>(_Buffer.size());
+        if (pos > offset) {
           cerr << "Error: Writing compressed files only supports forward seek (pos="
-               << gztell(fp) << ", offset=" << offset << ")" << endl;
+               << pos << ", offset=" << offset << ")" << endl;
           exit(1);
         }
-        gzseek(fp, offset, SEEK_SET);
+        if (!Append(nullptr, offset - pos)) return false;
       }
-      return (gzwrite(fp, data, length) == length);
+      return Append(data, length);
     }
   #endif // MIRTK_Common_WITH_ZLIB
   if (offset != -1) fseek(_File, offset, SEEK_SET);
@@ -272,9 +421,7 @@ bool Cofstream::WriteAsString(const char *data, long offset)
 {
   #if MIRTK_Common_WITH_ZLIB
     if (_Compressed) {
-      gzFile fp = reinterpret_cast<gzFile>(_ZFile);
-      if (offset != -1) gzseek(fp, offset, SEEK_SET);
-      return (gzputs(fp, data) > 0);
+      return Write(data, offset, static_cast<long>(strlen(data)));
     }
   #endif // MIRTK_Common_WITH_ZLIB
   if (offset != -1) fseek(_File, offset, SEEK_SET);
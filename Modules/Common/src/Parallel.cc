@@ -25,6 +25,14 @@
 
 #include <memory>
 
+#ifndef HAVE_TBB
+#  include "mirtk/Array.h"
+#  include <cstdlib>
+#  include <condition_variable>
+#  include <deque>
+#  include <thread>
+#endif
+
 
 namespace mirtk {
 
@@ -42,9 +50,10 @@ int debug_gpu = 0;
 // Default: No debugging of TBB code
 int tbb_debug = 0;
 
-#ifdef HAVE_TBB
+// Default: Voxel reductions use parallel_reduce
+bool deterministic_reduction = false;
+
 std::unique_ptr<task_scheduler_init> tbb_scheduler;
-#endif
 
 // =============================================================================
 // Command help
@@ -54,9 +63,10 @@ std::unique_ptr<task_scheduler_init> tbb_scheduler;
 bool IsParallelOption(const char *arg)
 {
   _option = NULL;
-  if      (strcmp(arg, "-cpu")     == 0) _option = "-cpu";
-  else if (strcmp(arg, "-gpu")     == 0) _option = "-gpu";
-  else if (strcmp(arg, "-threads") == 0) _option = "-threads";
+  if      (strcmp(arg, "-cpu")           == 0) _option = "-cpu";
+  else if (strcmp(arg, "-gpu")           == 0) _option = "-gpu";
+  else if (strcmp(arg, "-threads")       == 0) _option = "-threads";
+  else if (strcmp(arg, "-deterministic") == 0) _option = "-deterministic";
   return (_option != NULL);
 }
 
@@ -72,6 +82,9 @@ void ParseParallelOption(int &OPTIDX, int &argc, char *argv[])
     cerr << "WARNING: Program compiled without GPU support using CUDA." << endl;
     use_gpu = false;
 #endif
+  } else if (OPTION("-deterministic")) {
+    if (HAS_ARGUMENT) PARSE_ARGUMENT(deterministic_reduction);
+    else deterministic_reduction = true;
   } else if (OPTION("-threads")) {
     int no_threads = 0; // parse argument even if unused
     if (!FromString(ARGUMENT, no_threads)) {
@@ -79,38 +92,349 @@ void ParseParallelOption(int &OPTIDX, int &argc, char *argv[])
       exit(1);
     }
     if (no_threads < 0) {
-#ifdef HAVE_TBB
       no_threads = task_scheduler_init::automatic;
-#else
-      no_threads = 1;
-#endif
     } else if (no_threads == 0) {
       no_threads = 1;
     }
-#ifdef HAVE_TBB
-    if (!tbb_scheduler.get()) tbb_scheduler.reset(new task_scheduler_init(no_threads));
-    else                      tbb_scheduler.get()->initialize(no_threads);
-#endif
+    if (!tbb_scheduler.get()) {
+      tbb_scheduler.reset(new task_scheduler_init(no_threads));
+    } else {
+      #ifdef HAVE_TBB
+        tbb_scheduler.get()->terminate();
+      #endif
+      tbb_scheduler.get()->initialize(no_threads);
+    }
   }
 }
 
 // -----------------------------------------------------------------------------
-#if defined(HAVE_TBB) || defined(USE_CUDA)
 void PrintParallelOptions(ostream &out)
 {
   out << endl;
   out << "Parallelization options:" << endl;
-#ifdef HAVE_TBB
   out << "  -threads <n>                 Use maximal <n> threads for parallel execution. (default: automatic)" << endl;
-#endif
+  out << "  -deterministic [on|off]      Compute parallel reductions such that results do not depend on the" << endl;
+  out << "                               number of threads. (default: " << (deterministic_reduction ? "on" : "off") << ")" << endl;
 #ifdef USE_CUDA
   out << "  -gpu                         Enable  GPU acceleration."   << (use_gpu ? " (default)" : "") << endl;
   out << "  -cpu                         Disable GPU acceleration."   << (use_gpu ? "" : " (default)") << endl;
 #endif
 }
-#else
-void PrintParallelOptions(ostream &) {}
-#endif // HAVE_TBB || USE_CUDA
+
+#ifndef HAVE_TBB
+
+// =============================================================================
+// Multi-threading support using C++11 threads
+// =============================================================================
+
+namespace ParallelUtils {
+
+
+// -----------------------------------------------------------------------------
+/// Task executed by a thread of the thread pool
+struct Task
+{
+  std::function<void()>  _Function;
+  TaskGroup             *_Group;
+};
+
+// -----------------------------------------------------------------------------
+/// Double-ended queue of tasks
+struct TaskQueue
+{
+  std::mutex       _Mutex;
+  std::deque<Task> _Tasks;
+};
+
+// -----------------------------------------------------------------------------
+/// Pool of worker threads with work-stealing task queues
+///
+/// The pool consists of n - 1 worker threads, where n is the maximum number of
+/// threads. The n-th thread is the one which started the parallel loop. It
+/// executes pending tasks while waiting for the tasks of this loop to finish.
+/// Each worker thread has its own task queue, and tasks spawned by any other
+/// thread are added to a shared queue.
+class ThreadPool
+{
+  Array<std::thread>              _Threads;
+  Array<std::unique_ptr<TaskQueue> > _Queues;
+  std::atomic<int>                _NumberOfTasks;
+  std::atomic<int>                _NumberOfThreads;
+  bool                            _Stop;
+  std::mutex                      _Mutex;
+  std::condition_variable         _Wakeup;
+  int                             _Generation;
+  int                             _Id;
+
+  /// Index of task queue of current worker thread, -1 for non-worker threads
+  static thread_local int _Index;
+
+  /// Whether the program is terminating
+  static std::atomic<bool> _Exiting;
+
+  /// Called when the program terminates
+  static void AtExit()
+  {
+    _Exiting = true;
+  }
+
+  /// Constructor
+  ThreadPool()
+  :
+    _NumberOfTasks(0), _NumberOfThreads(0),
+    _Stop(false), _Generation(0), _Id(0)
+  {
+    Start(DefaultNumberOfThreads());
+    std::atexit(&ThreadPool::AtExit);
+  }
+
+  /// Start n - 1 worker threads
+  void Start(int n)
+  {
+    if (n < 1) n = 1;
+    _Stop = false;
+    _Queues.resize(n);
+    for (int i = 0; i < n; ++i) _Queues[i].reset(new TaskQueue());
+    _Threads.resize(n - 1);
+    for (int i = 0; i < n - 1; ++i) _Threads[i] = std::thread(&ThreadPool::Work, this, i);
+    _NumberOfThreads = n;
+  }
+
+  /// Stop worker threads after all pending tasks are finished
+  void Stop()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_Mutex);
+      _Stop = true;
+    }
+    _Wakeup.notify_all();
+    for (size_t i = 0; i < _Threads.size(); ++i) _Threads[i].join();
+    _Threads.clear();
+    _Queues.clear();
+    _NumberOfThreads = 0;
+  }
+
+  /// Main loop of worker threads
+  void Work(int index)
+  {
+    _Index = index;
+    Task task;
+    while (true) {
+      if (Pop(task)) {
+        Execute(task);
+      } else {
+        std::unique_lock<std::mutex> lock(_Mutex);
+        _Wakeup.wait(lock, [this]() { return _Stop || _NumberOfTasks > 0; });
+        if (_Stop && _NumberOfTasks == 0) break;
+      }
+    }
+    _Index = -1;
+  }
+
+  /// Take task from queue of current thread or steal task from other queue
+  bool Pop(Task &task)
+  {
+    const int n = static_cast<int>(_Queues.size());
+    const int i = (_Index < 0 ? n - 1 : _Index);
+    {
+      TaskQueue &queue = *_Queues[i];
+      std::lock_guard<std::mutex> lock(queue._Mutex);
+      if (!queue._Tasks.empty()) {
+        task = std::move(queue._Tasks.back());
+        queue._Tasks.pop_back();
+        --_NumberOfTasks;
+        return true;
+      }
+    }
+    for (int j = (i + 1) % n; j != i; j = (j + 1) % n) {
+      TaskQueue &queue = *_Queues[j];
+      std::lock_guard<std::mutex> lock(queue._Mutex);
+      if (!queue._Tasks.empty()) {
+        task = std::move(queue._Tasks.front());
+        queue._Tasks.pop_front();
+        --_NumberOfTasks;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// Execute task and notify its group
+  void Execute(Task &task)
+  {
+    TaskGroup * const group = task._Group;
+    try {
+      task._Function();
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(group->_Mutex);
+      if (!group->_Exception) group->_Exception = std::current_exception();
+    }
+    task._Function = nullptr;
+    --group->_Pending;
+  }
+
+public:
+
+  /// Singleton instance
+  ///
+  /// The thread pool is intentionally never destroyed, such that idle worker
+  /// threads do not prevent or interfere with the termination of the program.
+  static ThreadPool &Instance()
+  {
+    static ThreadPool *instance = new ThreadPool();
+    return *instance;
+  }
+
+  /// Number of hardware threads
+  static int DefaultNumberOfThreads()
+  {
+    const int n = static_cast<int>(std::thread::hardware_concurrency());
+    return (n > 0 ? n : 1);
+  }
+
+  /// Maximum number of threads
+  int NumberOfThreads() const
+  {
+    return _NumberOfThreads;
+  }
+
+  /// Set maximum number of threads
+  ///
+  /// The worker threads are only restarted when called by a thread which does
+  /// not belong to the pool and while the program is not terminating.
+  ///
+  /// \returns Identifier used to restore the default number of threads.
+  int NumberOfThreads(int n)
+  {
+    if (n < 1) n = DefaultNumberOfThreads();
+    if (n != _NumberOfThreads && _Index < 0 && !_Exiting) {
+      Stop();
+      Start(n);
+    }
+    return (_Id = ++_Generation);
+  }
+
+  /// Restore default number of threads unless changed since given identifier
+  void Reset(int id)
+  {
+    if (id != 0 && id == _Id) {
+      NumberOfThreads(DefaultNumberOfThreads());
+      _Id = 0;
+    }
+  }
+
+  /// Whether the number of threads was set by the given identifier
+  bool IsCurrent(int id) const
+  {
+    return id != 0 && id == _Id;
+  }
+
+  /// Add task to queue of current thread
+  void Push(Task task)
+  {
+    const int n = static_cast<int>(_Queues.size());
+    TaskQueue &queue = *_Queues[_Index < 0 ? n - 1 : _Index];
+    {
+      std::lock_guard<std::mutex> lock(queue._Mutex);
+      queue._Tasks.push_back(std::move(task));
+      ++_NumberOfTasks;
+    }
+    {
+      std::lock_guard<std::mutex> lock(_Mutex);
+    }
+    _Wakeup.notify_one();
+  }
+
+  /// Execute one pending task
+  ///
+  /// \returns Whether a task was executed.
+  bool RunOne()
+  {
+    Task task;
+    if (Pop(task)) {
+      Execute(task);
+      return true;
+    }
+    return false;
+  }
+};
+
+thread_local int  ThreadPool::_Index = -1;
+std::atomic<bool> ThreadPool::_Exiting(false);
+
+// -----------------------------------------------------------------------------
+int NumberOfThreads()
+{
+  return ThreadPool::Instance().NumberOfThreads();
+}
+
+// -----------------------------------------------------------------------------
+int MaxSplitDepth()
+{
+  int depth = 2;
+  for (int n = NumberOfThreads() - 1; n > 0; n >>= 1) ++depth;
+  return depth;
+}
+
+// -----------------------------------------------------------------------------
+void TaskGroup::Run(std::function<void()> f)
+{
+  Task task;
+  task._Function = std::move(f);
+  task._Group    = this;
+  ++_Pending;
+  ThreadPool::Instance().Push(std::move(task));
+}
+
+// -----------------------------------------------------------------------------
+void TaskGroup::Join()
+{
+  ThreadPool &pool = ThreadPool::Instance();
+  while (_Pending > 0) {
+    if (!pool.RunOne()) std::this_thread::yield();
+  }
+}
+
+// -----------------------------------------------------------------------------
+void TaskGroup::Wait()
+{
+  Join();
+  if (_Exception) {
+    std::exception_ptr e = _Exception;
+    _Exception = nullptr;
+    std::rethrow_exception(e);
+  }
+}
+
+
+} // namespace ParallelUtils
+
+// -----------------------------------------------------------------------------
+void task_scheduler_init::initialize(int n)
+{
+  _Id = ParallelUtils::ThreadPool::Instance().NumberOfThreads(n);
+}
+
+// -----------------------------------------------------------------------------
+void task_scheduler_init::terminate()
+{
+  ParallelUtils::ThreadPool::Instance().Reset(_Id);
+  _Id = 0;
+}
+
+// -----------------------------------------------------------------------------
+bool task_scheduler_init::is_active() const
+{
+  return ParallelUtils::ThreadPool::Instance().IsCurrent(_Id);
+}
+
+// -----------------------------------------------------------------------------
+int task_scheduler_init::default_num_threads()
+{
+  return ParallelUtils::ThreadPool::DefaultNumberOfThreads();
+}
+
+#endif // HAVE_TBB
 
 
 } // namespace mirtk
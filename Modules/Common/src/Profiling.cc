@@ -21,6 +21,13 @@
 
 #include "mirtk/Options.h"
 #include "mirtk/Stream.h"
+#include "mirtk/Algorithm.h"
+#include "mirtk/OrderedMap.h"
+#include "mirtk/Pair.h"
+#include "mirtk/Math.h"
+
+#include <chrono>
+#include <cstdlib>
 
 
 namespace mirtk {
@@ -53,8 +60,18 @@ bool IsProfilingOption(const char *arg)
 void ParseProfilingOption(int &OPTIDX, int &argc, char *argv[])
 {
   if (OPTION("-profile")) {
-    if (HAS_ARGUMENT) debug_time  = atoi(ARGUMENT);
-    else              debug_time += 1;
+    if (HAS_ARGUMENT) {
+      const char *arg = ARGUMENT;
+      char *end;
+      const long level = strtol(arg, &end, 10);
+      if (*arg != '\0' && *end == '\0') {
+        debug_time = static_cast<int>(level);
+      } else {
+        Profiler::WriteAtExit(arg);
+      }
+    } else {
+      debug_time += 1;
+    }
   } else if (OPTION("-profile-unit")) {
     const char *arg = ARGUMENT;
     if      (strcmp(arg, "msecs") == 0) debug_time_unit = TIME_IN_MILLISECONDS;
@@ -67,21 +84,308 @@ void ParseProfilingOption(int &OPTIDX, int &argc, char *argv[])
 }
 
 // -----------------------------------------------------------------------------
-#ifdef USE_TIMING
 void PrintProfilingOptions(ostream &out)
 {
   out << endl;
   out << "Profiling options:" << endl;
+  out << "  -profile <file>              Record execution time of named zones, print summary table" << endl;
+  out << "                               at exit, and write trace in Chrome trace event format to file." << endl;
+#ifdef MIRTK_WITH_PROFILING
   out << "  -profile [n]                 Increase/Set verbosity of time measurements. (default: 0)" << endl;
+#endif
 #ifdef USE_CUDA
   out << "  -profile-unit <msecs|secs>   Unit of time measurements. (default: secs [CPU], msecs [GPU])" << endl;
 #else
   out << "  -profile-unit <msecs|secs>   Unit of time measurements. (default: secs)" << endl;
 #endif
 }
-#else
-void PrintProfilingOptions(ostream &) {}
-#endif
+
+// =============================================================================
+// Profiling of named zones
+// =============================================================================
+
+namespace ProfilerUtils {
+
+
+// -----------------------------------------------------------------------------
+/// Aggregated statistics of a zone within the hierarchy of zones
+struct Node
+{
+  string                  _Name;      ///< Name of zone
+  int                     _Calls;     ///< Number of executions
+  double                  _Inclusive; ///< Total time including nested zones
+  double                  _Nested;    ///< Total time of directly nested zones
+  double                  _First;     ///< Start time of first execution
+  OrderedMap<string, int> _Children;  ///< Indices of nested zones
+
+  Node(const string &name = string())
+  :
+    _Name(name), _Calls(0), _Inclusive(.0), _Nested(.0), _First(.0)
+  {}
+};
+
+// -----------------------------------------------------------------------------
+/// Order events by start time, enclosing before nested events
+bool Precedes(const Profiler::Event &a, const Profiler::Event &b)
+{
+  if (a._Start == b._Start) return a._End > b._End;
+  return a._Start < b._Start;
+}
+
+// -----------------------------------------------------------------------------
+/// Escape string for output in JSON file
+string EscapeJSON(const string &str)
+{
+  string escaped;
+  escaped.reserve(str.size());
+  for (size_t i = 0; i < str.size(); ++i) {
+    const char c = str[i];
+    if      (c == '"')  escaped += "\\\"";
+    else if (c == '\\') escaped += "\\\\";
+    else if (c == '\n') escaped += "\\n";
+    else if (c == '\t') escaped += "\\t";
+    else if (static_cast<unsigned char>(c) < 0x20) escaped += ' ';
+    else escaped += c;
+  }
+  return escaped;
+}
+
+// -----------------------------------------------------------------------------
+/// Print statistics of zone and its nested zones
+void PrintNode(ostream &out, const Array<Node> &nodes, int i, int depth, double scale)
+{
+  const Node &node = nodes[i];
+  if (depth >= 0) {
+    const string name = string(2 * depth, ' ') + node._Name;
+    char line[256];
+    snprintf(line, 256, "%-64s %8d %14.3f %14.3f %14.3f",
+             name.substr(0, 64).c_str(), node._Calls,
+             scale * node._Inclusive,
+             scale * (node._Inclusive - node._Nested),
+             scale * node._Inclusive / node._Calls);
+    out << line << "\n";
+  }
+  // Print nested zones in order of their first execution
+  Array<Pair<double, int> > children;
+  children.reserve(node._Children.size());
+  for (auto it = node._Children.begin(); it != node._Children.end(); ++it) {
+    children.push_back(MakePair(nodes[it->second]._First, it->second));
+  }
+  sort(children.begin(), children.end());
+  for (size_t c = 0; c < children.size(); ++c) {
+    PrintNode(out, nodes, children[c].second, depth + 1, scale);
+  }
+}
+
+// -----------------------------------------------------------------------------
+/// Name of trace output file written at exit
+string _TraceFileName;
+
+// -----------------------------------------------------------------------------
+/// Write trace and print summary, called at program exit
+void WriteProfile()
+{
+  Profiler &profiler = Profiler::Instance();
+  cout << endl;
+  profiler.PrintSummary(cout);
+  if (!profiler.WriteTrace(_TraceFileName.c_str())) {
+    cerr << "Error: Failed to write profiling trace to file " << _TraceFileName << endl;
+  }
+}
+
+
+} // namespace ProfilerUtils
+using namespace ProfilerUtils;
+
+// -----------------------------------------------------------------------------
+Profiler::Profiler()
+:
+  _Enabled(false),
+  _Epoch(.0)
+{
+  _Epoch = Now();
+}
+
+// -----------------------------------------------------------------------------
+Profiler::~Profiler()
+{
+  for (size_t i = 0; i < _Threads.size(); ++i) {
+    delete _Threads[i];
+  }
+}
+
+// -----------------------------------------------------------------------------
+Profiler &Profiler::Instance()
+{
+  static Profiler instance;
+  return instance;
+}
+
+// -----------------------------------------------------------------------------
+bool Profiler::Enabled()
+{
+  return Instance()._Enabled;
+}
+
+// -----------------------------------------------------------------------------
+void Profiler::Enable(bool enable)
+{
+  Instance()._Enabled = enable;
+}
+
+// -----------------------------------------------------------------------------
+double Profiler::Now()
+{
+  typedef std::chrono::steady_clock Clock;
+  typedef std::chrono::duration<double> Seconds;
+  static const Clock::time_point start = Clock::now();
+  return std::chrono::duration_cast<Seconds>(Clock::now() - start).count();
+}
+
+// -----------------------------------------------------------------------------
+Profiler::ThreadEvents *Profiler::Buffer()
+{
+  static thread_local ThreadEvents *buffer = nullptr;
+  if (buffer == nullptr) {
+    std::lock_guard<std::mutex> lock(_Mutex);
+    buffer = new ThreadEvents;
+    buffer->_Thread = static_cast<int>(_Threads.size());
+    _Threads.push_back(buffer);
+  }
+  return buffer;
+}
+
+// -----------------------------------------------------------------------------
+void Profiler::Record(const string &name, double start, double end)
+{
+  Event event;
+  event._Name  = name;
+  event._Start = start;
+  event._End   = end;
+  Buffer()->_Events.push_back(event);
+}
+
+// -----------------------------------------------------------------------------
+void Profiler::Clear()
+{
+  std::lock_guard<std::mutex> lock(_Mutex);
+  for (size_t i = 0; i < _Threads.size(); ++i) {
+    _Threads[i]->_Events.clear();
+  }
+}
+
+// -----------------------------------------------------------------------------
+void Profiler::PrintSummary(ostream &out) const
+{
+  const bool   msecs = (debug_time_unit == TIME_IN_MILLISECONDS);
+  const double scale = (msecs ? 1e3 : 1.);
+  const char  *unit  = (msecs ? "msecs" : "secs");
+
+  // Reconstruct hierarchy of zones from nesting of time intervals
+  Array<Node>   nodes(1);
+  Array<int>    ncalls(_Threads.size(), 0);
+  Array<double> busy  (_Threads.size(), .0);
+  double tmin = numeric_limits<double>::infinity();
+  double tmax = -tmin;
+
+  for (size_t t = 0; t < _Threads.size(); ++t) {
+    Array<Event> events = _Threads[t]->_Events;
+    sort(events.begin(), events.end(), Precedes);
+    Array<Pair<int, double> > stack; // (node index, end time) of enclosing zones
+    for (size_t i = 0; i < events.size(); ++i) {
+      const Event &event = events[i];
+      const double duration = event._End - event._Start;
+      while (!stack.empty() && event._End > stack.back().second) {
+        stack.pop_back();
+      }
+      const int parent = (stack.empty() ? 0 : stack.back().first);
+      auto it = nodes[parent]._Children.find(event._Name);
+      int child;
+      if (it == nodes[parent]._Children.end()) {
+        child = static_cast<int>(nodes.size());
+        nodes[parent]._Children[event._Name] = child;
+        nodes.push_back(Node(event._Name));
+        nodes[child]._First = event._Start;
+      } else {
+        child = it->second;
+      }
+      Node &node = nodes[child];
+      node._Calls     += 1;
+      node._Inclusive += duration;
+      if (stack.empty()) busy[t] += duration;
+      else nodes[parent]._Nested += duration;
+      stack.push_back(MakePair(child, event._End));
+      tmin = min(tmin, event._Start);
+      tmax = max(tmax, event._End);
+    }
+    ncalls[t] = static_cast<int>(events.size());
+  }
+
+  // Print summary of zones
+  char line[256];
+  out << "Profile of named zones:\n\n";
+  snprintf(line, 256, "%-64s %8s %14s %14s %14s", "Zone", "Calls",
+           "Inclusive", "Exclusive", "Mean");
+  out << line << "\n";
+  snprintf(line, 256, "%-64s %8s %14s %14s %14s", "", "", unit, unit, unit);
+  out << line << "\n";
+  out << string(118, '-') << "\n";
+  PrintNode(out, nodes, 0, -1, scale);
+
+  // Print busy time of each thread
+  const double wall = (tmax > tmin ? tmax - tmin : .0);
+  out << "\n";
+  snprintf(line, 256, "%-8s %8s %14s %14s", "Thread", "Calls", "Busy", "Utilization");
+  out << line << "\n";
+  snprintf(line, 256, "%-8s %8s %14s %14s", "", "", unit, "%");
+  out << line << "\n";
+  out << string(47, '-') << "\n";
+  for (size_t t = 0; t < _Threads.size(); ++t) {
+    if (ncalls[t] == 0) continue;
+    snprintf(line, 256, "%-8d %8d %14.3f %14.1f", _Threads[t]->_Thread, ncalls[t],
+             scale * busy[t], (wall > .0 ? 100. * busy[t] / wall : .0));
+    out << line << "\n";
+  }
+  snprintf(line, 256, "%-8s %8s %14.3f", "Wall", "", scale * wall);
+  out << line << endl;
+}
+
+// -----------------------------------------------------------------------------
+bool Profiler::WriteTrace(const char *fname) const
+{
+  ofstream ofs(fname);
+  if (!ofs) return false;
+  ofs << "{\"traceEvents\":[";
+  bool first = true;
+  for (size_t t = 0; t < _Threads.size(); ++t) {
+    const ThreadEvents &thread = *_Threads[t];
+    if (thread._Events.empty()) continue;
+    if (!first) ofs << ",";
+    ofs << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread._Thread
+        << ",\"args\":{\"name\":\"Thread " << thread._Thread << "\"}}";
+    first = false;
+    for (size_t i = 0; i < thread._Events.size(); ++i) {
+      const Event &event = thread._Events[i];
+      ofs << ",\n{\"name\":\"" << EscapeJSON(event._Name) << "\",\"cat\":\"mirtk\",\"ph\":\"X\""
+          << ",\"ts\":"  << fixed << setprecision(3) << 1e6 * (event._Start - _Epoch)
+          << ",\"dur\":" << fixed << setprecision(3) << 1e6 * (event._End - event._Start)
+          << ",\"pid\":1,\"tid\":" << thread._Thread << "}";
+    }
+  }
+  ofs << "\n]}\n";
+  ofs.close();
+  return !ofs.fail();
+}
+
+// -----------------------------------------------------------------------------
+void Profiler::WriteAtExit(const char *fname)
+{
+  // Instantiate profiler before registering exit handler such that the
+  // singleton is destructed after the exit handler was called
+  Enable(true);
+  if (ProfilerUtils::_TraceFileName.empty()) atexit(WriteProfile);
+  ProfilerUtils::_TraceFileName = fname;
+}
 
 // =============================================================================
 // Profiling output
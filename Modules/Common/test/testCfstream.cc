@@ -0,0 +1,181 @@
+/*
+ * Medical Image Registration ToolKit (MIRTK)
+ *
+ * Copyright 2026 Imperial College London
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include "mirtk/Cfstream.h"
+#include "mirtk/Array.h"
+
+#if MIRTK_Common_WITH_ZLIB
+#  include <zlib.h>
+#endif
+#include <cstdio>
+
+using namespace mirtk;
+
+#if MIRTK_Common_WITH_ZLIB
+
+
+// =============================================================================
+// Helpers
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+/// Write test data of given length to compressed file
+void WriteTestFile(const char *fname, Array<int> &data, long n)
+{
+  data.resize(n);
+  for (long i = 0; i < n; ++i) data[i] = static_cast<int>((i * 7919) % 1000);
+  Cofstream to(fname);
+  EXPECT_TRUE(to.Compressed());
+  EXPECT_TRUE(to.WriteAsString("header\n"));
+  EXPECT_TRUE(to.WriteAsInt(data.data(), n, 16));
+  to.Close();
+}
+
+// =============================================================================
+// Compressed file streams
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+TEST(Cfstream, ReadCompressedBlocks)
+{
+  const char *fname = "testCfstream.gz";
+  const long n = 400000;
+  Array<int> data, read(n);
+  WriteTestFile(fname, data, n);
+  Cifstream from(fname);
+  char header[16];
+  EXPECT_TRUE(from.ReadAsString(header, 16, 0));
+  EXPECT_STREQ("header", header);
+  EXPECT_TRUE(from.ReadAsInt(read.data(), n, 16));
+  EXPECT_TRUE(read == data);
+  // Read range which starts and ends within blocks
+  const long offset = 100003;
+  EXPECT_TRUE(from.ReadAsInt(read.data(), n - offset, 16 + 4 * offset));
+  EXPECT_TRUE(memcmp(read.data(), data.data() + offset, 4 * (n - offset)) == 0);
+  // Continue reading from current position
+  EXPECT_TRUE(from.ReadAsInt(read.data(), 100000, 16));
+  EXPECT_TRUE(from.ReadAsInt(read.data() + 100000, 10));
+  EXPECT_TRUE(memcmp(read.data(), data.data(), 4 * 100010) == 0);
+  // Read past the end of the file
+  EXPECT_FALSE(from.ReadAsInt(read.data(), n, 20));
+  from.Close();
+  remove(fname);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Cfstream, ReadWithGzip)
+{
+  const char *fname = "testCfstream.gz";
+  const long n = 100000;
+  Array<int> data, read(n);
+  WriteTestFile(fname, data, n);
+  gzFile fp = gzopen(fname, "rb");
+  ASSERT_TRUE(fp != nullptr);
+  char header[16];
+  EXPECT_EQ(16, gzread(fp, header, 16));
+  EXPECT_EQ(0, strncmp(header, "header\n", 7));
+  EXPECT_EQ(static_cast<int>(4 * n), gzread(fp, read.data(), static_cast<unsigned int>(4 * n)));
+  EXPECT_EQ(0, gzread(fp, header, 1));
+  gzclose(fp);
+  Cifstream from(fname);
+  EXPECT_TRUE(from.ReadAsInt(read.data(), n, 16));
+  EXPECT_TRUE(read == data);
+  from.Close();
+  remove(fname);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Cfstream, ReadGzipFile)
+{
+  const char *fname = "testCfstream.gz";
+  const long n = 300000;
+  Array<int> data(n), read(n);
+  for (long i = 0; i < n; ++i) data[i] = static_cast<int>(i);
+  gzFile fp = gzopen(fname, "wb");
+  ASSERT_TRUE(fp != nullptr);
+  EXPECT_EQ(static_cast<int>(4 * n), gzwrite(fp, data.data(), static_cast<unsigned int>(4 * n)));
+  gzclose(fp);
+  Cifstream from(fname);
+  from.Swapped(false);
+  EXPECT_TRUE(from.ReadAsInt(read.data(), n, 0));
+  EXPECT_TRUE(read == data);
+  from.Swapped(true);
+  EXPECT_TRUE(from.ReadAsInt(read.data(), n, 0));
+  EXPECT_EQ(0x01000000, read[1]);
+  from.Close();
+  remove(fname);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Cfstream, WriteMultipleBatchesOfBlocks)
+{
+  const char *fname = "testCfstream.gz";
+  const long n = 4500000, gap = 17000000;
+  Array<int> data(n), read(n);
+  for (long i = 0; i < n; ++i) data[i] = static_cast<int>((i * 7919) % 100000);
+  Cofstream to(fname);
+  EXPECT_TRUE(to.WriteAsInt(data.data(), n, 0));
+  EXPECT_TRUE(to.WriteAsInt(data.data(), 10, 4 * n + gap));
+  to.Close();
+  Cifstream from(fname);
+  EXPECT_TRUE(from.ReadAsInt(read.data(), n, 0));
+  EXPECT_TRUE(read == data);
+  EXPECT_TRUE(from.ReadAsInt(read.data(), 10, 4 * n + gap - 40));
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(0,       read[i]);
+  EXPECT_TRUE(from.ReadAsInt(read.data(), 10));
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(data[i], read[i]);
+  from.Close();
+  remove(fname);
+}
+
+// -----------------------------------------------------------------------------
+TEST(Cfstream, ReopenCompressedFile)
+{
+  const char *fname1 = "testCfstream1.gz";
+  const char *fname2 = "testCfstream2.gz";
+  const long n = 200000;
+  Array<int> data1, data2, read(n);
+  WriteTestFile(fname1, data1, n);
+  WriteTestFile(fname2, data2, n / 2);
+  Cifstream from(fname1);
+  EXPECT_TRUE(from.ReadAsInt(read.data(), n, 16));
+  EXPECT_TRUE(read == data1);
+  from.Open(fname2);
+  read.resize(n / 2);
+  EXPECT_TRUE(from.ReadAsInt(read.data(), n / 2, 16));
+  EXPECT_TRUE(read == data2);
+  EXPECT_FALSE(from.ReadAsInt(read.data(), n / 2 + 1, 16));
+  from.Close();
+  remove(fname1);
+  remove(fname2);
+}
+
+#endif // MIRTK_Common_WITH_ZLIB
+
+// =============================================================================
+// Main
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
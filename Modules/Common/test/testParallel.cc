@@ -0,0 +1,168 @@
+/*
+ * Medical Image Registration ToolKit (MIRTK)
+ *
+ * Copyright 2026 Imperial College London
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include "mirtk/Parallel.h"
+#include "mirtk/Array.h"
+
+#include <atomic>
+using namespace mirtk;
+
+
+// =============================================================================
+// Auxiliaries
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+struct CountVisits
+{
+  std::atomic<int> *_Count;
+  int _X, _Y;
+
+  void operator ()(const blocked_range3d<int> &re) const
+  {
+    for (int k = re.pages().begin(); k != re.pages().end(); ++k)
+    for (int j = re.rows ().begin(); j != re.rows ().end(); ++j)
+    for (int i = re.cols ().begin(); i != re.cols ().end(); ++i) {
+      ++_Count[(k * _Y + j) * _X + i];
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+struct SumValues
+{
+  const Array<int> *_Values;
+  long long         _Sum;
+  double            _Real;
+  int               _Last;
+  bool              _Ordered;
+
+  SumValues(const Array<int> *values)
+  :
+    _Values(values), _Sum(0), _Real(0.), _Last(-1), _Ordered(true)
+  {}
+
+  SumValues(SumValues &other, split)
+  :
+    _Values(other._Values), _Sum(0), _Real(0.), _Last(-1), _Ordered(true)
+  {}
+
+  void join(SumValues &other)
+  {
+    if (other._Last != -1 && _Last != -1 && other._Last <= _Last) _Ordered = false;
+    if (other._Last != -1) _Last = other._Last;
+    _Sum     += other._Sum;
+    _Real    += other._Real;
+    _Ordered  = _Ordered && other._Ordered;
+  }
+
+  void operator ()(const blocked_range<int> &re)
+  {
+    for (int i = re.begin(); i != re.end(); ++i) {
+      if (i <= _Last) _Ordered = false;
+      _Sum  += (*_Values)[i];
+      _Real += 1.0 / (1.0 + (*_Values)[i]);
+      _Last  = i;
+    }
+  }
+};
+
+// =============================================================================
+// Tests
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+TEST(Parallel, SplitRange)
+{
+  blocked_range<int> a(0, 11, 2);
+  EXPECT_TRUE(a.is_divisible());
+  blocked_range<int> b(a, split());
+  EXPECT_EQ(0,  a.begin());
+  EXPECT_EQ(5,  a.end());
+  EXPECT_EQ(5,  b.begin());
+  EXPECT_EQ(11, b.end());
+  EXPECT_FALSE(blocked_range<int>(0, 2, 2).is_divisible());
+}
+
+// -----------------------------------------------------------------------------
+TEST(Parallel, ParallelFor)
+{
+  const int X = 37, Y = 21, Z = 13;
+  for (int n = 1; n <= 4; ++n) {
+    task_scheduler_init init(n);
+    Array<std::atomic<int> > count(X * Y * Z);
+    for (size_t i = 0; i < count.size(); ++i) count[i] = 0;
+    CountVisits body;
+    body._Count = count.data();
+    body._X = X, body._Y = Y;
+    parallel_for(blocked_range3d<int>(0, Z, 0, Y, 0, X), body);
+    for (size_t i = 0; i < count.size(); ++i) {
+      ASSERT_EQ(1, count[i]) << "voxel " << i << " using " << n << " threads";
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+TEST(Parallel, ParallelReduce)
+{
+  const int N = 100003;
+  Array<int> values(N);
+  long long expected = 0;
+  for (int i = 0; i < N; ++i) {
+    values[i]  = (i * 7919) % 1013;
+    expected  += values[i];
+  }
+  for (int n = 1; n <= 4; ++n) {
+    task_scheduler_init init(n);
+    SumValues body(&values);
+    parallel_reduce(blocked_range<int>(0, N), body);
+    EXPECT_EQ(expected, body._Sum) << "using " << n << " threads";
+    EXPECT_TRUE(body._Ordered)     << "using " << n << " threads";
+    EXPECT_EQ(N - 1, body._Last);
+  }
+}
+
+// -----------------------------------------------------------------------------
+TEST(Parallel, ParallelDeterministicReduce)
+{
+  const int N = 100003;
+  Array<int> values(N);
+  for (int i = 0; i < N; ++i) values[i] = (i * 7919) % 1013;
+  long long expected = 0;
+  for (int i = 0; i < N; ++i) expected += values[i];
+  double result = 0.;
+  for (int n = 1; n <= 4; ++n) {
+    task_scheduler_init init(n);
+    SumValues body(&values);
+    mirtk::parallel_deterministic_reduce(blocked_range<int>(0, N), body);
+    EXPECT_EQ(expected, body._Sum) << "using " << n << " threads";
+    EXPECT_TRUE(body._Ordered)     << "using " << n << " threads";
+    EXPECT_EQ(N - 1, body._Last);
+    if (n == 1) result = body._Real;
+    else EXPECT_EQ(result, body._Real) << "using " << n << " threads";
+  }
+}
+
+// -----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
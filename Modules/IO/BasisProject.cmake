@@ -69,6 +69,7 @@ basis_project (
     ZLIB     # for [NG]iftiCLib
     #<optional-dependency>
   TEST_DEPENDS
+    GTest
     #<test-dependency>
   OPTIONAL_TEST_DEPENDS
     #<optional-test-dependency>
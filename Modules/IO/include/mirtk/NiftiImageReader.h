@@ -36,6 +36,16 @@ class NiftiImage;
  * This is a class which reads images in NIFTI file format and converts them
  * into images. The NIFTI file format is a file format for 3D and 4D images.
  *
+ * The data of an uncompressed image file whose byte order matches the one of
+ * this machine is mapped into memory instead of being read into a newly
+ * allocated buffer. The returned image then refers to the mapped file data
+ * which is only read from disk when first accessed. Modifications of this
+ * image data are private to the image and not written to the file.
+ *
+ * The background value of a memory-mapped floating point image is not set to
+ * NaN when the image contains NaN values, because this would require reading
+ * all voxels. Disable MemoryMapping when NaN values must mark the background.
+ *
  * \sa http://nifti.nimh.nih.gov/nifti-1/
  */
 class NiftiImageReader : public ImageReader
@@ -45,6 +55,15 @@ class NiftiImageReader : public ImageReader
   /// Path/name of image data file
   mirtkReadOnlyAttributeMacro(string, ImageName);
 
+  /// Whether to map uncompressed image data into memory (default: true)
+  mirtkPublicAttributeMacro(bool, MemoryMapping);
+
+  /// Whether memory-mapped image data is read-only (default: false)
+  ///
+  /// Modifications of the data of a read-only memory-mapped image result in
+  /// a segmentation fault. When not read-only, modified pages are copied.
+  mirtkPublicAttributeMacro(bool, ReadOnly);
+
   /// NIfTI image
   NiftiImage *_Nifti;
 
@@ -68,6 +87,11 @@ public:
   /// Print image file information
   virtual void Print() const;
 
+  /// Read image from file
+  ///
+  /// \returns Newly read image. Must be deleted by caller.
+  virtual BaseImage *Run();
+
 protected:
 
   /// Read header of NIFTI file
@@ -38,6 +38,11 @@ class NiftiImage;
  *
  * This is a class which takes an image as input and produces an image file
  * in NIFTI file format.
+ *
+ * An existing output file which is mapped into memory by NiftiImageReader is
+ * removed before the new file is written, such that images which refer to the
+ * mapped data remain valid. When the output file name is a symbolic link, the
+ * file it refers to is replaced and the link is preserved.
  */
 class NiftiImageWriter : public ImageWriter
 {
@@ -23,6 +23,17 @@
 #include "mirtk/Math.h"
 #include "mirtk/Memory.h"
 #include "mirtk/Matrix.h"
+#include "mirtk/Array.h"
+#include "mirtk/Pair.h"
+
+#include <mutex>
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifndef WINDOWS
+#  include <fcntl.h>
+#  include <unistd.h>
+#  include <sys/mman.h>
+#endif
 
 
 namespace mirtk {
@@ -151,5 +162,113 @@ void NiftiImage::Print()
   if (nim != nullptr) nifti_image_infodump(nim);
 }
 
+// =============================================================================
+// Memory-mapped image files
+// =============================================================================
+
+#ifndef WINDOWS
+
+namespace NiftiImageUtils {
+
+
+/// Device and inode number identifying a file
+typedef Pair<dev_t, ino_t> FileId;
+
+// -----------------------------------------------------------------------------
+/// Identifiers of currently mapped files, one entry per mapping
+///
+/// \note The list is never freed such that mapped images can still be
+///       destroyed during the destruction of static objects at exit.
+Array<FileId> &MappedFiles()
+{
+  static Array<FileId> *files = new Array<FileId>();
+  return *files;
+}
+
+/// Mutex for concurrent access of mapped files list
+std::mutex _MappedFilesMutex;
+
+// -----------------------------------------------------------------------------
+/// Unmaps memory-mapped file when no longer referenced
+struct UnmapFile
+{
+  FileId _File;
+  size_t _Size;
+
+  void operator ()(void *addr) const
+  {
+    munmap(addr, _Size);
+    std::lock_guard<std::mutex> lock(_MappedFilesMutex);
+    Array<FileId> &files = MappedFiles();
+    for (size_t i = 0; i < files.size(); ++i) {
+      if (files[i] == _File) {
+        files.erase(files.begin() + i);
+        break;
+      }
+    }
+  }
+};
+
+
+} // namespace NiftiImageUtils
+using namespace NiftiImageUtils;
+
+// -----------------------------------------------------------------------------
+shared_ptr<void> MapNiftiImageFile(const char *fname, size_t size, bool read_only)
+{
+  shared_ptr<void> memory;
+  if (size == 0) return memory;
+  const int fd = open(fname, O_RDONLY);
+  if (fd == -1) return memory;
+  struct stat info;
+  if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) &&
+      static_cast<size_t>(info.st_size) >= size) {
+    const int prot = (read_only ? PROT_READ : PROT_READ | PROT_WRITE);
+    void *addr = mmap(nullptr, size, prot, MAP_PRIVATE, fd, 0);
+    if (addr != MAP_FAILED) {
+      UnmapFile unmap;
+      unmap._File = MakePair(info.st_dev, info.st_ino);
+      unmap._Size = size;
+      {
+        std::lock_guard<std::mutex> lock(_MappedFilesMutex);
+        MappedFiles().push_back(unmap._File);
+      }
+      memory.reset(addr, unmap);
+    }
+  }
+  close(fd);
+  return memory;
+}
+
+// -----------------------------------------------------------------------------
+bool IsMappedNiftiImageFile(const char *fname)
+{
+  struct stat info;
+  if (stat(fname, &info) != 0) return false;
+  const FileId file = MakePair(info.st_dev, info.st_ino);
+  std::lock_guard<std::mutex> lock(_MappedFilesMutex);
+  const Array<FileId> &files = MappedFiles();
+  for (size_t i = 0; i < files.size(); ++i) {
+    if (files[i] == file) return true;
+  }
+  return false;
+}
+
+#else // WINDOWS
+
+// -----------------------------------------------------------------------------
+shared_ptr<void> MapNiftiImageFile(const char *, size_t, bool)
+{
+  return shared_ptr<void>();
+}
+
+// -----------------------------------------------------------------------------
+bool IsMappedNiftiImageFile(const char *)
+{
+  return false;
+}
+
+#endif // WINDOWS
+
 
 } // namespace mirtk
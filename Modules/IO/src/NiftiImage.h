@@ -31,6 +31,7 @@
 #endif
 
 #include "mirtk/Matrix.h"
+#include "mirtk/Memory.h"
 
 
 namespace mirtk {
@@ -76,6 +77,27 @@ public:
 
 };
 
+// =============================================================================
+// Memory-mapped image files
+// =============================================================================
+
+/// Map uncompressed image data file into memory
+///
+/// The pages of the file are only read when first accessed. Modifications of
+/// a mapping which is not read-only are private to this process, i.e., the
+/// mapped file itself is never modified.
+///
+/// \param[in] fname     Name of image data file.
+/// \param[in] size      Number of bytes to map starting at the file beginning.
+/// \param[in] read_only Whether the mapped memory is read-only.
+///
+/// \returns Address of mapped memory which is unmapped when no longer referenced,
+///          or \c nullptr when the file cannot be mapped into memory.
+shared_ptr<void> MapNiftiImageFile(const char *fname, size_t size, bool read_only = false);
+
+/// Whether the given file is currently mapped into memory by MapNiftiImageFile
+bool IsMappedNiftiImageFile(const char *fname);
+
 
 } // namespace mirtk
 
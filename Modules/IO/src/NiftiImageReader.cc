@@ -27,6 +27,7 @@
 #include "mirtk/Voxel.h"
 #include "mirtk/Path.h"
 #include "mirtk/Matrix.h"
+#include "mirtk/GenericImage.h"
 
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -54,6 +55,15 @@ static inline nifti_dmat33 nifti_dmat44_to_dmat33(const nifti_dmat44 &x)
   return y;
 }
 
+// -----------------------------------------------------------------------------
+/// Create image which refers to memory-mapped image data
+template <class VoxelType>
+BaseImage *NewMappedImage(const ImageAttributes &attr, const shared_ptr<void> &memory, int offset)
+{
+  VoxelType *data = reinterpret_cast<VoxelType *>(reinterpret_cast<char *>(memory.get()) + offset);
+  return new GenericImage<VoxelType>(attr, data, memory);
+}
+
 // =============================================================================
 // Construction/Destruction
 // =============================================================================
@@ -61,6 +71,8 @@ static inline nifti_dmat33 nifti_dmat44_to_dmat33(const nifti_dmat44 &x)
 // -----------------------------------------------------------------------------
 NiftiImageReader::NiftiImageReader()
 :
+  _MemoryMapping(true),
+  _ReadOnly(false),
   _Nifti(new NiftiImage)
 {
 }
@@ -384,6 +396,49 @@ void NiftiImageReader::ReadHeader()
   _Start = static_cast<int>(_Nifti->nim->iname_offset);
 }
 
+// -----------------------------------------------------------------------------
+BaseImage *NiftiImageReader::Run()
+{
+  // Map uncompressed image data which requires no byte swapping into memory
+  if (_MemoryMapping && !_Swapped && !_ReflectX && !_ReflectY && !_ReflectZ &&
+      _Start % _Bytes == 0 && !nifti_is_gzfile(_ImageName.c_str())) {
+    const size_t n = static_cast<size_t>(_Attributes.NumberOfLatticePoints());
+    const size_t size = static_cast<size_t>(_Start) + n * static_cast<size_t>(_Bytes);
+    BaseImage *output = nullptr;
+    shared_ptr<void> memory;
+    switch (_DataType) {
+      case MIRTK_VOXEL_CHAR:
+      case MIRTK_VOXEL_UNSIGNED_CHAR:
+      case MIRTK_VOXEL_SHORT:
+      case MIRTK_VOXEL_UNSIGNED_SHORT:
+      case MIRTK_VOXEL_INT:
+      case MIRTK_VOXEL_FLOAT:
+      case MIRTK_VOXEL_DOUBLE:
+        memory = MapNiftiImageFile(_ImageName.c_str(), size, _ReadOnly);
+        break;
+      default: break;
+    }
+    // Unlike ImageReader::Run, the data of floating point images is not
+    // scanned for NaN values to set the background value, because this
+    // would read the entire file at once
+    if (memory) {
+      switch (_DataType) {
+        case MIRTK_VOXEL_CHAR:           output = NewMappedImage<char          >(_Attributes, memory, _Start); break;
+        case MIRTK_VOXEL_UNSIGNED_CHAR:  output = NewMappedImage<unsigned char >(_Attributes, memory, _Start); break;
+        case MIRTK_VOXEL_SHORT:          output = NewMappedImage<short         >(_Attributes, memory, _Start); break;
+        case MIRTK_VOXEL_UNSIGNED_SHORT: output = NewMappedImage<unsigned short>(_Attributes, memory, _Start); break;
+        case MIRTK_VOXEL_INT:            output = NewMappedImage<int           >(_Attributes, memory, _Start); break;
+        case MIRTK_VOXEL_FLOAT:          output = NewMappedImage<float         >(_Attributes, memory, _Start); break;
+        case MIRTK_VOXEL_DOUBLE:         output = NewMappedImage<double        >(_Attributes, memory, _Start); break;
+        default: break;
+      }
+      return output;
+    }
+  }
+  // Otherwise, read image data into newly allocated memory
+  return ImageReader::Run();
+}
+
 // -----------------------------------------------------------------------------
 void NiftiImageReader::Print() const
 {
@@ -25,6 +25,14 @@
 
 #include "mirtk/Voxel.h"
 
+#include <cstdlib>
+#ifdef WINDOWS
+#  include <io.h>
+#  define unlink _unlink
+#else
+#  include <unistd.h>
+#endif
+
 
 namespace mirtk {
 
@@ -33,6 +41,25 @@ namespace mirtk {
 mirtkAutoRegisterImageWriterMacro(NiftiImageWriter);
 
 
+// -----------------------------------------------------------------------------
+/// Whether file is mapped into memory, in which case a symbolic link is
+/// replaced by the path of the file it refers to
+///
+/// \param[in,out] fname Name of file allocated with malloc.
+static bool ResolveMappedFile(char *&fname)
+{
+  if (fname == nullptr || !IsMappedNiftiImageFile(fname)) return false;
+  #ifndef WINDOWS
+    char *path = realpath(fname, nullptr);
+    if (path) {
+      free(fname);
+      fname = path;
+    }
+  #endif
+  return true;
+}
+
+
 // -----------------------------------------------------------------------------
 Array<string> NiftiImageWriter::Extensions()
 {
@@ -218,6 +245,17 @@ void NiftiImageWriter::Run()
   _Nifti->nim->iname_offset = 352;       // Some nifti versions lose this on the way!
   _Nifti->nim->data         = data;      // Restore data pointer
 
+  // Remove existing files which are mapped into memory, e.g., because the
+  // input image was read from the file that is now being overwritten.
+  // The mapped data remains valid until unmapped, whereas truncating and
+  // writing the file in place would modify or invalidate the mapped data.
+  // When the output is a symbolic link, the file it refers to is replaced
+  // instead such that the link is preserved.
+  const bool hdr_mapped = ResolveMappedFile(_Nifti->nim->fname);
+  const bool img_mapped = ResolveMappedFile(_Nifti->nim->iname);
+  if (hdr_mapped) unlink(_Nifti->nim->fname);
+  if (img_mapped) unlink(_Nifti->nim->iname);
+
   // Write hdr and data
   nifti_image_write(_Nifti->nim);
 
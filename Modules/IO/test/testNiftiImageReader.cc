@@ -0,0 +1,198 @@
+/*
+ * Medical Image Registration ToolKit (MIRTK)
+ *
+ * Copyright 2026 Imperial College London
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include "mirtk/NiftiImageReader.h"
+#include "mirtk/NiftiImageWriter.h"
+
+#include "mirtk/Memory.h"
+#include "mirtk/GenericImage.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#ifndef WINDOWS
+#  include <unistd.h>
+#  include <sys/stat.h>
+#endif
+
+using namespace mirtk;
+
+// ===========================================================================
+// Helper
+// ===========================================================================
+
+// ---------------------------------------------------------------------------
+/// Create 4D test image with distinct voxel values
+template <class VoxelType>
+GenericImage<VoxelType> make_image(double offset = .0)
+{
+  ImageAttributes attr(17, 13, 5, 1.5, 1.25, 2.0);
+  attr._t = 2;
+  attr._xorigin = 3.0, attr._yorigin = -7.0, attr._zorigin = 1.5;
+  GenericImage<VoxelType> image(attr);
+  for (int idx = 0; idx < image.NumberOfVoxels(); ++idx) {
+    image.PutAsDouble(idx, offset + .5 * (idx % 1000));
+  }
+  return image;
+}
+
+// ---------------------------------------------------------------------------
+/// Write image to NIfTI file
+void write_image(const BaseImage &image, const char *fname)
+{
+  NiftiImageWriter writer;
+  writer.Input(&image);
+  writer.FileName(fname);
+  writer.Run();
+}
+
+// ---------------------------------------------------------------------------
+/// Read image from NIfTI file
+unique_ptr<BaseImage> read_image(const char *fname, bool mapping)
+{
+  NiftiImageReader reader;
+  reader.MemoryMapping(mapping);
+  reader.FileName(fname);
+  reader.Initialize();
+  return unique_ptr<BaseImage>(reader.Run());
+}
+
+// ---------------------------------------------------------------------------
+/// Read file content
+string read_file(const char *fname)
+{
+  std::ifstream ifs(fname, std::ios::binary);
+  return string(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+}
+
+// ---------------------------------------------------------------------------
+/// Compare image attributes and voxel values
+void expect_equal_images(const BaseImage &expected, const BaseImage &actual)
+{
+  EXPECT_EQ(expected.GetDataType(), actual.GetDataType());
+  ASSERT_TRUE(expected.Attributes() == actual.Attributes());
+  int ndiff = 0;
+  for (int idx = 0; idx < expected.NumberOfVoxels(); ++idx) {
+    if (expected.GetAsDouble(idx) != actual.GetAsDouble(idx)) ++ndiff;
+  }
+  EXPECT_EQ(0, ndiff);
+}
+
+// ===========================================================================
+// Tests
+// ===========================================================================
+
+// ---------------------------------------------------------------------------
+TEST(NiftiImageReader, MappedReadMatchesBufferedRead)
+{
+  const char *fname = "testNiftiImageReader_MappedRead.nii";
+  GenericImage<short> grey = make_image<short>();
+  write_image(grey, fname);
+  unique_ptr<BaseImage> buffered = read_image(fname, false);
+  unique_ptr<BaseImage> mapped   = read_image(fname, true);
+  expect_equal_images(*buffered, *mapped);
+  expect_equal_images(grey,      *mapped);
+  GenericImage<float> real = make_image<float>(.25);
+  write_image(real, fname);
+  buffered = read_image(fname, false);
+  mapped   = read_image(fname, true);
+  expect_equal_images(*buffered, *mapped);
+  expect_equal_images(real,      *mapped);
+  mapped.reset();
+  remove(fname);
+}
+
+// ---------------------------------------------------------------------------
+TEST(NiftiImageReader, MappedImageEditLeavesFileUnchanged)
+{
+  const char *fname = "testNiftiImageReader_CopyOnWrite.nii";
+  GenericImage<float> image = make_image<float>();
+  write_image(image, fname);
+  const string content = read_file(fname);
+  unique_ptr<BaseImage> mapped = read_image(fname, true);
+  for (int idx = 0; idx < mapped->NumberOfVoxels(); ++idx) {
+    mapped->PutAsDouble(idx, -1.0);
+  }
+  EXPECT_EQ(-1.0, mapped->GetAsDouble(0));
+  EXPECT_TRUE(read_file(fname) == content);
+  expect_equal_images(image, *read_image(fname, true));
+  mapped.reset();
+  remove(fname);
+}
+
+// ---------------------------------------------------------------------------
+TEST(NiftiImageReader, WriterOverwritesMappedFile)
+{
+  const char *fname = "testNiftiImageReader_Overwrite.nii";
+  GenericImage<float> image1 = make_image<float>(1.0);
+  GenericImage<float> image2 = make_image<float>(2.0);
+  write_image(image1, fname);
+  unique_ptr<BaseImage> mapped = read_image(fname, true);
+  write_image(image2, fname);
+  // Mapped data of the previous file remains valid and unchanged
+  expect_equal_images(image1, *mapped);
+  // File contains new image
+  expect_equal_images(image2, *read_image(fname, false));
+  // Image can be written to the file it was read from
+  write_image(*mapped, fname);
+  expect_equal_images(image1, *read_image(fname, false));
+  mapped.reset();
+  remove(fname);
+}
+
+#ifndef WINDOWS
+
+// ---------------------------------------------------------------------------
+TEST(NiftiImageReader, WriterOverwritesMappedFileThroughSymbolicLink)
+{
+  const char *fname = "testNiftiImageReader_Target.nii";
+  const char *lname = "testNiftiImageReader_Link.nii";
+  GenericImage<float> image1 = make_image<float>(1.0);
+  GenericImage<float> image2 = make_image<float>(2.0);
+  write_image(image1, fname);
+  unlink(lname);
+  ASSERT_EQ(0, symlink(fname, lname));
+  unique_ptr<BaseImage> mapped = read_image(lname, true);
+  write_image(image2, lname);
+  // Link is preserved and refers to the new file
+  struct stat info;
+  ASSERT_EQ(0, lstat(lname, &info));
+  EXPECT_TRUE(S_ISLNK(info.st_mode));
+  expect_equal_images(image2, *read_image(fname, false));
+  expect_equal_images(image2, *read_image(lname, false));
+  // Mapped data of the previous file remains valid and unchanged
+  expect_equal_images(image1, *mapped);
+  mapped.reset();
+  unlink(lname);
+  remove(fname);
+}
+
+#endif // WINDOWS
+
+// ===========================================================================
+// Main
+// ===========================================================================
+
+// ---------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -23,7 +23,7 @@
 #include "mirtk/ImageToImage.h"
 
 #include "mirtk/Array.h"
-#include "mirtk/OrderedSet.h"
+#include "mirtk/Vector3D.h"
 #include "mirtk/NeighborhoodOffsets.h"
 
 
@@ -44,6 +44,11 @@ enum ConnectedComponentsOrdering
  *
  * The components are sorted by decreasing size, i.e., the first
  * component is the largest connected component.
+ *
+ * The components are labelled by a two-pass union-find algorithm. Blocks of
+ * image rows are first labelled in parallel, after which the equivalences
+ * of voxels at the block boundaries are merged. When no ordering is requested,
+ * components are numbered in raster scan order of their first voxel.
  */
 template <class TVoxel = GreyPixel>
 class ConnectedComponents : public ImageToImage<TVoxel>
@@ -61,15 +66,18 @@ protected:
   /// What connectivity to assume when running the filter.
   mirtkPublicAttributeMacro(ConnectivityType, Connectivity);
 
-  /// List of voxel offsets of the neighborhood
-  mirtkAttributeMacro(NeighborhoodOffsets, Offsets);
-
   /// Number of connected components
   mirtkReadOnlyAttributeMacro(int, NumberOfComponents);
 
   /// Sizes of connected components
   mirtkReadOnlyAttributeMacro(Array<int>, ComponentSize);
 
+  /// Minimum voxel indices of axis-aligned bounding boxes of components
+  mirtkReadOnlyAttributeMacro(Array<Vector3D<int> >, ComponentBoundsMin);
+
+  /// Maximum voxel indices of axis-aligned bounding boxes of components
+  mirtkReadOnlyAttributeMacro(Array<Vector3D<int> >, ComponentBoundsMax);
+
   // ---------------------------------------------------------------------------
   // Construction/Destruction
 
@@ -84,7 +92,7 @@ public:
   // ---------------------------------------------------------------------------
   // Execution
 
-  /// Run erosion
+  /// Label connected components
   virtual void Run();
 
   /// Remove specified component from the output image
@@ -22,6 +22,7 @@
 
 #include "mirtk/BSpline.h"
 #include "mirtk/BaseImage.h"
+#include "mirtk/Memory.h"
 #include "mirtk/InterpolateImageFunction.h"
 
 
@@ -71,6 +72,9 @@ protected:
   /// Strides for fast iteration over coefficient image
   int _s2, _s3, _s4;
 
+  /// Coefficients shared with other interpolators of the same input image
+  shared_ptr<BaseImage> _SharedCoefficient;
+
 public:
 
   // ---------------------------------------------------------------------------
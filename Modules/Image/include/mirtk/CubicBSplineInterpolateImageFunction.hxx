@@ -80,22 +80,20 @@ void GenericCubicBSplineInterpolateImageFunction<TImage>
 
   // Initialize coefficient image
   if (coeff && this->Input()->GetDataType() == voxel_info<RealType>::type()) {
+    _SharedCoefficient.reset();
+    _Coefficient.Clear();
     _Coefficient.Initialize(this->Input()->Attributes(),
                             reinterpret_cast<RealType *>(
                             const_cast<void *>(this->Input()->GetDataPointer())));
-  } else {
+  } else if (coeff) {
+    _SharedCoefficient.reset();
     _Coefficient = *(this->Input());
-    if (!coeff) {
-      Real pole;
-      int  unused;
-      SplinePoles(3, &pole, unused);
-      switch (this->NumberOfDimensions()) {
-        case 4:  ConvertToInterpolationCoefficientsT(_Coefficient, &pole, 1);
-        case 3:  ConvertToInterpolationCoefficientsZ(_Coefficient, &pole, 1);
-        default: ConvertToInterpolationCoefficientsY(_Coefficient, &pole, 1);
-                 ConvertToInterpolationCoefficientsX(_Coefficient, &pole, 1);
-      }
-    }
+  } else {
+    // Use coefficients of unmodified input image computed before if possible
+    _SharedCoefficient = SharedCubicBSplineCoefficients<RealType>(this->Input(), this->NumberOfDimensions());
+    CoefficientImage *shared = static_cast<CoefficientImage *>(_SharedCoefficient.get());
+    _Coefficient.Clear();
+    _Coefficient.Initialize(shared->Attributes(), shared->Data());
   }
 
   // Initialize infinite coefficient image (i.e., extrapolator)
@@ -36,6 +36,7 @@ class GenericCubicBSplineInterpolateImageFunction2D
 {
   mirtkObjectMacro(GenericCubicBSplineInterpolateImageFunction2D);
   mirtkGenericInterpolatorTypes(GenericCubicBSplineInterpolateImageFunction);
+  mirtkGenericInterpolatorBatchMacro(GenericCubicBSplineInterpolateImageFunction2D);
 
 public:
 
@@ -36,6 +36,7 @@ class GenericCubicBSplineInterpolateImageFunction3D
 {
   mirtkObjectMacro(GenericCubicBSplineInterpolateImageFunction3D);
   mirtkGenericInterpolatorTypes(GenericCubicBSplineInterpolateImageFunction);
+  mirtkGenericInterpolatorBatchMacro(GenericCubicBSplineInterpolateImageFunction3D);
 
 public:
 
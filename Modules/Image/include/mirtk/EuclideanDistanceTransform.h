@@ -40,17 +40,11 @@ protected:
   /// 2D or 3D distance transform
   Mode _distanceTransformMode;
 
-  /// Calculate the Vornoi diagram
-  int edtVornoiEDT(long *, long);
+  /// Calculate 2D distance transform using 32-bit integer squared distances
+  void edtComputeEDT_2D(const char *, int *, long, long);
 
-  /// Calculate 2D distance transform
-  void edtComputeEDT_2D(char *, long *, long, long);
-
-  /// Calculate 3D distance transform
-  void edtComputeEDT_3D(char *, long *, long, long, long);
-
-  /// Calculate the Vornoi diagram for anisotripic voxel sizes
-  int edtVornoiEDT_anisotropic(VoxelType *, long, double);
+  /// Calculate 3D distance transform using 32-bit integer squared distances
+  void edtComputeEDT_3D(const char *, int *, long, long, long);
 
   /// Calculate 2D distance transform for anisotripic voxel sizes
   void edtComputeEDT_2D_anisotropic(const VoxelType *, VoxelType *, long, long, double, double);
@@ -21,6 +21,7 @@
 #define MIRTK_FastCubicBSplineInterpolateImageFunction_H
 
 #include "mirtk/BaseImage.h"
+#include "mirtk/Memory.h"
 #include "mirtk/InterpolateImageFunction.h"
 
 
@@ -77,6 +78,9 @@ protected:
   /// Strides for fast iteration over coefficient image
   int _s2, _s3, _s4;
 
+  /// Coefficients shared with other interpolators of the same input image
+  shared_ptr<BaseImage> _SharedCoefficient;
+
 public:
 
   // ---------------------------------------------------------------------------
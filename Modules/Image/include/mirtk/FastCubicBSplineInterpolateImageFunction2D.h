@@ -36,6 +36,7 @@ class GenericFastCubicBSplineInterpolateImageFunction2D
 {
   mirtkObjectMacro(GenericFastCubicBSplineInterpolateImageFunction2D);
   mirtkGenericInterpolatorTypes(GenericFastCubicBSplineInterpolateImageFunction);
+  mirtkGenericInterpolatorBatchMacro(GenericFastCubicBSplineInterpolateImageFunction2D);
 
 public:
 
@@ -36,6 +36,7 @@ class GenericFastCubicBSplineInterpolateImageFunction3D
 {
   mirtkObjectMacro(GenericFastCubicBSplineInterpolateImageFunction3D);
   mirtkGenericInterpolatorTypes(GenericFastCubicBSplineInterpolateImageFunction);
+  mirtkGenericInterpolatorBatchMacro(GenericFastCubicBSplineInterpolateImageFunction3D);
 
 public:
 
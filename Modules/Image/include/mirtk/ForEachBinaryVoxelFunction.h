@@ -917,7 +917,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, const GenericImage<T2> *
 {
   BinaryForEachVoxelBody_Const<T1, T2, VoxelFunc> body(*im1, *im2, vf);
   blocked_range<int> re(0, im2->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -938,7 +938,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, const GenericImage<T2> *i
   } else {
     BinaryForEachVoxelBody_Const<T1, T2, VoxelFunc> body(*im1, *im2, vf);
     blocked_range<int> re(0, im2->GetNumberOfVoxels() / im2->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -959,9 +959,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -986,7 +986,7 @@ template <class T1, class T2, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, VoxelFunc &vf)
 {
   BinaryForEachVoxelBody_Const<T1, T2, VoxelFunc> body(*im1, *im2, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1003,7 +1003,7 @@ template <class T1, class T2, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, VoxelFunc &vf)
 {
   BinaryForEachVoxelBody_Const<T1, T2, VoxelFunc> body(*im1, *im2, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1020,7 +1020,7 @@ template <class T1, class T2, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, VoxelFunc &vf)
 {
   BinaryForEachVoxelBody_Const<T1, T2, VoxelFunc> body(*im1, *im2, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1042,7 +1042,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, const GenericImage<T2> &
 {
   BinaryForEachVoxelBody_Const<T1, T2, VoxelFunc> body(im1, im2, vf);
   blocked_range<int> re(0, im2.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1063,7 +1063,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, const GenericImage<T2> &i
   } else {
     BinaryForEachVoxelBody_Const<T1, T2, VoxelFunc> body(im1, im2, vf);
     blocked_range<int> re(0, im2.GetNumberOfVoxels() / im2.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -1084,9 +1084,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -1111,7 +1111,7 @@ template <class T1, class T2, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, VoxelFunc &vf)
 {
   BinaryForEachVoxelBody_Const<T1, T2, VoxelFunc> body(im1, im2, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1128,7 +1128,7 @@ template <class T1, class T2, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, VoxelFunc &vf)
 {
   BinaryForEachVoxelBody_Const<T1, T2, VoxelFunc> body(im1, im2, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1145,7 +1145,7 @@ template <class T1, class T2, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, VoxelFunc &vf)
 {
   BinaryForEachVoxelBody_Const<T1, T2, VoxelFunc> body(im1, im2, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1172,7 +1172,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, const GenericImage<T2>
   BinaryForEachVoxelIfBody_Const<T1, T2, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, vf, of);
   blocked_range<int> re(0, im2->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1214,7 +1214,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, const GenericImage<T2>
     BinaryForEachVoxelIfBody_Const<T1, T2, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, vf, of);
     blocked_range<int> re(0, im2->GetNumberOfVoxels() / im2->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -1255,9 +1255,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -1300,7 +1300,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   BinaryForEachVoxelIfBody_Const<T1, T2, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1338,7 +1338,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   BinaryForEachVoxelIfBody_Const<T1, T2, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1376,7 +1376,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   BinaryForEachVoxelIfBody_Const<T1, T2, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1419,7 +1419,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, const GenericImage<T2>
   BinaryForEachVoxelIfBody_Const<T1, T2, VoxelFunc, OutsideFunc, Domain> body(im1, im2, vf, of);
   blocked_range<int> re(0, im2.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1461,7 +1461,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, const GenericImage<T2>
     BinaryForEachVoxelIfBody_Const<T1, T2, VoxelFunc, OutsideFunc, Domain> body(im1, im2, vf, of);
     blocked_range<int> re(0, im2.GetNumberOfVoxels() / im2.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -1502,9 +1502,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -1547,7 +1547,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   BinaryForEachVoxelIfBody_Const<T1, T2, VoxelFunc, OutsideFunc, Domain> body(im1, im2, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1585,7 +1585,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   BinaryForEachVoxelIfBody_Const<T1, T2, VoxelFunc, OutsideFunc, Domain> body(im1, im2, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1623,7 +1623,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   BinaryForEachVoxelIfBody_Const<T1, T2, VoxelFunc, OutsideFunc, Domain> body(im1, im2, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -2527,7 +2527,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, GenericImage<T2> *im2, V
 {
   BinaryForEachVoxelBody_1Const<T1, T2, VoxelFunc> body(*im1, *im2, vf);
   blocked_range<int> re(0, im2->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2548,7 +2548,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, GenericImage<T2> *im2, Vo
   } else {
     BinaryForEachVoxelBody_1Const<T1, T2, VoxelFunc> body(*im1, *im2, vf);
     blocked_range<int> re(0, im2->GetNumberOfVoxels() / im2->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -2569,9 +2569,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -2596,7 +2596,7 @@ template <class T1, class T2, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, GenericImage<T2> *im2, VoxelFunc &vf)
 {
   BinaryForEachVoxelBody_1Const<T1, T2, VoxelFunc> body(*im1, *im2, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2613,7 +2613,7 @@ template <class T1, class T2, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, GenericImage<T2> *im2, VoxelFunc &vf)
 {
   BinaryForEachVoxelBody_1Const<T1, T2, VoxelFunc> body(*im1, *im2, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2630,7 +2630,7 @@ template <class T1, class T2, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, GenericImage<T2> *im2, VoxelFunc &vf)
 {
   BinaryForEachVoxelBody_1Const<T1, T2, VoxelFunc> body(*im1, *im2, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2652,7 +2652,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, GenericImage<T2> &im2, V
 {
   BinaryForEachVoxelBody_1Const<T1, T2, VoxelFunc> body(im1, im2, vf);
   blocked_range<int> re(0, im2.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2673,7 +2673,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, GenericImage<T2> &im2, Vo
   } else {
     BinaryForEachVoxelBody_1Const<T1, T2, VoxelFunc> body(im1, im2, vf);
     blocked_range<int> re(0, im2.GetNumberOfVoxels() / im2.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -2694,9 +2694,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -2721,7 +2721,7 @@ template <class T1, class T2, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, GenericImage<T2> &im2, VoxelFunc &vf)
 {
   BinaryForEachVoxelBody_1Const<T1, T2, VoxelFunc> body(im1, im2, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2738,7 +2738,7 @@ template <class T1, class T2, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, GenericImage<T2> &im2, VoxelFunc &vf)
 {
   BinaryForEachVoxelBody_1Const<T1, T2, VoxelFunc> body(im1, im2, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2755,7 +2755,7 @@ template <class T1, class T2, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, GenericImage<T2> &im2, VoxelFunc &vf)
 {
   BinaryForEachVoxelBody_1Const<T1, T2, VoxelFunc> body(im1, im2, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2782,7 +2782,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, GenericImage<T2> *im2,
   BinaryForEachVoxelIfBody_1Const<T1, T2, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, vf, of);
   blocked_range<int> re(0, im2->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -2824,7 +2824,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, GenericImage<T2> *im2,
     BinaryForEachVoxelIfBody_1Const<T1, T2, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, vf, of);
     blocked_range<int> re(0, im2->GetNumberOfVoxels() / im2->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -2865,9 +2865,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -2910,7 +2910,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   BinaryForEachVoxelIfBody_1Const<T1, T2, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -2948,7 +2948,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   BinaryForEachVoxelIfBody_1Const<T1, T2, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -2986,7 +2986,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   BinaryForEachVoxelIfBody_1Const<T1, T2, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3029,7 +3029,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, GenericImage<T2> &im2,
   BinaryForEachVoxelIfBody_1Const<T1, T2, VoxelFunc, OutsideFunc, Domain> body(im1, im2, vf, of);
   blocked_range<int> re(0, im2.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3071,7 +3071,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, GenericImage<T2> &im2,
     BinaryForEachVoxelIfBody_1Const<T1, T2, VoxelFunc, OutsideFunc, Domain> body(im1, im2, vf, of);
     blocked_range<int> re(0, im2.GetNumberOfVoxels() / im2.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -3112,9 +3112,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -3157,7 +3157,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   BinaryForEachVoxelIfBody_1Const<T1, T2, VoxelFunc, OutsideFunc, Domain> body(im1, im2, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3195,7 +3195,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   BinaryForEachVoxelIfBody_1Const<T1, T2, VoxelFunc, OutsideFunc, Domain> body(im1, im2, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3233,7 +3233,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   BinaryForEachVoxelIfBody_1Const<T1, T2, VoxelFunc, OutsideFunc, Domain> body(im1, im2, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4137,7 +4137,7 @@ void ParallelForEachScalar(GenericImage<T1> *im1, GenericImage<T2> *im2, VoxelFu
 {
   BinaryForEachVoxelBody<T1, T2, VoxelFunc> body(*im1, *im2, vf);
   blocked_range<int> re(0, im2->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4158,7 +4158,7 @@ void ParallelForEachVoxel(GenericImage<T1> *im1, GenericImage<T2> *im2, VoxelFun
   } else {
     BinaryForEachVoxelBody<T1, T2, VoxelFunc> body(*im1, *im2, vf);
     blocked_range<int> re(0, im2->GetNumberOfVoxels() / im2->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -4179,9 +4179,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, GenericImage<T1> *im1, Ge
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -4206,7 +4206,7 @@ template <class T1, class T2, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, GenericImage<T1> *im1, GenericImage<T2> *im2, VoxelFunc &vf)
 {
   BinaryForEachVoxelBody<T1, T2, VoxelFunc> body(*im1, *im2, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4223,7 +4223,7 @@ template <class T1, class T2, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, GenericImage<T1> *im1, GenericImage<T2> *im2, VoxelFunc &vf)
 {
   BinaryForEachVoxelBody<T1, T2, VoxelFunc> body(*im1, *im2, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4240,7 +4240,7 @@ template <class T1, class T2, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, GenericImage<T1> *im1, GenericImage<T2> *im2, VoxelFunc &vf)
 {
   BinaryForEachVoxelBody<T1, T2, VoxelFunc> body(*im1, *im2, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4262,7 +4262,7 @@ void ParallelForEachScalar(GenericImage<T1> &im1, GenericImage<T2> &im2, VoxelFu
 {
   BinaryForEachVoxelBody<T1, T2, VoxelFunc> body(im1, im2, vf);
   blocked_range<int> re(0, im2.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4283,7 +4283,7 @@ void ParallelForEachVoxel(GenericImage<T1> &im1, GenericImage<T2> &im2, VoxelFun
   } else {
     BinaryForEachVoxelBody<T1, T2, VoxelFunc> body(im1, im2, vf);
     blocked_range<int> re(0, im2.GetNumberOfVoxels() / im2.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -4304,9 +4304,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, GenericImage<T1> &im1, Ge
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -4331,7 +4331,7 @@ template <class T1, class T2, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, GenericImage<T1> &im1, GenericImage<T2> &im2, VoxelFunc &vf)
 {
   BinaryForEachVoxelBody<T1, T2, VoxelFunc> body(im1, im2, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4348,7 +4348,7 @@ template <class T1, class T2, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, GenericImage<T1> &im1, GenericImage<T2> &im2, VoxelFunc &vf)
 {
   BinaryForEachVoxelBody<T1, T2, VoxelFunc> body(im1, im2, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4365,7 +4365,7 @@ template <class T1, class T2, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, GenericImage<T1> &im1, GenericImage<T2> &im2, VoxelFunc &vf)
 {
   BinaryForEachVoxelBody<T1, T2, VoxelFunc> body(im1, im2, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4392,7 +4392,7 @@ void ParallelForEachScalarIf(GenericImage<T1> *im1, GenericImage<T2> *im2, Voxel
   BinaryForEachVoxelIfBody<T1, T2, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, vf, of);
   blocked_range<int> re(0, im2->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4434,7 +4434,7 @@ void ParallelForEachVoxelIf(GenericImage<T1> *im1, GenericImage<T2> *im2, VoxelF
     BinaryForEachVoxelIfBody<T1, T2, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, vf, of);
     blocked_range<int> re(0, im2->GetNumberOfVoxels() / im2->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -4475,9 +4475,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, GenericImage<T1> *im1,
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -4520,7 +4520,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, GenericImage<T1> *im1,
 {
   BinaryForEachVoxelIfBody<T1, T2, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4558,7 +4558,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, GenericImage<T1> *im
 {
   BinaryForEachVoxelIfBody<T1, T2, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4596,7 +4596,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, GenericImage<T1> *im
 {
   BinaryForEachVoxelIfBody<T1, T2, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4639,7 +4639,7 @@ void ParallelForEachScalarIf(GenericImage<T1> &im1, GenericImage<T2> &im2, Voxel
   BinaryForEachVoxelIfBody<T1, T2, VoxelFunc, OutsideFunc, Domain> body(im1, im2, vf, of);
   blocked_range<int> re(0, im2.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4681,7 +4681,7 @@ void ParallelForEachVoxelIf(GenericImage<T1> &im1, GenericImage<T2> &im2, VoxelF
     BinaryForEachVoxelIfBody<T1, T2, VoxelFunc, OutsideFunc, Domain> body(im1, im2, vf, of);
     blocked_range<int> re(0, im2.GetNumberOfVoxels() / im2.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -4722,9 +4722,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, GenericImage<T1> &im1,
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -4767,7 +4767,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, GenericImage<T1> &im1,
 {
   BinaryForEachVoxelIfBody<T1, T2, VoxelFunc, OutsideFunc, Domain> body(im1, im2, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4805,7 +4805,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, GenericImage<T1> &im
 {
   BinaryForEachVoxelIfBody<T1, T2, VoxelFunc, OutsideFunc, Domain> body(im1, im2, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4843,7 +4843,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, GenericImage<T1> &im
 {
   BinaryForEachVoxelIfBody<T1, T2, VoxelFunc, OutsideFunc, Domain> body(im1, im2, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1001,7 +1001,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, const GenericImage<T2> *
 {
   NonaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
   blocked_range<int> re(0, im9->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1022,7 +1022,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, const GenericImage<T2> *i
   } else {
     NonaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
     blocked_range<int> re(0, im9->GetNumberOfVoxels() / im9->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -1043,9 +1043,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -1070,7 +1070,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, const GenericImage<T6> *im6, const GenericImage<T7> *im7, const GenericImage<T8> *im8, const GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1087,7 +1087,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, const GenericImage<T6> *im6, const GenericImage<T7> *im7, const GenericImage<T8> *im8, const GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1104,7 +1104,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, const GenericImage<T6> *im6, const GenericImage<T7> *im7, const GenericImage<T8> *im8, const GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1126,7 +1126,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, const GenericImage<T2> &
 {
   NonaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
   blocked_range<int> re(0, im9.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1147,7 +1147,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, const GenericImage<T2> &i
   } else {
     NonaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
     blocked_range<int> re(0, im9.GetNumberOfVoxels() / im9.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -1168,9 +1168,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -1195,7 +1195,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, const GenericImage<T6> &im6, const GenericImage<T7> &im7, const GenericImage<T8> &im8, const GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1212,7 +1212,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, const GenericImage<T6> &im6, const GenericImage<T7> &im7, const GenericImage<T8> &im8, const GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1229,7 +1229,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, const GenericImage<T6> &im6, const GenericImage<T7> &im7, const GenericImage<T8> &im8, const GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1256,7 +1256,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, const GenericImage<T2>
   NonaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   blocked_range<int> re(0, im9->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1298,7 +1298,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, const GenericImage<T2>
     NonaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
     blocked_range<int> re(0, im9->GetNumberOfVoxels() / im9->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -1339,9 +1339,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -1384,7 +1384,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   NonaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1422,7 +1422,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1460,7 +1460,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1503,7 +1503,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, const GenericImage<T2>
   NonaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   blocked_range<int> re(0, im9.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1545,7 +1545,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, const GenericImage<T2>
     NonaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
     blocked_range<int> re(0, im9.GetNumberOfVoxels() / im9.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -1586,9 +1586,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -1631,7 +1631,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   NonaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1669,7 +1669,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1707,7 +1707,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -2695,7 +2695,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, const GenericImage<T2> *
 {
   NonaryForEachVoxelBody_8Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
   blocked_range<int> re(0, im9->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2716,7 +2716,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, const GenericImage<T2> *i
   } else {
     NonaryForEachVoxelBody_8Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
     blocked_range<int> re(0, im9->GetNumberOfVoxels() / im9->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -2737,9 +2737,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -2764,7 +2764,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, const GenericImage<T6> *im6, const GenericImage<T7> *im7, const GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_8Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2781,7 +2781,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, const GenericImage<T6> *im6, const GenericImage<T7> *im7, const GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_8Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2798,7 +2798,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, const GenericImage<T6> *im6, const GenericImage<T7> *im7, const GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_8Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2820,7 +2820,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, const GenericImage<T2> &
 {
   NonaryForEachVoxelBody_8Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
   blocked_range<int> re(0, im9.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2841,7 +2841,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, const GenericImage<T2> &i
   } else {
     NonaryForEachVoxelBody_8Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
     blocked_range<int> re(0, im9.GetNumberOfVoxels() / im9.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -2862,9 +2862,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -2889,7 +2889,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, const GenericImage<T6> &im6, const GenericImage<T7> &im7, const GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_8Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2906,7 +2906,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, const GenericImage<T6> &im6, const GenericImage<T7> &im7, const GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_8Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2923,7 +2923,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, const GenericImage<T6> &im6, const GenericImage<T7> &im7, const GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_8Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2950,7 +2950,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, const GenericImage<T2>
   NonaryForEachVoxelIfBody_8Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   blocked_range<int> re(0, im9->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -2992,7 +2992,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, const GenericImage<T2>
     NonaryForEachVoxelIfBody_8Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
     blocked_range<int> re(0, im9->GetNumberOfVoxels() / im9->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -3033,9 +3033,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -3078,7 +3078,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   NonaryForEachVoxelIfBody_8Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3116,7 +3116,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_8Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3154,7 +3154,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_8Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3197,7 +3197,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, const GenericImage<T2>
   NonaryForEachVoxelIfBody_8Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   blocked_range<int> re(0, im9.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3239,7 +3239,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, const GenericImage<T2>
     NonaryForEachVoxelIfBody_8Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
     blocked_range<int> re(0, im9.GetNumberOfVoxels() / im9.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -3280,9 +3280,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -3325,7 +3325,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   NonaryForEachVoxelIfBody_8Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3363,7 +3363,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_8Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3401,7 +3401,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_8Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4389,7 +4389,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, const GenericImage<T2> *
 {
   NonaryForEachVoxelBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
   blocked_range<int> re(0, im9->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4410,7 +4410,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, const GenericImage<T2> *i
   } else {
     NonaryForEachVoxelBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
     blocked_range<int> re(0, im9->GetNumberOfVoxels() / im9->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -4431,9 +4431,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -4458,7 +4458,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, const GenericImage<T6> *im6, const GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4475,7 +4475,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, const GenericImage<T6> *im6, const GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4492,7 +4492,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, const GenericImage<T6> *im6, const GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4514,7 +4514,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, const GenericImage<T2> &
 {
   NonaryForEachVoxelBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
   blocked_range<int> re(0, im9.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4535,7 +4535,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, const GenericImage<T2> &i
   } else {
     NonaryForEachVoxelBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
     blocked_range<int> re(0, im9.GetNumberOfVoxels() / im9.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -4556,9 +4556,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -4583,7 +4583,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, const GenericImage<T6> &im6, const GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4600,7 +4600,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, const GenericImage<T6> &im6, const GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4617,7 +4617,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, const GenericImage<T6> &im6, const GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4644,7 +4644,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, const GenericImage<T2>
   NonaryForEachVoxelIfBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   blocked_range<int> re(0, im9->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4686,7 +4686,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, const GenericImage<T2>
     NonaryForEachVoxelIfBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
     blocked_range<int> re(0, im9->GetNumberOfVoxels() / im9->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -4727,9 +4727,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -4772,7 +4772,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   NonaryForEachVoxelIfBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4810,7 +4810,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4848,7 +4848,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4891,7 +4891,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, const GenericImage<T2>
   NonaryForEachVoxelIfBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   blocked_range<int> re(0, im9.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4933,7 +4933,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, const GenericImage<T2>
     NonaryForEachVoxelIfBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
     blocked_range<int> re(0, im9.GetNumberOfVoxels() / im9.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -4974,9 +4974,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -5019,7 +5019,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   NonaryForEachVoxelIfBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -5057,7 +5057,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -5095,7 +5095,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6083,7 +6083,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, const GenericImage<T2> *
 {
   NonaryForEachVoxelBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
   blocked_range<int> re(0, im9->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6104,7 +6104,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, const GenericImage<T2> *i
   } else {
     NonaryForEachVoxelBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
     blocked_range<int> re(0, im9->GetNumberOfVoxels() / im9->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -6125,9 +6125,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -6152,7 +6152,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, const GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6169,7 +6169,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, const GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6186,7 +6186,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, const GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6208,7 +6208,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, const GenericImage<T2> &
 {
   NonaryForEachVoxelBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
   blocked_range<int> re(0, im9.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6229,7 +6229,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, const GenericImage<T2> &i
   } else {
     NonaryForEachVoxelBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
     blocked_range<int> re(0, im9.GetNumberOfVoxels() / im9.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -6250,9 +6250,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -6277,7 +6277,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, const GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6294,7 +6294,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, const GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6311,7 +6311,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, const GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6338,7 +6338,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, const GenericImage<T2>
   NonaryForEachVoxelIfBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   blocked_range<int> re(0, im9->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6380,7 +6380,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, const GenericImage<T2>
     NonaryForEachVoxelIfBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
     blocked_range<int> re(0, im9->GetNumberOfVoxels() / im9->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -6421,9 +6421,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -6466,7 +6466,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   NonaryForEachVoxelIfBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6504,7 +6504,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6542,7 +6542,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6585,7 +6585,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, const GenericImage<T2>
   NonaryForEachVoxelIfBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   blocked_range<int> re(0, im9.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6627,7 +6627,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, const GenericImage<T2>
     NonaryForEachVoxelIfBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
     blocked_range<int> re(0, im9.GetNumberOfVoxels() / im9.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -6668,9 +6668,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -6713,7 +6713,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   NonaryForEachVoxelIfBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6751,7 +6751,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6789,7 +6789,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -7777,7 +7777,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, const GenericImage<T2> *
 {
   NonaryForEachVoxelBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
   blocked_range<int> re(0, im9->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7798,7 +7798,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, const GenericImage<T2> *i
   } else {
     NonaryForEachVoxelBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
     blocked_range<int> re(0, im9->GetNumberOfVoxels() / im9->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -7819,9 +7819,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -7846,7 +7846,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7863,7 +7863,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7880,7 +7880,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7902,7 +7902,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, const GenericImage<T2> &
 {
   NonaryForEachVoxelBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
   blocked_range<int> re(0, im9.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7923,7 +7923,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, const GenericImage<T2> &i
   } else {
     NonaryForEachVoxelBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
     blocked_range<int> re(0, im9.GetNumberOfVoxels() / im9.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -7944,9 +7944,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -7971,7 +7971,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7988,7 +7988,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -8005,7 +8005,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -8032,7 +8032,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, const GenericImage<T2>
   NonaryForEachVoxelIfBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   blocked_range<int> re(0, im9->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -8074,7 +8074,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, const GenericImage<T2>
     NonaryForEachVoxelIfBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
     blocked_range<int> re(0, im9->GetNumberOfVoxels() / im9->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -8115,9 +8115,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -8160,7 +8160,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   NonaryForEachVoxelIfBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -8198,7 +8198,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -8236,7 +8236,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -8279,7 +8279,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, const GenericImage<T2>
   NonaryForEachVoxelIfBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   blocked_range<int> re(0, im9.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -8321,7 +8321,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, const GenericImage<T2>
     NonaryForEachVoxelIfBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
     blocked_range<int> re(0, im9.GetNumberOfVoxels() / im9.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -8362,9 +8362,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -8407,7 +8407,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   NonaryForEachVoxelIfBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -8445,7 +8445,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -8483,7 +8483,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -9471,7 +9471,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, const GenericImage<T2> *
 {
   NonaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
   blocked_range<int> re(0, im9->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9492,7 +9492,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, const GenericImage<T2> *i
   } else {
     NonaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
     blocked_range<int> re(0, im9->GetNumberOfVoxels() / im9->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -9513,9 +9513,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -9540,7 +9540,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9557,7 +9557,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9574,7 +9574,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9596,7 +9596,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, const GenericImage<T2> &
 {
   NonaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
   blocked_range<int> re(0, im9.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9617,7 +9617,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, const GenericImage<T2> &i
   } else {
     NonaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
     blocked_range<int> re(0, im9.GetNumberOfVoxels() / im9.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -9638,9 +9638,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -9665,7 +9665,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9682,7 +9682,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9699,7 +9699,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9726,7 +9726,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, const GenericImage<T2>
   NonaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   blocked_range<int> re(0, im9->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -9768,7 +9768,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, const GenericImage<T2>
     NonaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
     blocked_range<int> re(0, im9->GetNumberOfVoxels() / im9->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -9809,9 +9809,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -9854,7 +9854,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   NonaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -9892,7 +9892,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -9930,7 +9930,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -9973,7 +9973,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, const GenericImage<T2>
   NonaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   blocked_range<int> re(0, im9.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -10015,7 +10015,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, const GenericImage<T2>
     NonaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
     blocked_range<int> re(0, im9.GetNumberOfVoxels() / im9.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -10056,9 +10056,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -10101,7 +10101,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   NonaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -10139,7 +10139,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -10177,7 +10177,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -11165,7 +11165,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, const GenericImage<T2> *
 {
   NonaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
   blocked_range<int> re(0, im9->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -11186,7 +11186,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, const GenericImage<T2> *i
   } else {
     NonaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
     blocked_range<int> re(0, im9->GetNumberOfVoxels() / im9->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -11207,9 +11207,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -11234,7 +11234,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -11251,7 +11251,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -11268,7 +11268,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -11290,7 +11290,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, const GenericImage<T2> &
 {
   NonaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
   blocked_range<int> re(0, im9.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -11311,7 +11311,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, const GenericImage<T2> &i
   } else {
     NonaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
     blocked_range<int> re(0, im9.GetNumberOfVoxels() / im9.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -11332,9 +11332,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -11359,7 +11359,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -11376,7 +11376,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -11393,7 +11393,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -11420,7 +11420,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, const GenericImage<T2>
   NonaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   blocked_range<int> re(0, im9->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -11462,7 +11462,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, const GenericImage<T2>
     NonaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
     blocked_range<int> re(0, im9->GetNumberOfVoxels() / im9->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -11503,9 +11503,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -11548,7 +11548,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   NonaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -11586,7 +11586,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -11624,7 +11624,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -11667,7 +11667,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, const GenericImage<T2>
   NonaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   blocked_range<int> re(0, im9.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -11709,7 +11709,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, const GenericImage<T2>
     NonaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
     blocked_range<int> re(0, im9.GetNumberOfVoxels() / im9.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -11750,9 +11750,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -11795,7 +11795,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   NonaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -11833,7 +11833,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -11871,7 +11871,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -12859,7 +12859,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, const GenericImage<T2> *
 {
   NonaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
   blocked_range<int> re(0, im9->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -12880,7 +12880,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, const GenericImage<T2> *i
   } else {
     NonaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
     blocked_range<int> re(0, im9->GetNumberOfVoxels() / im9->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -12901,9 +12901,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -12928,7 +12928,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -12945,7 +12945,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -12962,7 +12962,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -12984,7 +12984,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, const GenericImage<T2> &
 {
   NonaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
   blocked_range<int> re(0, im9.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -13005,7 +13005,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, const GenericImage<T2> &i
   } else {
     NonaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
     blocked_range<int> re(0, im9.GetNumberOfVoxels() / im9.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -13026,9 +13026,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -13053,7 +13053,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -13070,7 +13070,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -13087,7 +13087,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -13114,7 +13114,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, const GenericImage<T2>
   NonaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   blocked_range<int> re(0, im9->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -13156,7 +13156,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, const GenericImage<T2>
     NonaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
     blocked_range<int> re(0, im9->GetNumberOfVoxels() / im9->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -13197,9 +13197,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -13242,7 +13242,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   NonaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -13280,7 +13280,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -13318,7 +13318,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -13361,7 +13361,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, const GenericImage<T2>
   NonaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   blocked_range<int> re(0, im9.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -13403,7 +13403,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, const GenericImage<T2>
     NonaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
     blocked_range<int> re(0, im9.GetNumberOfVoxels() / im9.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -13444,9 +13444,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -13489,7 +13489,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   NonaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -13527,7 +13527,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -13565,7 +13565,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -14553,7 +14553,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, GenericImage<T2> *im2, G
 {
   NonaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
   blocked_range<int> re(0, im9->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -14574,7 +14574,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, GenericImage<T2> *im2, Ge
   } else {
     NonaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
     blocked_range<int> re(0, im9->GetNumberOfVoxels() / im9->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -14595,9 +14595,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -14622,7 +14622,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -14639,7 +14639,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -14656,7 +14656,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -14678,7 +14678,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, GenericImage<T2> &im2, G
 {
   NonaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
   blocked_range<int> re(0, im9.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -14699,7 +14699,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, GenericImage<T2> &im2, Ge
   } else {
     NonaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
     blocked_range<int> re(0, im9.GetNumberOfVoxels() / im9.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -14720,9 +14720,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -14747,7 +14747,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -14764,7 +14764,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -14781,7 +14781,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -14808,7 +14808,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, GenericImage<T2> *im2,
   NonaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   blocked_range<int> re(0, im9->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -14850,7 +14850,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, GenericImage<T2> *im2,
     NonaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
     blocked_range<int> re(0, im9->GetNumberOfVoxels() / im9->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -14891,9 +14891,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -14936,7 +14936,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   NonaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -14974,7 +14974,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -15012,7 +15012,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -15055,7 +15055,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, GenericImage<T2> &im2,
   NonaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   blocked_range<int> re(0, im9.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -15097,7 +15097,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, GenericImage<T2> &im2,
     NonaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
     blocked_range<int> re(0, im9.GetNumberOfVoxels() / im9.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -15138,9 +15138,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -15183,7 +15183,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   NonaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -15221,7 +15221,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -15259,7 +15259,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   NonaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -16247,7 +16247,7 @@ void ParallelForEachScalar(GenericImage<T1> *im1, GenericImage<T2> *im2, Generic
 {
   NonaryForEachVoxelBody<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
   blocked_range<int> re(0, im9->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -16268,7 +16268,7 @@ void ParallelForEachVoxel(GenericImage<T1> *im1, GenericImage<T2> *im2, GenericI
   } else {
     NonaryForEachVoxelBody<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
     blocked_range<int> re(0, im9->GetNumberOfVoxels() / im9->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -16289,9 +16289,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, GenericImage<T1> *im1, Ge
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -16316,7 +16316,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -16333,7 +16333,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -16350,7 +16350,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, GenericImage<T9> *im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -16372,7 +16372,7 @@ void ParallelForEachScalar(GenericImage<T1> &im1, GenericImage<T2> &im2, Generic
 {
   NonaryForEachVoxelBody<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
   blocked_range<int> re(0, im9.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -16393,7 +16393,7 @@ void ParallelForEachVoxel(GenericImage<T1> &im1, GenericImage<T2> &im2, GenericI
   } else {
     NonaryForEachVoxelBody<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
     blocked_range<int> re(0, im9.GetNumberOfVoxels() / im9.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -16414,9 +16414,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, GenericImage<T1> &im1, Ge
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -16441,7 +16441,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -16458,7 +16458,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -16475,7 +16475,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, GenericImage<T9> &im9, VoxelFunc &vf)
 {
   NonaryForEachVoxelBody<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -16502,7 +16502,7 @@ void ParallelForEachScalarIf(GenericImage<T1> *im1, GenericImage<T2> *im2, Gener
   NonaryForEachVoxelIfBody<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   blocked_range<int> re(0, im9->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -16544,7 +16544,7 @@ void ParallelForEachVoxelIf(GenericImage<T1> *im1, GenericImage<T2> *im2, Generi
     NonaryForEachVoxelIfBody<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
     blocked_range<int> re(0, im9->GetNumberOfVoxels() / im9->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -16585,9 +16585,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, GenericImage<T1> *im1,
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -16630,7 +16630,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, GenericImage<T1> *im1,
 {
   NonaryForEachVoxelIfBody<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -16668,7 +16668,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, GenericImage<T1> *im
 {
   NonaryForEachVoxelIfBody<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -16706,7 +16706,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, GenericImage<T1> *im
 {
   NonaryForEachVoxelIfBody<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, *im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -16749,7 +16749,7 @@ void ParallelForEachScalarIf(GenericImage<T1> &im1, GenericImage<T2> &im2, Gener
   NonaryForEachVoxelIfBody<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   blocked_range<int> re(0, im9.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -16791,7 +16791,7 @@ void ParallelForEachVoxelIf(GenericImage<T1> &im1, GenericImage<T2> &im2, Generi
     NonaryForEachVoxelIfBody<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
     blocked_range<int> re(0, im9.GetNumberOfVoxels() / im9.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -16832,9 +16832,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, GenericImage<T1> &im1,
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -16877,7 +16877,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, GenericImage<T1> &im1,
 {
   NonaryForEachVoxelIfBody<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -16915,7 +16915,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, GenericImage<T1> &im
 {
   NonaryForEachVoxelIfBody<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -16953,7 +16953,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, GenericImage<T1> &im
 {
   NonaryForEachVoxelIfBody<T1, T2, T3, T4, T5, T6, T7, T8, T9, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, im9, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
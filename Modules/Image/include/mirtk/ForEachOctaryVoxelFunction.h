@@ -989,7 +989,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, const GenericImage<T2> *
 {
   OctaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
   blocked_range<int> re(0, im8->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1010,7 +1010,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, const GenericImage<T2> *i
   } else {
     OctaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
     blocked_range<int> re(0, im8->GetNumberOfVoxels() / im8->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -1031,9 +1031,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -1058,7 +1058,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, const GenericImage<T6> *im6, const GenericImage<T7> *im7, const GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1075,7 +1075,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, const GenericImage<T6> *im6, const GenericImage<T7> *im7, const GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1092,7 +1092,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, const GenericImage<T6> *im6, const GenericImage<T7> *im7, const GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1114,7 +1114,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, const GenericImage<T2> &
 {
   OctaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
   blocked_range<int> re(0, im8.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1135,7 +1135,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, const GenericImage<T2> &i
   } else {
     OctaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
     blocked_range<int> re(0, im8.GetNumberOfVoxels() / im8.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -1156,9 +1156,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -1183,7 +1183,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, const GenericImage<T6> &im6, const GenericImage<T7> &im7, const GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1200,7 +1200,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, const GenericImage<T6> &im6, const GenericImage<T7> &im7, const GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1217,7 +1217,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, const GenericImage<T6> &im6, const GenericImage<T7> &im7, const GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1244,7 +1244,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, const GenericImage<T2>
   OctaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   blocked_range<int> re(0, im8->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1286,7 +1286,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, const GenericImage<T2>
     OctaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
     blocked_range<int> re(0, im8->GetNumberOfVoxels() / im8->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -1327,9 +1327,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -1372,7 +1372,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   OctaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1410,7 +1410,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1448,7 +1448,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1491,7 +1491,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, const GenericImage<T2>
   OctaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   blocked_range<int> re(0, im8.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1533,7 +1533,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, const GenericImage<T2>
     OctaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
     blocked_range<int> re(0, im8.GetNumberOfVoxels() / im8.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -1574,9 +1574,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -1619,7 +1619,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   OctaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1657,7 +1657,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1695,7 +1695,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -2671,7 +2671,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, const GenericImage<T2> *
 {
   OctaryForEachVoxelBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
   blocked_range<int> re(0, im8->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2692,7 +2692,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, const GenericImage<T2> *i
   } else {
     OctaryForEachVoxelBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
     blocked_range<int> re(0, im8->GetNumberOfVoxels() / im8->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -2713,9 +2713,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -2740,7 +2740,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, const GenericImage<T6> *im6, const GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2757,7 +2757,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, const GenericImage<T6> *im6, const GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2774,7 +2774,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, const GenericImage<T6> *im6, const GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2796,7 +2796,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, const GenericImage<T2> &
 {
   OctaryForEachVoxelBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
   blocked_range<int> re(0, im8.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2817,7 +2817,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, const GenericImage<T2> &i
   } else {
     OctaryForEachVoxelBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
     blocked_range<int> re(0, im8.GetNumberOfVoxels() / im8.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -2838,9 +2838,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -2865,7 +2865,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, const GenericImage<T6> &im6, const GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2882,7 +2882,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, const GenericImage<T6> &im6, const GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2899,7 +2899,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, const GenericImage<T6> &im6, const GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2926,7 +2926,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, const GenericImage<T2>
   OctaryForEachVoxelIfBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   blocked_range<int> re(0, im8->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -2968,7 +2968,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, const GenericImage<T2>
     OctaryForEachVoxelIfBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
     blocked_range<int> re(0, im8->GetNumberOfVoxels() / im8->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -3009,9 +3009,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -3054,7 +3054,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   OctaryForEachVoxelIfBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3092,7 +3092,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3130,7 +3130,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3173,7 +3173,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, const GenericImage<T2>
   OctaryForEachVoxelIfBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   blocked_range<int> re(0, im8.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3215,7 +3215,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, const GenericImage<T2>
     OctaryForEachVoxelIfBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
     blocked_range<int> re(0, im8.GetNumberOfVoxels() / im8.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -3256,9 +3256,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -3301,7 +3301,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   OctaryForEachVoxelIfBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3339,7 +3339,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3377,7 +3377,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_7Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4353,7 +4353,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, const GenericImage<T2> *
 {
   OctaryForEachVoxelBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
   blocked_range<int> re(0, im8->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4374,7 +4374,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, const GenericImage<T2> *i
   } else {
     OctaryForEachVoxelBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
     blocked_range<int> re(0, im8->GetNumberOfVoxels() / im8->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -4395,9 +4395,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -4422,7 +4422,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, const GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4439,7 +4439,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, const GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4456,7 +4456,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, const GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4478,7 +4478,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, const GenericImage<T2> &
 {
   OctaryForEachVoxelBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
   blocked_range<int> re(0, im8.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4499,7 +4499,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, const GenericImage<T2> &i
   } else {
     OctaryForEachVoxelBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
     blocked_range<int> re(0, im8.GetNumberOfVoxels() / im8.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -4520,9 +4520,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -4547,7 +4547,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, const GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4564,7 +4564,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, const GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4581,7 +4581,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, const GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4608,7 +4608,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, const GenericImage<T2>
   OctaryForEachVoxelIfBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   blocked_range<int> re(0, im8->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4650,7 +4650,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, const GenericImage<T2>
     OctaryForEachVoxelIfBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
     blocked_range<int> re(0, im8->GetNumberOfVoxels() / im8->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -4691,9 +4691,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -4736,7 +4736,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   OctaryForEachVoxelIfBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4774,7 +4774,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4812,7 +4812,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4855,7 +4855,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, const GenericImage<T2>
   OctaryForEachVoxelIfBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   blocked_range<int> re(0, im8.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4897,7 +4897,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, const GenericImage<T2>
     OctaryForEachVoxelIfBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
     blocked_range<int> re(0, im8.GetNumberOfVoxels() / im8.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -4938,9 +4938,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -4983,7 +4983,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   OctaryForEachVoxelIfBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -5021,7 +5021,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -5059,7 +5059,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_6Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6035,7 +6035,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, const GenericImage<T2> *
 {
   OctaryForEachVoxelBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
   blocked_range<int> re(0, im8->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6056,7 +6056,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, const GenericImage<T2> *i
   } else {
     OctaryForEachVoxelBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
     blocked_range<int> re(0, im8->GetNumberOfVoxels() / im8->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -6077,9 +6077,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -6104,7 +6104,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6121,7 +6121,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6138,7 +6138,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6160,7 +6160,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, const GenericImage<T2> &
 {
   OctaryForEachVoxelBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
   blocked_range<int> re(0, im8.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6181,7 +6181,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, const GenericImage<T2> &i
   } else {
     OctaryForEachVoxelBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
     blocked_range<int> re(0, im8.GetNumberOfVoxels() / im8.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -6202,9 +6202,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -6229,7 +6229,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6246,7 +6246,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6263,7 +6263,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6290,7 +6290,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, const GenericImage<T2>
   OctaryForEachVoxelIfBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   blocked_range<int> re(0, im8->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6332,7 +6332,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, const GenericImage<T2>
     OctaryForEachVoxelIfBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
     blocked_range<int> re(0, im8->GetNumberOfVoxels() / im8->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -6373,9 +6373,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -6418,7 +6418,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   OctaryForEachVoxelIfBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6456,7 +6456,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6494,7 +6494,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6537,7 +6537,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, const GenericImage<T2>
   OctaryForEachVoxelIfBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   blocked_range<int> re(0, im8.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6579,7 +6579,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, const GenericImage<T2>
     OctaryForEachVoxelIfBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
     blocked_range<int> re(0, im8.GetNumberOfVoxels() / im8.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -6620,9 +6620,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -6665,7 +6665,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   OctaryForEachVoxelIfBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6703,7 +6703,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6741,7 +6741,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_5Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -7717,7 +7717,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, const GenericImage<T2> *
 {
   OctaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
   blocked_range<int> re(0, im8->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7738,7 +7738,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, const GenericImage<T2> *i
   } else {
     OctaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
     blocked_range<int> re(0, im8->GetNumberOfVoxels() / im8->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -7759,9 +7759,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -7786,7 +7786,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7803,7 +7803,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7820,7 +7820,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7842,7 +7842,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, const GenericImage<T2> &
 {
   OctaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
   blocked_range<int> re(0, im8.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7863,7 +7863,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, const GenericImage<T2> &i
   } else {
     OctaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
     blocked_range<int> re(0, im8.GetNumberOfVoxels() / im8.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -7884,9 +7884,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -7911,7 +7911,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7928,7 +7928,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7945,7 +7945,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7972,7 +7972,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, const GenericImage<T2>
   OctaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   blocked_range<int> re(0, im8->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -8014,7 +8014,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, const GenericImage<T2>
     OctaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
     blocked_range<int> re(0, im8->GetNumberOfVoxels() / im8->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -8055,9 +8055,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -8100,7 +8100,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   OctaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -8138,7 +8138,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -8176,7 +8176,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -8219,7 +8219,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, const GenericImage<T2>
   OctaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   blocked_range<int> re(0, im8.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -8261,7 +8261,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, const GenericImage<T2>
     OctaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
     blocked_range<int> re(0, im8.GetNumberOfVoxels() / im8.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -8302,9 +8302,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -8347,7 +8347,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   OctaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -8385,7 +8385,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -8423,7 +8423,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -9399,7 +9399,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, const GenericImage<T2> *
 {
   OctaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
   blocked_range<int> re(0, im8->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9420,7 +9420,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, const GenericImage<T2> *i
   } else {
     OctaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
     blocked_range<int> re(0, im8->GetNumberOfVoxels() / im8->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -9441,9 +9441,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -9468,7 +9468,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9485,7 +9485,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9502,7 +9502,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9524,7 +9524,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, const GenericImage<T2> &
 {
   OctaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
   blocked_range<int> re(0, im8.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9545,7 +9545,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, const GenericImage<T2> &i
   } else {
     OctaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
     blocked_range<int> re(0, im8.GetNumberOfVoxels() / im8.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -9566,9 +9566,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -9593,7 +9593,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9610,7 +9610,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9627,7 +9627,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9654,7 +9654,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, const GenericImage<T2>
   OctaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   blocked_range<int> re(0, im8->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -9696,7 +9696,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, const GenericImage<T2>
     OctaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
     blocked_range<int> re(0, im8->GetNumberOfVoxels() / im8->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -9737,9 +9737,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -9782,7 +9782,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   OctaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -9820,7 +9820,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -9858,7 +9858,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -9901,7 +9901,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, const GenericImage<T2>
   OctaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   blocked_range<int> re(0, im8.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -9943,7 +9943,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, const GenericImage<T2>
     OctaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
     blocked_range<int> re(0, im8.GetNumberOfVoxels() / im8.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -9984,9 +9984,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -10029,7 +10029,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   OctaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -10067,7 +10067,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -10105,7 +10105,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -11081,7 +11081,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, const GenericImage<T2> *
 {
   OctaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
   blocked_range<int> re(0, im8->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -11102,7 +11102,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, const GenericImage<T2> *i
   } else {
     OctaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
     blocked_range<int> re(0, im8->GetNumberOfVoxels() / im8->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -11123,9 +11123,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -11150,7 +11150,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -11167,7 +11167,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -11184,7 +11184,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -11206,7 +11206,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, const GenericImage<T2> &
 {
   OctaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
   blocked_range<int> re(0, im8.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -11227,7 +11227,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, const GenericImage<T2> &i
   } else {
     OctaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
     blocked_range<int> re(0, im8.GetNumberOfVoxels() / im8.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -11248,9 +11248,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -11275,7 +11275,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -11292,7 +11292,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -11309,7 +11309,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -11336,7 +11336,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, const GenericImage<T2>
   OctaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   blocked_range<int> re(0, im8->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -11378,7 +11378,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, const GenericImage<T2>
     OctaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
     blocked_range<int> re(0, im8->GetNumberOfVoxels() / im8->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -11419,9 +11419,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -11464,7 +11464,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   OctaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -11502,7 +11502,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -11540,7 +11540,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -11583,7 +11583,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, const GenericImage<T2>
   OctaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   blocked_range<int> re(0, im8.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -11625,7 +11625,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, const GenericImage<T2>
     OctaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
     blocked_range<int> re(0, im8.GetNumberOfVoxels() / im8.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -11666,9 +11666,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -11711,7 +11711,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   OctaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -11749,7 +11749,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -11787,7 +11787,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -12763,7 +12763,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, GenericImage<T2> *im2, G
 {
   OctaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
   blocked_range<int> re(0, im8->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -12784,7 +12784,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, GenericImage<T2> *im2, Ge
   } else {
     OctaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
     blocked_range<int> re(0, im8->GetNumberOfVoxels() / im8->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -12805,9 +12805,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -12832,7 +12832,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -12849,7 +12849,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -12866,7 +12866,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -12888,7 +12888,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, GenericImage<T2> &im2, G
 {
   OctaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
   blocked_range<int> re(0, im8.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -12909,7 +12909,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, GenericImage<T2> &im2, Ge
   } else {
     OctaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
     blocked_range<int> re(0, im8.GetNumberOfVoxels() / im8.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -12930,9 +12930,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -12957,7 +12957,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -12974,7 +12974,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -12991,7 +12991,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -13018,7 +13018,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, GenericImage<T2> *im2,
   OctaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   blocked_range<int> re(0, im8->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -13060,7 +13060,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, GenericImage<T2> *im2,
     OctaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
     blocked_range<int> re(0, im8->GetNumberOfVoxels() / im8->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -13101,9 +13101,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -13146,7 +13146,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   OctaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -13184,7 +13184,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -13222,7 +13222,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -13265,7 +13265,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, GenericImage<T2> &im2,
   OctaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   blocked_range<int> re(0, im8.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -13307,7 +13307,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, GenericImage<T2> &im2,
     OctaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
     blocked_range<int> re(0, im8.GetNumberOfVoxels() / im8.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -13348,9 +13348,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -13393,7 +13393,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   OctaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -13431,7 +13431,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -13469,7 +13469,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   OctaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -14445,7 +14445,7 @@ void ParallelForEachScalar(GenericImage<T1> *im1, GenericImage<T2> *im2, Generic
 {
   OctaryForEachVoxelBody<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
   blocked_range<int> re(0, im8->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -14466,7 +14466,7 @@ void ParallelForEachVoxel(GenericImage<T1> *im1, GenericImage<T2> *im2, GenericI
   } else {
     OctaryForEachVoxelBody<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
     blocked_range<int> re(0, im8->GetNumberOfVoxels() / im8->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -14487,9 +14487,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, GenericImage<T1> *im1, Ge
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -14514,7 +14514,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -14531,7 +14531,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -14548,7 +14548,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, GenericImage<T6> *im6, GenericImage<T7> *im7, GenericImage<T8> *im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -14570,7 +14570,7 @@ void ParallelForEachScalar(GenericImage<T1> &im1, GenericImage<T2> &im2, Generic
 {
   OctaryForEachVoxelBody<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
   blocked_range<int> re(0, im8.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -14591,7 +14591,7 @@ void ParallelForEachVoxel(GenericImage<T1> &im1, GenericImage<T2> &im2, GenericI
   } else {
     OctaryForEachVoxelBody<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
     blocked_range<int> re(0, im8.GetNumberOfVoxels() / im8.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -14612,9 +14612,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, GenericImage<T1> &im1, Ge
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -14639,7 +14639,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range<int> &re, GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -14656,7 +14656,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range2d<int> &re, GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -14673,7 +14673,7 @@ template <class T1, class T2, class T3, class T4, class T5, class T6, class T7,
 void ParallelForEachVoxel(const blocked_range3d<int> &re, GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, GenericImage<T6> &im6, GenericImage<T7> &im7, GenericImage<T8> &im8, VoxelFunc &vf)
 {
   OctaryForEachVoxelBody<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc> body(im1, im2, im3, im4, im5, im6, im7, im8, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -14700,7 +14700,7 @@ void ParallelForEachScalarIf(GenericImage<T1> *im1, GenericImage<T2> *im2, Gener
   OctaryForEachVoxelIfBody<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   blocked_range<int> re(0, im8->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -14742,7 +14742,7 @@ void ParallelForEachVoxelIf(GenericImage<T1> *im1, GenericImage<T2> *im2, Generi
     OctaryForEachVoxelIfBody<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
     blocked_range<int> re(0, im8->GetNumberOfVoxels() / im8->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -14783,9 +14783,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, GenericImage<T1> *im1,
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -14828,7 +14828,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, GenericImage<T1> *im1,
 {
   OctaryForEachVoxelIfBody<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -14866,7 +14866,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, GenericImage<T1> *im
 {
   OctaryForEachVoxelIfBody<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -14904,7 +14904,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, GenericImage<T1> *im
 {
   OctaryForEachVoxelIfBody<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, *im6, *im7, *im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -14947,7 +14947,7 @@ void ParallelForEachScalarIf(GenericImage<T1> &im1, GenericImage<T2> &im2, Gener
   OctaryForEachVoxelIfBody<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   blocked_range<int> re(0, im8.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -14989,7 +14989,7 @@ void ParallelForEachVoxelIf(GenericImage<T1> &im1, GenericImage<T2> &im2, Generi
     OctaryForEachVoxelIfBody<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
     blocked_range<int> re(0, im8.GetNumberOfVoxels() / im8.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -15030,9 +15030,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, GenericImage<T1> &im1,
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -15075,7 +15075,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, GenericImage<T1> &im1,
 {
   OctaryForEachVoxelIfBody<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -15113,7 +15113,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, GenericImage<T1> &im
 {
   OctaryForEachVoxelIfBody<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -15151,7 +15151,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, GenericImage<T1> &im
 {
   OctaryForEachVoxelIfBody<T1, T2, T3, T4, T5, T6, T7, T8, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, im6, im7, im8, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -941,7 +941,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, const GenericImage<T2> *
 {
   QuaternaryForEachVoxelBody_Const<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
   blocked_range<int> re(0, im4->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -962,7 +962,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, const GenericImage<T2> *i
   } else {
     QuaternaryForEachVoxelBody_Const<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
     blocked_range<int> re(0, im4->GetNumberOfVoxels() / im4->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -983,9 +983,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -1010,7 +1010,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_Const<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1027,7 +1027,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_Const<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1044,7 +1044,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_Const<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1066,7 +1066,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, const GenericImage<T2> &
 {
   QuaternaryForEachVoxelBody_Const<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
   blocked_range<int> re(0, im4.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1087,7 +1087,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, const GenericImage<T2> &i
   } else {
     QuaternaryForEachVoxelBody_Const<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
     blocked_range<int> re(0, im4.GetNumberOfVoxels() / im4.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -1108,9 +1108,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -1135,7 +1135,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_Const<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1152,7 +1152,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_Const<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1169,7 +1169,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_Const<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1196,7 +1196,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, const GenericImage<T2>
   QuaternaryForEachVoxelIfBody_Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
   blocked_range<int> re(0, im4->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1238,7 +1238,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, const GenericImage<T2>
     QuaternaryForEachVoxelIfBody_Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
     blocked_range<int> re(0, im4->GetNumberOfVoxels() / im4->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -1279,9 +1279,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -1324,7 +1324,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   QuaternaryForEachVoxelIfBody_Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1362,7 +1362,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   QuaternaryForEachVoxelIfBody_Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1400,7 +1400,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   QuaternaryForEachVoxelIfBody_Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1443,7 +1443,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, const GenericImage<T2>
   QuaternaryForEachVoxelIfBody_Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
   blocked_range<int> re(0, im4.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1485,7 +1485,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, const GenericImage<T2>
     QuaternaryForEachVoxelIfBody_Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
     blocked_range<int> re(0, im4.GetNumberOfVoxels() / im4.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -1526,9 +1526,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -1571,7 +1571,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   QuaternaryForEachVoxelIfBody_Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1609,7 +1609,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   QuaternaryForEachVoxelIfBody_Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1647,7 +1647,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   QuaternaryForEachVoxelIfBody_Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -2575,7 +2575,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, const GenericImage<T2> *
 {
   QuaternaryForEachVoxelBody_3Const<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
   blocked_range<int> re(0, im4->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2596,7 +2596,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, const GenericImage<T2> *i
   } else {
     QuaternaryForEachVoxelBody_3Const<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
     blocked_range<int> re(0, im4->GetNumberOfVoxels() / im4->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -2617,9 +2617,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -2644,7 +2644,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, GenericImage<T4> *im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_3Const<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2661,7 +2661,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, GenericImage<T4> *im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_3Const<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2678,7 +2678,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, GenericImage<T4> *im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_3Const<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2700,7 +2700,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, const GenericImage<T2> &
 {
   QuaternaryForEachVoxelBody_3Const<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
   blocked_range<int> re(0, im4.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2721,7 +2721,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, const GenericImage<T2> &i
   } else {
     QuaternaryForEachVoxelBody_3Const<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
     blocked_range<int> re(0, im4.GetNumberOfVoxels() / im4.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -2742,9 +2742,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -2769,7 +2769,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, GenericImage<T4> &im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_3Const<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2786,7 +2786,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, GenericImage<T4> &im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_3Const<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2803,7 +2803,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, GenericImage<T4> &im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_3Const<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2830,7 +2830,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, const GenericImage<T2>
   QuaternaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
   blocked_range<int> re(0, im4->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -2872,7 +2872,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, const GenericImage<T2>
     QuaternaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
     blocked_range<int> re(0, im4->GetNumberOfVoxels() / im4->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -2913,9 +2913,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -2958,7 +2958,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   QuaternaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -2996,7 +2996,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   QuaternaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3034,7 +3034,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   QuaternaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3077,7 +3077,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, const GenericImage<T2>
   QuaternaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
   blocked_range<int> re(0, im4.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3119,7 +3119,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, const GenericImage<T2>
     QuaternaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
     blocked_range<int> re(0, im4.GetNumberOfVoxels() / im4.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -3160,9 +3160,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -3205,7 +3205,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   QuaternaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3243,7 +3243,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   QuaternaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3281,7 +3281,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   QuaternaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4209,7 +4209,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, const GenericImage<T2> *
 {
   QuaternaryForEachVoxelBody_2Const<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
   blocked_range<int> re(0, im4->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4230,7 +4230,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, const GenericImage<T2> *i
   } else {
     QuaternaryForEachVoxelBody_2Const<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
     blocked_range<int> re(0, im4->GetNumberOfVoxels() / im4->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -4251,9 +4251,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -4278,7 +4278,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_2Const<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4295,7 +4295,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_2Const<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4312,7 +4312,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_2Const<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4334,7 +4334,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, const GenericImage<T2> &
 {
   QuaternaryForEachVoxelBody_2Const<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
   blocked_range<int> re(0, im4.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4355,7 +4355,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, const GenericImage<T2> &i
   } else {
     QuaternaryForEachVoxelBody_2Const<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
     blocked_range<int> re(0, im4.GetNumberOfVoxels() / im4.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -4376,9 +4376,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -4403,7 +4403,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_2Const<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4420,7 +4420,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_2Const<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4437,7 +4437,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_2Const<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4464,7 +4464,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, const GenericImage<T2>
   QuaternaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
   blocked_range<int> re(0, im4->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4506,7 +4506,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, const GenericImage<T2>
     QuaternaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
     blocked_range<int> re(0, im4->GetNumberOfVoxels() / im4->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -4547,9 +4547,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -4592,7 +4592,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   QuaternaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4630,7 +4630,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   QuaternaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4668,7 +4668,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   QuaternaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4711,7 +4711,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, const GenericImage<T2>
   QuaternaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
   blocked_range<int> re(0, im4.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4753,7 +4753,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, const GenericImage<T2>
     QuaternaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
     blocked_range<int> re(0, im4.GetNumberOfVoxels() / im4.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -4794,9 +4794,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -4839,7 +4839,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   QuaternaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4877,7 +4877,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   QuaternaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4915,7 +4915,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   QuaternaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -5843,7 +5843,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, GenericImage<T2> *im2, G
 {
   QuaternaryForEachVoxelBody_1Const<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
   blocked_range<int> re(0, im4->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -5864,7 +5864,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, GenericImage<T2> *im2, Ge
   } else {
     QuaternaryForEachVoxelBody_1Const<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
     blocked_range<int> re(0, im4->GetNumberOfVoxels() / im4->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -5885,9 +5885,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -5912,7 +5912,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_1Const<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -5929,7 +5929,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_1Const<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -5946,7 +5946,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_1Const<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -5968,7 +5968,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, GenericImage<T2> &im2, G
 {
   QuaternaryForEachVoxelBody_1Const<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
   blocked_range<int> re(0, im4.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -5989,7 +5989,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, GenericImage<T2> &im2, Ge
   } else {
     QuaternaryForEachVoxelBody_1Const<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
     blocked_range<int> re(0, im4.GetNumberOfVoxels() / im4.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -6010,9 +6010,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -6037,7 +6037,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_1Const<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6054,7 +6054,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_1Const<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6071,7 +6071,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody_1Const<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6098,7 +6098,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, GenericImage<T2> *im2,
   QuaternaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
   blocked_range<int> re(0, im4->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6140,7 +6140,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, GenericImage<T2> *im2,
     QuaternaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
     blocked_range<int> re(0, im4->GetNumberOfVoxels() / im4->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -6181,9 +6181,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -6226,7 +6226,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   QuaternaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6264,7 +6264,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   QuaternaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6302,7 +6302,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   QuaternaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6345,7 +6345,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, GenericImage<T2> &im2,
   QuaternaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
   blocked_range<int> re(0, im4.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6387,7 +6387,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, GenericImage<T2> &im2,
     QuaternaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
     blocked_range<int> re(0, im4.GetNumberOfVoxels() / im4.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -6428,9 +6428,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -6473,7 +6473,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   QuaternaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6511,7 +6511,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   QuaternaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6549,7 +6549,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   QuaternaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -7477,7 +7477,7 @@ void ParallelForEachScalar(GenericImage<T1> *im1, GenericImage<T2> *im2, Generic
 {
   QuaternaryForEachVoxelBody<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
   blocked_range<int> re(0, im4->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7498,7 +7498,7 @@ void ParallelForEachVoxel(GenericImage<T1> *im1, GenericImage<T2> *im2, GenericI
   } else {
     QuaternaryForEachVoxelBody<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
     blocked_range<int> re(0, im4->GetNumberOfVoxels() / im4->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -7519,9 +7519,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, GenericImage<T1> *im1, Ge
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -7546,7 +7546,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7563,7 +7563,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7580,7 +7580,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody<T1, T2, T3, T4, VoxelFunc> body(*im1, *im2, *im3, *im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7602,7 +7602,7 @@ void ParallelForEachScalar(GenericImage<T1> &im1, GenericImage<T2> &im2, Generic
 {
   QuaternaryForEachVoxelBody<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
   blocked_range<int> re(0, im4.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7623,7 +7623,7 @@ void ParallelForEachVoxel(GenericImage<T1> &im1, GenericImage<T2> &im2, GenericI
   } else {
     QuaternaryForEachVoxelBody<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
     blocked_range<int> re(0, im4.GetNumberOfVoxels() / im4.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -7644,9 +7644,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, GenericImage<T1> &im1, Ge
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -7671,7 +7671,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7688,7 +7688,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7705,7 +7705,7 @@ template <class T1, class T2, class T3, class T4, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, VoxelFunc &vf)
 {
   QuaternaryForEachVoxelBody<T1, T2, T3, T4, VoxelFunc> body(im1, im2, im3, im4, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7732,7 +7732,7 @@ void ParallelForEachScalarIf(GenericImage<T1> *im1, GenericImage<T2> *im2, Gener
   QuaternaryForEachVoxelIfBody<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
   blocked_range<int> re(0, im4->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -7774,7 +7774,7 @@ void ParallelForEachVoxelIf(GenericImage<T1> *im1, GenericImage<T2> *im2, Generi
     QuaternaryForEachVoxelIfBody<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
     blocked_range<int> re(0, im4->GetNumberOfVoxels() / im4->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -7815,9 +7815,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, GenericImage<T1> *im1,
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -7860,7 +7860,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, GenericImage<T1> *im1,
 {
   QuaternaryForEachVoxelIfBody<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -7898,7 +7898,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, GenericImage<T1> *im
 {
   QuaternaryForEachVoxelIfBody<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -7936,7 +7936,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, GenericImage<T1> *im
 {
   QuaternaryForEachVoxelIfBody<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -7979,7 +7979,7 @@ void ParallelForEachScalarIf(GenericImage<T1> &im1, GenericImage<T2> &im2, Gener
   QuaternaryForEachVoxelIfBody<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
   blocked_range<int> re(0, im4.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -8021,7 +8021,7 @@ void ParallelForEachVoxelIf(GenericImage<T1> &im1, GenericImage<T2> &im2, Generi
     QuaternaryForEachVoxelIfBody<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
     blocked_range<int> re(0, im4.GetNumberOfVoxels() / im4.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -8062,9 +8062,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, GenericImage<T1> &im1,
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -8107,7 +8107,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, GenericImage<T1> &im1,
 {
   QuaternaryForEachVoxelIfBody<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -8145,7 +8145,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, GenericImage<T1> &im
 {
   QuaternaryForEachVoxelIfBody<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -8183,7 +8183,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, GenericImage<T1> &im
 {
   QuaternaryForEachVoxelIfBody<T1, T2, T3, T4, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
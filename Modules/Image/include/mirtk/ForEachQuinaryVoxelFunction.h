@@ -953,7 +953,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, const GenericImage<T2> *
 {
   QuinaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
   blocked_range<int> re(0, im5->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -974,7 +974,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, const GenericImage<T2> *i
   } else {
     QuinaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
     blocked_range<int> re(0, im5->GetNumberOfVoxels() / im5->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -995,9 +995,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -1022,7 +1022,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1039,7 +1039,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1056,7 +1056,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, const GenericImage<T5> *im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1078,7 +1078,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, const GenericImage<T2> &
 {
   QuinaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
   blocked_range<int> re(0, im5.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1099,7 +1099,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, const GenericImage<T2> &i
   } else {
     QuinaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
     blocked_range<int> re(0, im5.GetNumberOfVoxels() / im5.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -1120,9 +1120,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -1147,7 +1147,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1164,7 +1164,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1181,7 +1181,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, const GenericImage<T5> &im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1208,7 +1208,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, const GenericImage<T2>
   QuinaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   blocked_range<int> re(0, im5->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1250,7 +1250,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, const GenericImage<T2>
     QuinaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
     blocked_range<int> re(0, im5->GetNumberOfVoxels() / im5->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -1291,9 +1291,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -1336,7 +1336,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   QuinaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1374,7 +1374,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   QuinaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1412,7 +1412,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   QuinaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1455,7 +1455,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, const GenericImage<T2>
   QuinaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   blocked_range<int> re(0, im5.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1497,7 +1497,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, const GenericImage<T2>
     QuinaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
     blocked_range<int> re(0, im5.GetNumberOfVoxels() / im5.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -1538,9 +1538,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -1583,7 +1583,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   QuinaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1621,7 +1621,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   QuinaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1659,7 +1659,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   QuinaryForEachVoxelIfBody_Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -2599,7 +2599,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, const GenericImage<T2> *
 {
   QuinaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
   blocked_range<int> re(0, im5->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2620,7 +2620,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, const GenericImage<T2> *i
   } else {
     QuinaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
     blocked_range<int> re(0, im5->GetNumberOfVoxels() / im5->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -2641,9 +2641,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -2668,7 +2668,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, GenericImage<T5> *im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2685,7 +2685,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, GenericImage<T5> *im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2702,7 +2702,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, const GenericImage<T4> *im4, GenericImage<T5> *im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2724,7 +2724,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, const GenericImage<T2> &
 {
   QuinaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
   blocked_range<int> re(0, im5.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2745,7 +2745,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, const GenericImage<T2> &i
   } else {
     QuinaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
     blocked_range<int> re(0, im5.GetNumberOfVoxels() / im5.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -2766,9 +2766,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -2793,7 +2793,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, GenericImage<T5> &im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2810,7 +2810,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, GenericImage<T5> &im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2827,7 +2827,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, const GenericImage<T4> &im4, GenericImage<T5> &im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_4Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2854,7 +2854,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, const GenericImage<T2>
   QuinaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   blocked_range<int> re(0, im5->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -2896,7 +2896,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, const GenericImage<T2>
     QuinaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
     blocked_range<int> re(0, im5->GetNumberOfVoxels() / im5->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -2937,9 +2937,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -2982,7 +2982,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   QuinaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3020,7 +3020,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   QuinaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3058,7 +3058,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   QuinaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3101,7 +3101,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, const GenericImage<T2>
   QuinaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   blocked_range<int> re(0, im5.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3143,7 +3143,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, const GenericImage<T2>
     QuinaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
     blocked_range<int> re(0, im5.GetNumberOfVoxels() / im5.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -3184,9 +3184,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -3229,7 +3229,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   QuinaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3267,7 +3267,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   QuinaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3305,7 +3305,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   QuinaryForEachVoxelIfBody_4Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4245,7 +4245,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, const GenericImage<T2> *
 {
   QuinaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
   blocked_range<int> re(0, im5->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4266,7 +4266,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, const GenericImage<T2> *i
   } else {
     QuinaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
     blocked_range<int> re(0, im5->GetNumberOfVoxels() / im5->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -4287,9 +4287,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -4314,7 +4314,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4331,7 +4331,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4348,7 +4348,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, const GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4370,7 +4370,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, const GenericImage<T2> &
 {
   QuinaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
   blocked_range<int> re(0, im5.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4391,7 +4391,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, const GenericImage<T2> &i
   } else {
     QuinaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
     blocked_range<int> re(0, im5.GetNumberOfVoxels() / im5.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -4412,9 +4412,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -4439,7 +4439,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4456,7 +4456,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4473,7 +4473,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, const GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_3Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -4500,7 +4500,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, const GenericImage<T2>
   QuinaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   blocked_range<int> re(0, im5->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4542,7 +4542,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, const GenericImage<T2>
     QuinaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
     blocked_range<int> re(0, im5->GetNumberOfVoxels() / im5->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -4583,9 +4583,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -4628,7 +4628,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   QuinaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4666,7 +4666,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   QuinaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4704,7 +4704,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   QuinaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4747,7 +4747,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, const GenericImage<T2>
   QuinaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   blocked_range<int> re(0, im5.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4789,7 +4789,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, const GenericImage<T2>
     QuinaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
     blocked_range<int> re(0, im5.GetNumberOfVoxels() / im5.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -4830,9 +4830,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -4875,7 +4875,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   QuinaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4913,7 +4913,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   QuinaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -4951,7 +4951,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   QuinaryForEachVoxelIfBody_3Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -5891,7 +5891,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, const GenericImage<T2> *
 {
   QuinaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
   blocked_range<int> re(0, im5->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -5912,7 +5912,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, const GenericImage<T2> *i
   } else {
     QuinaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
     blocked_range<int> re(0, im5->GetNumberOfVoxels() / im5->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -5933,9 +5933,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -5960,7 +5960,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -5977,7 +5977,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -5994,7 +5994,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, const GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6016,7 +6016,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, const GenericImage<T2> &
 {
   QuinaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
   blocked_range<int> re(0, im5.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6037,7 +6037,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, const GenericImage<T2> &i
   } else {
     QuinaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
     blocked_range<int> re(0, im5.GetNumberOfVoxels() / im5.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -6058,9 +6058,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -6085,7 +6085,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6102,7 +6102,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6119,7 +6119,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, const GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_2Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -6146,7 +6146,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, const GenericImage<T2>
   QuinaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   blocked_range<int> re(0, im5->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6188,7 +6188,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, const GenericImage<T2>
     QuinaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
     blocked_range<int> re(0, im5->GetNumberOfVoxels() / im5->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -6229,9 +6229,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -6274,7 +6274,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   QuinaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6312,7 +6312,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   QuinaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6350,7 +6350,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   QuinaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6393,7 +6393,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, const GenericImage<T2>
   QuinaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   blocked_range<int> re(0, im5.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6435,7 +6435,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, const GenericImage<T2>
     QuinaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
     blocked_range<int> re(0, im5.GetNumberOfVoxels() / im5.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -6476,9 +6476,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -6521,7 +6521,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   QuinaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6559,7 +6559,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   QuinaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -6597,7 +6597,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   QuinaryForEachVoxelIfBody_2Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -7537,7 +7537,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, GenericImage<T2> *im2, G
 {
   QuinaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
   blocked_range<int> re(0, im5->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7558,7 +7558,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, GenericImage<T2> *im2, Ge
   } else {
     QuinaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
     blocked_range<int> re(0, im5->GetNumberOfVoxels() / im5->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -7579,9 +7579,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -7606,7 +7606,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7623,7 +7623,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7640,7 +7640,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7662,7 +7662,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, GenericImage<T2> &im2, G
 {
   QuinaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
   blocked_range<int> re(0, im5.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7683,7 +7683,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, GenericImage<T2> &im2, Ge
   } else {
     QuinaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
     blocked_range<int> re(0, im5.GetNumberOfVoxels() / im5.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -7704,9 +7704,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -7731,7 +7731,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7748,7 +7748,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7765,7 +7765,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody_1Const<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -7792,7 +7792,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, GenericImage<T2> *im2,
   QuinaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   blocked_range<int> re(0, im5->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -7834,7 +7834,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, GenericImage<T2> *im2,
     QuinaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
     blocked_range<int> re(0, im5->GetNumberOfVoxels() / im5->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -7875,9 +7875,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -7920,7 +7920,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   QuinaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -7958,7 +7958,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   QuinaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -7996,7 +7996,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   QuinaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -8039,7 +8039,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, GenericImage<T2> &im2,
   QuinaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   blocked_range<int> re(0, im5.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -8081,7 +8081,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, GenericImage<T2> &im2,
     QuinaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
     blocked_range<int> re(0, im5.GetNumberOfVoxels() / im5.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -8122,9 +8122,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -8167,7 +8167,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   QuinaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -8205,7 +8205,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   QuinaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -8243,7 +8243,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   QuinaryForEachVoxelIfBody_1Const<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -9183,7 +9183,7 @@ void ParallelForEachScalar(GenericImage<T1> *im1, GenericImage<T2> *im2, Generic
 {
   QuinaryForEachVoxelBody<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
   blocked_range<int> re(0, im5->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9204,7 +9204,7 @@ void ParallelForEachVoxel(GenericImage<T1> *im1, GenericImage<T2> *im2, GenericI
   } else {
     QuinaryForEachVoxelBody<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
     blocked_range<int> re(0, im5->GetNumberOfVoxels() / im5->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -9225,9 +9225,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, GenericImage<T1> *im1, Ge
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -9252,7 +9252,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9269,7 +9269,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9286,7 +9286,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, GenericImage<T1> *im1, GenericImage<T2> *im2, GenericImage<T3> *im3, GenericImage<T4> *im4, GenericImage<T5> *im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody<T1, T2, T3, T4, T5, VoxelFunc> body(*im1, *im2, *im3, *im4, *im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9308,7 +9308,7 @@ void ParallelForEachScalar(GenericImage<T1> &im1, GenericImage<T2> &im2, Generic
 {
   QuinaryForEachVoxelBody<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
   blocked_range<int> re(0, im5.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9329,7 +9329,7 @@ void ParallelForEachVoxel(GenericImage<T1> &im1, GenericImage<T2> &im2, GenericI
   } else {
     QuinaryForEachVoxelBody<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
     blocked_range<int> re(0, im5.GetNumberOfVoxels() / im5.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -9350,9 +9350,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, GenericImage<T1> &im1, Ge
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -9377,7 +9377,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9394,7 +9394,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9411,7 +9411,7 @@ template <class T1, class T2, class T3, class T4, class T5, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, GenericImage<T1> &im1, GenericImage<T2> &im2, GenericImage<T3> &im3, GenericImage<T4> &im4, GenericImage<T5> &im5, VoxelFunc &vf)
 {
   QuinaryForEachVoxelBody<T1, T2, T3, T4, T5, VoxelFunc> body(im1, im2, im3, im4, im5, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -9438,7 +9438,7 @@ void ParallelForEachScalarIf(GenericImage<T1> *im1, GenericImage<T2> *im2, Gener
   QuinaryForEachVoxelIfBody<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   blocked_range<int> re(0, im5->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -9480,7 +9480,7 @@ void ParallelForEachVoxelIf(GenericImage<T1> *im1, GenericImage<T2> *im2, Generi
     QuinaryForEachVoxelIfBody<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
     blocked_range<int> re(0, im5->GetNumberOfVoxels() / im5->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -9521,9 +9521,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, GenericImage<T1> *im1,
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -9566,7 +9566,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, GenericImage<T1> *im1,
 {
   QuinaryForEachVoxelIfBody<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -9604,7 +9604,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, GenericImage<T1> *im
 {
   QuinaryForEachVoxelIfBody<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -9642,7 +9642,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, GenericImage<T1> *im
 {
   QuinaryForEachVoxelIfBody<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(*im1, *im2, *im3, *im4, *im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -9685,7 +9685,7 @@ void ParallelForEachScalarIf(GenericImage<T1> &im1, GenericImage<T2> &im2, Gener
   QuinaryForEachVoxelIfBody<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   blocked_range<int> re(0, im5.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -9727,7 +9727,7 @@ void ParallelForEachVoxelIf(GenericImage<T1> &im1, GenericImage<T2> &im2, Generi
     QuinaryForEachVoxelIfBody<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
     blocked_range<int> re(0, im5.GetNumberOfVoxels() / im5.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -9768,9 +9768,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, GenericImage<T1> &im1,
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -9813,7 +9813,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, GenericImage<T1> &im1,
 {
   QuinaryForEachVoxelIfBody<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -9851,7 +9851,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, GenericImage<T1> &im
 {
   QuinaryForEachVoxelIfBody<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -9889,7 +9889,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, GenericImage<T1> &im
 {
   QuinaryForEachVoxelIfBody<T1, T2, T3, T4, T5, VoxelFunc, OutsideFunc, Domain> body(im1, im2, im3, im4, im5, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -905,7 +905,7 @@ void ParallelForEachScalar(const GenericImage<T1> *im1, VoxelFunc &vf)
 {
   UnaryForEachVoxelBody_Const<T1, VoxelFunc> body(*im1, vf);
   blocked_range<int> re(0, im1->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -926,7 +926,7 @@ void ParallelForEachVoxel(const GenericImage<T1> *im1, VoxelFunc &vf)
   } else {
     UnaryForEachVoxelBody_Const<T1, VoxelFunc> body(*im1, vf);
     blocked_range<int> re(0, im1->GetNumberOfVoxels() / im1->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -947,9 +947,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> *i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -974,7 +974,7 @@ template <class T1, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> *im1, VoxelFunc &vf)
 {
   UnaryForEachVoxelBody_Const<T1, VoxelFunc> body(*im1, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -991,7 +991,7 @@ template <class T1, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> *im1, VoxelFunc &vf)
 {
   UnaryForEachVoxelBody_Const<T1, VoxelFunc> body(*im1, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1008,7 +1008,7 @@ template <class T1, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> *im1, VoxelFunc &vf)
 {
   UnaryForEachVoxelBody_Const<T1, VoxelFunc> body(*im1, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1030,7 +1030,7 @@ void ParallelForEachScalar(const GenericImage<T1> &im1, VoxelFunc &vf)
 {
   UnaryForEachVoxelBody_Const<T1, VoxelFunc> body(im1, vf);
   blocked_range<int> re(0, im1.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1051,7 +1051,7 @@ void ParallelForEachVoxel(const GenericImage<T1> &im1, VoxelFunc &vf)
   } else {
     UnaryForEachVoxelBody_Const<T1, VoxelFunc> body(im1, vf);
     blocked_range<int> re(0, im1.GetNumberOfVoxels() / im1.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -1072,9 +1072,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, const GenericImage<T1> &i
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -1099,7 +1099,7 @@ template <class T1, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, const GenericImage<T1> &im1, VoxelFunc &vf)
 {
   UnaryForEachVoxelBody_Const<T1, VoxelFunc> body(im1, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1116,7 +1116,7 @@ template <class T1, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, const GenericImage<T1> &im1, VoxelFunc &vf)
 {
   UnaryForEachVoxelBody_Const<T1, VoxelFunc> body(im1, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1133,7 +1133,7 @@ template <class T1, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, const GenericImage<T1> &im1, VoxelFunc &vf)
 {
   UnaryForEachVoxelBody_Const<T1, VoxelFunc> body(im1, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -1160,7 +1160,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> *im1, VoxelFunc &vf, Outside
   UnaryForEachVoxelIfBody_Const<T1, VoxelFunc, OutsideFunc, Domain> body(*im1, vf, of);
   blocked_range<int> re(0, im1->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1202,7 +1202,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> *im1, VoxelFunc &vf, OutsideF
     UnaryForEachVoxelIfBody_Const<T1, VoxelFunc, OutsideFunc, Domain> body(*im1, vf, of);
     blocked_range<int> re(0, im1->GetNumberOfVoxels() / im1->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -1243,9 +1243,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -1288,7 +1288,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   UnaryForEachVoxelIfBody_Const<T1, VoxelFunc, OutsideFunc, Domain> body(*im1, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1326,7 +1326,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   UnaryForEachVoxelIfBody_Const<T1, VoxelFunc, OutsideFunc, Domain> body(*im1, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1364,7 +1364,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   UnaryForEachVoxelIfBody_Const<T1, VoxelFunc, OutsideFunc, Domain> body(*im1, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1407,7 +1407,7 @@ void ParallelForEachScalarIf(const GenericImage<T1> &im1, VoxelFunc &vf, Outside
   UnaryForEachVoxelIfBody_Const<T1, VoxelFunc, OutsideFunc, Domain> body(im1, vf, of);
   blocked_range<int> re(0, im1.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1449,7 +1449,7 @@ void ParallelForEachVoxelIf(const GenericImage<T1> &im1, VoxelFunc &vf, OutsideF
     UnaryForEachVoxelIfBody_Const<T1, VoxelFunc, OutsideFunc, Domain> body(im1, vf, of);
     blocked_range<int> re(0, im1.GetNumberOfVoxels() / im1.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -1490,9 +1490,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, const GenericImage<T1>
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -1535,7 +1535,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, const GenericImage<T1>
 {
   UnaryForEachVoxelIfBody_Const<T1, VoxelFunc, OutsideFunc, Domain> body(im1, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1573,7 +1573,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, const GenericImage<T
 {
   UnaryForEachVoxelIfBody_Const<T1, VoxelFunc, OutsideFunc, Domain> body(im1, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -1611,7 +1611,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, const GenericImage<T
 {
   UnaryForEachVoxelIfBody_Const<T1, VoxelFunc, OutsideFunc, Domain> body(im1, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -2503,7 +2503,7 @@ void ParallelForEachScalar(GenericImage<T1> *im1, VoxelFunc &vf)
 {
   UnaryForEachVoxelBody<T1, VoxelFunc> body(*im1, vf);
   blocked_range<int> re(0, im1->GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2524,7 +2524,7 @@ void ParallelForEachVoxel(GenericImage<T1> *im1, VoxelFunc &vf)
   } else {
     UnaryForEachVoxelBody<T1, VoxelFunc> body(*im1, vf);
     blocked_range<int> re(0, im1->GetNumberOfVoxels() / im1->GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -2545,9 +2545,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, GenericImage<T1> *im1, Vo
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -2572,7 +2572,7 @@ template <class T1, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, GenericImage<T1> *im1, VoxelFunc &vf)
 {
   UnaryForEachVoxelBody<T1, VoxelFunc> body(*im1, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2589,7 +2589,7 @@ template <class T1, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, GenericImage<T1> *im1, VoxelFunc &vf)
 {
   UnaryForEachVoxelBody<T1, VoxelFunc> body(*im1, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2606,7 +2606,7 @@ template <class T1, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, GenericImage<T1> *im1, VoxelFunc &vf)
 {
   UnaryForEachVoxelBody<T1, VoxelFunc> body(*im1, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2628,7 +2628,7 @@ void ParallelForEachScalar(GenericImage<T1> &im1, VoxelFunc &vf)
 {
   UnaryForEachVoxelBody<T1, VoxelFunc> body(im1, vf);
   blocked_range<int> re(0, im1.GetNumberOfVoxels());
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2649,7 +2649,7 @@ void ParallelForEachVoxel(GenericImage<T1> &im1, VoxelFunc &vf)
   } else {
     UnaryForEachVoxelBody<T1, VoxelFunc> body(im1, vf);
     blocked_range<int> re(0, im1.GetNumberOfVoxels() / im1.GetT());
-    if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+    if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
     else                            parallel_for   (re, body);
   }
 }
@@ -2670,9 +2670,9 @@ void ParallelForEachVoxel(const ImageAttributes &attr, GenericImage<T1> &im1, Vo
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
   } else {
@@ -2697,7 +2697,7 @@ template <class T1, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range<int> &re, GenericImage<T1> &im1, VoxelFunc &vf)
 {
   UnaryForEachVoxelBody<T1, VoxelFunc> body(im1, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2714,7 +2714,7 @@ template <class T1, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range2d<int> &re, GenericImage<T1> &im1, VoxelFunc &vf)
 {
   UnaryForEachVoxelBody<T1, VoxelFunc> body(im1, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2731,7 +2731,7 @@ template <class T1, class VoxelFunc>
 void ParallelForEachVoxel(const blocked_range3d<int> &re, GenericImage<T1> &im1, VoxelFunc &vf)
 {
   UnaryForEachVoxelBody<T1, VoxelFunc> body(im1, vf);
-  if (VoxelFunc::IsReduction()) { parallel_reduce(re, body); vf.join(body._VoxelFunc); }
+  if (VoxelFunc::IsReduction()) { ParallelVoxelReduction(re, body); vf.join(body._VoxelFunc); }
   else                            parallel_for   (re, body);
 }
 
@@ -2758,7 +2758,7 @@ void ParallelForEachScalarIf(GenericImage<T1> *im1, VoxelFunc &vf, OutsideFunc &
   UnaryForEachVoxelIfBody<T1, VoxelFunc, OutsideFunc, Domain> body(*im1, vf, of);
   blocked_range<int> re(0, im1->GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -2800,7 +2800,7 @@ void ParallelForEachVoxelIf(GenericImage<T1> *im1, VoxelFunc &vf, OutsideFunc &o
     UnaryForEachVoxelIfBody<T1, VoxelFunc, OutsideFunc, Domain> body(*im1, vf, of);
     blocked_range<int> re(0, im1->GetNumberOfVoxels() / im1->GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -2841,9 +2841,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, GenericImage<T1> *im1,
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -2886,7 +2886,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, GenericImage<T1> *im1,
 {
   UnaryForEachVoxelIfBody<T1, VoxelFunc, OutsideFunc, Domain> body(*im1, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -2924,7 +2924,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, GenericImage<T1> *im
 {
   UnaryForEachVoxelIfBody<T1, VoxelFunc, OutsideFunc, Domain> body(*im1, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -2962,7 +2962,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, GenericImage<T1> *im
 {
   UnaryForEachVoxelIfBody<T1, VoxelFunc, OutsideFunc, Domain> body(*im1, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3005,7 +3005,7 @@ void ParallelForEachScalarIf(GenericImage<T1> &im1, VoxelFunc &vf, OutsideFunc &
   UnaryForEachVoxelIfBody<T1, VoxelFunc, OutsideFunc, Domain> body(im1, vf, of);
   blocked_range<int> re(0, im1.GetNumberOfVoxels());
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3047,7 +3047,7 @@ void ParallelForEachVoxelIf(GenericImage<T1> &im1, VoxelFunc &vf, OutsideFunc &o
     UnaryForEachVoxelIfBody<T1, VoxelFunc, OutsideFunc, Domain> body(im1, vf, of);
     blocked_range<int> re(0, im1.GetNumberOfVoxels() / im1.GetT());
     if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
       vf.join(body._VoxelFunc);
       of.join(body._OutsideFunc);
     } else {
@@ -3088,9 +3088,9 @@ void ParallelForEachVoxelIf(const ImageAttributes &attr, GenericImage<T1> &im1,
   blocked_range3d<int> re(0, attr._z, 0, attr._y, 0, attr._x);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
     if (attr._dt) {
-      for (body._l = 0; body._l < attr._t; ++body._l) parallel_reduce(re, body);
+      for (body._l = 0; body._l < attr._t; ++body._l) ParallelVoxelReduction(re, body);
     } else {
-      parallel_reduce(re, body);
+      ParallelVoxelReduction(re, body);
     }
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
@@ -3133,7 +3133,7 @@ void ParallelForEachVoxelIf(const blocked_range<int> &re, GenericImage<T1> &im1,
 {
   UnaryForEachVoxelIfBody<T1, VoxelFunc, OutsideFunc, Domain> body(im1, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3171,7 +3171,7 @@ void ParallelForEachVoxelIf(const blocked_range2d<int> &re, GenericImage<T1> &im
 {
   UnaryForEachVoxelIfBody<T1, VoxelFunc, OutsideFunc, Domain> body(im1, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
@@ -3209,7 +3209,7 @@ void ParallelForEachVoxelIf(const blocked_range3d<int> &re, GenericImage<T1> &im
 {
   UnaryForEachVoxelIfBody<T1, VoxelFunc, OutsideFunc, Domain> body(im1, vf, of);
   if (VoxelFunc::IsReduction() || OutsideFunc::IsReduction()) {
-    parallel_reduce(re, body);
+    ParallelVoxelReduction(re, body);
     vf.join(body._VoxelFunc);
     of.join(body._OutsideFunc);
   } else {
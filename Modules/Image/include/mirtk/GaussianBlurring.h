@@ -40,6 +40,14 @@ namespace mirtk {
  * the 1D convolution with a 1D Gaussian kernel is performed only for
  * dimensions of more than one voxel size and for which a non-zero
  * standard deviation for the Gaussian kernel has been set.
+ *
+ * The spatial convolutions are applied slice by slice, where each slice is
+ * convolved along x and y using line buffers before the convolution along
+ * z (and t) is applied to tiles of adjacent image columns. The intermediate
+ * results are thus never stored in a full auxiliary image. For large
+ * standard deviations, the FIR filter can optionally be replaced by the
+ * recursive approximation of Young and van Vliet (1995), whose cost is
+ * independent of the standard deviation.
  */
 template <class TVoxel>
 class GaussianBlurring : public ImageToImage<TVoxel>
@@ -58,6 +66,10 @@ class GaussianBlurring : public ImageToImage<TVoxel>
   /// Standard deviation of Gaussian kernel in t
   mirtkAttributeMacro(double, SigmaT);
 
+  /// Minimum standard deviation in voxel units from which on the Gaussian
+  /// kernel is approximated by a recursive filter (0: never)
+  mirtkPublicAttributeMacro(double, RecursiveSigma);
+
 protected:
 
   /// Gaussian convolution kernel
@@ -26,6 +26,7 @@
 #define MIRTK_GenericImage_H
 
 #include "mirtk/VoxelCast.h"
+#include "mirtk/Memory.h"
 
 
 namespace mirtk {
@@ -78,11 +79,18 @@ protected:
   /// Whether image data memory itself is owned by this instance
   bool _dataOwner;
 
+  /// Externally managed memory which contains the image data, e.g., a
+  /// memory-mapped image file, and which is kept valid while referenced
+  ///
+  /// An image whose data is stored in such memory is treated like an image
+  /// which owns its data, i.e., copies of the image are deep copies.
+  shared_ptr<void> _dataMemory;
+
   // ---------------------------------------------------------------------------
   // Construction/Destruction
 
   /// Allocate image memory
-  void AllocateImage(VoxelType * = NULL);
+  void AllocateImage(VoxelType * = NULL, const shared_ptr<void> & = shared_ptr<void>());
 
 public:
 
@@ -104,6 +112,14 @@ public:
   /// Constructor for given image attributes
   explicit GenericImage(const ImageAttributes &, int, VoxelType *data = NULL);
 
+  /// Constructor for image data stored in externally managed memory
+  ///
+  /// \param[in] attr   Image attributes.
+  /// \param[in] data   Image data within the given memory.
+  /// \param[in] memory Memory containing the image data, e.g., a memory-mapped
+  ///                   image file, which is released when no longer referenced.
+  GenericImage(const ImageAttributes &attr, VoxelType *data, const shared_ptr<void> &memory);
+
   /// Copy constructor for image
   explicit GenericImage(const BaseImage &);
 
@@ -25,6 +25,8 @@
 #include "mirtk/GenericImage.h"
 #include "mirtk/Parallel.h"
 #include "mirtk/Stream.h"
+#include "mirtk/Memory.h"
+#include "mirtk/InterpolationCoefficientCache.h"
 
 
 namespace mirtk {
@@ -107,6 +109,9 @@ struct ConvertToInterpolationCoefficientsBase
     _image(image), _z(z), _npoles(npoles)
   {}
 
+  /// Number of adjacent image lines copied at once
+  static const int TileSize = 16;
+
   void Process(TData *data, int n) const
   {
     ConvertToInterpolationCoefficients(data, n, _z, _npoles, static_cast<TReal>(DBL_EPSILON));
@@ -118,6 +123,9 @@ protected:
   int                  _npoles;
 };
 
+template <class TData, class TReal>
+const int ConvertToInterpolationCoefficientsBase<TData, TReal>::TileSize;
+
 // -----------------------------------------------------------------------------
 template <class TData, class TReal>
 struct ConvertToInterpolationCoefficientsXFunc : public ConvertToInterpolationCoefficientsBase<TData, TReal>
@@ -129,19 +137,12 @@ struct ConvertToInterpolationCoefficientsXFunc : public ConvertToInterpolationCo
 
   void operator()(const blocked_range3d<int> &re) const
   {
-    TData *data = new TData[this->_image.X()];
+    // Rows are contiguous in memory and processed in place
     for (int l = re.pages().begin(); l != re.pages().end(); ++l)
     for (int k = re.rows ().begin(); k != re.rows ().end(); ++k)
     for (int j = re.cols ().begin(); j != re.cols ().end(); ++j) {
-      for (int i = 0; i < this->_image.X(); ++i) {
-        data[i] = this->_image(i, j, k, l);
-      }
-      this->Process(data, this->_image.X());
-      for (int i = 0; i < this->_image.X(); ++i) {
-        this->_image(i, j, k, l) = data[i];
-      }
+      this->Process(this->_image.Data(0, j, k, l), this->_image.X());
     }
-    delete[] data;
   }
 
   void operator()(int l = -1)
@@ -171,16 +172,24 @@ struct ConvertToInterpolationCoefficientsYFunc : public ConvertToInterpolationCo
 
   void operator()(const blocked_range3d<int> &re) const
   {
-    TData *data = new TData[this->_image.Y()];
+    // Copy a tile of adjacent columns at once such that memory is accessed
+    // in contiguous segments of rows rather than with a stride of one row
+    const int n = this->_image.Y();
+    TData *data = new TData[this->TileSize * n];
     for (int l = re.pages().begin(); l != re.pages().end(); ++l)
     for (int k = re.rows ().begin(); k != re.rows ().end(); ++k)
-    for (int i = re.cols ().begin(); i != re.cols ().end(); ++i) {
-      for (int j = 0; j < this->_image.Y(); ++j) {
-        data[j] = this->_image(i, j, k, l);
+    for (int i1 = re.cols ().begin(); i1 < re.cols ().end(); i1 += this->TileSize) {
+      const int m = min(this->TileSize, re.cols().end() - i1);
+      for (int j = 0; j < n; ++j) {
+        const TData *p = this->_image.Data(i1, j, k, l);
+        for (int b = 0; b < m; ++b) data[b * n + j] = p[b];
       }
-      this->Process(data, this->_image.Y());
-      for (int j = 0; j < this->_image.Y(); ++j) {
-        this->_image(i, j, k, l) = data[j];
+      for (int b = 0; b < m; ++b) {
+        this->Process(data + b * n, n);
+      }
+      for (int j = 0; j < n; ++j) {
+        TData *p = this->_image.Data(i1, j, k, l);
+        for (int b = 0; b < m; ++b) p[b] = data[b * n + j];
       }
     }
     delete[] data;
@@ -213,16 +222,24 @@ struct ConvertToInterpolationCoefficientsZFunc : public ConvertToInterpolationCo
 
   void operator()(const blocked_range3d<int> &re) const
   {
-    TData *data = new TData[this->_image.Z()];
+    // Copy a tile of adjacent columns at once such that memory is accessed
+    // in contiguous segments of rows rather than with a stride of one slice
+    const int n = this->_image.Z();
+    TData *data = new TData[this->TileSize * n];
     for (int l = re.pages().begin(); l != re.pages().end(); ++l)
     for (int j = re.rows ().begin(); j != re.rows ().end(); ++j)
-    for (int i = re.cols ().begin(); i != re.cols ().end(); ++i) {
-      for (int k = 0; k < this->_image.Z(); ++k) {
-        data[k] = this->_image(i, j, k, l);
+    for (int i1 = re.cols ().begin(); i1 < re.cols ().end(); i1 += this->TileSize) {
+      const int m = min(this->TileSize, re.cols().end() - i1);
+      for (int k = 0; k < n; ++k) {
+        const TData *p = this->_image.Data(i1, j, k, l);
+        for (int b = 0; b < m; ++b) data[b * n + k] = p[b];
       }
-      this->Process(data, this->_image.Z());
-      for (int k = 0; k < this->_image.Z(); ++k) {
-        this->_image(i, j, k, l) = data[k];
+      for (int b = 0; b < m; ++b) {
+        this->Process(data + b * n, n);
+      }
+      for (int k = 0; k < n; ++k) {
+        TData *p = this->_image.Data(i1, j, k, l);
+        for (int b = 0; b < m; ++b) p[b] = data[b * n + k];
       }
     }
     delete[] data;
@@ -451,6 +468,42 @@ void ConvertToCubicBSplineCoefficients(GenericImage<TData> &image)
   ConvertToSplineCoefficients(3, image);
 }
 
+// -----------------------------------------------------------------------------
+/// Get cubic B-spline coefficients of 2D, 3D, or 4D image
+///
+/// The coefficients are computed only when no other interpolator uses the
+/// coefficients of the unmodified input image already.
+///
+/// \param[in] image Input image.
+/// \param[in] dim   Number of image dimensions to prefilter.
+///
+/// \returns Shared image of type GenericImage<TData> with spline coefficients.
+template <class TData>
+shared_ptr<BaseImage> SharedCubicBSplineCoefficients(const BaseImage *image, int dim)
+{
+  typedef GenericImage<TData> CoefficientImage;
+  InterpolationCoefficientCache &cache = InterpolationCoefficientCache::Instance();
+  const InterpolationCoefficientCache::Key key =
+      InterpolationCoefficientCache::MakeKey(image, voxel_info<TData>::type(), dim);
+  shared_ptr<BaseImage> coeff = cache.Find(key);
+  if (!dynamic_cast<CoefficientImage *>(coeff.get())) {
+    CoefficientImage *c = new CoefficientImage();
+    coeff.reset(c);
+    *c = *image;
+    typename voxel_info<TData>::ScalarType pole;
+    int                                    unused;
+    SplinePoles(3, &pole, unused);
+    switch (dim) {
+      case 4:  ConvertToInterpolationCoefficientsT(*c, &pole, 1);
+      case 3:  ConvertToInterpolationCoefficientsZ(*c, &pole, 1);
+      default: ConvertToInterpolationCoefficientsY(*c, &pole, 1);
+               ConvertToInterpolationCoefficientsX(*c, &pole, 1);
+    }
+    cache.Insert(key, coeff);
+  }
+  return coeff;
+}
+
 
 } // namespace mirtk
 
@@ -394,6 +394,31 @@ public:
   /// outside locations is used.
   void EvaluateWithPadding(Vector &, double, double, double = 0, double = 0) const;
 
+  /// Evaluate scalar image at multiple locations (in pixels), e.g., of a scanline
+  ///
+  /// Each location is classified as inside or outside the domain for which the
+  /// interpolation requires no boundary conditions, and the image is evaluated
+  /// as by Evaluate. Subclasses override this function such that no virtual
+  /// function call is required per location.
+  ///
+  /// \param[out] v Interpolated values.
+  /// \param[in]  n Number of locations.
+  /// \param[in]  x Image coordinates along x axis.
+  /// \param[in]  y Image coordinates along y axis.
+  /// \param[in]  z Image coordinates along z axis or NULL if all zero.
+  /// \param[in]  t Temporal image coordinate (channel).
+  virtual void EvaluateBatch(double *v, int n, const double *x, const double *y,
+                             const double *z = NULL, double t = 0) const;
+
+  /// Evaluate scalar image at multiple locations (in pixels), e.g., of a scanline
+  ///
+  /// Each location is classified as inside or outside the domain for which the
+  /// interpolation requires no boundary conditions, and the image is evaluated
+  /// as by EvaluateWithPadding. Subclasses override this function such that no
+  /// virtual function call is required per location.
+  virtual void EvaluateWithPaddingBatch(double *v, int n, const double *x, const double *y,
+                                        const double *z = NULL, double t = 0) const;
+
   /// Evaluate image function at all locations of the output image
   template <class TOutputImage>
   void Evaluate(TOutputImage &) const;
@@ -661,6 +686,43 @@ public:
     mirtkGenericInterpolatorTypes(GenericInterpolateImageFunction);            \
   private:
 
+// -----------------------------------------------------------------------------
+/// Override batch evaluation functions by ones which call the GetInside and
+/// GetOutside functions of the named subclass without virtual function calls
+#define mirtkGenericInterpolatorBatchMacro(clsname)                            \
+  public:                                                                      \
+    /** Evaluate scalar image at multiple locations (in pixels) */             \
+    virtual void EvaluateBatch(double *v, int n, const double *x,              \
+                               const double *y, const double *z = NULL,        \
+                               double t = 0) const                             \
+    {                                                                          \
+      double w = .0;                                                           \
+      for (int i = 0; i < n; ++i) {                                            \
+        if (z) w = z[i];                                                       \
+        if (this->IsInside(x[i], y[i], w, t)) {                                \
+          v[i] = voxel_cast<double>(this->clsname::GetInside (x[i], y[i], w, t)); \
+        } else {                                                               \
+          v[i] = voxel_cast<double>(this->clsname::GetOutside(x[i], y[i], w, t)); \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+    /** Evaluate scalar image at multiple locations (in pixels) */             \
+    virtual void EvaluateWithPaddingBatch(double *v, int n, const double *x,   \
+                                          const double *y, const double *z = NULL, \
+                                          double t = 0) const                  \
+    {                                                                          \
+      double w = .0;                                                           \
+      for (int i = 0; i < n; ++i) {                                            \
+        if (z) w = z[i];                                                       \
+        if (this->IsInside(x[i], y[i], w, t)) {                                \
+          v[i] = voxel_cast<double>(this->clsname::GetWithPaddingInside (x[i], y[i], w, t)); \
+        } else {                                                               \
+          v[i] = voxel_cast<double>(this->clsname::GetWithPaddingOutside(x[i], y[i], w, t)); \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+  private:
+
 ////////////////////////////////////////////////////////////////////////////////
 // Inline definitions -- InterpolateImageFunction
 ////////////////////////////////////////////////////////////////////////////////
@@ -970,6 +1032,30 @@ inline void InterpolateImageFunction::EvaluateWithPadding(Vector &v, double x, d
   else                      this->EvaluateWithPaddingOutside(v, x, y, z, t);
 }
 
+// -----------------------------------------------------------------------------
+inline void InterpolateImageFunction
+::EvaluateBatch(double *v, int n, const double *x, const double *y, const double *z, double t) const
+{
+  double w = .0;
+  for (int i = 0; i < n; ++i) {
+    if (z) w = z[i];
+    if (IsInside(x[i], y[i], w, t)) v[i] = this->EvaluateInside (x[i], y[i], w, t);
+    else                            v[i] = this->EvaluateOutside(x[i], y[i], w, t);
+  }
+}
+
+// -----------------------------------------------------------------------------
+inline void InterpolateImageFunction
+::EvaluateWithPaddingBatch(double *v, int n, const double *x, const double *y, const double *z, double t) const
+{
+  double w = .0;
+  for (int i = 0; i < n; ++i) {
+    if (z) w = z[i];
+    if (IsInside(x[i], y[i], w, t)) v[i] = this->EvaluateWithPaddingInside (x[i], y[i], w, t);
+    else                            v[i] = this->EvaluateWithPaddingOutside(x[i], y[i], w, t);
+  }
+}
+
 // -----------------------------------------------------------------------------
 template <class TOutputImage>
 inline void InterpolateImageFunction::Evaluate(TOutputImage &output) const
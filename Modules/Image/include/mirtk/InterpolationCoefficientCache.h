@@ -0,0 +1,130 @@
+/*
+ * Medical Image Registration ToolKit (MIRTK)
+ *
+ * Copyright 2026 Imperial College London
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MIRTK_InterpolationCoefficientCache_H
+#define MIRTK_InterpolationCoefficientCache_H
+
+#include "mirtk/BaseImage.h"
+
+#include "mirtk/Array.h"
+#include "mirtk/Memory.h"
+#include "mirtk/Parallel.h"
+
+
+namespace mirtk {
+
+
+/**
+ * Cache of interpolation coefficients computed from an input image
+ *
+ * Interpolators which require a prefiltering of the input image, such as the
+ * cubic B-spline interpolators, look up the coefficients of their input image
+ * in this cache before computing these anew. An entry is identified by the
+ * memory address of the input image data, the image size, the voxel type of
+ * input and coefficients, the number of prefiltered dimensions, and a checksum
+ * of the image data which serves as modification stamp. Thus, the coefficients
+ * are shared by all interpolators of an unmodified image, e.g., the copies of
+ * an interpolator made for each thread of a parallel for loop.
+ *
+ * The cache does not own the coefficient images. An entry is only valid as
+ * long as at least one interpolator still uses the coefficients.
+ */
+class InterpolationCoefficientCache
+{
+  // ---------------------------------------------------------------------------
+  // Types
+public:
+
+  /// Key of cache entry
+  struct Key
+  {
+    const void        *_Data;       ///< Address of input image data
+    int                _Size[4];    ///< Size of input image
+    int                _InputType;  ///< Voxel type of input image
+    int                _Type;       ///< Voxel type of coefficient image
+    int                _Dimensions; ///< Number of prefiltered dimensions
+    unsigned long long _Checksum;   ///< Checksum of input image data
+
+    /// Whether this key is identical to another
+    bool operator ==(const Key &other) const;
+  };
+
+  // ---------------------------------------------------------------------------
+  // Singleton
+private:
+
+  /// Constructor
+  InterpolationCoefficientCache();
+
+  /// Destructor
+  ~InterpolationCoefficientCache();
+
+  /// Copy constructor. Intentionally not implemented.
+  InterpolationCoefficientCache(const InterpolationCoefficientCache &);
+
+  /// Assignment operator. Intentionally not implemented.
+  void operator =(const InterpolationCoefficientCache &);
+
+public:
+
+  /// Singleton instance
+  static InterpolationCoefficientCache &Instance();
+
+  // ---------------------------------------------------------------------------
+  // Cache entries
+private:
+
+  /// Cache entry
+  struct Entry
+  {
+    Key                      _Key;
+    std::weak_ptr<BaseImage> _Coefficients;
+  };
+
+  /// Cache entries
+  Array<Entry> _Entries;
+
+  /// Mutex for concurrent access of cache entries
+  mutable mutex _Mutex;
+
+  /// Remove entries whose coefficients are no longer used
+  void Purge();
+
+public:
+
+  /// Compute key of cache entry for given input image
+  ///
+  /// \param[in] image Input image.
+  /// \param[in] type  Voxel type of coefficient image.
+  /// \param[in] dim   Number of prefiltered dimensions.
+  static Key MakeKey(const BaseImage *image, int type, int dim);
+
+  /// Get previously computed coefficients
+  ///
+  /// \returns Coefficient image or nullptr if not found.
+  shared_ptr<BaseImage> Find(const Key &) const;
+
+  /// Add computed coefficients to cache
+  void Insert(const Key &, const shared_ptr<BaseImage> &);
+
+};
+
+
+} // namespace mirtk
+
+#endif // MIRTK_InterpolationCoefficientCache_H
@@ -36,6 +36,7 @@ class GenericLinearInterpolateImageFunction2D
 {
   mirtkObjectMacro(GenericLinearInterpolateImageFunction2D);
   mirtkGenericInterpolatorTypes(GenericLinearInterpolateImageFunction);
+  mirtkGenericInterpolatorBatchMacro(GenericLinearInterpolateImageFunction2D);
 
 public:
 
@@ -36,6 +36,7 @@ class GenericLinearInterpolateImageFunction3D
 {
   mirtkObjectMacro(GenericLinearInterpolateImageFunction3D);
   mirtkGenericInterpolatorTypes(GenericLinearInterpolateImageFunction);
+  mirtkGenericInterpolatorBatchMacro(GenericLinearInterpolateImageFunction3D);
 
 public:
 
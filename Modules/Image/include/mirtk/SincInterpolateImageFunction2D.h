@@ -36,6 +36,7 @@ class GenericSincInterpolateImageFunction2D
 {
   mirtkObjectMacro(GenericSincInterpolateImageFunction2D);
   mirtkGenericInterpolatorTypes(GenericSincInterpolateImageFunction);
+  mirtkGenericInterpolatorBatchMacro(GenericSincInterpolateImageFunction2D);
 
 public:
 
@@ -36,6 +36,7 @@ class GenericSincInterpolateImageFunction3D
 {
   mirtkObjectMacro(GenericSincInterpolateImageFunction3D);
   mirtkGenericInterpolatorTypes(GenericSincInterpolateImageFunction);
+  mirtkGenericInterpolatorBatchMacro(GenericSincInterpolateImageFunction3D);
 
 public:
 
@@ -253,6 +253,21 @@ struct ForEachVoxelIfBody : public ForEachVoxelBody<VoxelFunc>
   }
 };
 
+// =============================================================================
+// Parallel execution of voxel reductions
+// =============================================================================
+
+/// Execute ForEachVoxel body of voxel reduction in parallel
+///
+/// Uses parallel_deterministic_reduce when deterministic_reduction is enabled
+/// and parallel_reduce otherwise.
+template <class Range, class Body>
+void ParallelVoxelReduction(const Range &re, Body &body)
+{
+  if (deterministic_reduction) mirtk::parallel_deterministic_reduce(re, body);
+  else                         parallel_reduce                     (re, body);
+}
+
 // =============================================================================
 // NOP voxel function
 // =============================================================================
@@ -20,9 +20,10 @@
 #include "mirtk/ConnectedComponents.h"
 
 #include "mirtk/Assert.h"
-#include "mirtk/Queue.h"
-#include "mirtk/OrderedSet.h"
 #include "mirtk/Algorithm.h"
+#include "mirtk/Parallel.h"
+
+#include <atomic>
 
 
 namespace mirtk {
@@ -32,83 +33,383 @@ namespace mirtk {
 // Auxiliaries
 // =============================================================================
 
+namespace ConnectedComponentsUtils {
+
+
 // -----------------------------------------------------------------------------
-/// Marks all voxels as unvisited and collects set of unique segmentation labels
-template <class TLabel>
-void MarkUnvisited(const GenericImage<TLabel> &segmentation,
-                   GenericImage<TLabel>       &components)
-{
-  for (int idx = 0; idx < segmentation.NumberOfVoxels(); ++idx) {
-    if (segmentation(idx)) {
-      components(idx) = voxel_limits<TLabel>::max_value();
-    } else {
-      components(idx) = TLabel(0);
+/// Disjoint-set forest of image voxels with lock-free union of sets
+///
+/// Sets are always linked such that the root of a set is the voxel with the
+/// smallest linear index, i.e., the first voxel of a connected component in
+/// raster scan order. Background voxels have parent index -1.
+class DisjointVoxelSets
+{
+  std::atomic<int> *_Parent;
+
+  DisjointVoxelSets(const DisjointVoxelSets &);
+  void operator =(const DisjointVoxelSets &);
+
+public:
+
+  DisjointVoxelSets(int n) : _Parent(new std::atomic<int>[n]) {}
+  ~DisjointVoxelSets() { delete[] _Parent; }
+
+  /// Initialize singleton set or mark voxel as background
+  void Reset(int i, bool fg)
+  {
+    _Parent[i].store(fg ? i : -1, std::memory_order_relaxed);
+  }
+
+  /// Whether voxel is a foreground voxel
+  bool IsForeground(int i) const
+  {
+    return _Parent[i].load(std::memory_order_relaxed) != -1;
+  }
+
+  /// Whether voxel is the root of its set
+  bool IsRoot(int i) const
+  {
+    return _Parent[i].load(std::memory_order_relaxed) == i;
+  }
+
+  /// Find root of set containing the given voxel using path halving
+  ///
+  /// Path halving only ever replaces a parent link by a link to an ancestor.
+  /// It is therefore safe to call concurrently with Union.
+  int Find(int i)
+  {
+    int p, gp;
+    while (true) {
+      p = _Parent[i].load(std::memory_order_relaxed);
+      if (p == i) return i;
+      gp = _Parent[p].load(std::memory_order_relaxed);
+      if (gp == p) return p;
+      _Parent[i].compare_exchange_weak(p, gp, std::memory_order_relaxed);
+      i = gp;
     }
   }
-}
+
+  /// Merge sets of two voxels when only one thread modifies these sets
+  void LocalUnion(int a, int b)
+  {
+    a = LocalFind(a), b = LocalFind(b);
+    if (a < b) _Parent[b].store(a, std::memory_order_relaxed);
+    else if (b < a) _Parent[a].store(b, std::memory_order_relaxed);
+  }
+
+  /// Merge sets of two voxels when other threads may modify these sets
+  void Union(int a, int b)
+  {
+    int expected;
+    while (true) {
+      a = Find(a), b = Find(b);
+      if (a == b) return;
+      if (a < b) swap(a, b);
+      expected = a;
+      if (_Parent[a].compare_exchange_strong(expected, b)) return;
+    }
+  }
+
+private:
+
+  /// Find root of set with path halving when only one thread modifies it
+  int LocalFind(int i)
+  {
+    int p, gp;
+    while (true) {
+      p = _Parent[i].load(std::memory_order_relaxed);
+      if (p == i) return i;
+      gp = _Parent[p].load(std::memory_order_relaxed);
+      if (gp == p) return p;
+      _Parent[i].store(gp, std::memory_order_relaxed);
+      i = gp;
+    }
+  }
+};
 
 // -----------------------------------------------------------------------------
-/// Finds index of next unlabeled component voxel or -1 when done
+/// Neighbors of a voxel which precede it in raster scan order
+struct CausalNeighborhood
+{
+  int _Size;
+  int _Offset[13];
+  int _DeltaX[13];
+  int _DeltaY[13];
+  int _DeltaZ[13];
+
+  /// Maximum number of image rows by which a causal neighbor precedes a voxel
+  int _MaxRowDistance;
+
+  CausalNeighborhood(int nx, int ny, ConnectivityType connectivity)
+  :
+    _Size(0), _MaxRowDistance(0)
+  {
+    int n;
+    for (int dk = -1; dk <= 0; ++dk)
+    for (int dj = -1; dj <= 1; ++dj)
+    for (int di = -1; di <= 1; ++di) {
+      if (dk == 0 && (dj > 0 || (dj == 0 && di >= 0))) continue;
+      n = abs(di) + abs(dj) + abs(dk);
+      switch (connectivity) {
+        case CONNECTIVITY_4:  if (dk != 0 || n > 1) continue; break;
+        case CONNECTIVITY_6:  if (n > 1) continue; break;
+        case CONNECTIVITY_18: if (n > 2) continue; break;
+        case CONNECTIVITY_26: break;
+      }
+      _Offset[_Size] = (dk * ny + dj) * nx + di;
+      _DeltaX[_Size] = di;
+      _DeltaY[_Size] = dj;
+      _DeltaZ[_Size] = dk;
+      _MaxRowDistance = max(_MaxRowDistance, -(dk * ny + dj));
+      ++_Size;
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Partition of image rows into blocks which are labelled independently
+struct RowBlocks
+{
+  int _Rows;      ///< Total number of image rows, i.e., _Y * _Z * _T
+  int _BlockSize; ///< Number of rows per block
+  int _Blocks;    ///< Number of blocks
+
+  RowBlocks(int rows, int min_block_size)
+  {
+    const int max_blocks = 64;
+    _Rows      = rows;
+    _BlockSize = max(max(1, min_block_size), (rows + max_blocks - 1) / max_blocks);
+    _Blocks    = (rows + _BlockSize - 1) / _BlockSize;
+  }
+
+  int Begin(int b) const { return b * _BlockSize; }
+  int End  (int b) const { return min(_Rows, (b + 1) * _BlockSize); }
+};
+
+// -----------------------------------------------------------------------------
+/// Common attributes of parallel labelling passes
 template <class TLabel>
-int NextSeed(const GenericImage<TLabel> &components)
+struct LabelBody
 {
-  for (int idx = 0; idx < components.NumberOfVoxels(); ++idx) {
-    if (components(idx) == voxel_limits<TLabel>::max_value()) return idx;
+  const GenericImage<TLabel> *_Input;
+  const CausalNeighborhood   *_Neighbors;
+  const RowBlocks            *_Blocks;
+  DisjointVoxelSets          *_Sets;
+  int _X, _Y, _Z;
+
+  /// Whether voxel at given row and column index is connected to its n-th causal neighbor
+  bool IsConnected(int idx, int i, int row, int n, TLabel label) const
+  {
+    const int j  = row % _Y;
+    const int k  = (row / _Y) % _Z;
+    const int ni = i + _Neighbors->_DeltaX[n];
+    if (ni < 0 || ni >= _X) return false;
+    const int nj = j + _Neighbors->_DeltaY[n];
+    if (nj < 0 || nj >= _Y) return false;
+    if (k + _Neighbors->_DeltaZ[n] < 0) return false;
+    return _Input->Get(idx + _Neighbors->_Offset[n]) == label;
   }
-  return -1;
-}
+};
 
 // -----------------------------------------------------------------------------
-/// Performs region growing for a specific input label and seed
+/// First pass: label voxels within each block of image rows
 template <class TLabel>
-int LabelComponent(const NeighborhoodOffsets  &offsets,
-                   const GenericImage<TLabel> &segmentation,
-                   GenericImage<TLabel>       &components,
-                   int                         seed,
-                   TLabel                      component_label)
-{
-  const TLabel unvisited     = voxel_limits<TLabel>::max_value();
-  const TLabel current_label = segmentation(seed);
-  const TLabel * start_label = segmentation.Data();
-
-  int idx, neighbor_idx, num = 0;
-  Queue<int> active;
-  active.push(seed);
-
-  while (!active.empty()) {
-    idx = active.front();
-    active.pop();
-    if (components(idx) == unvisited) {
-      components(idx) = component_label, ++num;
-      if (segmentation.IsBoundary(idx)) {
-        const TLabel *neighbor_label, *label = segmentation.Data(idx);
-        const TLabel *neighbor_comp,  *comp  = components.Data(idx);
-        for (int n = 0; n < offsets.Size(); ++n) {
-          neighbor_label = label + offsets(n);
-          neighbor_idx   = static_cast<int>(neighbor_label - start_label);
-          if (0 <= neighbor_idx && neighbor_idx < segmentation.NumberOfVoxels()) {
-            neighbor_comp = comp + offsets(n);
-            if (*neighbor_label == current_label && *neighbor_comp == unvisited) {
-              active.push(neighbor_idx);
-            }
+struct LabelBlocks : public LabelBody<TLabel>
+{
+  void operator ()(const blocked_range<int> &re) const
+  {
+    const TLabel zero(0);
+    const int nn = this->_Neighbors->_Size;
+    for (int b = re.begin(); b != re.end(); ++b) {
+      const int row1 = this->_Blocks->Begin(b);
+      const int row2 = this->_Blocks->End(b);
+      for (int row = row1, idx = row1 * this->_X; row < row2; ++row)
+      for (int i = 0; i < this->_X; ++i, ++idx) {
+        const TLabel label = this->_Input->Get(idx);
+        this->_Sets->Reset(idx, label != zero);
+        if (label == zero) continue;
+        for (int n = 0; n < nn; ++n) {
+          // Only causal neighbors within the same block, others merged by MergeBlocks
+          if (idx + this->_Neighbors->_Offset[n] < row1 * this->_X) continue;
+          if (this->IsConnected(idx, i, row, n, label)) {
+            this->_Sets->LocalUnion(idx + this->_Neighbors->_Offset[n], idx);
           }
         }
-      } else {
-        const TLabel *neighbor_label, *label  = segmentation.Data(idx);
-        const TLabel *neighbor_comp,  *comp = components.Data(idx);
-        for (int n = 0; n < offsets.Size(); ++n) {
-          neighbor_label = label + offsets(n);
-          neighbor_comp  = comp  + offsets(n);
-          if (*neighbor_label == current_label && *neighbor_comp == unvisited) {
-            active.push(static_cast<int>(neighbor_label - start_label));
+      }
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Second pass: merge equivalent labels across block boundaries
+template <class TLabel>
+struct MergeBlocks : public LabelBody<TLabel>
+{
+  void operator ()(const blocked_range<int> &re) const
+  {
+    const TLabel zero(0);
+    const int nn = this->_Neighbors->_Size;
+    for (int b = re.begin(); b != re.end(); ++b) {
+      if (b == 0) continue;
+      const int row1 = this->_Blocks->Begin(b);
+      const int row2 = min(this->_Blocks->End(b), row1 + this->_Neighbors->_MaxRowDistance);
+      const int idx1 = row1 * this->_X;
+      for (int row = row1, idx = idx1; row < row2; ++row)
+      for (int i = 0; i < this->_X; ++i, ++idx) {
+        const TLabel label = this->_Input->Get(idx);
+        if (label == zero) continue;
+        for (int n = 0; n < nn; ++n) {
+          if (idx + this->_Neighbors->_Offset[n] >= idx1) continue;
+          if (this->IsConnected(idx, i, row, n, label)) {
+            this->_Sets->Union(idx + this->_Neighbors->_Offset[n], idx);
           }
         }
       }
     }
   }
+};
 
-  return num;
-}
+// -----------------------------------------------------------------------------
+/// Count number of components whose first voxel lies within each block
+struct CountRoots
+{
+  const RowBlocks   *_Blocks;
+  DisjointVoxelSets *_Sets;
+  int               *_Count;
+  int                _X;
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    for (int b = re.begin(); b != re.end(); ++b) {
+      const int idx2 = _Blocks->End(b) * _X;
+      int n = 0;
+      for (int idx = _Blocks->Begin(b) * _X; idx < idx2; ++idx) {
+        if (_Sets->IsRoot(idx)) ++n;
+      }
+      _Count[b] = n;
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Assign consecutive component labels in raster scan order to root voxels
+template <class TLabel>
+struct LabelRoots
+{
+  const RowBlocks      *_Blocks;
+  DisjointVoxelSets    *_Sets;
+  const int            *_Offset;
+  GenericImage<TLabel> *_Output;
+  int                   _X;
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    const TLabel zero(0);
+    for (int b = re.begin(); b != re.end(); ++b) {
+      const int idx2 = _Blocks->End(b) * _X;
+      int c = _Offset[b];
+      for (int idx = _Blocks->Begin(b) * _X; idx < idx2; ++idx) {
+        _Output->Put(idx, _Sets->IsRoot(idx) ? voxel_cast<TLabel>(++c) : zero);
+      }
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Third pass: propagate root labels and compute component statistics
+template <class TLabel>
+struct LabelVoxels
+{
+  const RowBlocks      *_Blocks;
+  DisjointVoxelSets    *_Sets;
+  GenericImage<TLabel> *_Output;
+  int                   _X, _Y, _Z;
+  Array<int>            _Size;
+  Array<Vector3D<int> > _Min;
+  Array<Vector3D<int> > _Max;
+
+  LabelVoxels(const RowBlocks *blocks, DisjointVoxelSets *sets,
+              GenericImage<TLabel> *output, int ncomponents)
+  :
+    _Blocks(blocks), _Sets(sets), _Output(output),
+    _X(output->X()), _Y(output->Y()), _Z(output->Z()),
+    _Size(ncomponents, 0),
+    _Min(ncomponents, Vector3D<int>(_X, _Y, _Z)),
+    _Max(ncomponents, Vector3D<int>(-1, -1, -1))
+  {}
+
+  LabelVoxels(const LabelVoxels &other, split)
+  :
+    _Blocks(other._Blocks), _Sets(other._Sets), _Output(other._Output),
+    _X(other._X), _Y(other._Y), _Z(other._Z),
+    _Size(other._Size.size(), 0),
+    _Min(other._Min.size(), Vector3D<int>(_X, _Y, _Z)),
+    _Max(other._Max.size(), Vector3D<int>(-1, -1, -1))
+  {}
+
+  void join(const LabelVoxels &other)
+  {
+    for (size_t c = 0; c < _Size.size(); ++c) {
+      if (other._Size[c] == 0) continue;
+      _Size[c] += other._Size[c];
+      _Min[c]._x = min(_Min[c]._x, other._Min[c]._x);
+      _Min[c]._y = min(_Min[c]._y, other._Min[c]._y);
+      _Min[c]._z = min(_Min[c]._z, other._Min[c]._z);
+      _Max[c]._x = max(_Max[c]._x, other._Max[c]._x);
+      _Max[c]._y = max(_Max[c]._y, other._Max[c]._y);
+      _Max[c]._z = max(_Max[c]._z, other._Max[c]._z);
+    }
+  }
+
+  void operator ()(const blocked_range<int> &re)
+  {
+    int c, j, k;
+    for (int b = re.begin(); b != re.end(); ++b) {
+      const int row2 = _Blocks->End(b);
+      for (int row = _Blocks->Begin(b), idx = row * _X; row < row2; ++row) {
+        j = row % _Y;
+        k = (row / _Y) % _Z;
+        for (int i = 0; i < _X; ++i, ++idx) {
+          if (!_Sets->IsForeground(idx)) continue;
+          if (!_Sets->IsRoot(idx)) {
+            _Output->Put(idx, _Output->Get(_Sets->Find(idx)));
+          }
+          c = static_cast<int>(_Output->Get(idx)) - 1;
+          _Size[c] += 1;
+          if (i < _Min[c]._x) _Min[c]._x = i;
+          if (i > _Max[c]._x) _Max[c]._x = i;
+          if (j < _Min[c]._y) _Min[c]._y = j;
+          if (j > _Max[c]._y) _Max[c]._y = j;
+          if (k < _Min[c]._z) _Min[c]._z = k;
+          if (k > _Max[c]._z) _Max[c]._z = k;
+        }
+      }
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Replace component labels by new labels
+template <class TLabel>
+struct RelabelComponents
+{
+  GenericImage<TLabel> *_Output;
+  const TLabel         *_NewLabel;
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    const TLabel zero(0);
+    TLabel *label = _Output->Data(re.begin());
+    for (int idx = re.begin(); idx != re.end(); ++idx, ++label) {
+      if (*label > zero) *label = _NewLabel[static_cast<int>(*label) - 1];
+    }
+  }
+};
+
+
+} // namespace ConnectedComponentsUtils
+
+using namespace ConnectedComponentsUtils;
 
 // =============================================================================
 // Construction/Destruction
@@ -142,9 +443,8 @@ void ConnectedComponents<VoxelType>::Initialize()
 
   _NumberOfComponents = 0;
   _ComponentSize.clear();
-
-  MarkUnvisited(*this->Input(), *this->Output());
-  _Offsets.Initialize(this->Input(), _Connectivity);
+  _ComponentBoundsMin.clear();
+  _ComponentBoundsMax.clear();
 }
 
 // -----------------------------------------------------------------------------
@@ -153,18 +453,68 @@ void ConnectedComponents<VoxelType>::Run()
 {
   this->Initialize();
 
-  int num, seed;
-  VoxelType c(0);
-  while ((seed = NextSeed(*this->Output())) != -1) {
-    if (++c == voxel_limits<VoxelType>::max_value()) {
-      cerr << "ConnectedComponents::Run: No. of components exceeded maximum label value!" << endl;
-      exit(1);
-    }
-    num = LabelComponent(_Offsets, *this->Input(), *this->Output(), seed, c);
-    mirtkAssert(num > 0, "found seed must be valid and no. of unvisited voxels decrease");
-    _ComponentSize.push_back(num);
+  const GenericImage<VoxelType> *input  = this->Input();
+  GenericImage<VoxelType>       *output = this->Output();
+
+  const int nx    = input->X();
+  const int ny    = input->Y();
+  const int nz    = input->Z();
+  const int nrows = ny * nz * input->T();
+
+  // Partition image into blocks of rows, each block needs to span at least
+  // the causal neighborhood such that boundary merges involve adjacent blocks
+  CausalNeighborhood neighbors(nx, ny, _Connectivity);
+  RowBlocks          blocks(nrows, neighbors._MaxRowDistance);
+  DisjointVoxelSets  sets(input->NumberOfVoxels());
+  blocked_range<int> all_blocks(0, blocks._Blocks, 1);
+
+  // First pass: label blocks independently, then merge label equivalences
+  // of voxels adjacent to the lower boundary of each block
+  LabelBlocks<VoxelType> label_blocks;
+  label_blocks._Input     = input;
+  label_blocks._Neighbors = &neighbors;
+  label_blocks._Blocks    = &blocks;
+  label_blocks._Sets      = &sets;
+  label_blocks._X         = nx;
+  label_blocks._Y         = ny;
+  label_blocks._Z         = nz;
+  parallel_for(all_blocks, label_blocks);
+
+  MergeBlocks<VoxelType> merge_blocks;
+  static_cast<LabelBody<VoxelType> &>(merge_blocks) = label_blocks;
+  parallel_for(all_blocks, merge_blocks);
+
+  // Assign consecutive labels to components in order of their first voxel
+  Array<int> offset(blocks._Blocks + 1, 0);
+  CountRoots count_roots;
+  count_roots._Blocks = &blocks;
+  count_roots._Sets   = &sets;
+  count_roots._Count  = offset.data() + 1;
+  count_roots._X      = nx;
+  parallel_for(all_blocks, count_roots);
+  for (int b = 1; b <= blocks._Blocks; ++b) {
+    offset[b] += offset[b-1];
   }
-  _NumberOfComponents = static_cast<int>(c);
+  _NumberOfComponents = offset.back();
+  if (_NumberOfComponents >= static_cast<int>(voxel_limits<VoxelType>::max_value())) {
+    cerr << "ConnectedComponents::Run: No. of components exceeded maximum label value!" << endl;
+    exit(1);
+  }
+
+  LabelRoots<VoxelType> label_roots;
+  label_roots._Blocks = &blocks;
+  label_roots._Sets   = &sets;
+  label_roots._Offset = offset.data();
+  label_roots._Output = output;
+  label_roots._X      = nx;
+  parallel_for(all_blocks, label_roots);
+
+  // Second pass: label remaining voxels and compute component statistics
+  LabelVoxels<VoxelType> label_voxels(&blocks, &sets, output, _NumberOfComponents);
+  parallel_reduce(all_blocks, label_voxels);
+  _ComponentSize.swap(label_voxels._Size);
+  _ComponentBoundsMin.swap(label_voxels._Min);
+  _ComponentBoundsMax.swap(label_voxels._Max);
 
   this->Finalize();
 }
@@ -173,10 +523,10 @@ void ConnectedComponents<VoxelType>::Run()
 template <class VoxelType>
 void ConnectedComponents<VoxelType>::Finalize()
 {
-  if (_Ordering != CC_NoOrdering) {
-    Array<VoxelType> perm(_NumberOfComponents);
+  if (_Ordering != CC_NoOrdering && _NumberOfComponents > 0) {
+    Array<int> perm(_NumberOfComponents);
     for (int i = 0; i < _NumberOfComponents; ++i) {
-      perm[i] = voxel_cast<VoxelType>(i);
+      perm[i] = i;
     }
     sort(perm.begin(), perm.end(), SortIndicesOfArray<int>(_ComponentSize));
     if (_Ordering == CC_LargestFirst) reverse(perm.begin(), perm.end());
@@ -184,22 +534,27 @@ void ConnectedComponents<VoxelType>::Finalize()
     for (int i = 0; i < _NumberOfComponents; ++i) {
       new_label[perm[i]] = voxel_cast<VoxelType>(i + 1);
     }
-    GenericImage<VoxelType> &output = *this->Output();
-    const Array<int> new_size = _ComponentSize; // make copy
-    VoxelType current;
-    const VoxelType zero(0);
-    for (int idx = 0; idx < output.NumberOfVoxels(); ++idx) {
-      current = output(idx);
-      if (current > zero) {
-        output(idx)                   = new_label[current-1];
-        _ComponentSize[output(idx)-1] = new_size [current-1];
-      }
+    Array<int>            size(_NumberOfComponents);
+    Array<Vector3D<int> > bmin(_NumberOfComponents);
+    Array<Vector3D<int> > bmax(_NumberOfComponents);
+    for (int i = 0; i < _NumberOfComponents; ++i) {
+      size[i] = _ComponentSize     [perm[i]];
+      bmin[i] = _ComponentBoundsMin[perm[i]];
+      bmax[i] = _ComponentBoundsMax[perm[i]];
     }
+    _ComponentSize     .swap(size);
+    _ComponentBoundsMin.swap(bmin);
+    _ComponentBoundsMax.swap(bmax);
+    RelabelComponents<VoxelType> relabel;
+    relabel._Output   = this->Output();
+    relabel._NewLabel = new_label.data();
+    parallel_for(blocked_range<int>(0, this->Output()->NumberOfVoxels()), relabel);
   }
 
   ImageToImage<VoxelType>::Finalize();
 }
 
+
 // -----------------------------------------------------------------------------
 template <class VoxelType>
 void ConnectedComponents<VoxelType>::DeleteComponent(VoxelType c)
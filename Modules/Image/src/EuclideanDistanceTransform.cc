@@ -19,7 +19,9 @@
 #include "mirtk/EuclideanDistanceTransform.h"
 
 #include "mirtk/Math.h"
+#include "mirtk/Array.h"
 #include "mirtk/Stream.h"
+#include "mirtk/Parallel.h"
 
 #define EDT_MAX_IMAGE_DIMENSION 26754
 #define EDT_MAX_DISTANCE_SQUARED 2147329548
@@ -29,233 +31,77 @@
 namespace mirtk {
 
 
-// -----------------------------------------------------------------------------
-template <class VoxelType>
-EuclideanDistanceTransform<VoxelType>
-::EuclideanDistanceTransform(Mode distanceTransformMode)
-{
-  _distanceTransformMode = distanceTransformMode;
-}
+// =============================================================================
+// Auxiliary functors
+// =============================================================================
 
-// -----------------------------------------------------------------------------
-// This procedure computes the squared EDT of a 2D binary image with isotropic
-// voxels of unit dimension. The EDT can obviously be obtained simply from the
-// output by taking the square root of each element. The output can be scaled
-// to account for non-unit dimension. But neither of these functions are
-// provided as options in this procedure.
-//
-// The EDT is returned in the array edt. Memory for the array edt must be
-// allocated by the caller. The binary image can be provided in two different
-// ways. It can be provided in the array img. In this case it is not changed by
-// the procedure. Alternatively, the binary image can be provided in the array
-// edt. In this case, the array img must be the NULL pointer, and the binary
-// image will be overwritten by the EDT. The binary image doesn't have to
-// consist of 0's and 1's. A voxel value of 0 denotes a background voxel and
-// any other value denotes a foreground or feature voxel. The binary image and
-// EDT dimensions are nX x nY voxels.
-//
-// The procedure uses the algorithm described in the paper:
-// CR Maurer Jr, R Qi, V Raghavan. A linear time algorithm for computing exact
-// Euclidean distance transforms of binary images in arbitrary dimensions.
-// IEEE Transactions on Pattern Analysis and Machine Intelligence. In review.
-// A preliminary version of this paper was published in the conference
-// proceedings:
-// CR Maurer Jr, V Raghavan, R Qi. A linear time algorithm for computing the
-// Euclidean distance transform in arbitrary dimensions. In: MF Insana, RM
-// Leahy, eds. Information Processing in Medical Imaging (IPMI) 2001. Berlin:
-// Springer-Verlag, 2001, pp. 358-364. (Davis, CA, June 18-22, 2001).
-template <class VoxelType>
-void EuclideanDistanceTransform<VoxelType>::edtComputeEDT_2D(char *img, long *edt, long nX, long nY)
-{
-  const long max_dist2 = long(EDT_MAX_DISTANCE_SQUARED);
+namespace EuclideanDistanceTransformUtils {
 
-  char *c;
-  long i, j, nXY, d, *p, *q, *f;
 
-  /* nXY is number of voxels in 2D image */
-  nXY = nX * nY;
+// -----------------------------------------------------------------------------
+/// Maximum number of adjacent lines processed at once along y or z
+const int MaxLinesPerBlock = 16;
 
-  /* if binary image is provided in the array img, copy it to the arry edt */
-  /* this is effectively equivalent to computing D_0 */
-  if (img != NULL) {
-    c = img;
-    p = edt;
-    for (i = 0; i < nXY; i++, c++, p++) {
-      *p = *c;
+// -----------------------------------------------------------------------------
+/// Compute D_1 as simple forward-and-reverse distance propagation
+///
+/// D_1 is the squared distance to the closest feature voxel in a row (x direction).
+/// It is possible to use a simple distance propagation for D_1 because L_1 and
+/// L_2 norms are equivalent for the 1D case. The distances are multiplied by the
+/// voxel size \p w before squaring.
+template <class T>
+void DistanceAlongRow(T *p, long n, T max_dist2, T w)
+{
+  T d;
+  /* forward pass */
+  d = max_dist2;
+  for (long i = 0; i < n; i++, p++) {
+    /* set d = 0 when we encounter a feature voxel */
+    if (*p) {
+      *p = d = 0;
+    /* increment distance ... */
+    } else if (d != max_dist2) {
+      *p = ++d;
+    /* ... unless we haven't encountered a feature voxel yet */
+    } else {
+      *p = max_dist2;
     }
   }
-
-  /* compute D_1 as simple forward-and-reverse distance propagation */
-  /* (instead of calling edtVornoiEDT) */
-  /* D_1 is distance to closest feature voxel in row (x direction) */
-  /* it is possible to use a simple distance propagation for D_1  because */
-  /* L_1 and L_2 norms are equivalent for 1D case */
-  for (j = 0; j < nY; j++) {
-    /* forward pass */
-    p = edt + j * nX;
+  /* reverse pass */
+  if (*(--p) != max_dist2) {
     d = max_dist2;
-    for (i = 0; i < nX; i++, p++) {
+    for (long i = n - 1; i >= 0; i--, p--) {
       /* set d = 0 when we encounter a feature voxel */
-      if (*p) {
-        *p = d = 0;
-      }
-      /* increment distance ... */
-      else if (d != max_dist2) {
-        *p = ++d;
-      }
-      /* ... unless we haven't encountered a feature voxel yet */
-      else {
-        *p = max_dist2;
-      }
-    }
-    /* reverse pass */
-    if (*(--p) != max_dist2) {
-      d = max_dist2;
-      for (i = nX - 1; i >= 0; i--, p--) {
-        /* set d = 0 when we encounter a feature voxel */
-        if (*p == 0) {
-          d = 0;
-        }
-        /* increment distance after encountering a feature voxel */
-        else if (d != max_dist2) {
-          /* compare forward and reverse distances */
-          if (++d < *p) {
-            *p = d;
-          }
+      if (*p == 0) {
+        d = 0;
+      /* increment distance after encountering a feature voxel */
+      } else if (d != max_dist2) {
+        /* compare forward and reverse distances */
+        if (++d < *p) {
+          *p = d;
         }
-        /* square distance */
-        /* (we use squared distance in rest of algorithm) */
-        *p *= *p;
-      }
-    }
-  }
-
-  /* compute D_2 = squared EDT */
-  /* solve 1D problem for each column (y direction) */
-  f = (long *)malloc(nY * sizeof(long));
-  if (f == NULL) {
-    fprintf(stderr, "Error in edtComputeEDT_2D()\n");
-    fprintf(stderr, "Cannot malloc f\n");
-    exit(EXIT_FAILURE);
-  }
-  for (i = 0; i < nX; i++) {
-    /* fill array f with D_1 distances in column */
-    /* this is essentially line 4 in Procedure VoronoiEDT() in tPAMI paper */
-    p = edt + i;
-    q = f;
-    for (j = 0; j < nY; j++, p += nX, q++) {
-      *q = *p;
-    }
-    /* call edtVornoiEDT */
-    if (edtVornoiEDT(f, nY)) {
-      p = edt + i;
-      q = f;
-      for (j = 0; j < nY; j++, p += nX, q++) {
-        *p = *q;
-      }
-    }
-  }
-  free(f);
-} /* edtComputeEDT_2D */
-
-// -----------------------------------------------------------------------------
-// This procedure computes the squared EDT of a 3D binary image with isotropic
-// voxels of unit dimension. See notes for edtComputeEDT_2D.
-template <class VoxelType>
-void EuclideanDistanceTransform<VoxelType>::edtComputeEDT_3D(char *img, long *edt, long nX, long nY, long nZ)
-{
-  char *c;
-  long i, k, nXY, nXYZ, *p, *q, *f;
-
-  /* nXY is number of voxels in each plane (xy) */
-  /* nXYZ is number of voxels in 3D image */
-  nXY = nX * nY;
-  nXYZ = nX * nY * nZ;
-
-  /* if binary image is provided in the array img, copy it to the arry edt */
-  /* this is effectively equivalent to computing D_0 */
-  if (img != NULL) {
-    c = img;
-    p = edt;
-    for (i = 0; i < nXYZ; i++, c++, p++) {
-      *p = *c;
-    }
-  }
-
-  /* compute D_2 */
-  /* call edtComputeEDT_2D for each plane */
-  p = edt;
-  for (k = 0; k < nZ; k++, p += nXY) {
-    edtComputeEDT_2D(NULL, p, nX, nY);
-  }
-
-  /* compute D_3 */
-  /* solve 1D problem for each column (z direction) */
-  f = (long *)malloc(nZ * sizeof(long));
-  if (f == NULL) {
-    fprintf(stderr, "Error in edtComputeEDT_3D()\n");
-    fprintf(stderr, "Cannot malloc f\n");
-    exit(EXIT_FAILURE);
-  }
-  for (i = 0; i < nXY; i++) {
-    /* fill array f with D_2 distances in column */
-    /* this is essentially line 4 in Procedure VoronoiEDT() in tPAMI paper */
-    p = edt + i;
-    q = f;
-    for (k = 0; k < nZ; k++, p += nXY, q++) {
-      *q = *p;
-    }
-    /* call edtVornoiEDT */
-    if (edtVornoiEDT(f, nZ)) {
-      p = edt + i;
-      q = f;
-      for (k = 0; k < nZ; k++, p += nXY, q++) {
-        *p = *q;
       }
+      /* square distance */
+      /* (we use squared distance in rest of algorithm) */
+      *p *= w;
+      *p *= *p;
     }
   }
-  free(f);
-} /* edtComputeEDT_3D */
+}
 
 // -----------------------------------------------------------------------------
-// This is Procedure edtVornoiEDT() in tPAMI paper.
-template <class VoxelType>
-int EuclideanDistanceTransform<VoxelType>::edtVornoiEDT(long *f, long n)
+/// This is Procedure VoronoiEDT() in tPAMI paper
+///
+/// The squared distances \p f of one line are of type \p T, whereas the
+/// partial Voronoi diagram is computed using arithmetic of type \p S.
+/// The scratch arrays \p g and \p h must have (at least) size \p n.
+///
+/// \returns 1 if the diagram was queried, 0 if the line has no feature voxels.
+template <class T, class S>
+int VoronoiEDT(T *f, long n, double w, S *g, S *h, T max_dist2)
 {
-  const VoxelType max_dist2 = VoxelType(EDT_MAX_DISTANCE_SQUARED);
-
-  long i, l, a, b, c, v, n_S, lhs, rhs;
-  static int firstCall = 1;
-  static long *g, *h, size_gh = 0;
-
-  /* this procedure is called often */
-  /* we keep static arrays to avoid frequent calls to malloc() */
-  /* the downside is that this memory is never freed, */
-  /* but it is not so much memory: max(nX,nY,nZ)*sizeof(long) */
-  /* need to check if arrays are sufficiently large */
-  if (n > size_gh && !firstCall) {
-    free(g);
-    free(h);
-    firstCall = 1;
-  }
-  /* malloc arrays if this is first call to procedure, or if arrays */
-  /* are too small and need to be reallocated */
-  if (firstCall) {
-    g = (long *)malloc(n * sizeof(long));
-    if (g == NULL) {
-      fprintf(stderr, "Error in edtVornoiEDT()\n");
-      fprintf(stderr, "Cannot malloc g\n");
-      exit(EXIT_FAILURE);
-    }
-    h = (long *)malloc(n * sizeof(long));
-    if (h == NULL) {
-      fprintf(stderr, "Error in edtVornoiEDT()\n");
-      fprintf(stderr, "Cannot malloc h\n");
-      exit(EXIT_FAILURE);
-    }
-    size_gh = n;
-    firstCall = 0;
-  }
+  long i, l, n_S;
+  S a, b, c, v, lhs, rhs;
 
   /* construct partial Vornoi diagram */
   /* this loop is lines 1-14 in Procedure edtVornoiEDT() in tPAMI paper */
@@ -266,8 +112,8 @@ int EuclideanDistanceTransform<VoxelType>::edtVornoiEDT(long *f, long n)
       /* line 5 */
       if (l < 1) {
         /* line 6 */
-        g[++l] = f[i];
-        h[l] = i;
+        g[++l] = static_cast<S>(f[i]);
+        h[l] = static_cast<S>(w * i);
       }
       /* line 7 */
       else {
@@ -276,10 +122,10 @@ int EuclideanDistanceTransform<VoxelType>::edtVornoiEDT(long *f, long n)
           /* compute removeEDT() in line 8 */
           v = h[l];
           a = v - h[l-1];
-          b = i - v;
+          b = static_cast<S>(w * i) - v;
           c = a + b;
           /* compute Eq. 2 */
-          if ((c*g[l] - b*g[l-1] - a*f[i] - a*b*c) > 0) {
+          if ((c*g[l] - b*g[l-1] - a*static_cast<S>(f[i]) - a*b*c) > S(0)) {
             /* line 9 */
             l--;
           } else {
@@ -287,8 +133,8 @@ int EuclideanDistanceTransform<VoxelType>::edtVornoiEDT(long *f, long n)
           }
         }
         /* line 11 */
-        g[++l] = f[i];
-        h[l] = i;
+        g[++l] = static_cast<S>(f[i]);
+        h[l] = static_cast<S>(w * i);
       }
     }
   }
@@ -304,10 +150,10 @@ int EuclideanDistanceTransform<VoxelType>::edtVornoiEDT(long *f, long n)
     /* we reduce number of arithmetic operations by taking advantage of */
     /* similarities in successive computations instead of treating them as */
     /* independent ones */
-    a = h[l] - i;
+    a = h[l] - static_cast<S>(w * i);
     lhs = g[l] + a * a;
     while (l < n_S - 1) {
-      a = h[l+1] - i;
+      a = h[l+1] - static_cast<S>(w * i);
       rhs = g[l+1] + a * a;
       if (lhs > rhs) {
         /* line 21 */
@@ -320,124 +166,248 @@ int EuclideanDistanceTransform<VoxelType>::edtVornoiEDT(long *f, long n)
     /* line 23 */
     /* we put distance into the 1D array that was passed; */
     /* must copy into EDT in calling procedure */
-    f[i] = lhs;
+    f[i] = static_cast<T>(lhs);
   }
   /* line 25 */
   /* return 1 if we queried diagram, 0 if we returned because n_S = 0 */
   return (1);
-} /* edtVornoiEDT */
+}
 
 // -----------------------------------------------------------------------------
-// This is Procedure edtVornoiEDT() in tPAMI paper.
-template <class VoxelType>
-int EuclideanDistanceTransform<VoxelType>::edtVornoiEDT_anisotropic(VoxelType *f, long n, double w)
+/// Initialize D_0 from binary image, where non-zero voxels are feature voxels
+template <class TIn, class T>
+class InitializeEDT
 {
-  const VoxelType max_dist2 = VoxelType(EDT_MAX_DISTANCE_SQUARED_ANISOTROPIC);
+  const TIn *_Input;
+  T         *_Output;
 
-  long i, l, n_S;
-  float a, b, c, v, lhs, rhs;
-  static int firstCall = 1;
-  static long size_gh = 0;
-  static float *g, *h;
-
-  /* this procedure is called often */
-  /* we keep static arrays to avoid frequent calls to malloc() */
-  /* the downside is that this memory is never freed, */
-  /* but it is not so much memory: max(nX,nY,nZ)*sizeof(long) */
-  /* need to check if arrays are sufficiently large */
-  if (n > size_gh && !firstCall) {
-    free(g);
-    free(h);
-    firstCall = 1;
-  }
-  /* malloc arrays if this is first call to procedure, or if arrays */
-  /* are too small and need to be reallocated */
-  if (firstCall) {
-    g = (float *)malloc(n * sizeof(float));
-    if (g == NULL) {
-      fprintf(stderr, "Error in edtVornoiEDT()\n");
-      fprintf(stderr, "Cannot malloc g\n");
-      exit(EXIT_FAILURE);
+public:
+
+  InitializeEDT(const TIn *in, T *out) : _Input(in), _Output(out) {}
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    for (int i = re.begin(); i != re.end(); ++i) {
+      _Output[i] = (_Input[i] != TIn(0) ? T(1) : T(0));
     }
-    h = (float *)malloc(n * sizeof(float));
-    if (h == NULL) {
-      fprintf(stderr, "Error in edtVornoiEDT()\n");
-      fprintf(stderr, "Cannot malloc h\n");
-      exit(EXIT_FAILURE);
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Compute D_1 for each row of the image (x direction)
+template <class T>
+class ComputeEDTAlongRows
+{
+  T   *_EDT;
+  long _N;
+  T    _MaxDist2;
+  T    _W;
+
+public:
+
+  ComputeEDTAlongRows(T *edt, long n, T max_dist2, T w)
+  :
+    _EDT(edt), _N(n), _MaxDist2(max_dist2), _W(w)
+  {}
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    for (int l = re.begin(); l != re.end(); ++l) {
+      DistanceAlongRow(_EDT + l * _N, _N, _MaxDist2, _W);
     }
-    size_gh = n;
-    firstCall = 0;
   }
+};
 
-  /* construct partial Vornoi diagram */
-  /* this loop is lines 1-14 in Procedure edtVornoiEDT() in tPAMI paper */
-  /* note we use 0 indexing in this program whereas paper uses 1 indexing */
-  for (i = 0, l = -1; i < n; i++) {
-    /* line 4 */
-    if (f[i] != max_dist2) {
-      /* line 5 */
-      if (l < 1) {
-        /* line 6 */
-        g[++l] = static_cast<float>(f[i]);
-        h[l] = static_cast<float>(w * i);
+// -----------------------------------------------------------------------------
+/// Solve 1D problem for each column of the image (y or z direction)
+///
+/// Line index L corresponds to the image column starting at offset
+/// (L / inner) * outer + L % inner, where the image values of the column
+/// are separated by the given stride. Adjacent columns are copied in blocks
+/// to a thread-local buffer to make better use of the cache.
+template <class T, class S>
+class ComputeEDTAlongColumns
+{
+  T     *_EDT;
+  long   _N;
+  long   _Stride;
+  long   _Inner;
+  long   _Outer;
+  double _W;
+  T      _MaxDist2;
+
+public:
+
+  ComputeEDTAlongColumns(T *edt, long n, long stride, long inner, long outer,
+                         double w, T max_dist2)
+  :
+    _EDT(edt), _N(n), _Stride(stride), _Inner(inner), _Outer(outer),
+    _W(w), _MaxDist2(max_dist2)
+  {}
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    Array<T> f(MaxLinesPerBlock * _N);
+    Array<S> g(_N), h(_N);
+    bool changed[MaxLinesPerBlock];
+    for (long L = re.begin(), m; L < re.end(); L += m) {
+      const long o = L % _Inner;
+      m = min(min(long(MaxLinesPerBlock), long(re.end()) - L), _Inner - o);
+      T * const col = _EDT + (L / _Inner) * _Outer + o;
+      /* fill array f with distances of m adjacent columns */
+      /* this is essentially line 4 in Procedure VoronoiEDT() in tPAMI paper */
+      const T *p = col;
+      for (long j = 0; j < _N; ++j, p += _Stride) {
+        for (long b = 0; b < m; ++b) f[b * _N + j] = p[b];
       }
-      /* line 7 */
-      else {
-        /* line 8 */
-        while (l >= 1) {
-          /* compute removeEDT() in line 8 */
-          v = h[l];
-          a = v - h[l-1];
-          b = static_cast<float>(w * i) - v;
-          c = a + b;
-          /* compute Eq. 2 */
-          if ((c*g[l] - b*g[l-1] - a*static_cast<float>(f[i]) - a*b*c) > .0f) {
-            /* line 9 */
-            l--;
-          } else {
-            break;
-          }
+      /* solve 1D problem for each column */
+      for (long b = 0; b < m; ++b) {
+        changed[b] = (VoronoiEDT(f.data() + b * _N, _N, _W, g.data(), h.data(), _MaxDist2) != 0);
+      }
+      /* copy modified distances back */
+      T *q = col;
+      for (long j = 0; j < _N; ++j, q += _Stride) {
+        for (long b = 0; b < m; ++b) {
+          if (changed[b]) q[b] = f[b * _N + j];
         }
-        /* line 11 */
-        g[++l] = static_cast<float>(f[i]);
-        h[l] = static_cast<float>(w * i);
       }
     }
   }
-  /* query partial Vornoi diagram */
-  /* this is lines 15-25 in Procedure edtVornoiEDT() in tPAMI paper */
-  /* lines 15-17 */
-  if ((n_S = l + 1) == 0) {
-    return (0);
+};
+
+// -----------------------------------------------------------------------------
+/// Compute squared EDT of a 3D image, or of each 2D slice when \p along_z is false
+template <class T, class S>
+void ComputeEDT(T *edt, long nX, long nY, long nZ, double wX, double wY, double wZ,
+                T max_dist2, bool along_z = true)
+{
+  const long nXY = nX * nY;
+
+  /* compute D_1 */
+  ComputeEDTAlongRows<T> rows(edt, nX, max_dist2, static_cast<T>(wX));
+  parallel_for(blocked_range<int>(0, static_cast<int>(nY * nZ)), rows);
+
+  /* compute D_2 */
+  /* solve 1D problem for each column (y direction) */
+  ComputeEDTAlongColumns<T, S> cols(edt, nY, nX, nX, nXY, wY, max_dist2);
+  parallel_for(blocked_range<int>(0, static_cast<int>(nX * nZ)), cols);
+
+  /* compute D_3 */
+  /* solve 1D problem for each column (z direction) */
+  if (along_z && nZ > 1) {
+    ComputeEDTAlongColumns<T, S> lines(edt, nZ, nXY, nXY, 0, wZ, max_dist2);
+    parallel_for(blocked_range<int>(0, static_cast<int>(nXY)), lines);
   }
-  /* lines 18-19 */
-  for (i = 0, l = 0; i < n; i++) {
-    /* line 20 */
-    /* we reduce number of arithmetic operations by taking advantage of */
-    /* similarities in successive computations instead of treating them as */
-    /* independent ones */
-    a = h[l] - static_cast<float>(w * i);
-    lhs = g[l] + a * a;
-    while (l < n_S - 1) {
-      a = h[l+1] - static_cast<float>(w * i);
-      rhs = g[l+1] + a * a;
-      if (lhs > rhs) {
-        /* line 21 */
-        l++;
-        lhs = rhs;
+}
+
+// -----------------------------------------------------------------------------
+/// Convert squared EDT in voxel units to output voxel type
+///
+/// Voxels without feature voxel in their row, column, or slice keep the
+/// maximum squared distance, which is not scaled by the voxel size such that
+/// the output matches the one computed for anisotropic voxels.
+template <class TVoxel>
+class ConvertEDT
+{
+  const int *_EDT;
+  TVoxel    *_Output;
+  double     _Scale;
+
+public:
+
+  ConvertEDT(const int *edt, TVoxel *out, double scale)
+  :
+    _EDT(edt), _Output(out), _Scale(scale)
+  {}
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    const TVoxel max_dist2 = TVoxel(EDT_MAX_DISTANCE_SQUARED_ANISOTROPIC);
+    for (int i = re.begin(); i != re.end(); ++i) {
+      if (_EDT[i] == int(EDT_MAX_DISTANCE_SQUARED)) {
+        _Output[i] = max_dist2;
       } else {
-        break;
+        _Output[i] = static_cast<TVoxel>(_Scale * static_cast<double>(_EDT[i]));
       }
     }
-    /* line 23 */
-    /* we put distance into the 1D array that was passed; */
-    /* must copy into EDT in calling procedure */
-    f[i] = static_cast<VoxelType>(lhs);
   }
-  /* line 25 */
-  /* return 1 if we queried diagram, 0 if we returned because n_S = 0 */
-  return (1);
-} /* edtVornoiEDT_anisotropic */
+};
+
+
+} // namespace EuclideanDistanceTransformUtils
+using namespace EuclideanDistanceTransformUtils;
+
+// =============================================================================
+// EuclideanDistanceTransform
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+template <class VoxelType>
+EuclideanDistanceTransform<VoxelType>
+::EuclideanDistanceTransform(Mode distanceTransformMode)
+{
+  _distanceTransformMode = distanceTransformMode;
+}
+
+// -----------------------------------------------------------------------------
+// This procedure computes the squared EDT of a 2D binary image with isotropic
+// voxels of unit dimension. The EDT can obviously be obtained simply from the
+// output by taking the square root of each element. The output can be scaled
+// to account for non-unit dimension. But neither of these functions are
+// provided as options in this procedure.
+//
+// The EDT is returned in the array edt. Memory for the array edt must be
+// allocated by the caller. The binary image can be provided in two different
+// ways. It can be provided in the array img. In this case it is not changed by
+// the procedure. Alternatively, the binary image can be provided in the array
+// edt. In this case, the array img must be the NULL pointer, and the binary
+// image will be overwritten by the EDT. The binary image doesn't have to
+// consist of 0's and 1's. A voxel value of 0 denotes a background voxel and
+// any other value denotes a foreground or feature voxel. The binary image and
+// EDT dimensions are nX x nY voxels.
+//
+// The squared distances are stored as 32-bit integers, while the partial
+// Voronoi diagrams are computed using 64-bit integer arithmetic. The rows
+// and columns of the image are processed in parallel.
+//
+// The procedure uses the algorithm described in the paper:
+// CR Maurer Jr, R Qi, V Raghavan. A linear time algorithm for computing exact
+// Euclidean distance transforms of binary images in arbitrary dimensions.
+// IEEE Transactions on Pattern Analysis and Machine Intelligence. In review.
+// A preliminary version of this paper was published in the conference
+// proceedings:
+// CR Maurer Jr, V Raghavan, R Qi. A linear time algorithm for computing the
+// Euclidean distance transform in arbitrary dimensions. In: MF Insana, RM
+// Leahy, eds. Information Processing in Medical Imaging (IPMI) 2001. Berlin:
+// Springer-Verlag, 2001, pp. 358-364. (Davis, CA, June 18-22, 2001).
+template <class VoxelType>
+void EuclideanDistanceTransform<VoxelType>::edtComputeEDT_2D(const char *img, int *edt, long nX, long nY)
+{
+  /* if binary image is provided in the array img, copy it to the arry edt */
+  /* this is effectively equivalent to computing D_0 */
+  if (img != NULL) {
+    InitializeEDT<char, int> init(img, edt);
+    parallel_for(blocked_range<int>(0, static_cast<int>(nX * nY)), init);
+  }
+  /* compute D_1 and D_2 = squared EDT */
+  ComputeEDT<int, long>(edt, nX, nY, 1, 1., 1., 1., int(EDT_MAX_DISTANCE_SQUARED), false);
+} /* edtComputeEDT_2D */
+
+// -----------------------------------------------------------------------------
+// This procedure computes the squared EDT of a 3D binary image with isotropic
+// voxels of unit dimension. See notes for edtComputeEDT_2D.
+template <class VoxelType>
+void EuclideanDistanceTransform<VoxelType>::edtComputeEDT_3D(const char *img, int *edt, long nX, long nY, long nZ)
+{
+  /* if binary image is provided in the array img, copy it to the arry edt */
+  /* this is effectively equivalent to computing D_0 */
+  if (img != NULL) {
+    InitializeEDT<char, int> init(img, edt);
+    parallel_for(blocked_range<int>(0, static_cast<int>(nX * nY * nZ)), init);
+  }
+  /* compute D_1, D_2, and D_3 = squared EDT */
+  ComputeEDT<int, long>(edt, nX, nY, nZ, 1., 1., 1., int(EDT_MAX_DISTANCE_SQUARED));
+} /* edtComputeEDT_3D */
 
 // -----------------------------------------------------------------------------
 // This procedure computes the squared EDT of a 2D binary image with anisotropic
@@ -448,91 +418,14 @@ template <class VoxelType>
 void EuclideanDistanceTransform<VoxelType>
 ::edtComputeEDT_2D_anisotropic(const VoxelType *img, VoxelType *edt, long nX, long nY, double wX, double wY)
 {
-  const VoxelType max_dist2 = VoxelType(EDT_MAX_DISTANCE_SQUARED_ANISOTROPIC);
-
-  const VoxelType *c;
-  VoxelType d, *p, *q, *f;
-
-  /* nXY is number of voxels in 2D image */
-  const long nXY = nX * nY;
-
   /* if binary image is provided in the array img, copy it to the arry edt */
   /* this is effectively equivalent to computing D_0 */
-  if (img != nullptr) {
-    c = img;
-    p = edt;
-    memcpy(edt, img, nXY * sizeof(VoxelType));
+  if (img != nullptr && img != edt) {
+    memcpy(edt, img, nX * nY * sizeof(VoxelType));
   }
-
-  /* compute D_1 as simple forward-and-reverse distance propagation */
-  /* (instead of calling edtVornoiEDT) */
-  /* D_1 is distance to closest feature voxel in row (x direction) */
-  /* it is possible to use a simple distance propagation for D_1  because */
-  /* L_1 and L_2 norms are equivalent for 1D case */
-  for (long j = 0; j < nY; j++) {
-    /* forward pass */
-    p = edt + j * nX;
-    d = max_dist2;
-    for (long i = 0; i < nX; i++, p++) {
-      /* set d = 0 when we encounter a feature voxel */
-      if (*p) {
-        *p = d = 0;
-      /* increment distance ... */
-      } else if (d != max_dist2) {
-        *p = ++d;
-      /* ... unless we haven't encountered a feature voxel yet */
-      } else {
-        *p = max_dist2;
-      }
-    }
-    /* reverse pass */
-    if (*(--p) != max_dist2) {
-      d = max_dist2;
-      for (long i = nX - 1; i >= 0; i--, p--) {
-        /* set d = 0 when we encounter a feature voxel */
-        if (*p == 0) {
-          d = 0;
-        /* increment distance after encountering a feature voxel */
-        } else if (d != max_dist2) {
-          /* compare forward and reverse distances */
-          if (++d < *p) {
-            *p = d;
-          }
-        }
-        /* square distance */
-        /* (we use squared distance in rest of algorithm) */
-        *p *= static_cast<VoxelType>(wX);
-        *p *= *p;
-      }
-    }
-  }
-
-  /* compute D_2 = squared EDT */
-  /* solve 1D problem for each column (y direction) */
-  f = (VoxelType *)malloc(nY * sizeof(VoxelType));
-  if (f == NULL) {
-    fprintf(stderr, "Error in edtComputeEDT_2D()\n");
-    fprintf(stderr, "Cannot malloc f\n");
-    exit(EXIT_FAILURE);
-  }
-  for (long i = 0; i < nX; i++) {
-    /* fill array f with D_1 distances in column */
-    /* this is essentially line 4 in Procedure VoronoiEDT() in tPAMI paper */
-    p = edt + i;
-    q = f;
-    for (long j = 0; j < nY; j++, p += nX, q++) {
-      *q = *p;
-    }
-    /* call edtVornoiEDT */
-    if (edtVornoiEDT_anisotropic(f, nY, wY)) {
-      p = edt + i;
-      q = f;
-      for (long j = 0; j < nY; j++, p += nX, q++) {
-        *p = *q;
-      }
-    }
-  }
-  free(f);
+  /* compute D_1 and D_2 = squared EDT */
+  const VoxelType max_dist2 = VoxelType(EDT_MAX_DISTANCE_SQUARED_ANISOTROPIC);
+  ComputeEDT<VoxelType, float>(edt, nX, nY, 1, wX, wY, 1., max_dist2, false);
 } /* edtComputeEDT_2D_anisotropic */
 
 // -----------------------------------------------------------------------------
@@ -543,58 +436,14 @@ void EuclideanDistanceTransform<VoxelType>
 ::edtComputeEDT_3D_anisotropic(const VoxelType *img, VoxelType *edt,
                                long nX, long nY, long nZ, double wX, double wY, double wZ)
 {
-  const VoxelType *c;
-  long i, k, nXY, nXYZ;
-  VoxelType *p, *q, *f;
-
-  /* nXY is number of voxels in each plane (xy) */
-  /* nXYZ is number of voxels in 3D image */
-  nXY = nX * nY;
-  nXYZ = nX * nY * nZ;
-
   /* if binary image is provided in the array img, copy it to the arry edt */
   /* this is effectively equivalent to computing D_0 */
-  if (img != NULL) {
-    c = img;
-    p = edt;
-    for (i = 0; i < nXYZ; i++, c++, p++) {
-      *p = *c;
-    }
-  }
-
-  /* compute D_2 */
-  /* call edtComputeEDT_2D for each plane */
-  p = edt;
-  for (k = 0; k < nZ; k++, p += nXY) {
-    edtComputeEDT_2D_anisotropic(NULL, p, nX, nY, wX, wY);
-  }
-
-  /* compute D_3 */
-  /* solve 1D problem for each column (z direction) */
-  f = (VoxelType *)malloc(nZ * sizeof(VoxelType));
-  if (f == NULL) {
-    fprintf(stderr, "Error in edtComputeEDT_3D()\n");
-    fprintf(stderr, "Cannot malloc f\n");
-    exit(EXIT_FAILURE);
-  }
-  for (i = 0; i < nXY; i++) {
-    /* fill array f with D_2 distances in column */
-    /* this is essentially line 4 in Procedure VoronoiEDT() in tPAMI paper */
-    p = edt + i;
-    q = f;
-    for (k = 0; k < nZ; k++, p += nXY, q++) {
-      *q = *p;
-    }
-    /* call edtVornoiEDT */
-    if (edtVornoiEDT_anisotropic(f, nZ, wZ)) {
-      p = edt + i;
-      q = f;
-      for (k = 0; k < nZ; k++, p += nXY, q++) {
-        *p = *q;
-      }
-    }
+  if (img != nullptr && img != edt) {
+    memcpy(edt, img, nX * nY * nZ * sizeof(VoxelType));
   }
-  free(f);
+  /* compute D_1, D_2, and D_3 = squared EDT */
+  const VoxelType max_dist2 = VoxelType(EDT_MAX_DISTANCE_SQUARED_ANISOTROPIC);
+  ComputeEDT<VoxelType, float>(edt, nX, nY, nZ, wX, wY, wZ, max_dist2);
 } /* edtComputeEDT_3D_anisotropic */
 
 // -----------------------------------------------------------------------------
@@ -619,20 +468,36 @@ void EuclideanDistanceTransform<VoxelType>::Run()
   const double dy = input->YSize();
   const double dz = input->ZSize();
 
+  // Use exact integer arithmetic in case of isotropic voxels
+  const bool isotropic = (fequal(dx, dy) && (_distanceTransformMode == DT_2D || fequal(dx, dz)));
+  Array<int> edt;
+  if (isotropic) edt.resize(static_cast<size_t>(nx) * ny * nz);
+  const int n = static_cast<int>(edt.size());
+
   for (int t = 0; t < nt; ++t) {
-	  if (_distanceTransformMode == DT_3D) {
-		  edtComputeEDT_3D_anisotropic(
-        input ->Data(0, 0, 0, t),
-			  output->Data(0, 0, 0, t),
-			  nx, ny, nz, dx, dy, dz);
-	  } else {
-		  for (int z = 0; z < nz; ++z) {
-			  edtComputeEDT_2D_anisotropic(
-          input ->Data(0, 0, z, t),
-				  output->Data(0, 0, z, t),
-				  nx, ny, dx, dy);
-		  }
-	  }
+    if (isotropic) {
+      InitializeEDT<VoxelType, int> init(input->Data(0, 0, 0, t), edt.data());
+      parallel_for(blocked_range<int>(0, n), init);
+      if (_distanceTransformMode == DT_3D) {
+        edtComputeEDT_3D(nullptr, edt.data(), nx, ny, nz);
+      } else {
+        ComputeEDT<int, long>(edt.data(), nx, ny, nz, 1., 1., 1., int(EDT_MAX_DISTANCE_SQUARED), false);
+      }
+      ConvertEDT<VoxelType> convert(edt.data(), output->Data(0, 0, 0, t), dx * dx);
+      parallel_for(blocked_range<int>(0, n), convert);
+    } else if (_distanceTransformMode == DT_3D) {
+      edtComputeEDT_3D_anisotropic(input ->Data(0, 0, 0, t),
+                                   output->Data(0, 0, 0, t),
+                                   nx, ny, nz, dx, dy, dz);
+    } else {
+      // Slices are processed all at once, without D_3 along z
+      VoxelType *edt2d = output->Data(0, 0, 0, t);
+      if (input->Data(0, 0, 0, t) != edt2d) {
+        memcpy(edt2d, input->Data(0, 0, 0, t), static_cast<size_t>(nx) * ny * nz * sizeof(VoxelType));
+      }
+      const VoxelType max_dist2 = VoxelType(EDT_MAX_DISTANCE_SQUARED_ANISOTROPIC);
+      ComputeEDT<VoxelType, float>(edt2d, nx, ny, nz, dx, dy, 1., max_dist2, false);
+    }
   }
 
   // Do the final cleaning up
@@ -22,17 +22,243 @@
 
 #include "mirtk/Math.h"
 #include "mirtk/Memory.h"
+#include "mirtk/Array.h"
 #include "mirtk/GenericImage.h"
-#include "mirtk/ConvolutionFunction.h"
 #include "mirtk/ScalarFunctionToImage.h"
 #include "mirtk/ScalarGaussian.h"
 #include "mirtk/Profiling.h"
+#include "mirtk/Parallel.h"
 #include "mirtk/Deallocate.h"
 
 
 namespace mirtk {
 
 
+// =============================================================================
+// Auxiliary functors
+// =============================================================================
+
+namespace GaussianBlurringUtils {
+
+
+// -----------------------------------------------------------------------------
+/// 1D Gaussian filter applied to lines of adjacent image columns
+///
+/// The input and output lines are stored one after the other in contiguous
+/// memory, such that the filter is applied to all columns of a line at once.
+struct GaussianFilter1D
+{
+  /// Minimum standard deviation in voxel units for which the recursive
+  /// filter coefficients of Young and van Vliet (1995) are valid
+  static const double MinRecursiveSigma;
+
+  Array<double> _Kernel;    ///< FIR kernel, empty if not used
+  bool          _Recursive; ///< Whether to apply recursive filter
+  double        _B;         ///< Normalized input coefficient of recursive filter
+  double        _b[3];      ///< Normalized feedback coefficients of recursive filter
+
+  GaussianFilter1D() : _Recursive(false), _B(.0)
+  {
+    _b[0] = _b[1] = _b[2] = .0;
+  }
+
+  /// Whether this filter is applied
+  bool IsEnabled() const
+  {
+    return _Recursive || !_Kernel.empty();
+  }
+
+  /// Use discrete FIR kernel
+  void Initialize(const RealPixel *kernel, int size)
+  {
+    _Recursive = false;
+    _Kernel.resize(size);
+    for (int n = 0; n < size; ++n) _Kernel[n] = static_cast<double>(kernel[n]);
+  }
+
+  /// Use recursive approximation of Gaussian with given standard deviation
+  void InitializeRecursive(double sigma)
+  {
+    double q;
+    if (sigma >= 2.5) q = .98711 * sigma - .96330;
+    else              q = 3.97156 - 4.14554 * sqrt(1.0 - .26891 * sigma);
+    const double q2 = q * q, q3 = q2 * q;
+    const double b0 = 1.57825 + 2.44413 * q + 1.4281 * q2 + .422205 * q3;
+    _b[0] = (2.44413 * q + 2.85619 * q2 + 1.26661 * q3) / b0;
+    _b[1] = - (1.4281 * q2 + 1.26661 * q3) / b0;
+    _b[2] = .422205 * q3 / b0;
+    _B    = 1.0 - (_b[0] + _b[1] + _b[2]);
+    _Recursive = true;
+    _Kernel.clear();
+  }
+
+  /// Convolve n lines of w adjacent columns
+  ///
+  /// The FIR kernel is truncated at the boundary and normalized by the sum of
+  /// the overlapping kernel weights. The recursive filter is initialized with
+  /// the steady state of a constant continuation of the boundary values.
+  void operator ()(const double *in, double *out, int n, int w) const
+  {
+    if (_Recursive) {
+      // Causal pass
+      const double *p1, *p2, *p3;
+      double       *o = out;
+      for (int i = 0; i < n; ++i, in += w, o += w) {
+        p1 = (i > 0 ? o - w     : in - i * w);
+        p2 = (i > 1 ? o - 2 * w : in - i * w);
+        p3 = (i > 2 ? o - 3 * w : in - i * w);
+        for (int x = 0; x < w; ++x) {
+          o[x] = _B * in[x] + _b[0] * p1[x] + _b[1] * p2[x] + _b[2] * p3[x];
+        }
+      }
+      // Anti-causal pass, the last line is the steady state of its continuation
+      const double *last = out + (n - 1) * w;
+      o = out + (n - 2) * w;
+      for (int i = n - 2; i >= 0; --i, o -= w) {
+        p1 = (i + 1 < n ? o + w     : last);
+        p2 = (i + 2 < n ? o + 2 * w : last);
+        p3 = (i + 3 < n ? o + 3 * w : last);
+        for (int x = 0; x < w; ++x) {
+          o[x] = _B * o[x] + _b[0] * p1[x] + _b[1] * p2[x] + _b[2] * p3[x];
+        }
+      }
+    } else {
+      const int     r = (static_cast<int>(_Kernel.size()) - 1) / 2;
+      const double *kernel = _Kernel.data();
+      const double *p;
+      double        k, sum, acc;
+      int           j, m;
+      if (w == 1) {
+        for (int i = 0; i < n; ++i, ++out) {
+          j = i - r, m = r + r;
+          if (j < 0) m += j, j = 0;
+          for (p = in + j, acc = sum = .0; j < n && m >= 0; ++j, --m, ++p) {
+            k = kernel[m];
+            acc += k * (*p);
+            sum += k;
+          }
+          if (sum != .0) acc /= sum;
+          *out = acc;
+        }
+        return;
+      }
+      for (int i = 0; i < n; ++i, out += w) {
+        // Go to start of input and end of kernel
+        j = i - r, m = r + r;
+        // Outside left boundary
+        if (j < 0) m += j, j = 0;
+        // Inside image domain
+        for (int x = 0; x < w; ++x) out[x] = .0;
+        for (p = in + j * w, sum = .0; j < n && m >= 0; ++j, --m, p += w) {
+          k = kernel[m];
+          for (int x = 0; x < w; ++x) out[x] += k * p[x];
+          sum += k;
+        }
+        if (sum != .0) {
+          for (int x = 0; x < w; ++x) out[x] /= sum;
+        }
+      }
+    }
+  }
+};
+
+const double GaussianFilter1D::MinRecursiveSigma = .5;
+
+// -----------------------------------------------------------------------------
+/// Convolve image slices along x and y
+///
+/// Each slice is first convolved along x row by row and then along y, where
+/// all columns of the slice are processed at once. The intermediate result is
+/// cast to the voxel type as if it were stored in an image.
+template <class VoxelType>
+struct ConvolveSlicesInXY
+{
+  const VoxelType        *_Input;   ///< Input image data
+  VoxelType              *_Output;  ///< Output image data, may equal input
+  int                     _X;       ///< Number of voxels in x
+  int                     _Y;       ///< Number of voxels in y
+  const GaussianFilter1D *_FilterX; ///< Filter along x
+  const GaussianFilter1D *_FilterY; ///< Filter along y
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    const int nxy = _X * _Y;
+    Array<double> slice(nxy), result(_FilterY->IsEnabled() ? nxy : _X);
+    for (int k = re.begin(); k != re.end(); ++k) {
+      const VoxelType *in  = _Input  + k * nxy;
+      VoxelType       *out = _Output + k * nxy;
+      for (int i = 0; i < nxy; ++i) {
+        slice[i] = static_cast<double>(in[i]);
+      }
+      if (_FilterX->IsEnabled()) {
+        double *row = slice.data();
+        for (int j = 0; j < _Y; ++j, row += _X) {
+          (*_FilterX)(row, result.data(), _X, 1);
+          for (int i = 0; i < _X; ++i) {
+            row[i] = static_cast<double>(static_cast<VoxelType>(result[i]));
+          }
+        }
+      }
+      if (_FilterY->IsEnabled()) {
+        (*_FilterY)(slice.data(), result.data(), _Y, _X);
+        for (int i = 0; i < nxy; ++i) out[i] = static_cast<VoxelType>(result[i]);
+      } else {
+        for (int i = 0; i < nxy; ++i) out[i] = static_cast<VoxelType>(slice[i]);
+      }
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Convolve image along z or t in tiles of adjacent image columns
+///
+/// The n-th work item convolves the lines which start at the image row with
+/// offset (n / _Inner) * _Outer + (n % _Inner) * _X, where consecutive line
+/// elements are _Stride voxels apart.
+template <class VoxelType>
+struct ConvolveColumns
+{
+  static const int TileSize = 64;
+
+  const VoxelType        *_Input;  ///< Input image data
+  VoxelType              *_Output; ///< Output image data, may equal input
+  int                     _X;      ///< Number of voxels in x
+  int                     _Inner;  ///< Number of rows per outer block
+  int                     _Outer;  ///< Offset between outer blocks of rows
+  int                     _Stride; ///< Offset between line elements
+  int                     _N;      ///< Number of line elements
+  const GaussianFilter1D *_Filter; ///< Filter along lines
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    Array<double> tile(TileSize * _N), result(TileSize * _N);
+    for (int r = re.begin(); r != re.end(); ++r) {
+      const int offset = (r / _Inner) * _Outer + (r % _Inner) * _X;
+      for (int i0 = 0; i0 < _X; i0 += TileSize) {
+        const int w = min(TileSize, _X - i0);
+        const VoxelType *in = _Input + offset + i0;
+        for (int n = 0; n < _N; ++n, in += _Stride) {
+          for (int i = 0; i < w; ++i) tile[n * w + i] = static_cast<double>(in[i]);
+        }
+        (*_Filter)(tile.data(), result.data(), _N, w);
+        VoxelType *out = _Output + offset + i0;
+        for (int n = 0; n < _N; ++n, out += _Stride) {
+          for (int i = 0; i < w; ++i) out[i] = static_cast<VoxelType>(result[n * w + i]);
+        }
+      }
+    }
+  }
+};
+
+
+} // namespace GaussianBlurringUtils
+
+using namespace GaussianBlurringUtils;
+
+// =============================================================================
+// Construction/Destruction
+// =============================================================================
+
 // -----------------------------------------------------------------------------
 template <class VoxelType>
 GaussianBlurring<VoxelType>::GaussianBlurring(double sigma)
@@ -41,6 +267,7 @@ GaussianBlurring<VoxelType>::GaussianBlurring(double sigma)
   _SigmaY(sigma),
   _SigmaZ(sigma),
   _SigmaT(.0),
+  _RecursiveSigma(.0),
   _Kernel(NULL)
 {
 }
@@ -53,6 +280,7 @@ GaussianBlurring<VoxelType>::GaussianBlurring(double xsigma, double ysigma, doub
   _SigmaY(ysigma),
   _SigmaZ(zsigma),
   _SigmaT(tsigma),
+  _RecursiveSigma(.0),
   _Kernel(NULL)
 {
 }
@@ -127,69 +355,74 @@ void GaussianBlurring<VoxelType>::Run()
   // Do the initial set up
   this->Initialize();
 
-  GenericImage<VoxelType> *input  = const_cast<GenericImage<VoxelType> *>(this->Input());
-  GenericImage<VoxelType> *output = this->Output();
+  const GenericImage<VoxelType> *input  = this->Input();
+  GenericImage<VoxelType>       *output = this->Output();
 
   const ImageAttributes &attr = input->Attributes();
-  const int N = ((attr._dt == .0) ? attr._t : 1);
-
-  // Blur along x axis
-  if (_SigmaX != .0 && input->X() > 1) {
-    if (output == this->Input()) output = new GenericImage<VoxelType>(attr);
-    this->InitializeKernel(_SigmaX / input->GetXSize());
-    for (int n = 0; n < N; ++n) {
-      using ConvolutionFunction::ConvolveInX;
-      ConvolveInX<RealPixel> conv(input, _Kernel->Data(), _Kernel->X(), true, n);
-      ParallelForEachVoxel(attr, input, output, conv);
-    }
-    swap(input, output);
-  }
 
-  // Blur along y axis
-  if (_SigmaY != .0 && input->Y() > 1) {
-    if (output == this->Input()) output = new GenericImage<VoxelType>(attr);
-    this->InitializeKernel(_SigmaY / input->GetYSize());
-    for (int n = 0; n < N; ++n) {
-      using ConvolutionFunction::ConvolveInY;
-      ConvolveInY<RealPixel> conv(input, _Kernel->Data(), _Kernel->X(), true, n);
-      ParallelForEachVoxel(attr, input, output, conv);
+  // Initialize 1D filters of dimensions to be blurred
+  const int    size [4] = {attr._x, attr._y, attr._z, attr._t};
+  const double sigma[4] = {_SigmaX, _SigmaY, _SigmaZ, _SigmaT};
+  const double delta[4] = {attr._dx, attr._dy, attr._dz, attr._dt};
+  GaussianFilter1D filter[4];
+  for (int d = 0; d < 4; ++d) {
+    if (sigma[d] != .0 && size[d] > 1) {
+      const double s = sigma[d] / delta[d];
+      if (_RecursiveSigma > .0 && s >= max(_RecursiveSigma, GaussianFilter1D::MinRecursiveSigma)) {
+        filter[d].InitializeRecursive(s);
+      } else {
+        this->InitializeKernel(s);
+        filter[d].Initialize(_Kernel->Data(), _Kernel->X());
+      }
     }
-    swap(input, output);
   }
 
-  // Blur along z axis
-  if (_SigmaZ != .0 && input->Z() > 1) {
-    if (output == this->Input()) output = new GenericImage<VoxelType>(attr);
-    this->InitializeKernel(_SigmaZ / input->GetZSize());
-    for (int n = 0; n < N; ++n) {
-      using ConvolutionFunction::ConvolveInZ;
-      ConvolveInZ<RealPixel> conv(input, _Kernel->Data(), _Kernel->X(), true, n);
-      ParallelForEachVoxel(attr, input, output, conv);
-    }
-    swap(input, output);
+  // Blur along x and y axes slice by slice
+  if (filter[0].IsEnabled() || filter[1].IsEnabled()) {
+    ConvolveSlicesInXY<VoxelType> conv;
+    conv._Input   = input->Data();
+    conv._Output  = output->Data();
+    conv._X       = attr._x;
+    conv._Y       = attr._y;
+    conv._FilterX = &filter[0];
+    conv._FilterY = &filter[1];
+    parallel_for(blocked_range<int>(0, attr._z * attr._t), conv);
+    input = output;
   }
 
-  // Blur along t axis
-  if (_SigmaT != .0 && input->T() > 1) {
-    if (output == this->Input()) output = new GenericImage<VoxelType>(attr);
-    this->InitializeKernel(_SigmaT / input->GetTSize());
-    using ConvolutionFunction::ConvolveInT;
-    ConvolveInT<RealPixel> conv(input, _Kernel->Data(), _Kernel->X(), true);
-    ParallelForEachVoxel(attr, input, output, conv);
-    swap(input, output);
+  // Blur along z axis tile by tile of image columns
+  if (filter[2].IsEnabled()) {
+    ConvolveColumns<VoxelType> conv;
+    conv._Input  = input->Data();
+    conv._Output = output->Data();
+    conv._X      = attr._x;
+    conv._Inner  = attr._y;
+    conv._Outer  = attr._x * attr._y * attr._z;
+    conv._Stride = attr._x * attr._y;
+    conv._N      = attr._z;
+    conv._Filter = &filter[2];
+    parallel_for(blocked_range<int>(0, attr._y * attr._t), conv);
+    input = output;
   }
 
-  // Copy result if last output (i.e., after swap input pointer) was not filter
-  // output image and delete possibly additionally allocated image
-  if (input != output) {
-    if (input == this->Output()) {
-      if (output != this->Input()) Delete(output);
-    } else {
-      this->Output()->CopyFrom(input->Data());
-      if (input != this->Input ()) Delete(input);
-    }
+  // Blur along t axis tile by tile of image columns
+  if (filter[3].IsEnabled()) {
+    ConvolveColumns<VoxelType> conv;
+    conv._Input  = input->Data();
+    conv._Output = output->Data();
+    conv._X      = attr._x;
+    conv._Inner  = attr._y * attr._z;
+    conv._Outer  = 0;
+    conv._Stride = attr._x * attr._y * attr._z;
+    conv._N      = attr._t;
+    conv._Filter = &filter[3];
+    parallel_for(blocked_range<int>(0, attr._y * attr._z), conv);
+    input = output;
   }
 
+  // Copy input if no blurring was applied at all
+  if (input != output) output->CopyFrom(input->Data());
+
   // Do the final cleaning up
   this->Finalize();
 
@@ -53,7 +53,7 @@ namespace mirtk {
 // -----------------------------------------------------------------------------
 // Note: Base class BaseImage must be initialized before calling this function!
 template <class VoxelType>
-void GenericImage<VoxelType>::AllocateImage(VoxelType *data)
+void GenericImage<VoxelType>::AllocateImage(VoxelType *data, const shared_ptr<void> &memory)
 {
   // Delete existing mask (if any)
   if (_maskOwner) Delete(_mask);
@@ -61,12 +61,14 @@ void GenericImage<VoxelType>::AllocateImage(VoxelType *data)
   Deallocate(_matrix, _data);
   if (_dataOwner) Deallocate(_data);
   _dataOwner = false;
+  _dataMemory.reset();
   // Initialize memory
   const int nvox = _attr.NumberOfLatticePoints();
   if (nvox > 0) {
     if (data) {
-      _data      = data;
-      _dataOwner = false;
+      _data       = data;
+      _dataOwner  = false;
+      _dataMemory = memory;
     } else {
       _data      = CAllocate<VoxelType>(nvox);
       _dataOwner = true;
@@ -159,6 +161,19 @@ GenericImage<VoxelType>::GenericImage(const ImageAttributes &attr, int n, VoxelT
   AllocateImage(data);
 }
 
+// -----------------------------------------------------------------------------
+template <class VoxelType>
+GenericImage<VoxelType>::GenericImage(const ImageAttributes &attr, VoxelType *data,
+                                      const shared_ptr<void> &memory)
+:
+  BaseImage(attr),
+  _matrix   (NULL),
+  _data     (NULL),
+  _dataOwner(false)
+{
+  AllocateImage(data, memory);
+}
+
 // -----------------------------------------------------------------------------
 template <class VoxelType>
 GenericImage<VoxelType>::GenericImage(const BaseImage &image)
@@ -186,7 +201,7 @@ GenericImage<VoxelType>::GenericImage(const GenericImage &image)
   _data     (NULL),
   _dataOwner(false)
 {
-  if (image._dataOwner) {
+  if (image._dataOwner || image._dataMemory) {
     AllocateImage();
     memcpy(_data, image._data, _NumberOfVoxels * sizeof(VoxelType));
   } else {
@@ -250,7 +265,7 @@ void GenericImage<VoxelType>::Initialize(const ImageAttributes &a, int n, VoxelT
     AllocateImage(data);
   } else {
     PutAttributes(attr);
-    if (_dataOwner) *this = VoxelType();
+    if (_dataOwner || _dataMemory) *this = VoxelType();
   }
 }
 
@@ -375,6 +390,7 @@ template <class VoxelType> void GenericImage<VoxelType>::Clear()
 {
   Deallocate(_matrix, _data);
   if (_dataOwner) Deallocate(_data);
+  _dataMemory.reset();
   if (_maskOwner) Delete(_mask);
   _attr = ImageAttributes();
 }
@@ -1747,6 +1763,17 @@ void GenericImage<VoxelType>::Read(const char *fname)
   // Read image
   unique_ptr<ImageReader> reader(ImageReader::New(fname));
   unique_ptr<BaseImage>   image(reader->Run());
+  // Refer to memory-mapped image data directly if no conversion is required
+  GenericImage *mapped = dynamic_cast<GenericImage *>(image.get());
+  if (mapped && mapped->_dataMemory &&
+      (reader->Slope() == .0 || reader->Slope() == 1.0) && reader->Intercept() == .0) {
+    PutAttributes(mapped->Attributes());
+    AllocateImage(mapped->_data, mapped->_dataMemory);
+    if (mapped->HasBackgroundValue()) {
+      this->PutBackgroundValueAsDouble(mapped->GetBackgroundValueAsDouble());
+    }
+    return;
+  }
   // Convert image
   switch (image->GetDataType()) {
     case MIRTK_VOXEL_CHAR:           { *this = *(dynamic_cast<GenericImage<char>           *>(image.get())); } break;
@@ -0,0 +1,184 @@
+/*
+ * Medical Image Registration ToolKit (MIRTK)
+ *
+ * Copyright 2026 Imperial College London
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mirtk/InterpolationCoefficientCache.h"
+
+#include "mirtk/Math.h"
+
+
+namespace mirtk {
+
+
+// =============================================================================
+// Auxiliary functors
+// =============================================================================
+
+namespace InterpolationCoefficientCacheUtils {
+
+
+/// Offset basis of 64-bit FNV-1a hash
+const unsigned long long FNVOffset = 14695981039346656037ULL;
+
+/// Prime of 64-bit FNV-1a hash
+const unsigned long long FNVPrime = 1099511628211ULL;
+
+/// Number of bytes of each block of image data hashed by one task
+const size_t BlockSize = 1 << 18;
+
+// -----------------------------------------------------------------------------
+/// Compute hash of each block of image data
+struct HashBlocks
+{
+  const unsigned char *_Data;
+  size_t               _Size;
+  unsigned long long  *_Hash;
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    for (int b = re.begin(); b != re.end(); ++b) {
+      const size_t begin = static_cast<size_t>(b) * BlockSize;
+      const size_t end   = min(begin + BlockSize, _Size);
+      unsigned long long h = FNVOffset, w;
+      size_t i = begin;
+      for (; i + sizeof(w) <= end; i += sizeof(w)) {
+        memcpy(&w, _Data + i, sizeof(w));
+        h = (h ^ w) * FNVPrime;
+      }
+      for (; i < end; ++i) {
+        h = (h ^ _Data[i]) * FNVPrime;
+      }
+      _Hash[b] = h;
+    }
+  }
+};
+
+
+} // namespace InterpolationCoefficientCacheUtils
+
+using namespace InterpolationCoefficientCacheUtils;
+
+// =============================================================================
+// Key
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+bool InterpolationCoefficientCache::Key::operator ==(const Key &other) const
+{
+  return _Data       == other._Data       &&
+         _Size[0]    == other._Size[0]    &&
+         _Size[1]    == other._Size[1]    &&
+         _Size[2]    == other._Size[2]    &&
+         _Size[3]    == other._Size[3]    &&
+         _InputType  == other._InputType  &&
+         _Type       == other._Type       &&
+         _Dimensions == other._Dimensions &&
+         _Checksum   == other._Checksum;
+}
+
+// =============================================================================
+// Singleton
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+InterpolationCoefficientCache::InterpolationCoefficientCache()
+{
+}
+
+// -----------------------------------------------------------------------------
+InterpolationCoefficientCache::~InterpolationCoefficientCache()
+{
+}
+
+// -----------------------------------------------------------------------------
+InterpolationCoefficientCache &InterpolationCoefficientCache::Instance()
+{
+  static InterpolationCoefficientCache instance;
+  return instance;
+}
+
+// =============================================================================
+// Cache entries
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+InterpolationCoefficientCache::Key
+InterpolationCoefficientCache::MakeKey(const BaseImage *image, int type, int dim)
+{
+  Key key;
+  key._Data       = image->GetDataPointer();
+  key._Size[0]    = image->X();
+  key._Size[1]    = image->Y();
+  key._Size[2]    = image->Z();
+  key._Size[3]    = image->T();
+  key._InputType  = image->GetDataType();
+  key._Type       = type;
+  key._Dimensions = dim;
+  // Hash blocks of image data in parallel and combine them in fixed order
+  HashBlocks hash;
+  hash._Data = reinterpret_cast<const unsigned char *>(key._Data);
+  hash._Size = static_cast<size_t>(image->NumberOfVoxels()) * image->GetDataTypeSize();
+  const int nblocks = static_cast<int>((hash._Size + BlockSize - 1) / BlockSize);
+  Array<unsigned long long> blocks(nblocks);
+  hash._Hash = blocks.data();
+  parallel_for(blocked_range<int>(0, nblocks), hash);
+  key._Checksum = FNVOffset;
+  for (int b = 0; b < nblocks; ++b) {
+    key._Checksum = (key._Checksum ^ blocks[b]) * FNVPrime;
+  }
+  return key;
+}
+
+// -----------------------------------------------------------------------------
+void InterpolationCoefficientCache::Purge()
+{
+  size_t n = 0;
+  for (size_t i = 0; i < _Entries.size(); ++i) {
+    if (!_Entries[i]._Coefficients.expired()) {
+      if (n != i) _Entries[n] = _Entries[i];
+      ++n;
+    }
+  }
+  _Entries.resize(n);
+}
+
+// -----------------------------------------------------------------------------
+shared_ptr<BaseImage> InterpolationCoefficientCache::Find(const Key &key) const
+{
+  mutex::scoped_lock lock(_Mutex);
+  for (size_t i = 0; i < _Entries.size(); ++i) {
+    if (_Entries[i]._Key == key) {
+      shared_ptr<BaseImage> coeff = _Entries[i]._Coefficients.lock();
+      if (coeff) return coeff;
+    }
+  }
+  return shared_ptr<BaseImage>();
+}
+
+// -----------------------------------------------------------------------------
+void InterpolationCoefficientCache::Insert(const Key &key, const shared_ptr<BaseImage> &coeff)
+{
+  mutex::scoped_lock lock(_Mutex);
+  Purge();
+  Entry entry;
+  entry._Key          = key;
+  entry._Coefficients = coeff;
+  _Entries.push_back(entry);
+}
+
+
+} // namespace mirtk
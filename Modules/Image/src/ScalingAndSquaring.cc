@@ -322,320 +322,174 @@ struct EvaluateJacobianAndDetAndLog : public EvaluateJacobianBase<TReal>
 };
 
 // -----------------------------------------------------------------------------
-/// Voxel function for update of displacement field at each squaring step
-template <class TInterpolator>
-struct UpdateDisplacement : public VoxelFunction
-{
-  typedef typename TInterpolator::VoxelType TReal;
-
-  const int            _x, _y, _z;
-  const TInterpolator *_Displacement;
-
-  UpdateDisplacement(const TInterpolator *f)
-  :
-    _x(0), _y(f->Input()->NumberOfSpatialVoxels()), _z(2 * _y),
-    _Displacement(f)
-  {}
-
-  void operator()(int i, int j, int k, int, const TReal *in, TReal *out)
-  {
-    double u[3] = {.0, .0, .0};
-    _Displacement->Evaluate(u, static_cast<double>(i + in[_x]),
-                               static_cast<double>(j + in[_y]),
-                               static_cast<double>(k + in[_z]));
-    out[_x] = in[_x] + static_cast<TReal>(u[0]);
-    out[_y] = in[_y] + static_cast<TReal>(u[1]);
-    out[_z] = in[_z] + static_cast<TReal>(u[2]);
-  }
-};
-
-// -----------------------------------------------------------------------------
-/// Voxel function for update of Jacobian w.r.t. x at each squaring step
-template <class TInterpolator>
-struct UpdateJacobianBase : public VoxelFunction
+/// Trilinear interpolation weights and offsets of the eight neighboring voxels
+///
+/// Neighbors outside the image domain are replaced by the nearest voxel
+/// inside the domain. The result is identical to the one of a linear
+/// interpolator with nearest neighbor extrapolation, but the weights and
+/// offsets are computed only once for all vector components and images.
+struct TrilinearSample
 {
-  typedef typename TInterpolator::VoxelType TReal;
-
-  static const int     _x = 0, _xx = 0;
-  int                  _y, _z, _xy, _xz, _yx, _yy, _yz, _zx, _zy, _zz;
-  const TInterpolator *_Jacobian;
-  const TInterpolator *_DetJacobian;
-  const TInterpolator *_LogJacobian;
+  int    _Offset[8];
+  double _A, _B, _C, _a, _b, _c;
 
-  inline void Initialize(const TInterpolator *j,
-                         const TInterpolator *dj,
-                         const TInterpolator *lj)
+  void Initialize(double x, double y, double z, int nx, int ny, int nz)
   {
-    // number of voxels
-    int n = 0;
-    if (j ) n = j ->Input()->NumberOfSpatialVoxels();
-    if (dj) n = dj->Input()->NumberOfSpatialVoxels();
-    if (lj) n = lj->Input()->NumberOfSpatialVoxels();
-    // vector element offsets
-    /* _x  = 0 */_y  = 1 * n; _z  = 2 * n;
-    // matrix element offsets
-    /* _xx = 0 */_xy = 1 * n; _xz = 2 * n;
-    _yx = 3 * n; _yy = 4 * n; _yz = 5 * n;
-    _zx = 6 * n; _zy = 7 * n; _zz = 8 * n;
-    // interpolators
-    _Jacobian    = j;
-    _DetJacobian = dj;
-    _LogJacobian = lj;
+    const int i = static_cast<int>(floor(x));
+    const int j = static_cast<int>(floor(y));
+    const int k = static_cast<int>(floor(z));
+    _A = x - i, _a = 1.0 - _A;
+    _B = y - j, _b = 1.0 - _B;
+    _C = z - k, _c = 1.0 - _C;
+    if (nz == 1) _C = .0, _c = 1.0;
+    const int i0 = max(0, min(i,     nx - 1));
+    const int i1 = max(0, min(i + 1, nx - 1));
+    const int j0 = max(0, min(j,     ny - 1)) * nx;
+    const int j1 = max(0, min(j + 1, ny - 1)) * nx;
+    const int k0 = max(0, min(k,     nz - 1)) * nx * ny;
+    const int k1 = max(0, min(k + 1, nz - 1)) * nx * ny;
+    _Offset[0] = i0 + j0 + k0;
+    _Offset[1] = i1 + j0 + k0;
+    _Offset[2] = i0 + j1 + k0;
+    _Offset[3] = i1 + j1 + k0;
+    _Offset[4] = i0 + j0 + k1;
+    _Offset[5] = i1 + j0 + k1;
+    _Offset[6] = i0 + j1 + k1;
+    _Offset[7] = i1 + j1 + k1;
   }
 
-  // ---------------------------------------------------------------------------
-  inline void Transform(double &x, double &y, double &z, const TReal *u)
+  template <class T>
+  T operator ()(const T *data) const
   {
-    x += static_cast<double>(u[_x]);
-    y += static_cast<double>(u[_y]);
-    z += static_cast<double>(u[_z]);
-  }
-
-  // ---------------------------------------------------------------------------
-  inline void UpdateJac(double x, double y, double z, const TReal *in, TReal *out)
-  {
-    if (_Jacobian->IsInside(x, y, z)) {
-      double jac[9];
-      _Jacobian->EvaluateInside(jac, x, y, z);
-      out[_xx] = static_cast<TReal>(jac[0]) * in[_xx]
-               + static_cast<TReal>(jac[1]) * in[_yx]
-               + static_cast<TReal>(jac[2]) * in[_zx];
-      out[_xy] = static_cast<TReal>(jac[0]) * in[_xy]
-               + static_cast<TReal>(jac[1]) * in[_yy]
-               + static_cast<TReal>(jac[2]) * in[_zy];
-      out[_xz] = static_cast<TReal>(jac[0]) * in[_xz]
-               + static_cast<TReal>(jac[1]) * in[_yz]
-               + static_cast<TReal>(jac[2]) * in[_zz];
-      out[_yx] = static_cast<TReal>(jac[3]) * in[_xx]
-               + static_cast<TReal>(jac[4]) * in[_yx]
-               + static_cast<TReal>(jac[5]) * in[_zx];
-      out[_yy] = static_cast<TReal>(jac[3]) * in[_xy]
-               + static_cast<TReal>(jac[4]) * in[_yy]
-               + static_cast<TReal>(jac[5]) * in[_zy];
-      out[_yz] = static_cast<TReal>(jac[3]) * in[_xz]
-               + static_cast<TReal>(jac[4]) * in[_yz]
-               + static_cast<TReal>(jac[5]) * in[_zz];
-      out[_zx] = static_cast<TReal>(jac[6]) * in[_xx]
-               + static_cast<TReal>(jac[7]) * in[_yx]
-               + static_cast<TReal>(jac[8]) * in[_zx];
-      out[_zy] = static_cast<TReal>(jac[6]) * in[_xy]
-               + static_cast<TReal>(jac[7]) * in[_yy]
-               + static_cast<TReal>(jac[8]) * in[_zy];
-      out[_zz] = static_cast<TReal>(jac[6]) * in[_xz]
-               + static_cast<TReal>(jac[7]) * in[_yz]
-               + static_cast<TReal>(jac[8]) * in[_zz];
-    } else {
-      out[_xx] = in[_xx]; out[_xy] = in[_xy]; out[_xz] = in[_xz];
-      out[_yx] = in[_yx]; out[_yy] = in[_yy]; out[_yz] = in[_yz];
-      out[_zx] = in[_zx]; out[_zy] = in[_zy]; out[_zz] = in[_zz];
-    }
-  }
-
-  // ---------------------------------------------------------------------------
-  inline void UpdateDet(double x, double y, double z, const TReal *dj_in, TReal *dj_out)
-  {
-    if (_DetJacobian->IsInside(x, y, z)) {
-      (*dj_out) = (*dj_in) * static_cast<TReal>(max(.0001, _DetJacobian->EvaluateInside(x, y, z)));
-    } else {
-      (*dj_out) = (*dj_in);
-    }
-  }
-
-  // ---------------------------------------------------------------------------
-  inline void UpdateLog(double x, double y, double z, const TReal *lj_in, TReal *lj_out)
-  {
-    if (_LogJacobian->IsInside(x, y, z)) {
-      (*lj_out) = (*lj_in) + static_cast<TReal>(max(/*log(.0001)=*/-4.0, _LogJacobian->EvaluateInside(x, y, z)));
-    } else {
-      (*lj_out) = (*lj_in);
-    }
-  }
-
-  // ---------------------------------------------------------------------------
-  // Lorenzi, M., Ayache, N., Frisoni, G. B., & Pennec, X. (2013).
-  // LCC-Demons: a robust and accurate symmetric diffeomorphic registration algorithm.
-  // NeuroImage, 81, 470–83. doi:10.1016/j.neuroimage.2013.04.114
-  inline void UpdateDetAndLog(double x, double y, double z,
-                              const TReal *dj_in, const TReal *lj_in,
-                              TReal *dj_out, TReal *lj_out)
-  {
-    if (_DetJacobian->IsInside(x, y, z)) {
-      (*lj_out) = (*lj_in) + static_cast<TReal>(log(max(.0001, _DetJacobian->EvaluateInside(x, y, z))));
-      (*dj_out) = exp(*lj_out);
-    } else {
-      (*lj_out) = (*lj_in);
-      (*dj_out) = (*dj_in);
-    }
+    return static_cast<T>(_c * (_b * (_a * data[_Offset[0]] + _A * data[_Offset[1]])  +
+                                _B * (_a * data[_Offset[2]] + _A * data[_Offset[3]])) +
+                          _C * (_b * (_a * data[_Offset[4]] + _A * data[_Offset[5]])  +
+                                _B * (_a * data[_Offset[6]] + _A * data[_Offset[7]])));
   }
 };
 
 // -----------------------------------------------------------------------------
-template <class TInterpolator>
-struct UpdateJacobian : public UpdateJacobianBase<TInterpolator>
-{
-  typedef typename TInterpolator::VoxelType TReal;
-  void operator()(int i, int j, int k, int,
-                  const TReal *u, const TReal *in, TReal *out)
-  {
-    double x = i, y = j, z = k;
-    this->Transform(x, y, z, u);
-    this->UpdateJac(x, y, z, in, out);
-  }
-};
-
-// -----------------------------------------------------------------------------
-template <class TInterpolator>
-struct UpdateDetJacobian : public UpdateJacobianBase<TInterpolator>
-{
-  typedef typename TInterpolator::VoxelType TReal;
-  void operator()(int i, int j, int k, int,
-                  const TReal *u, const TReal *dj_in, TReal *dj_out)
-  {
-    double x = i, y = j, z = k;
-    this->Transform(x, y, z, u);
-    this->UpdateDet(x, y, z, dj_in, dj_out);
-  }
-};
-
-// -----------------------------------------------------------------------------
-template <class TInterpolator>
-struct UpdateLogJacobian : public UpdateJacobianBase<TInterpolator>
+/// Update of displacement field and its derivatives at each squaring step
+///
+/// All requested images are updated in a single sweep over the image domain,
+/// where each voxel is mapped by the current displacement only once. With
+/// linear interpolation, the intermediate images are sampled directly using
+/// a common set of interpolation weights. Otherwise, the given interpolators
+/// of the current intermediate images are used.
+template <class TReal>
+struct SquaringStep
 {
-  typedef typename TInterpolator::VoxelType TReal;
-  void operator()(int i, int j, int k, int,
-                  const TReal *u, const TReal *lj_in, TReal *lj_out)
-  {
-    double x = i, y = j, z = k;
-    this->Transform(x, y, z, u);
-    this->UpdateLog(x, y, z, lj_in, lj_out);
-  }
-};
+  typedef GenericInterpolateImageFunction<GenericImage<TReal> > Interpolator;
 
-// -----------------------------------------------------------------------------
-template <class TInterpolator>
-struct UpdateDetJacobianAndLog : public UpdateJacobianBase<TInterpolator>
-{
-  typedef typename TInterpolator::VoxelType TReal;
-  void operator()(int i, int j, int k, int, const TReal *u,
-                  const TReal *dj_in,  const TReal *lj_in,
-                  const TReal *dj_out, TReal       *lj_out)
-  {
-    double x = i, y = j, z = k;
-    this->Transform(x, y, z, u);
-    this->UpdateDetAndLog(x, y, z, dj_in, lj_in, const_cast<TReal *>(dj_out), lj_out);
-  }
-};
+  int _X, _Y, _Z, _N;   ///< Image size and number of spatial voxels
+  bool _Linear;         ///< Whether to sample images directly using linear interpolation
 
-// -----------------------------------------------------------------------------
-template <class TInterpolator>
-struct UpdateJacobianAndDet : public UpdateJacobianBase<TInterpolator>
-{
-  typedef typename TInterpolator::VoxelType TReal;
-  void operator()(int i, int j, int k, int, const TReal *u,
-                  const TReal *in,  const TReal *dj_in,
-                  const TReal *out, TReal       *dj_out)
-  {
-    double x = i, y = j, z = k;
-    this->Transform(x, y, z, u);
-    this->UpdateJac(x, y, z, in, const_cast<TReal *>(out));
-    this->UpdateDet(x, y, z, dj_in, dj_out);
-  }
-};
+  const TReal *_Disp;    TReal *_DispOut;    ///< Displacement in voxel units
+  const TReal *_Jac;     TReal *_JacOut;     ///< Jacobian w.r.t. x
+  const TReal *_DetJac;  TReal *_DetJacOut;  ///< Determinant of Jacobian w.r.t. x
+  const TReal *_LogJac;  TReal *_LogJacOut;  ///< Log of determinant of Jacobian w.r.t. x
+  const TReal *_JacDOFs; TReal *_JacDOFsOut; ///< Jacobian w.r.t. v
 
-// -----------------------------------------------------------------------------
-template <class TInterpolator>
-struct UpdateJacobianAndLog : public UpdateJacobianBase<TInterpolator>
-{
-  typedef typename TInterpolator::VoxelType TReal;
-  void operator()(int i, int j, int k, int, const TReal *u,
-                  const TReal *in,  const TReal *lj_in,
-                  const TReal *out, TReal       *lj_out)
-  {
-    double x = i, y = j, z = k;
-    this->Transform(x, y, z, u);
-    this->UpdateJac(x, y, z, in, const_cast<TReal *>(out));
-    this->UpdateLog(x, y, z, lj_in, lj_out);
-  }
-};
+  const Interpolator *_Displacement;
+  const Interpolator *_Jacobian;
+  const Interpolator *_DetJacobian;
+  const Interpolator *_LogJacobian;
+  const Interpolator *_JacobianDOFs;
 
-// -----------------------------------------------------------------------------
-template <class TInterpolator>
-struct UpdateJacobianAndDetAndLog : public UpdateJacobianBase<TInterpolator>
-{
-  typedef typename TInterpolator::VoxelType TReal;
-  void operator()(int i, int j, int k, int, const TReal *u,
-                  const TReal *in,  const TReal *dj_in,  const TReal *lj_in,
-                  const TReal *out, const TReal *dj_out, TReal       *lj_out)
+  /// Multiply Jacobian matrix with 3x3 matrix stored in image at voxel offset
+  static void Multiply(const double jac[9], const TReal *in, TReal *out, int n)
   {
-    double x = i, y = j, z = k;
-    this->Transform(x, y, z, u);
-    this->UpdateJac(x, y, z, in, const_cast<TReal *>(out));
-    this->UpdateDetAndLog(x, y, z, dj_in, lj_in, const_cast<TReal *>(dj_out), lj_out);
+    for (int r = 0; r < 3; ++r)
+    for (int c = 0; c < 3; ++c) {
+      out[(3 * r + c) * n] = static_cast<TReal>(jac[3 * r    ]) * in[      c  * n]
+                           + static_cast<TReal>(jac[3 * r + 1]) * in[(3 +  c) * n]
+                           + static_cast<TReal>(jac[3 * r + 2]) * in[(6 +  c) * n];
+    }
   }
-};
 
-// -----------------------------------------------------------------------------
-/// Voxel function for update of Jacobian w.r.t. v at each squaring step
-template <class TInterpolator>
-struct UpdateJacobianDOFs : public VoxelFunction
-{
-  typedef typename TInterpolator::VoxelType TReal;
-
-  const int            _x, _y, _z;
-  const int            _xx, _xy, _xz, _yx, _yy, _yz, _zx, _zy, _zz;
-  const TInterpolator *_Jacobian;
-  const TInterpolator *_JacobianDOFs;
-
-  UpdateJacobianDOFs(const TInterpolator *f, const TInterpolator *g)
-  :
-    _x(0), _y(f->Input()->NumberOfSpatialVoxels()), _z(2 * _y),
-    _xx(0      ), _xy(     _y), _xz(2 * _xy),
-    _yx(3 * _xy), _yy(4 * _xy), _yz(5 * _xy),
-    _zx(6 * _xy), _zy(7 * _xy), _zz(8 * _xy),
-    _Jacobian(f), _JacobianDOFs(g)
-  {}
-
-  void operator()(int i, int j, int k, int, const TReal *u, const TReal *in, TReal *out)
+  void operator ()(const blocked_range3d<int> &re) const
   {
-    double x = i + u[_x], y = j + u[_y], z = k + u[_z], jac[9], jacdof[9];
-    _Jacobian    ->Evaluate(jac,    x, y, z);
-    _JacobianDOFs->Evaluate(jacdof, x, y, z);
-    out[_xx] = static_cast<TReal>(jac[0]) * in[_xx]
-             + static_cast<TReal>(jac[1]) * in[_yx]
-             + static_cast<TReal>(jac[2]) * in[_zx]
-             + static_cast<TReal>(jacdof[0]);
-    out[_xy] = static_cast<TReal>(jac[0]) * in[_xy]
-             + static_cast<TReal>(jac[1]) * in[_yy]
-             + static_cast<TReal>(jac[2]) * in[_zy]
-             + static_cast<TReal>(jacdof[1]);
-    out[_xz] = static_cast<TReal>(jac[0]) * in[_xz]
-             + static_cast<TReal>(jac[1]) * in[_yz]
-             + static_cast<TReal>(jac[2]) * in[_zz]
-             + static_cast<TReal>(jacdof[2]);
-    out[_yx] = static_cast<TReal>(jac[3]) * in[_xx]
-             + static_cast<TReal>(jac[4]) * in[_yx]
-             + static_cast<TReal>(jac[5]) * in[_zx]
-             + static_cast<TReal>(jacdof[3]);
-    out[_yy] = static_cast<TReal>(jac[3]) * in[_xy]
-             + static_cast<TReal>(jac[4]) * in[_yy]
-             + static_cast<TReal>(jac[5]) * in[_zy]
-             + static_cast<TReal>(jacdof[4]);
-    out[_yz] = static_cast<TReal>(jac[3]) * in[_xz]
-             + static_cast<TReal>(jac[4]) * in[_yz]
-             + static_cast<TReal>(jac[5]) * in[_zz]
-             + static_cast<TReal>(jacdof[5]);
-    out[_zx] = static_cast<TReal>(jac[6]) * in[_xx]
-             + static_cast<TReal>(jac[7]) * in[_yx]
-             + static_cast<TReal>(jac[8]) * in[_zx]
-             + static_cast<TReal>(jacdof[6]);
-    out[_zy] = static_cast<TReal>(jac[6]) * in[_xy]
-             + static_cast<TReal>(jac[7]) * in[_yy]
-             + static_cast<TReal>(jac[8]) * in[_zy]
-             + static_cast<TReal>(jacdof[7]);
-    out[_zz] = static_cast<TReal>(jac[6]) * in[_xz]
-             + static_cast<TReal>(jac[7]) * in[_yz]
-             + static_cast<TReal>(jac[8]) * in[_zz]
-             + static_cast<TReal>(jacdof[8]);
+    const int n = _N;
+    TrilinearSample s;
+    double x, y, z, jac[9], jacdof[9], u[3], dj;
+    for (int k = re.pages().begin(); k != re.pages().end(); ++k)
+    for (int j = re.rows ().begin(); j != re.rows ().end(); ++j)
+    for (int i = re.cols ().begin(); i != re.cols ().end(); ++i) {
+      const int idx = i + _X * (j + _Y * k);
+      const TReal *d = _Disp + idx;
+      x = i + static_cast<double>(d[0]);
+      y = j + static_cast<double>(d[n]);
+      z = k + static_cast<double>(d[2 * n]);
+      const bool inside = _Displacement->IsInside(x, y, z);
+      if (_Linear) s.Initialize(x, y, z, _X, _Y, _Z);
+      // Compose displacements
+      if (_Linear) {
+        for (int c = 0; c < 3; ++c) u[c] = static_cast<double>(s(_Disp + c * n));
+      } else {
+        _Displacement->Evaluate(u, x, y, z);
+      }
+      TReal *dout = _DispOut + idx;
+      dout[0]     = d[0]     + static_cast<TReal>(u[0]);
+      dout[n]     = d[n]     + static_cast<TReal>(u[1]);
+      dout[2 * n] = d[2 * n] + static_cast<TReal>(u[2]);
+      // Update Jacobian w.r.t. x
+      if (_Jac) {
+        const TReal *in  = _Jac    + idx;
+        TReal       *out = _JacOut + idx;
+        if (_Linear) {
+          for (int c = 0; c < 9; ++c) jac[c] = static_cast<double>(s(_Jac + c * n));
+        } else if (inside) {
+          _Jacobian->EvaluateInside(jac, x, y, z);
+        } else if (_JacDOFs) {
+          _Jacobian->EvaluateOutside(jac, x, y, z);
+        }
+        if (inside) {
+          Multiply(jac, in, out, n);
+        } else {
+          for (int c = 0; c < 9; ++c) out[c * n] = in[c * n];
+        }
+        // Update Jacobian w.r.t. v
+        if (_JacDOFs) {
+          const TReal *in  = _JacDOFs    + idx;
+          TReal       *out = _JacDOFsOut + idx;
+          if (_Linear) {
+            for (int c = 0; c < 9; ++c) jacdof[c] = static_cast<double>(s(_JacDOFs + c * n));
+          } else {
+            _JacobianDOFs->Evaluate(jacdof, x, y, z);
+          }
+          Multiply(jac, in, out, n);
+          for (int c = 0; c < 9; ++c) out[c * n] += static_cast<TReal>(jacdof[c]);
+        }
+      }
+      // Update (log) determinant of Jacobian w.r.t. x
+      if (_DetJac && _LogJac) {
+        // Lorenzi, M., Ayache, N., Frisoni, G. B., & Pennec, X. (2013).
+        // LCC-Demons: a robust and accurate symmetric diffeomorphic registration algorithm.
+        // NeuroImage, 81, 470–83. doi:10.1016/j.neuroimage.2013.04.114
+        if (inside) {
+          dj = (_Linear ? static_cast<double>(s(_DetJac)) : _DetJacobian->EvaluateInside(x, y, z));
+          _LogJacOut[idx] = _LogJac[idx] + static_cast<TReal>(log(max(.0001, dj)));
+          _DetJacOut[idx] = exp(_LogJacOut[idx]);
+        } else {
+          _LogJacOut[idx] = _LogJac[idx];
+          _DetJacOut[idx] = _DetJac[idx];
+        }
+      } else if (_DetJac) {
+        if (inside) {
+          dj = (_Linear ? static_cast<double>(s(_DetJac)) : _DetJacobian->EvaluateInside(x, y, z));
+          _DetJacOut[idx] = _DetJac[idx] * static_cast<TReal>(max(.0001, dj));
+        } else {
+          _DetJacOut[idx] = _DetJac[idx];
+        }
+      } else if (_LogJac) {
+        if (inside) {
+          dj = (_Linear ? static_cast<double>(s(_LogJac)) : _LogJacobian->EvaluateInside(x, y, z));
+          _LogJacOut[idx] = _LogJac[idx] + static_cast<TReal>(max(/*log(.0001)=*/-4.0, dj));
+        } else {
+          _LogJacOut[idx] = _LogJac[idx];
+        }
+      }
+    }
   }
 };
 
@@ -1073,11 +927,6 @@ void ScalingAndSquaring<TReal>::Run()
   // Get common attributes of intermediate images
   const ImageAttributes &attr = _InterimDisplacement->Attributes();
 
-  int jac_mode = 0;
-  if (_InterimJacobian   ) jac_mode += 1;
-  if (_InterimDetJacobian) jac_mode += 2;
-  if (_InterimLogJacobian) jac_mode += 4;
-
   // Either allocate required temporary images or use provided output
   ImageType *disp   = _OutputDisplacement;
   ImageType *jac3x3 = NULL;
@@ -1113,68 +962,70 @@ void ScalingAndSquaring<TReal>::Run()
   ConvertToVoxelUnits3D<TReal> w2i(attr);
   ParallelForEachVoxel(attr, _InterimDisplacement, _InterimDisplacement, w2i);
 
-  // Do the squaring steps
-  int n = _NumberOfSquaringSteps;
-  while (n--) {
-    // (Re-)initialize interpolators
-    _Displacement                   ->Initialize();
-    if (_Jacobian    ) _Jacobian    ->Initialize();
-    if (_DetJacobian ) _DetJacobian ->Initialize();
-    if (_LogJacobian ) _LogJacobian ->Initialize();
-    if (_JacobianDOFs) _JacobianDOFs->Initialize();
-    // Compute updates
-    {
-      UpdateDisplacement<DisplacementField> update(_Displacement);
-      ParallelForEachVoxel(attr, _InterimDisplacement, disp, update);
-    }
-    switch (jac_mode) {
-      case 1: {
-        UpdateJacobian<JacobianField> update;
-        update.Initialize(_Jacobian, NULL, NULL);
-        ParallelForEachVoxel(attr, _InterimDisplacement, _InterimJacobian, jac3x3, update);
-      } break;
-      case 2: {
-        UpdateDetJacobian<JacobianField> update;
-        update.Initialize(NULL, _DetJacobian, NULL);
-        ParallelForEachVoxel(attr, _InterimDisplacement, _InterimDetJacobian, detjac, update);
-      } break;
-      case 3: {
-        UpdateJacobianAndDet<JacobianField> update;
-        update.Initialize(_Jacobian, _DetJacobian, NULL);
-        ParallelForEachVoxel(attr, _InterimDisplacement, _InterimJacobian, _InterimDetJacobian, jac3x3, detjac, update);
-      } break;
-      case 4: {
-        UpdateLogJacobian<JacobianField> update;
-        update.Initialize(NULL, NULL, _LogJacobian);
-        ParallelForEachVoxel(attr, _InterimDisplacement, _InterimLogJacobian, logjac, update);
-      } break;
-      case 5: {
-        UpdateJacobianAndLog<JacobianField> update;
-        update.Initialize(_Jacobian, NULL, _LogJacobian);
-        ParallelForEachVoxel(attr, _InterimDisplacement, _InterimJacobian, _InterimLogJacobian, jac3x3, logjac, update);
-      } break;
-      case 6: {
-        UpdateDetJacobianAndLog<JacobianField> update;
-        update.Initialize(NULL, _DetJacobian, _LogJacobian);
-        ParallelForEachVoxel(attr, _InterimDisplacement, _InterimDetJacobian, _InterimLogJacobian, detjac, logjac, update);
-      } break;
-      case 7: {
-        UpdateJacobianAndDetAndLog<JacobianField> update;
-        update.Initialize(_Jacobian, _DetJacobian, _LogJacobian);
-        ParallelForEachVoxel(attr, _InterimDisplacement, _InterimJacobian, _InterimDetJacobian, _InterimLogJacobian, jac3x3, detjac, logjac, update);
-      } break;
-    }
-    if (_InterimJacobianDOFs) {
-      UpdateJacobianDOFs<JacobianField> update(_Jacobian, _JacobianDOFs);
-      ParallelForEachVoxel(attr, _InterimDisplacement, _InterimJacobianDOFs, dofjac, update);
+  // Do the squaring steps, alternating between the intermediate images and
+  // the temporary images as input and output of each step
+  ImageType *cur_disp   = _InterimDisplacement, *nxt_disp   = disp;
+  ImageType *cur_jac3x3 = _InterimJacobian,     *nxt_jac3x3 = jac3x3;
+  ImageType *cur_detjac = _InterimDetJacobian,  *nxt_detjac = detjac;
+  ImageType *cur_logjac = _InterimLogJacobian,  *nxt_logjac = logjac;
+  ImageType *cur_dofjac = _InterimJacobianDOFs, *nxt_dofjac = dofjac;
+
+  SquaringStep<TReal> step;
+  step._X            = attr._x;
+  step._Y            = attr._y;
+  step._Z            = attr._z;
+  step._N            = attr.NumberOfSpatialPoints();
+  step._Linear       = (_Interpolation == Interpolation_Linear);
+  step._Displacement = _Displacement;
+  step._Jacobian     = _Jacobian;
+  step._DetJacobian  = _DetJacobian;
+  step._LogJacobian  = _LogJacobian;
+  step._JacobianDOFs = _JacobianDOFs;
+
+  blocked_range3d<int> voxels(0, attr._z, 0, attr._y, 0, attr._x);
+  for (int n = 0; n < _NumberOfSquaringSteps; ++n) {
+    // (Re-)initialize interpolators of current intermediate images
+    _Displacement->Input(cur_disp);
+    _Displacement->Initialize();
+    if (!step._Linear) {
+      if (_Jacobian    ) _Jacobian    ->Input(cur_jac3x3), _Jacobian    ->Initialize();
+      if (_DetJacobian ) _DetJacobian ->Input(cur_detjac), _DetJacobian ->Initialize();
+      if (_LogJacobian ) _LogJacobian ->Input(cur_logjac), _LogJacobian ->Initialize();
+      if (_JacobianDOFs) _JacobianDOFs->Input(cur_dofjac), _JacobianDOFs->Initialize();
     }
-    // Update intermediate output images
-    _InterimDisplacement                          ->CopyFrom(disp  ->Data());
-    if (_InterimJacobian    ) _InterimJacobian    ->CopyFrom(jac3x3->Data());
-    if (_InterimDetJacobian ) _InterimDetJacobian ->CopyFrom(detjac->Data());
-    if (_InterimLogJacobian ) _InterimLogJacobian ->CopyFrom(logjac->Data());
-    if (_InterimJacobianDOFs) _InterimJacobianDOFs->CopyFrom(dofjac->Data());
+    // Compute updates
+    step._Disp       = cur_disp->Data();
+    step._DispOut    = nxt_disp->Data();
+    step._Jac        = (cur_jac3x3 ? cur_jac3x3->Data() : NULL);
+    step._JacOut     = (nxt_jac3x3 ? nxt_jac3x3->Data() : NULL);
+    step._DetJac     = (cur_detjac ? cur_detjac->Data() : NULL);
+    step._DetJacOut  = (nxt_detjac ? nxt_detjac->Data() : NULL);
+    step._LogJac     = (cur_logjac ? cur_logjac->Data() : NULL);
+    step._LogJacOut  = (nxt_logjac ? nxt_logjac->Data() : NULL);
+    step._JacDOFs    = (cur_dofjac ? cur_dofjac->Data() : NULL);
+    step._JacDOFsOut = (nxt_dofjac ? nxt_dofjac->Data() : NULL);
+    parallel_for(voxels, step);
+    // Output of this step is input of next step
+    swap(cur_disp,   nxt_disp);
+    swap(cur_jac3x3, nxt_jac3x3);
+    swap(cur_detjac, nxt_detjac);
+    swap(cur_logjac, nxt_logjac);
+    swap(cur_dofjac, nxt_dofjac);
+  }
+
+  // Copy result of last step to intermediate images after odd number of steps
+  if (cur_disp != _InterimDisplacement) {
+    _InterimDisplacement                          ->CopyFrom(cur_disp  ->Data());
+    if (_InterimJacobian    ) _InterimJacobian    ->CopyFrom(cur_jac3x3->Data());
+    if (_InterimDetJacobian ) _InterimDetJacobian ->CopyFrom(cur_detjac->Data());
+    if (_InterimLogJacobian ) _InterimLogJacobian ->CopyFrom(cur_logjac->Data());
+    if (_InterimJacobianDOFs) _InterimJacobianDOFs->CopyFrom(cur_dofjac->Data());
   }
+  _Displacement                   ->Input(_InterimDisplacement);
+  if (_Jacobian    ) _Jacobian    ->Input(_InterimJacobian);
+  if (_DetJacobian ) _DetJacobian ->Input(_InterimDetJacobian);
+  if (_LogJacobian ) _LogJacobian ->Input(_InterimLogJacobian);
+  if (_JacobianDOFs) _JacobianDOFs->Input(_InterimJacobianDOFs);
 
   // Convert final displacements back to world units if output requested
   if (_OutputDisplacement) {
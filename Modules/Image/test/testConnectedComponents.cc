@@ -0,0 +1,110 @@
+/*
+ * Medical Image Registration ToolKit (MIRTK)
+ *
+ * Copyright 2026 Imperial College London
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include "mirtk/GenericImage.h"
+#include "mirtk/ConnectedComponents.h"
+
+using namespace mirtk;
+
+// ===========================================================================
+// Tests
+// ===========================================================================
+
+// ---------------------------------------------------------------------------
+TEST(ConnectedComponents, RowBoundary)
+{
+  // Voxels at opposite ends of adjacent rows must not be connected
+  GreyImage labels(5, 4, 3), components;
+  labels.Put(4, 1, 1, 1);
+  labels.Put(0, 2, 1, 1);
+  ConnectedComponents<GreyPixel> cc(CC_NoOrdering, CONNECTIVITY_26);
+  cc.Input (&labels);
+  cc.Output(&components);
+  cc.Run();
+  EXPECT_EQ(2, cc.NumberOfComponents());
+  EXPECT_EQ(1, components(4, 1, 1));
+  EXPECT_EQ(2, components(0, 2, 1));
+}
+
+// ---------------------------------------------------------------------------
+TEST(ConnectedComponents, Connectivity)
+{
+  // Two voxels sharing a corner and one voxel sharing an edge with the first
+  GreyImage labels(7, 6, 5), components;
+  labels.Put(2, 2, 2, 1);
+  labels.Put(3, 3, 3, 1);
+  labels.Put(2, 3, 1, 1);
+  ConnectedComponents<GreyPixel> cc(CC_NoOrdering);
+  cc.Input (&labels);
+  cc.Output(&components);
+  cc.Connectivity(CONNECTIVITY_6);
+  cc.Run();
+  EXPECT_EQ(3, cc.NumberOfComponents());
+  cc.Connectivity(CONNECTIVITY_18);
+  cc.Run();
+  EXPECT_EQ(2, cc.NumberOfComponents());
+  cc.Connectivity(CONNECTIVITY_26);
+  cc.Run();
+  EXPECT_EQ(1, cc.NumberOfComponents());
+  EXPECT_EQ(3, cc.ComponentSize()[0]);
+}
+
+// ---------------------------------------------------------------------------
+TEST(ConnectedComponents, OrderingAndBounds)
+{
+  // Small component first in raster order, large U-shaped component second
+  GreyImage labels(64, 48, 40), components;
+  labels.Put(1, 1, 1, 3);
+  for (int k = 5; k < 35; ++k)
+  for (int j = 10; j < 40; ++j) {
+    labels.Put(10, j, k, 1);
+    labels.Put(50, j, k, 1);
+  }
+  for (int i = 10; i <= 50; ++i) {
+    labels.Put(i, 39, 34, 1);
+  }
+  // Different input labels are never connected
+  labels.Put(11, 20, 20, 2);
+  ConnectedComponents<GreyPixel> cc(CC_LargestFirst, CONNECTIVITY_6);
+  cc.Input (&labels);
+  cc.Output(&components);
+  cc.Run();
+  ASSERT_EQ(3, cc.NumberOfComponents());
+  EXPECT_EQ(2 * 30 * 30 + 39, cc.ComponentSize()[0]);
+  EXPECT_EQ(1, cc.ComponentSize()[2]);
+  EXPECT_EQ(1, components(10, 10,  5));
+  EXPECT_EQ(1, components(50, 39, 34));
+  EXPECT_EQ(3, components( 1,  1,  1));
+  EXPECT_EQ(Vector3D<int>(10, 10,  5), cc.ComponentBoundsMin()[0]);
+  EXPECT_EQ(Vector3D<int>(50, 39, 34), cc.ComponentBoundsMax()[0]);
+  EXPECT_EQ(Vector3D<int>(11, 20, 20), cc.ComponentBoundsMin()[1]);
+  EXPECT_EQ(Vector3D<int>(11, 20, 20), cc.ComponentBoundsMax()[1]);
+}
+
+// ===========================================================================
+// Main
+// ===========================================================================
+
+// ---------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,136 @@
+/*
+ * Medical Image Registration ToolKit (MIRTK)
+ *
+ * Copyright 2026 Imperial College London
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include "mirtk/GenericImage.h"
+#include "mirtk/EuclideanDistanceTransform.h"
+
+using namespace mirtk;
+
+// ===========================================================================
+// Helper
+// ===========================================================================
+
+// ---------------------------------------------------------------------------
+/// Distance transform with public access to the anisotropic implementation
+template <class TVoxel>
+class TestEDT : public EuclideanDistanceTransform<TVoxel>
+{
+public:
+  TestEDT(typename EuclideanDistanceTransform<TVoxel>::Mode mode)
+  :
+    EuclideanDistanceTransform<TVoxel>(mode)
+  {}
+  using EuclideanDistanceTransform<TVoxel>::edtComputeEDT_2D_anisotropic;
+  using EuclideanDistanceTransform<TVoxel>::edtComputeEDT_3D_anisotropic;
+};
+
+// ---------------------------------------------------------------------------
+/// Create image with isotropic voxels of size 2.5 mm, where only the given
+/// slices contain feature voxels
+template <class TVoxel>
+GenericImage<TVoxel> make_features(const ImageAttributes &attr, int k1, int k2)
+{
+  GenericImage<TVoxel> image(attr);
+  for (int k = 0; k < attr._z; ++k) {
+    if (k != k1 && k != k2) continue;
+    image(1, 2, k) = TVoxel(1);
+    image(attr._x - 2, attr._y - 1, k) = TVoxel(1);
+    image(attr._x / 2, 0, k) = TVoxel(1);
+  }
+  return image;
+}
+
+// ---------------------------------------------------------------------------
+/// Compare output of Run for isotropic voxels to anisotropic implementation
+template <class TVoxel>
+void expect_anisotropic_edt(typename EuclideanDistanceTransform<TVoxel>::Mode mode,
+                            const GenericImage<TVoxel> &input)
+{
+  const int    nx = input.X(), ny = input.Y(), nz = input.Z();
+  const double dx = input.XSize();
+  // Squared EDT computed by Run using integer arithmetic
+  GenericImage<TVoxel> output;
+  TestEDT<TVoxel> edt(mode);
+  edt.Input (&input);
+  edt.Output(&output);
+  edt.Run();
+  // Squared EDT computed using floating point arithmetic
+  GenericImage<TVoxel> expected(input.Attributes());
+  if (mode == EuclideanDistanceTransform<TVoxel>::DT_3D) {
+    edt.edtComputeEDT_3D_anisotropic(input.Data(), expected.Data(), nx, ny, nz, dx, dx, dx);
+  } else {
+    for (int k = 0; k < nz; ++k) {
+      edt.edtComputeEDT_2D_anisotropic(input.Data(0, 0, k), expected.Data(0, 0, k), nx, ny, dx, dx);
+    }
+  }
+  int nfail = 0;
+  for (int k = 0; k < nz; ++k)
+  for (int j = 0; j < ny; ++j)
+  for (int i = 0; i < nx; ++i) {
+    const double a = output  (i, j, k);
+    const double b = expected(i, j, k);
+    if (fabs(a - b) > 1e-6 * (1.0 + fabs(b))) {
+      if (++nfail <= 10) {
+        ADD_FAILURE() << "Squared distance of voxel (" << i << ", " << j << ", " << k
+                      << ") is " << a << ", expected " << b;
+      }
+    }
+  }
+  EXPECT_EQ(0, nfail);
+}
+
+// ===========================================================================
+// Tests
+// ===========================================================================
+
+// ---------------------------------------------------------------------------
+TEST(EuclideanDistanceTransform, IsotropicSlicesWithoutFeatures)
+{
+  ImageAttributes attr(13, 11, 6, 2.5, 2.5, 2.5);
+  expect_anisotropic_edt(EuclideanDistanceTransform<float >::DT_2D, make_features<float >(attr, 1, 4));
+  expect_anisotropic_edt(EuclideanDistanceTransform<double>::DT_2D, make_features<double>(attr, 1, 4));
+}
+
+// ---------------------------------------------------------------------------
+TEST(EuclideanDistanceTransform, IsotropicVolume)
+{
+  ImageAttributes attr(13, 11, 6, 2.5, 2.5, 2.5);
+  expect_anisotropic_edt(EuclideanDistanceTransform<float >::DT_3D, make_features<float >(attr, 1, 4));
+  expect_anisotropic_edt(EuclideanDistanceTransform<double>::DT_3D, make_features<double>(attr, 1, 4));
+}
+
+// ---------------------------------------------------------------------------
+TEST(EuclideanDistanceTransform, IsotropicVolumeWithoutFeatures)
+{
+  ImageAttributes attr(13, 11, 6, 20.0, 20.0, 20.0);
+  expect_anisotropic_edt(EuclideanDistanceTransform<float >::DT_3D, make_features<float >(attr, -1, -1));
+  expect_anisotropic_edt(EuclideanDistanceTransform<double>::DT_3D, make_features<double>(attr, -1, -1));
+}
+
+// ===========================================================================
+// Main
+// ===========================================================================
+
+// ---------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -22,6 +22,8 @@
 #include "mirtk/GenericImage.h"
 #include "mirtk/InterpolateImageFunction.h"
 #include "mirtk/ExtrapolateImageFunction.h"
+#include "mirtk/CubicBSplineInterpolateImageFunction.h"
+#include "mirtk/ImageToInterpolationCoefficients.h"
 
 using namespace mirtk;
 
@@ -495,6 +497,77 @@ int test_Interpolation_Linear_Extrapolation_NN()
   return RESULT;
 }
 
+// ---------------------------------------------------------------------------
+int test_EvaluateBatch()
+{
+  TEST("test_EvaluateBatch");
+
+  const InterpolationMode modes[] = {
+    Interpolation_NN, Interpolation_Linear, Interpolation_FastLinear,
+    Interpolation_BSpline, Interpolation_CubicBSpline, Interpolation_FastCubicBSpline,
+    Interpolation_Sinc, Interpolation_LinearWithPadding
+  };
+
+  GenericImage<double> *image = NULL;
+  double x[32], y[32], z[32], v[32];
+
+  // Sample points inside and outside of image domain
+  for (int i = 0; i < 32; ++i) {
+    x[i] = -2.0 + 0.65 * i;
+    y[i] = 17.0 - 0.6 * i;
+    z[i] =  3.3 + 0.1 * (i % 7);
+  }
+
+  for (int dim = 2; dim <= 3; ++dim) {
+    image = create_test_image<double>(16, 16, dim == 2 ? 1 : 16);
+    for (size_t m = 0; m < sizeof(modes) / sizeof(modes[0]); ++m) {
+      InterpolateImageFunction *func = InterpolateImageFunction::New(modes[m], image);
+      func->Initialize();
+      func->EvaluateBatch(v, 32, x, y, dim == 2 ? NULL : z);
+      for (int i = 0; i < 32; ++i) {
+        EXPECT_EQUAL(v[i], func->Evaluate(x[i], y[i], dim == 2 ? 0. : z[i]), "Batch evaluation of " << func->NameOfClass());
+      }
+      func->EvaluateWithPaddingBatch(v, 32, x, y, dim == 2 ? NULL : z);
+      for (int i = 0; i < 32; ++i) {
+        EXPECT_EQUAL(v[i], func->EvaluateWithPadding(x[i], y[i], dim == 2 ? 0. : z[i]), "Batch evaluation with padding of " << func->NameOfClass());
+      }
+      delete func;
+    }
+    delete image;
+  }
+
+  return RESULT;
+}
+
+// ---------------------------------------------------------------------------
+int test_SharedCubicBSplineCoefficients()
+{
+  TEST("test_SharedCubicBSplineCoefficients");
+
+  typedef GenericCubicBSplineInterpolateImageFunction<GenericImage<double> > Interpolator;
+
+  GenericImage<double> *image = create_test_image<double>(16, 16, 16);
+  Interpolator f1, f2;
+
+  f1.Input(image);
+  f1.Initialize();
+  shared_ptr<BaseImage> c1 = SharedCubicBSplineCoefficients<double>(image, 3);
+  shared_ptr<BaseImage> c2 = SharedCubicBSplineCoefficients<double>(image, 3);
+  EXPECT_EQUAL(c1 == c2, true, "Coefficients of unmodified image are shared");
+
+  image->Put(3, 2, 5, 1000.0);
+  shared_ptr<BaseImage> c3 = SharedCubicBSplineCoefficients<double>(image, 3);
+  EXPECT_EQUAL(c1 == c3, false, "Coefficients of modified image are recomputed");
+
+  f2.Input(image);
+  f2.Initialize();
+  EXPECT_NOT_EQUAL(f2.Evaluate(3.4, 2.1, 5.5), f1.Evaluate(3.4, 2.1, 5.5), "Interpolate modified image value");
+
+  delete image;
+
+  return RESULT;
+}
+
 // ===========================================================================
 // Main
 // ===========================================================================
@@ -510,6 +583,8 @@ int InterpolateExtrapolateImageFunctionTest(int, char *[])
   retval += test_Interpolation_NN_Extrapolation_Const();
   retval += test_Interpolation_Linear_Extrapolation_Const();
   retval += test_Interpolation_Linear_Extrapolation_NN();
+  retval += test_EvaluateBatch();
+  retval += test_SharedCubicBSplineCoefficients();
 
   return retval;
 }
@@ -0,0 +1,250 @@
+/*
+ * Medical Image Registration ToolKit (MIRTK)
+ *
+ * Copyright 2026 Imperial College London
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include "mirtk/Math.h"
+#include "mirtk/Memory.h"
+#include "mirtk/GenericImage.h"
+#include "mirtk/ScalingAndSquaring.h"
+#include "mirtk/InterpolateImageFunction.h"
+
+using namespace mirtk;
+
+// ===========================================================================
+// Helper
+// ===========================================================================
+
+/// Number of squaring steps
+static const int NSTEPS = 4;
+
+// ---------------------------------------------------------------------------
+/// Create smooth velocity field with unit voxel size
+template <class TReal>
+GenericImage<TReal> make_velocity(double amplitude = 3.0)
+{
+  ImageAttributes attr(19, 17, 15);
+  GenericImage<TReal> v(attr, 3);
+  for (int k = 0; k < attr._z; ++k)
+  for (int j = 0; j < attr._y; ++j)
+  for (int i = 0; i < attr._x; ++i) {
+    v(i, j, k, 0) = static_cast<TReal>(amplitude * sin(.31 * j + .17 * k));
+    v(i, j, k, 1) = static_cast<TReal>(amplitude * cos(.23 * i - .29 * k));
+    v(i, j, k, 2) = static_cast<TReal>(amplitude * sin(.19 * i + .37 * j + .5));
+  }
+  return v;
+}
+
+// ---------------------------------------------------------------------------
+/// Outputs of scaling and squaring
+template <class TReal>
+struct Outputs
+{
+  GenericImage<TReal> _Disp, _Jac, _DetJac, _LogJac;
+  bool _WithJac, _WithDetJac, _WithLogJac;
+
+  Outputs(bool jac, bool det, bool log)
+  :
+    _WithJac(jac), _WithDetJac(det), _WithLogJac(log)
+  {}
+};
+
+// ---------------------------------------------------------------------------
+/// Integrate velocity field using the given number of squaring steps
+template <class TReal>
+void exponentiate(const GenericImage<TReal> &v, Outputs<TReal> &out,
+                  int nsteps, double limit = 1.0)
+{
+  ScalingAndSquaring<TReal> exp;
+  exp.InputVelocity(&v);
+  exp.Interpolation(Interpolation_Linear);
+  exp.UpperIntegrationLimit(limit);
+  if (nsteps > 0) exp.NumberOfSquaringSteps(nsteps);
+  else            exp.NumberOfSteps(1);
+  exp.OutputDisplacement(&out._Disp);
+  if (out._WithJac   ) exp.OutputJacobian   (&out._Jac);
+  if (out._WithDetJac) exp.OutputDetJacobian(&out._DetJac);
+  if (out._WithLogJac) exp.OutputLogJacobian(&out._LogJac);
+  exp.Run();
+}
+
+// ---------------------------------------------------------------------------
+/// Squaring steps as computed previously, where each image is updated in a
+/// separate pass using a linear interpolator with nearest neighbor extrapolation
+template <class TReal>
+void square(Outputs<TReal> &out, int nsteps)
+{
+  typedef GenericImage<TReal>                         ImageType;
+  typedef GenericInterpolateImageFunction<ImageType>  Interpolator;
+
+  const ImageAttributes &attr = out._Disp.Attributes();
+  for (int n = 0; n < nsteps; ++n) {
+    unique_ptr<Interpolator> disp(Interpolator::New(Interpolation_Linear, Extrapolation_NN, &out._Disp));
+    unique_ptr<Interpolator> jac, det, log;
+    disp->Initialize();
+    if (out._WithJac) {
+      jac.reset(Interpolator::New(Interpolation_Linear, Extrapolation_NN, &out._Jac));
+      jac->Initialize();
+    }
+    if (out._WithDetJac) {
+      det.reset(Interpolator::New(Interpolation_Linear, Extrapolation_NN, &out._DetJac));
+      det->Initialize();
+    }
+    if (out._WithLogJac) {
+      log.reset(Interpolator::New(Interpolation_Linear, Extrapolation_NN, &out._LogJac));
+      log->Initialize();
+    }
+    ImageType d(out._Disp), J(out._Jac), dj(out._DetJac), lj(out._LogJac);
+    for (int k = 0; k < attr._z; ++k)
+    for (int j = 0; j < attr._y; ++j)
+    for (int i = 0; i < attr._x; ++i) {
+      const double x = i + out._Disp(i, j, k, 0);
+      const double y = j + out._Disp(i, j, k, 1);
+      const double z = k + out._Disp(i, j, k, 2);
+      const bool inside = disp->IsInside(x, y, z);
+      for (int c = 0; c < 3; ++c) {
+        d(i, j, k, c) = out._Disp(i, j, k, c) + static_cast<TReal>(disp->Evaluate(x, y, z, c));
+      }
+      if (jac && inside) {
+        for (int r = 0; r < 3; ++r)
+        for (int c = 0; c < 3; ++c) {
+          double sum = .0;
+          for (int m = 0; m < 3; ++m) {
+            sum += jac->Evaluate(x, y, z, 3 * r + m) * out._Jac(i, j, k, 3 * m + c);
+          }
+          J(i, j, k, 3 * r + c) = static_cast<TReal>(sum);
+        }
+      }
+      if (det && log) {
+        if (inside) {
+          lj(i, j, k) = out._LogJac(i, j, k) + static_cast<TReal>(::log(max(.0001, det->Evaluate(x, y, z))));
+          dj(i, j, k) = static_cast<TReal>(exp(lj(i, j, k)));
+        }
+      } else if (det) {
+        if (inside) dj(i, j, k) = out._DetJac(i, j, k) * static_cast<TReal>(max(.0001, det->Evaluate(x, y, z)));
+      } else if (log) {
+        if (inside) lj(i, j, k) = out._LogJac(i, j, k) + static_cast<TReal>(max(-4.0, log->Evaluate(x, y, z)));
+      }
+    }
+    out._Disp = d;
+    if (out._WithJac   ) out._Jac    = J;
+    if (out._WithDetJac) out._DetJac = dj;
+    if (out._WithLogJac) out._LogJac = lj;
+  }
+}
+
+// ---------------------------------------------------------------------------
+/// Count voxels whose values differ by more than the given relative tolerance
+template <class TReal>
+int count_differences(const GenericImage<TReal> &expected,
+                      const GenericImage<TReal> &actual, double tol)
+{
+  EXPECT_TRUE(expected.Attributes().EqualInSpace(actual.Attributes()));
+  EXPECT_EQ(expected.T(), actual.T());
+  if (expected.NumberOfVoxels() != actual.NumberOfVoxels()) return -1;
+  int ndiff = 0;
+  for (int idx = 0; idx < expected.NumberOfVoxels(); ++idx) {
+    const double a = static_cast<double>(actual  (idx));
+    const double b = static_cast<double>(expected(idx));
+    if (fabs(a - b) > tol * (1.0 + fabs(b))) {
+      if (++ndiff <= 5) {
+        ADD_FAILURE() << "Value of voxel " << idx << " is " << a << ", expected " << b;
+      }
+    }
+  }
+  return ndiff;
+}
+
+// ---------------------------------------------------------------------------
+/// Compare outputs of scaling and squaring to previous squaring steps
+template <class TReal>
+void expect_previous_squaring(bool jac, bool det, bool log, double tol)
+{
+  GenericImage<TReal> v = make_velocity<TReal>();
+  Outputs<TReal> expected(jac, det, log), actual(jac, det, log);
+  exponentiate(v, expected, 0, 1.0 / pow(2.0, NSTEPS));
+  square(expected, NSTEPS);
+  exponentiate(v, actual, NSTEPS);
+  EXPECT_EQ(0, count_differences(expected._Disp, actual._Disp, tol));
+  if (jac) EXPECT_EQ(0, count_differences(expected._Jac,    actual._Jac,    tol));
+  if (det) EXPECT_EQ(0, count_differences(expected._DetJac, actual._DetJac, tol));
+  if (log) EXPECT_EQ(0, count_differences(expected._LogJac, actual._LogJac, tol));
+}
+
+// ===========================================================================
+// Tests
+// ===========================================================================
+
+// ---------------------------------------------------------------------------
+TEST(ScalingAndSquaring, DisplacementAndJacobian)
+{
+  expect_previous_squaring<double>(true, true, false, 1e-9);
+}
+
+// ---------------------------------------------------------------------------
+TEST(ScalingAndSquaring, DetAndLogJacobian)
+{
+  expect_previous_squaring<double>(false, true, true, 1e-9);
+}
+
+// ---------------------------------------------------------------------------
+TEST(ScalingAndSquaring, LogJacobian)
+{
+  expect_previous_squaring<double>(false, false, true, 1e-9);
+}
+
+// ---------------------------------------------------------------------------
+TEST(ScalingAndSquaring, SinglePrecision)
+{
+  expect_previous_squaring<float>(true, true, true, 1e-4);
+}
+
+// ---------------------------------------------------------------------------
+TEST(ScalingAndSquaring, ConstantVelocity)
+{
+  // Exponential of a constant velocity field is a translation by this velocity
+  const ImageAttributes attr(11, 10, 9);
+  const int n = attr.NumberOfSpatialPoints();
+  GenericImage<double> v(attr, 3);
+  for (int idx = 0; idx < n; ++idx) {
+    v(idx) = .7, v(idx + n) = -1.3, v(idx + 2 * n) = .4;
+  }
+  Outputs<double> out(true, true, true);
+  exponentiate(v, out, NSTEPS);
+  EXPECT_EQ(0, count_differences(v, out._Disp, 1e-9));
+  GenericImage<double> identity(attr, 9), one(attr);
+  for (int idx = 0; idx < n; ++idx) {
+    one(idx) = 1.0;
+    for (int c = 0; c < 3; ++c) identity(idx + 4 * c * n) = 1.0;
+  }
+  EXPECT_EQ(0, count_differences(identity, out._Jac,    1e-9));
+  EXPECT_EQ(0, count_differences(one,      out._DetJac, 1e-9));
+  one = .0;
+  EXPECT_EQ(0, count_differences(one,      out._LogJac, 1e-9));
+}
+
+// ===========================================================================
+// Main
+// ===========================================================================
+
+// ---------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,583 @@
+/*
+ * Medical Image Registration ToolKit (MIRTK)
+ *
+ * Copyright 2026 Imperial College London
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MIRTK_KdTree_H
+#define MIRTK_KdTree_H
+
+#include "mirtk/Math.h"
+#include "mirtk/Array.h"
+#include "mirtk/ArrayHeap.h"
+#include "mirtk/Pair.h"
+#include "mirtk/Algorithm.h"
+#include "mirtk/Parallel.h"
+#include "mirtk/Stream.h"
+
+#include <cstdlib>
+
+
+namespace mirtk {
+
+
+/**
+ * Kd tree for exact nearest neighbor search in N-dimensional point sets
+ *
+ * The tree is a balanced binary tree which is implicitly defined by the
+ * recursive median splits of the point set. Nodes are therefore not stored
+ * explicitly, only the split dimension and value of each inner node in level
+ * order. The points themselves are stored in a contiguous array in the order
+ * of the tree leaves, such that the points of a leaf are adjacent in memory.
+ *
+ * Once the tree is built, all queries are read-only and can be executed
+ * concurrently by multiple threads without locking. The batch queries
+ * process a list of query points in parallel.
+ *
+ * The indices returned by the search functions are the indices of the points
+ * in the point array passed to Initialize.
+ */
+template <class TReal = float>
+class KdTree
+{
+public:
+
+  /// Type of point coordinates stored in the tree
+  typedef TReal RealType;
+
+  /// Default maximum number of points per leaf node
+  static const int DefaultLeafSize = 8;
+
+  // ---------------------------------------------------------------------------
+  // Construction/Destruction
+
+  /// Constructor
+  KdTree();
+
+  /// Build tree for given points
+  ///
+  /// \param[in] n         Number of points.
+  /// \param[in] d         Dimension of points.
+  /// \param[in] points    Coordinates of points, where the coordinates of
+  ///                      the i-th point are at points[i * d + j], j < d.
+  /// \param[in] leaf_size Maximum number of points per leaf node.
+  template <class T>
+  void Initialize(int n, int d, const T *points, int leaf_size = DefaultLeafSize);
+
+  /// Number of points in tree
+  int NumberOfPoints() const;
+
+  /// Dimension of points
+  int Dimension() const;
+
+  // ---------------------------------------------------------------------------
+  // Closest point
+
+  /// Find closest point
+  ///
+  /// \param[in]  q     Query point.
+  /// \param[out] dist2 Squared Euclidean distance of closest point.
+  ///
+  /// \returns Index of closest point.
+  int FindClosestPoint(const double *q, double *dist2 = NULL) const;
+
+  /// Find closest point of each query point in parallel
+  ///
+  /// \param[in]  m       Number of query points.
+  /// \param[in]  queries Coordinates of query points, where the coordinates of
+  ///                     the i-th query point are at queries[i * d + j], j < d.
+  /// \param[out] index   Indices of closest points.
+  /// \param[out] dist2   Squared Euclidean distances of closest points.
+  void FindClosestPoint(int m, const double *queries, int *index, double *dist2 = NULL) const;
+
+  // ---------------------------------------------------------------------------
+  // Nearest neighbors (kNN)
+
+  /// Find k nearest neighbors
+  ///
+  /// \param[in]  k     Number of nearest neighbors.
+  /// \param[in]  q     Query point.
+  /// \param[out] index Indices of nearest neighbors sorted by increasing distance.
+  /// \param[out] dist2 Squared Euclidean distances of nearest neighbors.
+  ///
+  /// \returns Number of found neighbors, i.e., min(k, NumberOfPoints()).
+  int FindClosestNPoints(int k, const double *q, int *index, double *dist2 = NULL) const;
+
+  /// Find k nearest neighbors
+  ///
+  /// \param[in]  k     Number of nearest neighbors.
+  /// \param[in]  q     Query point.
+  /// \param[out] dist2 Squared Euclidean distances of nearest neighbors.
+  ///
+  /// \returns Indices of nearest neighbors sorted by increasing distance.
+  Array<int> FindClosestNPoints(int k, const double *q, Array<double> *dist2 = NULL) const;
+
+  /// Find k nearest neighbors of each query point in parallel
+  ///
+  /// \param[in]  k       Number of nearest neighbors.
+  /// \param[in]  m       Number of query points.
+  /// \param[in]  queries Coordinates of query points.
+  /// \param[out] index   Indices of nearest neighbors of each query point.
+  /// \param[out] dist2   Squared Euclidean distances of nearest neighbors.
+  void FindClosestNPoints(int k, int m, const double *queries,
+                          Array<Array<int> > &index,
+                          Array<Array<double> > *dist2 = NULL) const;
+
+  // ---------------------------------------------------------------------------
+  // Radius search
+
+  /// Find points within search radius
+  ///
+  /// \param[in]  radius Search radius.
+  /// \param[in]  q      Query point.
+  /// \param[out] dist2  Squared Euclidean distances of found points.
+  ///
+  /// \returns Indices of points within search radius sorted by increasing distance.
+  Array<int> FindPointsWithinRadius(double radius, const double *q, Array<double> *dist2 = NULL) const;
+
+  /// Find points within search radius of each query point in parallel
+  ///
+  /// \param[in]  radius  Search radius.
+  /// \param[in]  m       Number of query points.
+  /// \param[in]  queries Coordinates of query points.
+  /// \param[out] index   Indices of points within search radius of each query point.
+  /// \param[out] dist2   Squared Euclidean distances of found points.
+  void FindPointsWithinRadius(double radius, int m, const double *queries,
+                              Array<Array<int> > &index,
+                              Array<Array<double> > *dist2 = NULL) const;
+
+protected:
+
+  /// Number of points
+  int _NumberOfPoints;
+
+  /// Dimension of points
+  int _Dimension;
+
+  /// Maximum number of points per leaf node
+  int _LeafSize;
+
+  /// Point coordinates in order of tree leaves
+  Array<TReal> _Points;
+
+  /// Original point indices in order of tree leaves
+  Array<int> _Index;
+
+  /// Split dimension of inner nodes in level order
+  Array<int> _SplitDim;
+
+  /// Split value of inner nodes in level order
+  Array<TReal> _SplitValue;
+
+  /// Squared Euclidean distance of query point to i-th point in tree order
+  double Distance2(const double *q, int i) const;
+
+  /// Build subtree for points in given range of tree order
+  template <class T>
+  void Build(int node, int begin, int end, const T *points, int *perm);
+
+  /// Find closest point within subtree
+  void FindClosestPoint(int node, int begin, int end, const double *q,
+                        int &index, double &dist2) const;
+
+  /// Find nearest neighbors within subtree
+  void FindClosestNPoints(int node, int begin, int end, const double *q,
+                          int k, int &n, Pair<double, int> *heap) const;
+
+  /// Find points within search radius within subtree
+  void FindPointsWithinRadius(int node, int begin, int end, const double *q,
+                              double maxdist2, Array<Pair<double, int> > &found) const;
+
+  // ---------------------------------------------------------------------------
+  // Parallel batch queries
+
+  struct FindClosestPointBody
+  {
+    const KdTree *_Tree;
+    const double *_Queries;
+    int          *_Index;
+    double       *_Dist2;
+
+    void operator ()(const blocked_range<int> &re) const
+    {
+      const int d = _Tree->_Dimension;
+      for (int i = re.begin(); i != re.end(); ++i) {
+        _Index[i] = _Tree->FindClosestPoint(_Queries + i * d, _Dist2 ? _Dist2 + i : NULL);
+      }
+    }
+  };
+
+  struct FindClosestNPointsBody
+  {
+    const KdTree          *_Tree;
+    const double          *_Queries;
+    Array<Array<int> >    *_Index;
+    Array<Array<double> > *_Dist2;
+    int                    _K;
+
+    void operator ()(const blocked_range<int> &re) const
+    {
+      const int d = _Tree->_Dimension;
+      for (int i = re.begin(); i != re.end(); ++i) {
+        (*_Index)[i] = _Tree->FindClosestNPoints(_K, _Queries + i * d, _Dist2 ? &(*_Dist2)[i] : NULL);
+      }
+    }
+  };
+
+  struct FindPointsWithinRadiusBody
+  {
+    const KdTree          *_Tree;
+    const double          *_Queries;
+    Array<Array<int> >    *_Index;
+    Array<Array<double> > *_Dist2;
+    double                 _Radius;
+
+    void operator ()(const blocked_range<int> &re) const
+    {
+      const int d = _Tree->_Dimension;
+      for (int i = re.begin(); i != re.end(); ++i) {
+        (*_Index)[i] = _Tree->FindPointsWithinRadius(_Radius, _Queries + i * d, _Dist2 ? &(*_Dist2)[i] : NULL);
+      }
+    }
+  };
+
+  /// Compare split coordinate of points given their indices
+  template <class T>
+  struct CompareCoordinate
+  {
+    const T *_Points;
+    int      _Dimension;
+    int      _SplitDim;
+
+    bool operator ()(int a, int b) const
+    {
+      return _Points[a * _Dimension + _SplitDim] < _Points[b * _Dimension + _SplitDim];
+    }
+  };
+
+  /// Compare heap entries by distance such that the farthest point is on top
+  static bool CompareDistance(const Pair<double, int> &a, const Pair<double, int> &b)
+  {
+    return a.first < b.first;
+  }
+
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Inline definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// =============================================================================
+// Construction/Destruction
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+template <class TReal>
+KdTree<TReal>::KdTree()
+:
+  _NumberOfPoints(0),
+  _Dimension(0),
+  _LeafSize(DefaultLeafSize)
+{
+}
+
+// -----------------------------------------------------------------------------
+template <class TReal> template <class T>
+void KdTree<TReal>::Initialize(int n, int d, const T *points, int leaf_size)
+{
+  if (n < 0 || d <= 0 || (n > 0 && !points)) {
+    cerr << "KdTree::Initialize: Invalid point set" << endl;
+    exit(1);
+  }
+  _NumberOfPoints = n;
+  _Dimension      = d;
+  _LeafSize       = max(1, leaf_size);
+  // Number of tree levels, where the larger half of a node has ceil(m/2) points
+  int depth = 0;
+  for (int m = n; m > _LeafSize; m = (m + 1) / 2) ++depth;
+  const int ninner = (1 << depth) - 1;
+  _SplitDim  .resize(ninner);
+  _SplitValue.resize(ninner);
+  _Index.resize(n);
+  for (int i = 0; i < n; ++i) _Index[i] = i;
+  if (n > 0) Build(0, 0, n, points, _Index.data());
+  _Points.resize(static_cast<size_t>(n) * d);
+  for (int i = 0; i < n; ++i) {
+    const T *p = points + static_cast<size_t>(_Index[i]) * d;
+    TReal   *q = _Points.data() + static_cast<size_t>(i) * d;
+    for (int j = 0; j < d; ++j) q[j] = static_cast<TReal>(p[j]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+template <class TReal> template <class T>
+void KdTree<TReal>::Build(int node, int begin, int end, const T *points, int *perm)
+{
+  if (end - begin <= _LeafSize) return;
+  // Split along dimension of largest extent
+  int    dim = 0;
+  double max_extent = -1.0;
+  for (int j = 0; j < _Dimension; ++j) {
+    double a = numeric_limits<double>::infinity(), b = -a, c;
+    for (int i = begin; i < end; ++i) {
+      c = static_cast<double>(points[perm[i] * _Dimension + j]);
+      if (c < a) a = c;
+      if (c > b) b = c;
+    }
+    if (b - a > max_extent) max_extent = b - a, dim = j;
+  }
+  // Partition points at median
+  const int mid = begin + (end - begin) / 2;
+  CompareCoordinate<T> comp;
+  comp._Points    = points;
+  comp._Dimension = _Dimension;
+  comp._SplitDim  = dim;
+  std::nth_element(perm + begin, perm + mid, perm + end, comp);
+  _SplitDim  [node] = dim;
+  _SplitValue[node] = static_cast<TReal>(points[perm[mid] * _Dimension + dim]);
+  Build(2 * node + 1, begin, mid, points, perm);
+  Build(2 * node + 2, mid,   end, points, perm);
+}
+
+// -----------------------------------------------------------------------------
+template <class TReal>
+inline int KdTree<TReal>::NumberOfPoints() const
+{
+  return _NumberOfPoints;
+}
+
+// -----------------------------------------------------------------------------
+template <class TReal>
+inline int KdTree<TReal>::Dimension() const
+{
+  return _Dimension;
+}
+
+// -----------------------------------------------------------------------------
+template <class TReal>
+inline double KdTree<TReal>::Distance2(const double *q, int i) const
+{
+  const TReal *p = _Points.data() + static_cast<size_t>(i) * _Dimension;
+  double d, dist2 = .0;
+  for (int j = 0; j < _Dimension; ++j) {
+    d = static_cast<double>(p[j]) - q[j];
+    dist2 += d * d;
+  }
+  return dist2;
+}
+
+// =============================================================================
+// Closest point
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+template <class TReal>
+void KdTree<TReal>::FindClosestPoint(int node, int begin, int end, const double *q,
+                                     int &index, double &dist2) const
+{
+  if (end - begin <= _LeafSize) {
+    double d2;
+    for (int i = begin; i < end; ++i) {
+      d2 = Distance2(q, i);
+      if (d2 < dist2) dist2 = d2, index = i;
+    }
+  } else {
+    const int    mid  = begin + (end - begin) / 2;
+    const double diff = q[_SplitDim[node]] - static_cast<double>(_SplitValue[node]);
+    if (diff < .0) {
+      FindClosestPoint(2 * node + 1, begin, mid, q, index, dist2);
+      if (diff * diff < dist2) FindClosestPoint(2 * node + 2, mid, end, q, index, dist2);
+    } else {
+      FindClosestPoint(2 * node + 2, mid, end, q, index, dist2);
+      if (diff * diff < dist2) FindClosestPoint(2 * node + 1, begin, mid, q, index, dist2);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+template <class TReal>
+int KdTree<TReal>::FindClosestPoint(const double *q, double *dist2) const
+{
+  int    index = -1;
+  double mind2 = numeric_limits<double>::infinity();
+  if (_NumberOfPoints > 0) {
+    FindClosestPoint(0, 0, _NumberOfPoints, q, index, mind2);
+    index = _Index[index];
+  }
+  if (dist2) *dist2 = mind2;
+  return index;
+}
+
+// -----------------------------------------------------------------------------
+template <class TReal>
+void KdTree<TReal>::FindClosestPoint(int m, const double *queries, int *index, double *dist2) const
+{
+  FindClosestPointBody body;
+  body._Tree    = this;
+  body._Queries = queries;
+  body._Index   = index;
+  body._Dist2   = dist2;
+  parallel_for(blocked_range<int>(0, m), body);
+}
+
+// =============================================================================
+// Nearest neighbors (kNN)
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+template <class TReal>
+void KdTree<TReal>::FindClosestNPoints(int node, int begin, int end, const double *q,
+                                       int k, int &n, Pair<double, int> *heap) const
+{
+  if (end - begin <= _LeafSize) {
+    double d2;
+    for (int i = begin; i < end; ++i) {
+      d2 = Distance2(q, i);
+      if (n < k) {
+        heap[n++] = MakePair(d2, i);
+        push_heap(heap, heap + n, CompareDistance);
+      } else if (d2 < heap[0].first) {
+        pop_heap(heap, heap + n, CompareDistance);
+        heap[n-1] = MakePair(d2, i);
+        push_heap(heap, heap + n, CompareDistance);
+      }
+    }
+  } else {
+    const int    mid  = begin + (end - begin) / 2;
+    const double diff = q[_SplitDim[node]] - static_cast<double>(_SplitValue[node]);
+    if (diff < .0) {
+      FindClosestNPoints(2 * node + 1, begin, mid, q, k, n, heap);
+      if (n < k || diff * diff < heap[0].first) {
+        FindClosestNPoints(2 * node + 2, mid, end, q, k, n, heap);
+      }
+    } else {
+      FindClosestNPoints(2 * node + 2, mid, end, q, k, n, heap);
+      if (n < k || diff * diff < heap[0].first) {
+        FindClosestNPoints(2 * node + 1, begin, mid, q, k, n, heap);
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+template <class TReal>
+int KdTree<TReal>::FindClosestNPoints(int k, const double *q, int *index, double *dist2) const
+{
+  k = min(k, _NumberOfPoints);
+  if (k <= 0) return 0;
+  int n = 0;
+  Array<Pair<double, int> > heap(k);
+  FindClosestNPoints(0, 0, _NumberOfPoints, q, k, n, heap.data());
+  sort_heap(heap.begin(), heap.end(), CompareDistance);
+  for (int i = 0; i < k; ++i) {
+    index[i] = _Index[heap[i].second];
+    if (dist2) dist2[i] = heap[i].first;
+  }
+  return k;
+}
+
+// -----------------------------------------------------------------------------
+template <class TReal>
+Array<int> KdTree<TReal>::FindClosestNPoints(int k, const double *q, Array<double> *dist2) const
+{
+  Array<int> index(max(0, min(k, _NumberOfPoints)));
+  if (dist2) dist2->resize(index.size());
+  FindClosestNPoints(k, q, index.data(), dist2 ? dist2->data() : NULL);
+  return index;
+}
+
+// -----------------------------------------------------------------------------
+template <class TReal>
+void KdTree<TReal>::FindClosestNPoints(int k, int m, const double *queries,
+                                       Array<Array<int> > &index,
+                                       Array<Array<double> > *dist2) const
+{
+  index.resize(m);
+  if (dist2) dist2->resize(m);
+  FindClosestNPointsBody body;
+  body._Tree    = this;
+  body._Queries = queries;
+  body._Index   = &index;
+  body._Dist2   = dist2;
+  body._K       = k;
+  parallel_for(blocked_range<int>(0, m), body);
+}
+
+// =============================================================================
+// Radius search
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+template <class TReal>
+void KdTree<TReal>::FindPointsWithinRadius(int node, int begin, int end, const double *q,
+                                           double maxdist2, Array<Pair<double, int> > &found) const
+{
+  if (end - begin <= _LeafSize) {
+    double d2;
+    for (int i = begin; i < end; ++i) {
+      d2 = Distance2(q, i);
+      if (d2 <= maxdist2) found.push_back(MakePair(d2, i));
+    }
+  } else {
+    const int    mid  = begin + (end - begin) / 2;
+    const double diff = q[_SplitDim[node]] - static_cast<double>(_SplitValue[node]);
+    if (diff <= .0 || diff * diff <= maxdist2) {
+      FindPointsWithinRadius(2 * node + 1, begin, mid, q, maxdist2, found);
+    }
+    if (diff >= .0 || diff * diff <= maxdist2) {
+      FindPointsWithinRadius(2 * node + 2, mid, end, q, maxdist2, found);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+template <class TReal>
+Array<int> KdTree<TReal>::FindPointsWithinRadius(double radius, const double *q, Array<double> *dist2) const
+{
+  Array<Pair<double, int> > found;
+  if (_NumberOfPoints > 0) {
+    FindPointsWithinRadius(0, 0, _NumberOfPoints, q, radius * radius, found);
+  }
+  sort(found.begin(), found.end());
+  Array<int> index(found.size());
+  if (dist2) dist2->resize(found.size());
+  for (size_t i = 0; i < found.size(); ++i) {
+    index[i] = _Index[found[i].second];
+    if (dist2) (*dist2)[i] = found[i].first;
+  }
+  return index;
+}
+
+// -----------------------------------------------------------------------------
+template <class TReal>
+void KdTree<TReal>::FindPointsWithinRadius(double radius, int m, const double *queries,
+                                           Array<Array<int> > &index,
+                                           Array<Array<double> > *dist2) const
+{
+  index.resize(m);
+  if (dist2) dist2->resize(m);
+  FindPointsWithinRadiusBody body;
+  body._Tree    = this;
+  body._Queries = queries;
+  body._Index   = &index;
+  body._Dist2   = dist2;
+  body._Radius  = radius;
+  parallel_for(blocked_range<int>(0, m), body);
+}
+
+
+} // namespace mirtk
+
+#endif // MIRTK_KdTree_H
@@ -0,0 +1,136 @@
+/*
+ * Medical Image Registration ToolKit (MIRTK)
+ *
+ * Copyright 2026 Imperial College London
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NumericsTest.h"
+
+#include "mirtk/KdTree.h"
+#include "mirtk/Random.h"
+using namespace mirtk;
+
+// =============================================================================
+// Auxiliaries
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+/// Random points in unit hypercube
+Array<double> RandomPoints(int n, int d, int seed)
+{
+  mt19937 rng(seed);
+  std::uniform_real_distribution<double> dist(.0, 1.0);
+  Array<double> points(n * d);
+  for (int i = 0; i < n * d; ++i) points[i] = dist(rng);
+  return points;
+}
+
+// -----------------------------------------------------------------------------
+/// Squared distances of query point to all points sorted in ascending order
+Array<Pair<double, int> > SortedDistances(const Array<double> &points, int d, const double *q)
+{
+  const int n = static_cast<int>(points.size()) / d;
+  Array<Pair<double, int> > dist2(n);
+  for (int i = 0; i < n; ++i) {
+    double dx, sum = .0;
+    for (int j = 0; j < d; ++j) {
+      dx = static_cast<double>(static_cast<float>(points[i * d + j])) - q[j];
+      sum += dx * dx;
+    }
+    dist2[i] = MakePair(sum, i);
+  }
+  sort(dist2.begin(), dist2.end());
+  return dist2;
+}
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+TEST(KdTree, FindClosestPoint)
+{
+  const int d = 3, n = 1000, m = 100;
+  Array<double> points  = RandomPoints(n, d, 1);
+  Array<double> queries = RandomPoints(m, d, 2);
+  KdTree<float> tree;
+  tree.Initialize(n, d, points.data());
+  ASSERT_EQ(n, tree.NumberOfPoints());
+  Array<int>    index(m);
+  Array<double> dist2(m);
+  tree.FindClosestPoint(m, queries.data(), index.data(), dist2.data());
+  for (int i = 0; i < m; ++i) {
+    Array<Pair<double, int> > expected = SortedDistances(points, d, &queries[i * d]);
+    EXPECT_EQ(expected[0].second, index[i]);
+    EXPECT_EQ(expected[0].first,  dist2[i]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+TEST(KdTree, FindClosestNPoints)
+{
+  const int d = 5, n = 500, m = 50, k = 7;
+  Array<double> points  = RandomPoints(n, d, 3);
+  Array<double> queries = RandomPoints(m, d, 4);
+  KdTree<float> tree;
+  tree.Initialize(n, d, points.data());
+  Array<Array<int> >    index;
+  Array<Array<double> > dist2;
+  tree.FindClosestNPoints(k, m, queries.data(), index, &dist2);
+  ASSERT_EQ(m, static_cast<int>(index.size()));
+  for (int i = 0; i < m; ++i) {
+    Array<Pair<double, int> > expected = SortedDistances(points, d, &queries[i * d]);
+    ASSERT_EQ(k, static_cast<int>(index[i].size()));
+    for (int j = 0; j < k; ++j) {
+      EXPECT_EQ(expected[j].second, index[i][j]);
+      EXPECT_EQ(expected[j].first,  dist2[i][j]);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+TEST(KdTree, FindPointsWithinRadius)
+{
+  const int d = 2, n = 800, m = 50;
+  const double radius = .1;
+  Array<double> points  = RandomPoints(n, d, 5);
+  Array<double> queries = RandomPoints(m, d, 6);
+  KdTree<float> tree;
+  tree.Initialize(n, d, points.data());
+  Array<Array<int> >    index;
+  Array<Array<double> > dist2;
+  tree.FindPointsWithinRadius(radius, m, queries.data(), index, &dist2);
+  for (int i = 0; i < m; ++i) {
+    Array<Pair<double, int> > expected = SortedDistances(points, d, &queries[i * d]);
+    size_t num = 0;
+    while (num < expected.size() && expected[num].first <= radius * radius) ++num;
+    ASSERT_EQ(num, index[i].size());
+    for (size_t j = 0; j < num; ++j) {
+      EXPECT_EQ(expected[j].second, index[i][j]);
+      EXPECT_EQ(expected[j].first,  dist2[i][j]);
+    }
+  }
+}
+
+// =============================================================================
+// Main
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
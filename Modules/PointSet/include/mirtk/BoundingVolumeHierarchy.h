@@ -0,0 +1,254 @@
+/*
+ * Medical Image Registration ToolKit (MIRTK)
+ *
+ * Copyright 2026 Imperial College London
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MIRTK_BoundingVolumeHierarchy_H
+#define MIRTK_BoundingVolumeHierarchy_H
+
+#include "mirtk/Object.h"
+
+#include "mirtk/Array.h"
+
+#include "vtkSmartPointer.h"
+#include "vtkPolyData.h"
+
+
+namespace mirtk {
+
+
+/**
+ * Bounding volume hierarchy of the triangles of a surface mesh
+ *
+ * The hierarchy is a binary tree of axis-aligned bounding boxes. It is built
+ * by recursive median splits of the triangle centers along the axis of largest
+ * extent. The nodes are stored in depth-first order in a contiguous array,
+ * such that the first child of an inner node immediately follows its parent.
+ *
+ * When the surface points move but the triangles remain the same, the bounding
+ * boxes can be refitted to the new point positions without rebuilding the tree.
+ * Queries do not modify the hierarchy and can be executed concurrently, unlike
+ * those of the VTK cell locators which use internal scratch buffers. The vertex
+ * coordinates of the triangles are copied in the order of the leaf nodes, such
+ * that the triangles of a leaf are tested against a query point or line using
+ * contiguous memory.
+ */
+class BoundingVolumeHierarchy : public Object
+{
+  mirtkObjectMacro(BoundingVolumeHierarchy);
+
+  // ---------------------------------------------------------------------------
+  // Types
+public:
+
+  /// Node of the hierarchy
+  struct Node
+  {
+    double _Min[3]; ///< Lower bounds of axis-aligned bounding box
+    double _Max[3]; ///< Upper bounds of axis-aligned bounding box
+    int    _Index;  ///< Offset of leaf into _Cells or index of second child of inner node
+    int    _Count;  ///< Number of triangles of leaf node or zero for inner node
+
+    /// Whether this node is a leaf node
+    bool IsLeaf() const { return _Count > 0; }
+
+    /// Whether bounding box of node overlaps the given box
+    bool Overlaps(const double min[3], const double max[3]) const
+    {
+      return _Min[0] <= max[0] && min[0] <= _Max[0] &&
+             _Min[1] <= max[1] && min[1] <= _Max[1] &&
+             _Min[2] <= max[2] && min[2] <= _Max[2];
+    }
+
+    /// Squared distance of point from bounding box of node
+    double Distance2(const double p[3]) const
+    {
+      double d, dist2 = .0;
+      for (int i = 0; i < 3; ++i) {
+        if      (p[i] < _Min[i]) d = _Min[i] - p[i];
+        else if (p[i] > _Max[i]) d = p[i] - _Max[i];
+        else continue;
+        dist2 += d * d;
+      }
+      return dist2;
+    }
+
+    /// Intersect line segment p0 + t * dir, t in [0, 1], with bounding box
+    /// enlarged by the given tolerance and return entry parameter or -1
+    double Intersect(const double p0[3], const double dir[3], double tol) const
+    {
+      double t0 = .0, t1 = 1.0, a, b;
+      for (int i = 0; i < 3; ++i) {
+        if (dir[i] == .0) {
+          if (p0[i] < _Min[i] - tol || p0[i] > _Max[i] + tol) return -1.0;
+        } else {
+          a = (_Min[i] - tol - p0[i]) / dir[i];
+          b = (_Max[i] + tol - p0[i]) / dir[i];
+          if (dir[i] < .0) {
+            if (b > t0) t0 = b;
+            if (a < t1) t1 = a;
+          } else {
+            if (a > t0) t0 = a;
+            if (b < t1) t1 = b;
+          }
+          if (t0 > t1) return -1.0;
+        }
+      }
+      return t0;
+    }
+  };
+
+  // ---------------------------------------------------------------------------
+  // Attributes
+private:
+
+  /// Triangulated surface mesh
+  mirtkReadOnlyAttributeMacro(vtkSmartPointer<vtkPolyData>, Surface);
+
+  /// Maximum number of triangles per leaf node
+  mirtkPublicAttributeMacro(int, MaxLeafSize);
+
+  /// Nodes of hierarchy in depth-first order, where the first node is the root
+  mirtkReadOnlyAttributeMacro(Array<Node>, Nodes);
+
+  /// IDs of triangles in order of the leaf nodes
+  mirtkReadOnlyAttributeMacro(Array<int>, Cells);
+
+  /// IDs of the three vertices of each triangle
+  mirtkReadOnlyAttributeMacro(Array<int>, Triangles);
+
+  /// Coordinates of the three vertices of each triangle in order of the leaf nodes
+  mirtkReadOnlyAttributeMacro(Array<double>, Coordinates);
+
+  // ---------------------------------------------------------------------------
+  // Construction/destruction
+private:
+
+  /// Copy constructor -- not implemented
+  BoundingVolumeHierarchy(const BoundingVolumeHierarchy &);
+
+  /// Assignment operator -- not implemented
+  BoundingVolumeHierarchy &operator =(const BoundingVolumeHierarchy &);
+
+  /// Build subtree for triangles in given range of _Cells
+  int Build(int, int, const Array<double> &);
+
+public:
+
+  /// Constructor
+  BoundingVolumeHierarchy();
+
+  /// Destructor
+  virtual ~BoundingVolumeHierarchy();
+
+  /// Build hierarchy of the triangles of a surface mesh
+  void Initialize(vtkPolyData *);
+
+  /// Refit bounding boxes to the current point positions of the surface
+  void Refit();
+
+  /// Refit hierarchy if the triangles of the given surface are those of the
+  /// current hierarchy, and rebuild the hierarchy otherwise
+  void Update(vtkPolyData *);
+
+  // ---------------------------------------------------------------------------
+  // Queries
+public:
+
+  /// Number of triangles
+  int NumberOfCells() const;
+
+  /// Get vertex positions of triangle
+  void GetTriangle(int, double [3], double [3], double [3]) const;
+
+  /// Find triangles whose bounding box overlaps the given axis-aligned box
+  ///
+  /// \param[in]  min   Lower bounds of query box.
+  /// \param[in]  max   Upper bounds of query box.
+  /// \param[out] cells IDs of found triangles in ascending order.
+  void FindCellsInBox(const double min[3], const double max[3], Array<int> &cells) const;
+
+  /// Find closest point on surface
+  ///
+  /// \param[in]  x      Query point.
+  /// \param[out] p      Closest point on surface.
+  /// \param[out] cellId ID of triangle containing closest point or -1 if surface is empty.
+  /// \param[out] dist2  Squared distance of closest point from query point.
+  void FindClosestPoint(const double x[3], double p[3], int &cellId, double &dist2) const;
+
+  /// Find closest points on surface for each of the given query points in parallel
+  ///
+  /// \param[in]  n       Number of query points.
+  /// \param[in]  x       Coordinates of query points.
+  /// \param[out] p       Coordinates of closest points.
+  /// \param[out] cellIds IDs of triangles containing closest points.
+  /// \param[out] dist2   Squared distances of closest points. May be NULL.
+  void FindClosestPoints(int n, const double *x, double *p, int *cellIds, double *dist2 = NULL) const;
+
+  /// Find intersection of line segment with surface closest to the start point
+  ///
+  /// Like vtkAbstractCellLocator::IntersectWithLine, a point on the line whose
+  /// distance from a triangle is at most the given tolerance is considered an
+  /// intersection with this triangle.
+  ///
+  /// \param[in]  p0     Start point of line segment.
+  /// \param[in]  p1     End point of line segment.
+  /// \param[in]  tol    Distance tolerance.
+  /// \param[out] t      Parametric coordinate of intersection, i.e., x = p0 + t * (p1 - p0).
+  /// \param[out] x      Intersection point.
+  /// \param[out] cellId ID of intersected triangle or -1 if no intersection was found.
+  ///
+  /// \returns Whether the line segment intersects the surface.
+  bool IntersectWithLine(const double p0[3], const double p1[3], double tol,
+                         double &t, double x[3], int &cellId) const;
+
+  /// Find first intersections of line segments with surface in parallel
+  ///
+  /// \param[in]  n       Number of line segments.
+  /// \param[in]  p0      Coordinates of start points.
+  /// \param[in]  p1      Coordinates of end points.
+  /// \param[in]  tol     Distance tolerance.
+  /// \param[out] t       Parametric coordinates of intersections.
+  /// \param[out] x       Coordinates of intersection points.
+  /// \param[out] cellIds IDs of intersected triangles or -1 if segment does not intersect surface.
+  void IntersectWithLines(int n, const double *p0, const double *p1, double tol,
+                          double *t, double *x, int *cellIds) const;
+
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Inline definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// -----------------------------------------------------------------------------
+inline int BoundingVolumeHierarchy::NumberOfCells() const
+{
+  return static_cast<int>(_Cells.size());
+}
+
+// -----------------------------------------------------------------------------
+inline void BoundingVolumeHierarchy::GetTriangle(int cellId, double a[3], double b[3], double c[3]) const
+{
+  const int *pts = _Triangles.data() + 3 * cellId;
+  _Surface->GetPoint(pts[0], a);
+  _Surface->GetPoint(pts[1], b);
+  _Surface->GetPoint(pts[2], c);
+}
+
+
+} // namespace mirtk
+
+#endif // MIRTK_BoundingVolumeHierarchy_H
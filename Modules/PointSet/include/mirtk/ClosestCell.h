@@ -41,7 +41,12 @@ class ClosestCell : public PointCorrespondence
 public:
 
   /// Enumeration value of supported cell locators
-  enum LocatorType { Default, CellTree, BSPTree, OBBTree };
+  ///
+  /// The default locator is a BoundingVolumeHierarchy when the point set is a
+  /// triangulated surface mesh and a vtkCellLocator otherwise. Only the closest
+  /// point queries of the bounding volume hierarchy are executed in parallel,
+  /// because those of the VTK cell locators are not thread-safe.
+  enum LocatorType { Default, CellTree, BSPTree, OBBTree, BVH };
 
   // ---------------------------------------------------------------------------
   // Attributes
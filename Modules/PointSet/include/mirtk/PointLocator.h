@@ -25,6 +25,7 @@
 #include "mirtk/Array.h"
 #include "mirtk/Point.h"
 #include "mirtk/Memory.h"
+#include "mirtk/KdTree.h"
 
 #include "vtkSmartPointer.h"
 #include "vtkPointSet.h"
@@ -51,17 +52,31 @@ class FlannPointLocator;
  * nearest neighbors within the n-dimensional feature space spanned by the
  * feature Arrays used to establish point correspondences.
  *
- * The implementation uses either VTK for point search in three dimensions or
- * FLANN for higher dimensional feature spaces if available. Alternatively,
- * an ITK Kd tree is used if the library is available. As last resort, a brute
- * force search without actual Kd tree search structure is performed.
+ * The default implementation uses a Kd tree of the (weighted and rescaled)
+ * feature vectors of the points, which are stored with single floating point
+ * precision. The search structure is read-only after initialization, such that
+ * queries can be executed concurrently. Queries for all points of a dataset are
+ * processed in parallel. Alternatively, a VTK octree can be used for point search
+ * in up to three dimensions or FLANN for higher dimensional feature spaces if
+ * available (see LocatorType).
  *
- * \todo Consider actual implementation of own thread-safe N-dimensional Kd tree?
+ * The indices returned by the search functions are the indices of the found
+ * points within the (sample) points of the dataset for which the search
+ * structure was build.
  */
 class PointLocator : public Object
 {
   mirtkObjectMacro(PointLocator);
 
+public:
+
+  /// Enumeration of available search structures
+  ///
+  /// The Default search structure is the Kd tree. The VTK octree can only be
+  /// used for feature spaces of dimension three or less, and FLANN only when
+  /// MIRTK was built with it.
+  enum LocatorType { Default, KdTreeLocator, OctreeLocator, FlannLocator };
+
   // ---------------------------------------------------------------------------
   // Feature Arrays
 public:
@@ -194,6 +209,12 @@ public:
   /// Dimension of feature Arrays/points
   mirtkReadOnlyAttributeMacro(int, PointDimension);
 
+  /// Type of search structure
+  mirtkReadOnlyAttributeMacro(enum LocatorType, LocatorType);
+
+  /// Kd tree of feature vectors
+  KdTree<float> _Tree;
+
   /// VTK point locator used for three-dimensional feature spaces
   vtkSmartPointer<vtkOctreePointLocator> _VtkLocator;
 
@@ -228,9 +249,11 @@ public:
   /// \param[in] dataset Dataset in which points are searched.
   /// \param[in] sample  Indices of points in \p dataset to consider only or NULL for all.
   /// \param[in] feature Indices and weights of point data in \p dataset to use.
+  /// \param[in] type    Type of search structure.
   static PointLocator *New(vtkPointSet       *dataset,
                            const Array<int>  *sample  = NULL,
-                           const FeatureList *feature = NULL);
+                           const FeatureList *feature = NULL,
+                           enum LocatorType   type    = Default);
 
   /// Destructor
   virtual ~PointLocator();
@@ -25,6 +25,7 @@
 #include "mirtk/Array.h"
 #include "mirtk/PointSet.h"
 #include "mirtk/Transformation.h"
+#include "mirtk/RegisteredImage.h"
 #include "mirtk/EdgeTable.h"
 #include "mirtk/EdgeConnectivity.h"
 
@@ -97,6 +98,9 @@ public:
   /// Table of n-connected node neighbors
   typedef EdgeConnectivity NodeNeighbors;
 
+  /// Type of cached displacement fields
+  typedef RegisteredImage::DisplacementImageType DisplacementImageType;
+
   // ---------------------------------------------------------------------------
   // Attributes
 
@@ -202,10 +206,10 @@ protected:
   mirtkPublicAttributeMacro(ImageAttributes, Domain);
 
   /// Externally pre-computed displacements to use
-  mirtkPublicAggregateMacro(GenericImage<double>, ExternalDisplacement);
+  mirtkPublicAggregateMacro(DisplacementImageType, ExternalDisplacement);
 
   /// Cached displacement field evaluated at each lattice point of _Domain
-  mirtkComponentMacro(GenericImage<double>, Displacement);
+  mirtkComponentMacro(DisplacementImageType, Displacement);
 
   /// Copy attributes of this class from another instance
   void CopyAttributes(const RegisteredPointSet &);
@@ -26,6 +26,7 @@
 #include "mirtk/Array.h"
 #include "mirtk/OrderedSet.h"
 #include "mirtk/Memory.h"
+#include "mirtk/BoundingVolumeHierarchy.h"
 
 #include "vtkSmartPointer.h"
 
@@ -193,11 +194,14 @@ private:
   /// Use BoundingSphereCenter and BoundingSphereRadius cell data arrays of input
   mirtkPublicAttributeMacro(bool, UseInputBoundingSpheres);
 
-  /// Minimum search radius around triangle center used to determine the set
+  /// Minimum half width of box around triangle center used to determine the set
   /// of nearby triangles to be tested for collisions with this triangle
+  ///
+  /// By default, only triangles whose bounding box is within the minimum
+  /// front-/backface distance of the bounding box of this triangle are tested.
   mirtkPublicAttributeMacro(double, MinSearchRadius);
 
-  /// Maximum search radius around triangle center used to determine the set
+  /// Maximum half width of box around triangle center used to determine the set
   /// of nearby triangles to be tested for collisions with this triangle
   mirtkPublicAttributeMacro(double, MaxSearchRadius);
 
@@ -245,6 +249,12 @@ private:
   /// \note Only non-empty after Run when _StoreCollisionDetails is \c true.
   mirtkReadOnlyAttributeMacro(CollisionsArray, Collisions);
 
+  /// Bounding volume hierarchy of output triangles
+  ///
+  /// The hierarchy is kept between runs and only its bounding boxes are
+  /// refitted when the triangles of the input surface remain unchanged.
+  BoundingVolumeHierarchy _Hierarchy;
+
   // ---------------------------------------------------------------------------
   // Construction/destruction
 private:
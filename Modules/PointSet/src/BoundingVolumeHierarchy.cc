@@ -0,0 +1,567 @@
+/*
+ * Medical Image Registration ToolKit (MIRTK)
+ *
+ * Copyright 2026 Imperial College London
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mirtk/BoundingVolumeHierarchy.h"
+
+#include "mirtk/Math.h"
+#include "mirtk/Memory.h"
+#include "mirtk/Algorithm.h"
+#include "mirtk/Parallel.h"
+
+#include "vtkPolyData.h"
+#include "vtkCellArray.h"
+
+
+namespace mirtk {
+
+
+// =============================================================================
+// Auxiliary functors
+// =============================================================================
+
+namespace BoundingVolumeHierarchyUtils {
+
+
+// -----------------------------------------------------------------------------
+/// Compute center points of triangles
+struct ComputeTriangleCenters
+{
+  const BoundingVolumeHierarchy *_Hierarchy;
+  double                        *_Centers;
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    double a[3], b[3], c[3], *p = _Centers + 3 * re.begin();
+    for (int cellId = re.begin(); cellId != re.end(); ++cellId, p += 3) {
+      _Hierarchy->GetTriangle(cellId, a, b, c);
+      p[0] = (a[0] + b[0] + c[0]) / 3.0;
+      p[1] = (a[1] + b[1] + c[1]) / 3.0;
+      p[2] = (a[2] + b[2] + c[2]) / 3.0;
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Compare triangles by coordinate of their center points
+struct CompareTriangleCenters
+{
+  const double *_Centers;
+  int           _Axis;
+
+  bool operator ()(int a, int b) const
+  {
+    return _Centers[3 * a + _Axis] < _Centers[3 * b + _Axis];
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Compute bounding boxes of leaf nodes and copy vertex coordinates of triangles
+struct RefitLeafNodes
+{
+  typedef BoundingVolumeHierarchy::Node Node;
+
+  const BoundingVolumeHierarchy *_Hierarchy;
+  Node                          *_Nodes;
+  double                        *_Coordinates;
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    double *a, *b, *c;
+    const int *cells = _Hierarchy->Cells().data();
+    for (int n = re.begin(); n != re.end(); ++n) {
+      Node &node = _Nodes[n];
+      if (!node.IsLeaf()) continue;
+      for (int d = 0; d < 3; ++d) {
+        node._Min[d] = +numeric_limits<double>::infinity();
+        node._Max[d] = -numeric_limits<double>::infinity();
+      }
+      for (int i = node._Index; i < node._Index + node._Count; ++i) {
+        a = _Coordinates + 9 * i, b = a + 3, c = b + 3;
+        _Hierarchy->GetTriangle(cells[i], a, b, c);
+        for (int d = 0; d < 3; ++d) {
+          node._Min[d] = min(node._Min[d], min(a[d], min(b[d], c[d])));
+          node._Max[d] = max(node._Max[d], max(a[d], max(b[d], c[d])));
+        }
+      }
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Closest point on line segment [a, b] and its squared distance from x
+inline double ClosestPointOnSegment(const double a[3], const double b[3],
+                                    const double x[3], double p[3])
+{
+  const double ab[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+  const double l2 = ab[0] * ab[0] + ab[1] * ab[1] + ab[2] * ab[2];
+  double t = .0;
+  if (l2 > .0) {
+    t = (ab[0] * (x[0] - a[0]) + ab[1] * (x[1] - a[1]) + ab[2] * (x[2] - a[2])) / l2;
+    if      (t < .0)  t = .0;
+    else if (t > 1.0) t = 1.0;
+  }
+  double d, dist2 = .0;
+  for (int i = 0; i < 3; ++i) {
+    p[i]   = a[i] + t * ab[i];
+    d      = x[i] - p[i];
+    dist2 += d * d;
+  }
+  return dist2;
+}
+
+// -----------------------------------------------------------------------------
+/// Closest point on triangle and its squared distance from x
+///
+/// The Voronoi region of the triangle containing x is determined using
+/// barycentric coordinates as described in Ericson, Real-Time Collision
+/// Detection, section 5.1.5. Unlike vtkTriangle::EvaluatePosition, no cell
+/// object or scratch memory is needed. Degenerate triangles are handled by
+/// returning the closest point on the triangle edges.
+///
+/// \param[in]  tri Coordinates of the three triangle vertices.
+/// \param[in]  x   Query point.
+/// \param[out] p   Closest point on triangle.
+inline double ClosestPointOnTriangle(const double tri[9], const double x[3], double p[3])
+{
+  const double *a = tri, *b = tri + 3, *c = tri + 6;
+  const double ab[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+  const double ac[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+  const double ax[3] = {x[0] - a[0], x[1] - a[1], x[2] - a[2]};
+  const double bx[3] = {x[0] - b[0], x[1] - b[1], x[2] - b[2]};
+  const double cx[3] = {x[0] - c[0], x[1] - c[1], x[2] - c[2]};
+
+  double v, w;
+  const double d1 = ab[0] * ax[0] + ab[1] * ax[1] + ab[2] * ax[2];
+  const double d2 = ac[0] * ax[0] + ac[1] * ax[1] + ac[2] * ax[2];
+  const double d3 = ab[0] * bx[0] + ab[1] * bx[1] + ab[2] * bx[2];
+  const double d4 = ac[0] * bx[0] + ac[1] * bx[1] + ac[2] * bx[2];
+  const double d5 = ab[0] * cx[0] + ab[1] * cx[1] + ab[2] * cx[2];
+  const double d6 = ac[0] * cx[0] + ac[1] * cx[1] + ac[2] * cx[2];
+  const double va = d3 * d6 - d5 * d4;
+  const double vb = d5 * d2 - d1 * d6;
+  const double vc = d1 * d4 - d3 * d2;
+
+  if (d1 <= .0 && d2 <= .0) {
+    // Vertex region of a
+    v = w = .0;
+  } else if (d3 >= .0 && d4 <= d3) {
+    // Vertex region of b
+    v = 1.0, w = .0;
+  } else if (vc <= .0 && d1 >= .0 && d3 <= .0) {
+    // Edge region of ab
+    v = d1 / (d1 - d3), w = .0;
+  } else if (d6 >= .0 && d5 <= d6) {
+    // Vertex region of c
+    v = .0, w = 1.0;
+  } else if (vb <= .0 && d2 >= .0 && d6 <= .0) {
+    // Edge region of ac
+    v = .0, w = d2 / (d2 - d6);
+  } else if (va <= .0 && (d4 - d3) >= .0 && (d5 - d6) >= .0) {
+    // Edge region of bc
+    w = (d4 - d3) / ((d4 - d3) + (d5 - d6)), v = 1.0 - w;
+  } else if (va + vb + vc > .0) {
+    // Face region
+    const double denom = 1.0 / (va + vb + vc);
+    v = vb * denom, w = vc * denom;
+  } else {
+    // Degenerate triangle
+    double q[3], dist2 = ClosestPointOnSegment(a, b, x, p), d;
+    if ((d = ClosestPointOnSegment(b, c, x, q)) < dist2) {
+      p[0] = q[0], p[1] = q[1], p[2] = q[2], dist2 = d;
+    }
+    if ((d = ClosestPointOnSegment(c, a, x, q)) < dist2) {
+      p[0] = q[0], p[1] = q[1], p[2] = q[2], dist2 = d;
+    }
+    return dist2;
+  }
+
+  double d, dist2 = .0;
+  for (int i = 0; i < 3; ++i) {
+    p[i]   = a[i] + v * ab[i] + w * ac[i];
+    d      = x[i] - p[i];
+    dist2 += d * d;
+  }
+  return dist2;
+}
+
+// -----------------------------------------------------------------------------
+/// Intersect line segment p0 + t * dir, t in [0, 1], with plane of triangle
+/// and test whether the intersection point is within tol of the triangle
+inline bool IntersectTriangle(const double tri[9], const double p0[3], const double dir[3],
+                              double tol, double &t, double x[3])
+{
+  const double *a = tri, *b = tri + 3, *c = tri + 6;
+  const double ab[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+  const double ac[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+  const double n [3] = {ab[1] * ac[2] - ab[2] * ac[1],
+                        ab[2] * ac[0] - ab[0] * ac[2],
+                        ab[0] * ac[1] - ab[1] * ac[0]};
+  const double denom = n[0] * dir[0] + n[1] * dir[1] + n[2] * dir[2];
+  if (denom == .0) return false;
+  t = (n[0] * (a[0] - p0[0]) + n[1] * (a[1] - p0[1]) + n[2] * (a[2] - p0[2])) / denom;
+  if (t < .0 || t > 1.0) return false;
+  x[0] = p0[0] + t * dir[0];
+  x[1] = p0[1] + t * dir[1];
+  x[2] = p0[2] + t * dir[2];
+  double p[3];
+  return ClosestPointOnTriangle(tri, x, p) <= tol * tol;
+}
+
+// -----------------------------------------------------------------------------
+/// Find closest points on surface for a batch of query points
+struct FindClosestPoints
+{
+  const BoundingVolumeHierarchy *_Hierarchy;
+  const double                  *_Points;
+  double                        *_ClosestPoints;
+  int                           *_CellIds;
+  double                        *_Distance2;
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    double dist2;
+    for (int i = re.begin(); i != re.end(); ++i) {
+      _Hierarchy->FindClosestPoint(_Points + 3 * i, _ClosestPoints + 3 * i, _CellIds[i], dist2);
+      if (_Distance2) _Distance2[i] = dist2;
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Intersect a batch of line segments with surface
+struct IntersectWithLines
+{
+  const BoundingVolumeHierarchy *_Hierarchy;
+  const double                  *_StartPoints;
+  const double                  *_EndPoints;
+  double                         _Tolerance;
+  double                        *_Coordinates;
+  double                        *_Intersections;
+  int                           *_CellIds;
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    for (int i = re.begin(); i != re.end(); ++i) {
+      _Hierarchy->IntersectWithLine(_StartPoints + 3 * i, _EndPoints + 3 * i, _Tolerance,
+                                    _Coordinates[i], _Intersections + 3 * i, _CellIds[i]);
+    }
+  }
+};
+
+
+} // namespace BoundingVolumeHierarchyUtils
+
+using namespace BoundingVolumeHierarchyUtils;
+
+// =============================================================================
+// Construction/destruction
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+BoundingVolumeHierarchy::BoundingVolumeHierarchy()
+:
+  _MaxLeafSize(4)
+{
+}
+
+// -----------------------------------------------------------------------------
+BoundingVolumeHierarchy::~BoundingVolumeHierarchy()
+{
+}
+
+// -----------------------------------------------------------------------------
+int BoundingVolumeHierarchy::Build(int begin, int end, const Array<double> &centers)
+{
+  const int n = static_cast<int>(_Nodes.size());
+  _Nodes.push_back(Node());
+  if (end - begin <= _MaxLeafSize) {
+    _Nodes[n]._Index = begin;
+    _Nodes[n]._Count = end - begin;
+    return n;
+  }
+  // Split at median triangle center along axis of largest extent
+  double min[3], max[3];
+  for (int d = 0; d < 3; ++d) {
+    min[d] = +numeric_limits<double>::infinity();
+    max[d] = -numeric_limits<double>::infinity();
+  }
+  for (int i = begin; i < end; ++i) {
+    const double *p = centers.data() + 3 * _Cells[i];
+    for (int d = 0; d < 3; ++d) {
+      if (p[d] < min[d]) min[d] = p[d];
+      if (p[d] > max[d]) max[d] = p[d];
+    }
+  }
+  CompareTriangleCenters comp;
+  comp._Centers = centers.data();
+  comp._Axis    = 0;
+  for (int d = 1; d < 3; ++d) {
+    if (max[d] - min[d] > max[comp._Axis] - min[comp._Axis]) comp._Axis = d;
+  }
+  const int mid = begin + (end - begin) / 2;
+  std::nth_element(_Cells.begin() + begin, _Cells.begin() + mid, _Cells.begin() + end, comp);
+  _Nodes[n]._Count = 0;
+  Build(begin, mid, centers);
+  const int second = Build(mid, end, centers);
+  _Nodes[n]._Index = second;
+  return n;
+}
+
+// -----------------------------------------------------------------------------
+void BoundingVolumeHierarchy::Initialize(vtkPolyData *surface)
+{
+  _Surface = surface;
+  _Nodes.clear();
+  _Cells.clear();
+  _Triangles.clear();
+  _Coordinates.clear();
+  if (!_Surface) {
+    cerr << "BoundingVolumeHierarchy::Initialize: Missing surface mesh" << endl;
+    exit(1);
+  }
+  if (_MaxLeafSize < 1) _MaxLeafSize = 1;
+
+  // Copy vertex IDs of triangles
+  const int ncells = static_cast<int>(_Surface->GetNumberOfCells());
+  vtkIdType npts, *pts;
+  _Triangles.resize(3 * ncells);
+  _Cells.resize(ncells);
+  for (int cellId = 0; cellId < ncells; ++cellId) {
+    _Surface->GetCellPoints(cellId, npts, pts);
+    if (npts != 3) {
+      cerr << "BoundingVolumeHierarchy::Initialize: Surface must be a triangular mesh" << endl;
+      exit(1);
+    }
+    _Triangles[3 * cellId    ] = static_cast<int>(pts[0]);
+    _Triangles[3 * cellId + 1] = static_cast<int>(pts[1]);
+    _Triangles[3 * cellId + 2] = static_cast<int>(pts[2]);
+    _Cells[cellId] = cellId;
+  }
+  if (ncells == 0) return;
+
+  // Build tree
+  Array<double> centers(3 * ncells);
+  ComputeTriangleCenters eval;
+  eval._Hierarchy = this;
+  eval._Centers   = centers.data();
+  parallel_for(blocked_range<int>(0, ncells), eval);
+  _Nodes.reserve(2 * ((ncells + _MaxLeafSize - 1) / _MaxLeafSize));
+  Build(0, ncells, centers);
+
+  // Compute bounding boxes
+  Refit();
+}
+
+// -----------------------------------------------------------------------------
+void BoundingVolumeHierarchy::Refit()
+{
+  if (_Nodes.empty()) return;
+  _Coordinates.resize(9 * _Cells.size());
+  RefitLeafNodes refit;
+  refit._Hierarchy   = this;
+  refit._Nodes       = _Nodes.data();
+  refit._Coordinates = _Coordinates.data();
+  parallel_for(blocked_range<int>(0, static_cast<int>(_Nodes.size())), refit);
+  // Children have greater indices than their parent
+  for (int n = static_cast<int>(_Nodes.size()) - 1; n >= 0; --n) {
+    Node &node = _Nodes[n];
+    if (node.IsLeaf()) continue;
+    const Node &child1 = _Nodes[n + 1];
+    const Node &child2 = _Nodes[node._Index];
+    for (int d = 0; d < 3; ++d) {
+      node._Min[d] = min(child1._Min[d], child2._Min[d]);
+      node._Max[d] = max(child1._Max[d], child2._Max[d]);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+void BoundingVolumeHierarchy::Update(vtkPolyData *surface)
+{
+  bool rebuild = (surface->GetNumberOfCells() != static_cast<vtkIdType>(_Cells.size()));
+  if (!rebuild) {
+    vtkIdType npts, *pts;
+    const int *tri = _Triangles.data();
+    for (vtkIdType cellId = 0; cellId < surface->GetNumberOfCells(); ++cellId, tri += 3) {
+      surface->GetCellPoints(cellId, npts, pts);
+      if (npts != 3 || pts[0] != tri[0] || pts[1] != tri[1] || pts[2] != tri[2]) {
+        rebuild = true;
+        break;
+      }
+    }
+  }
+  if (rebuild) {
+    Initialize(surface);
+  } else {
+    _Surface = surface;
+    Refit();
+  }
+}
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+void BoundingVolumeHierarchy
+::FindCellsInBox(const double min[3], const double max[3], Array<int> &cells) const
+{
+  cells.clear();
+  if (_Nodes.empty()) return;
+  int stack[64], top = 0;
+  stack[top++] = 0;
+  while (top > 0) {
+    const int  n    = stack[--top];
+    const Node &node = _Nodes[n];
+    if (!node.Overlaps(min, max)) continue;
+    if (node.IsLeaf()) {
+      double a[3], b[3], c[3];
+      for (int i = node._Index; i < node._Index + node._Count; ++i) {
+        GetTriangle(_Cells[i], a, b, c);
+        if (mirtk::min(a[0], mirtk::min(b[0], c[0])) <= max[0] && min[0] <= mirtk::max(a[0], mirtk::max(b[0], c[0])) &&
+            mirtk::min(a[1], mirtk::min(b[1], c[1])) <= max[1] && min[1] <= mirtk::max(a[1], mirtk::max(b[1], c[1])) &&
+            mirtk::min(a[2], mirtk::min(b[2], c[2])) <= max[2] && min[2] <= mirtk::max(a[2], mirtk::max(b[2], c[2]))) {
+          cells.push_back(_Cells[i]);
+        }
+      }
+    } else {
+      stack[top++] = node._Index;
+      stack[top++] = n + 1;
+    }
+  }
+  sort(cells.begin(), cells.end());
+}
+
+// -----------------------------------------------------------------------------
+void BoundingVolumeHierarchy
+::FindClosestPoint(const double x[3], double p[3], int &cellId, double &dist2) const
+{
+  cellId = -1;
+  dist2  = numeric_limits<double>::infinity();
+  if (_Nodes.empty()) return;
+  // Visit nodes in order of increasing distance of their bounding boxes
+  // and skip those which cannot contain a closer point
+  int    stack[64], top = 0;
+  double bound[64];
+  double q[3], d;
+  stack[top] = 0, bound[top] = _Nodes[0].Distance2(x), ++top;
+  while (top > 0) {
+    --top;
+    if (bound[top] >= dist2) continue;
+    const int   n    = stack[top];
+    const Node &node = _Nodes[n];
+    if (node.IsLeaf()) {
+      const double *tri = _Coordinates.data() + 9 * node._Index;
+      for (int i = node._Index; i < node._Index + node._Count; ++i, tri += 9) {
+        d = ClosestPointOnTriangle(tri, x, q);
+        if (d < dist2) {
+          p[0] = q[0], p[1] = q[1], p[2] = q[2];
+          cellId = _Cells[i], dist2 = d;
+        }
+      }
+    } else {
+      int    child1 = n + 1, child2 = node._Index;
+      double d1 = _Nodes[child1].Distance2(x);
+      double d2 = _Nodes[child2].Distance2(x);
+      if (d1 > d2) {
+        swap(child1, child2);
+        swap(d1, d2);
+      }
+      if (d2 < dist2) stack[top] = child2, bound[top] = d2, ++top;
+      if (d1 < dist2) stack[top] = child1, bound[top] = d1, ++top;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+void BoundingVolumeHierarchy
+::FindClosestPoints(int n, const double *x, double *p, int *cellIds, double *dist2) const
+{
+  BoundingVolumeHierarchyUtils::FindClosestPoints query;
+  query._Hierarchy     = this;
+  query._Points        = x;
+  query._ClosestPoints = p;
+  query._CellIds       = cellIds;
+  query._Distance2     = dist2;
+  parallel_for(blocked_range<int>(0, n), query);
+}
+
+// -----------------------------------------------------------------------------
+bool BoundingVolumeHierarchy
+::IntersectWithLine(const double p0[3], const double p1[3], double tol,
+                    double &t, double x[3], int &cellId) const
+{
+  cellId = -1;
+  t      = numeric_limits<double>::infinity();
+  if (_Nodes.empty()) return false;
+  const double dir[3] = {p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2]};
+  // Visit nodes in order of the line parameter at which the line segment
+  // enters their (enlarged) bounding boxes and skip those entered after
+  // the closest intersection found so far
+  int    stack[64], top = 0;
+  double bound[64];
+  double s, y[3];
+  if ((bound[top] = _Nodes[0].Intersect(p0, dir, tol)) < .0) return false;
+  stack[top++] = 0;
+  while (top > 0) {
+    --top;
+    if (bound[top] > t) continue;
+    const int   n    = stack[top];
+    const Node &node = _Nodes[n];
+    if (node.IsLeaf()) {
+      const double *tri = _Coordinates.data() + 9 * node._Index;
+      for (int i = node._Index; i < node._Index + node._Count; ++i, tri += 9) {
+        if (IntersectTriangle(tri, p0, dir, tol, s, y) && s < t) {
+          x[0] = y[0], x[1] = y[1], x[2] = y[2];
+          cellId = _Cells[i], t = s;
+        }
+      }
+    } else {
+      int    child1 = n + 1, child2 = node._Index;
+      double t1 = _Nodes[child1].Intersect(p0, dir, tol);
+      double t2 = _Nodes[child2].Intersect(p0, dir, tol);
+      if (t1 < .0 || (t2 >= .0 && t2 < t1)) {
+        swap(child1, child2);
+        swap(t1, t2);
+      }
+      if (t2 >= .0 && t2 <= t) stack[top] = child2, bound[top] = t2, ++top;
+      if (t1 >= .0 && t1 <= t) stack[top] = child1, bound[top] = t1, ++top;
+    }
+  }
+  if (cellId == -1) t = .0;
+  return cellId != -1;
+}
+
+// -----------------------------------------------------------------------------
+void BoundingVolumeHierarchy
+::IntersectWithLines(int n, const double *p0, const double *p1, double tol,
+                     double *t, double *x, int *cellIds) const
+{
+  BoundingVolumeHierarchyUtils::IntersectWithLines query;
+  query._Hierarchy     = this;
+  query._StartPoints   = p0;
+  query._EndPoints     = p1;
+  query._Tolerance     = tol;
+  query._Coordinates   = t;
+  query._Intersections = x;
+  query._CellIds       = cellIds;
+  parallel_for(blocked_range<int>(0, n), query);
+}
+
+
+} // namespace mirtk
@@ -23,6 +23,8 @@
 #include "mirtk/Array.h"
 #include "mirtk/Parallel.h"
 #include "mirtk/Point.h"
+#include "mirtk/PointSetUtils.h"
+#include "mirtk/BoundingVolumeHierarchy.h"
 #include "mirtk/Transformation.h"
 
 #include "vtkSmartPointer.h"
@@ -55,23 +57,25 @@ class UpdateCorrespondences
 {
 private:
 
-  vtkPointSet            *_Target;
-  const Array<int>       *_Sample;
-  vtkAbstractCellLocator *_Source;
-  PointSet               *_Points;
-  Array<double>          *_Distance;
-  const Transformation   *_Transformation;
-  bool                    _Changed;
+  vtkPointSet                   *_Target;
+  const Array<int>              *_Sample;
+  vtkAbstractCellLocator        *_Source;
+  const BoundingVolumeHierarchy *_Hierarchy;
+  PointSet                      *_Points;
+  Array<double>                 *_Distance;
+  const Transformation          *_Transformation;
+  bool                           _Changed;
 
 public:
 
-  UpdateCorrespondences() : _Changed(false) {}
+  UpdateCorrespondences() : _Source(NULL), _Hierarchy(NULL), _Changed(false) {}
 
   UpdateCorrespondences(const UpdateCorrespondences &lhs, split)
   :
     _Target(lhs._Target),
     _Sample(lhs._Sample),
     _Source(lhs._Source),
+    _Hierarchy(lhs._Hierarchy),
     _Points(lhs._Points),
     _Distance(lhs._Distance),
     _Transformation(lhs._Transformation),
@@ -86,14 +90,18 @@ public:
   void operator()(const blocked_range<int> &re)
   {
     vtkIdType cellId;
-    int       subId;
+    int       subId, triId;
     double    p[3];
 
     Array<double> &distance = *_Distance;
 
     for (int k = re.begin(); k != re.end(); ++k) {
       _Target->GetPoint(PointCorrespondence::GetPointIndex(_Target, _Sample, k), p);
-      _Source->FindClosestPoint(p, p, cellId, subId, distance[k]);
+      if (_Hierarchy) {
+        _Hierarchy->FindClosestPoint(p, p, triId, distance[k]);
+      } else {
+        _Source->FindClosestPoint(p, p, cellId, subId, distance[k]);
+      }
       distance[k] = sqrt(distance[k]);
       if (_Transformation) {
         if (!_Transformation->Inverse(p[0], p[1], p[2])) {
@@ -125,6 +133,29 @@ public:
     points  .Resize (n);
     distance.resize (n);
     if (n == 0) return false;
+    // Use thread-safe bounding volume hierarchy of triangulated surface
+    vtkPolyData *surface = vtkPolyData::SafeDownCast(source->PointSet());
+    if (type == LocatorType::Default && surface && IsTriangularMesh(surface)) {
+      type = LocatorType::BVH;
+    }
+    if (type == LocatorType::BVH) {
+      if (!surface || !IsTriangularMesh(surface)) {
+        cerr << "ClosestCell::Initialize: BVH locator requires a triangulated surface mesh" << endl;
+        exit(1);
+      }
+      BoundingVolumeHierarchy hierarchy;
+      hierarchy.MaxLeafSize(cells_per_node);
+      hierarchy.Initialize(surface);
+      UpdateCorrespondences body;
+      body._Target         = target->PointSet();
+      body._Sample         = sample;
+      body._Hierarchy      = &hierarchy;
+      body._Points         = &points;
+      body._Distance       = &distance;
+      body._Transformation = transformation;
+      parallel_reduce(blocked_range<int>(0, n), body);
+      return body._Changed;
+    }
     // Initialize cell locator
     vtkSmartPointer<vtkAbstractCellLocator> locator;
     switch (type) {
@@ -140,6 +171,7 @@ public:
     locator->SetDataSet(source->PointSet());
     locator->BuildLocator();
     // Find closest cell points
+    // Note: vtkAbstractCellLocator's are not thread-safe!
     UpdateCorrespondences body;
     body._Target         = target->PointSet();
     body._Sample         = sample;
@@ -147,12 +179,7 @@ public:
     body._Points         = &points;
     body._Distance       = &distance;
     body._Transformation = transformation;
-    blocked_range<int> range(0, n);
-    // TODO: vtkAbstractCellLocator's are not thread-safe!
-    //       Why not use separate cell locator instances for each thread?
-    //       Use concurrent_bounded_queue to store pointers to these.
-    //parallel_reduction(range, body);
-    body(range);
+    body(blocked_range<int>(0, n));
     return body._Changed;
   }
 };
@@ -232,6 +259,11 @@ bool ClosestCell::Set(const char *name, const char *value)
       _LocatorType = OBBTree;
       return true;
     }
+    if (strcmp(value, "BVH")                     == 0 ||
+        strcmp(value, "BoundingVolumeHierarchy") == 0) {
+      _LocatorType = BVH;
+      return true;
+    }
     return false;
   }
   if (strcmp(name, "No. of cells per node") == 0 ||
@@ -256,6 +288,7 @@ ParameterList ClosestCell::Parameter() const
     case CellTree: Insert(params, "Locator type", "CellTree"); break;
     case BSPTree:  Insert(params, "Locator type", "BSPTree" );  break;
     case OBBTree:  Insert(params, "Locator type", "OBBTree" );  break;
+    case BVH:      Insert(params, "Locator type", "BVH"     );  break;
   }
   Insert(params, "No. of cells per node", _NumberOfCellsPerNode);
   if (_Sigma >= .0) {
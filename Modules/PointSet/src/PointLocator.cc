@@ -28,8 +28,6 @@
 
 #include "mirtk/Assert.h"
 #include "mirtk/Array.h"
-#include "mirtk/ArrayHeap.h"
-#include "mirtk/Pair.h"
 #include "mirtk/Allocate.h"
 #include "mirtk/Deallocate.h"
 #include "mirtk/Parallel.h"
@@ -346,14 +344,14 @@ Array<Array<int> > FlannPointLocator
   Array<Array<int> > indices;
   Array<Array<FlannType> > dists;
   flann::Matrix<FlannType> queries = FlannMatrix(dataset, sample, features);
-  _FlannTree.radiusSearch(queries, indices, dists, radius,
+  _FlannTree.radiusSearch(queries, indices, dists, radius * radius,
                           flann::SearchParams(flann::FLANN_CHECKS_UNLIMITED));
   delete[] queries.ptr();
   if (dist2) {
     dist2->resize(dists.size());
     for (size_t i = 0; i < dists.size(); ++i) {
       Array<double> &row = (*dist2)[i];
-      row.resize(dists[0].size());
+      row.resize(dists[i].size());
       for (size_t j = 0; j < row.size(); ++j) {
         row[j] = static_cast<double>(dists[i][j]);
       }
@@ -367,6 +365,123 @@ Array<Array<int> > FlannPointLocator
 // class: PointLocator
 ////////////////////////////////////////////////////////////////////////////////
 
+// =============================================================================
+// Auxiliaries
+// =============================================================================
+
+namespace PointLocatorUtils {
+
+
+// -----------------------------------------------------------------------------
+/// Copy feature vectors of (sample) points into contiguous array
+struct GetFeatureVectors
+{
+  vtkPointSet                     *_DataSet;
+  const Array<int>                *_Sample;
+  const PointLocator::FeatureList *_Features;
+  double                          *_Points;
+  int                              _PointDimension;
+
+  void operator ()(const blocked_range<int> &idx) const
+  {
+    for (int i = idx.begin(); i != idx.end(); ++i) {
+      PointLocator::GetPoint(_Points + i * _PointDimension, _DataSet, _Sample, i, _Features);
+    }
+  }
+
+  static void Run(vtkPointSet *dataset, const Array<int> *sample,
+                  const PointLocator::FeatureList *features,
+                  int dim, Array<double> &points)
+  {
+    const int n = PointLocator::GetNumberOfPoints(dataset, sample);
+    points.resize(static_cast<size_t>(n) * dim);
+    GetFeatureVectors body;
+    body._DataSet        = dataset;
+    body._Sample         = sample;
+    body._Features       = features;
+    body._Points         = points.data();
+    body._PointDimension = dim;
+    parallel_for(blocked_range<int>(0, n), body);
+  }
+};
+
+// -----------------------------------------------------------------------------
+struct FindClosestPoint
+{
+  vtkPointSet                     *_DataSet;
+  const Array<int>                *_Sample;
+  const PointLocator::FeatureList *_Features;
+  PointLocator                    *_Locator;
+  Array<int>                      *_Index;
+  Array<double>                   *_Dist2;
+
+  void operator ()(const blocked_range<int> &idx) const
+  {
+    if (_Dist2) {
+      for (int i = idx.begin(); i != idx.end(); ++i) {
+        (*_Index)[i] = _Locator->FindClosestPoint(_DataSet, _Sample, i, _Features, &((*_Dist2)[i]));
+      }
+    } else {
+      for (int i = idx.begin(); i != idx.end(); ++i) {
+        (*_Index)[i] = _Locator->FindClosestPoint(_DataSet, _Sample, i, _Features);
+      }
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+struct FindClosestNPoints
+{
+  vtkPointSet                     *_DataSet;
+  const Array<int>                *_Sample;
+  const PointLocator::FeatureList *_Features;
+  PointLocator                    *_Locator;
+  Array<Array<int> >              *_Indices;
+  Array<Array<double> >           *_Dist2;
+  int                              _K;
+
+  void operator ()(const blocked_range<int> &idx) const
+  {
+    if (_Dist2) {
+      for (int i = idx.begin(); i != idx.end(); ++i) {
+        (*_Indices)[i] = _Locator->FindClosestNPoints(_K, _DataSet, _Sample, i, _Features, &((*_Dist2)[i]));
+      }
+    } else {
+      for (int i = idx.begin(); i != idx.end(); ++i) {
+        (*_Indices)[i] = _Locator->FindClosestNPoints(_K, _DataSet, _Sample, i, _Features);
+      }
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+struct FindPointsWithinRadius
+{
+  vtkPointSet                     *_DataSet;
+  const Array<int>                *_Sample;
+  const PointLocator::FeatureList *_Features;
+  PointLocator                    *_Locator;
+  Array<Array<int> >              *_Indices;
+  Array<Array<double> >           *_Dist2;
+  double                           _Radius;
+
+  void operator ()(const blocked_range<int> &idx) const
+  {
+    if (_Dist2) {
+      for (int i = idx.begin(); i != idx.end(); ++i) {
+        (*_Indices)[i] = _Locator->FindPointsWithinRadius(_Radius, _DataSet, _Sample, i, _Features, &((*_Dist2)[i]));
+      }
+    } else {
+      for (int i = idx.begin(); i != idx.end(); ++i) {
+        (*_Indices)[i] = _Locator->FindPointsWithinRadius(_Radius, _DataSet, _Sample, i, _Features);
+      }
+    }
+  }
+};
+
+
+} // namespace PointLocatorUtils
+
 // =============================================================================
 // Construction/Destruction
 // =============================================================================
@@ -378,6 +493,7 @@ PointLocator::PointLocator()
   _Sample(NULL),
   _NumberOfPoints(0),
   _PointDimension(0),
+  _LocatorType(Default),
   _FlannLocator(nullptr)
 {
 }
@@ -393,7 +509,8 @@ PointLocator::~PointLocator()
 // -----------------------------------------------------------------------------
 void PointLocator::Initialize()
 {
-  // Destruct previous internal locator(s)
+  // Destruct previous search structure(s)
+  _Tree = KdTree<float>();
   _VtkLocator = NULL;
 #ifdef HAVE_FLANN
   delete _FlannLocator;
@@ -414,45 +531,64 @@ void PointLocator::Initialize()
     cerr << "PointLocator: Point feature vector size is zero!" << endl;
     exit(1);
   }
-  // Build VTK locator for 3-D feature vectors
-  if (_PointDimension <= 3) {
-    // Dataset of 2/3-D sample feature points
-    vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
-    points->SetNumberOfPoints(_NumberOfPoints);
-    double point[3] = {0};
-    for (int i = 0; i < _NumberOfPoints; ++i) {
-      GetPoint(point, _DataSet, _Sample, i, &_Features);
-      points->SetPoint(i, point);
-    }
-    vtkSmartPointer<vtkPolyData> dataset = vtkSmartPointer<vtkPolyData>::New();
-    dataset->SetPoints(points);
-    // Note: vtkOctreeLocator preferred over vtkKdTree because the
-    //       latter is not thread safe even after BuildLocator was called!
-    _VtkLocator = vtkSmartPointer<vtkOctreePointLocator>::New();
-    _VtkLocator->SetDataSet(dataset);
-    _VtkLocator->BuildLocator();
-  } else {
-#ifdef HAVE_FLANN
+  switch (_LocatorType) {
+    // Build VTK locator for 3-D feature vectors
+    case OctreeLocator: {
+      if (_PointDimension > 3) {
+        cerr << "PointLocator: VTK octree requires feature vectors of dimension 3 or less!" << endl;
+        exit(1);
+      }
+      // Dataset of 2/3-D sample feature points
+      vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
+      points->SetNumberOfPoints(_NumberOfPoints);
+      double point[3] = {0};
+      for (int i = 0; i < _NumberOfPoints; ++i) {
+        GetPoint(point, _DataSet, _Sample, i, &_Features);
+        points->SetPoint(i, point);
+      }
+      vtkSmartPointer<vtkPolyData> dataset = vtkSmartPointer<vtkPolyData>::New();
+      dataset->SetPoints(points);
+      // Note: vtkOctreeLocator preferred over vtkKdTree because the
+      //       latter is not thread safe even after BuildLocator was called!
+      _VtkLocator = vtkSmartPointer<vtkOctreePointLocator>::New();
+      _VtkLocator->SetDataSet(dataset);
+      _VtkLocator->BuildLocator();
+    } break;
     // Build FLANN tree for N-D feature vectors
-    _FlannLocator = new FlannPointLocator();
-    _FlannLocator->DataSet(_DataSet);
-    _FlannLocator->Sample(_Sample);
-    _FlannLocator->Features(_Features);
-    _FlannLocator->PointDimension(_PointDimension);
-    _FlannLocator->Initialize();
+    case FlannLocator: {
+#ifdef HAVE_FLANN
+      _FlannLocator = new FlannPointLocator();
+      _FlannLocator->DataSet(_DataSet);
+      _FlannLocator->Sample(_Sample);
+      _FlannLocator->Features(_Features);
+      _FlannLocator->PointDimension(_PointDimension);
+      _FlannLocator->Initialize();
+#else
+      cerr << "PointLocator: MIRTK was built without FLANN!" << endl;
+      exit(1);
 #endif
+    } break;
+    // Build Kd tree of feature vectors
+    case Default:
+    case KdTreeLocator: {
+      Array<double> points;
+      PointLocatorUtils::GetFeatureVectors::Run(_DataSet, _Sample, &_Features, _PointDimension, points);
+      _Tree.Initialize(_NumberOfPoints, _PointDimension, points.data());
+    } break;
   }
 }
 
 // -----------------------------------------------------------------------------
 PointLocator *PointLocator::New(vtkPointSet       *dataset,
                                 const Array<int>  *sample,
-                                const FeatureList *features)
+                                const FeatureList *features,
+                                enum LocatorType   type)
 {
   PointLocator *locator = new PointLocator();
   locator->DataSet(dataset);
   locator->Sample(sample);
   if (features) locator->Features(*features);
+  locator->_LocatorType = type;
   locator->Initialize();
   return locator;
 }
@@ -470,7 +606,7 @@ int PointLocator::FindClosestPoint(double *point, double *dist2)
     vtkIdType j = _VtkLocator->FindClosestPoint(point);
     if (dist2) {
       double p[3] = {0};
-      _DataSet->GetPoint(j, p);
+      _VtkLocator->GetDataSet()->GetPoint(j, p);
       *dist2 = Distance2BetweenPoints(p, point);
     }
     return static_cast<int>(j);
@@ -485,71 +621,51 @@ int PointLocator::FindClosestPoint(double *point, double *dist2)
 #endif
 
   // ---------------------------------------------------------------------------
-  // Brute force
-  double *p = new double[_PointDimension];
-  int    idx, index = -1;
-  double d2, mind2 = numeric_limits<double>::infinity();
-  for (int i = 0; i < _NumberOfPoints; ++i) {
-    idx = GetPointIndex(_DataSet, _Sample, i);
-    GetPoint(p, _DataSet, idx, &_Features);
-    d2 = Distance2BetweenPoints(p, point, _PointDimension);
-    if (d2 < mind2) {
-      index = idx;
-      mind2 = d2;
-    }
-  }
-  delete[] p;
-  if (dist2) (*dist2) = mind2;
-  return index;
+  // Using Kd tree
+  return _Tree.FindClosestPoint(point, dist2);
 }
 
-// -----------------------------------------------------------------------------
-namespace PointLocatorUtils {
-struct FindClosestPoint
-{
-  vtkPointSet                     *_DataSet;
-  const Array<int>                *_Sample;
-  const PointLocator::FeatureList *_Features;
-  PointLocator                    *_Locator;
-  Array<int>                      *_Index;
-  Array<double>                   *_Dist2;
-
-  void operator ()(const blocked_range<int> &idx) const
-  {
-    if (_Dist2) {
-      for (int i = idx.begin(); i != idx.end(); ++i) {
-        (*_Index)[i] = _Locator->FindClosestPoint(_DataSet, _Sample, i, _Features, &((*_Dist2)[i]));
-      }
-    } else {
-      for (int i = idx.begin(); i != idx.end(); ++i) {
-        (*_Index)[i] = _Locator->FindClosestPoint(_DataSet, _Sample, i, _Features);
-      }
-    }
-  }
-};
-} // namespace PointLocatorUtils
-
 // -----------------------------------------------------------------------------
 Array<int> PointLocator
 ::FindClosestPoint(vtkPointSet *dataset, const Array<int> *sample,
                    const FeatureList *features, Array<double> *dist2)
 {
+  mirtkAssert(GetPointDimension(dataset, features) == _PointDimension,
+              "Query points must have same dimension as feature points");
+
+  const int n = GetNumberOfPoints(dataset, sample);
+
+  // ---------------------------------------------------------------------------
+  // Using VTK
+  if (_VtkLocator) {
+    Array<int> index(n);
+    if (dist2) dist2->resize(n);
+    PointLocatorUtils::FindClosestPoint query;
+    query._DataSet  = dataset;
+    query._Sample   = sample;
+    query._Features = features;
+    query._Locator  = this;
+    query._Index    = &index;
+    query._Dist2    = dist2;
+    parallel_for(blocked_range<int>(0, n), query);
+    return index;
+  }
+
+  // ---------------------------------------------------------------------------
+  // Using FLANN
 #ifdef HAVE_FLANN
-  if (!_VtkLocator && _FlannLocator) {
+  if (_FlannLocator) {
     return _FlannLocator->FindClosestPoint(dataset, sample, features, dist2);
   }
 #endif
 
-  Array<int> index(GetNumberOfPoints(dataset, sample));
-  if (dist2) dist2->resize(index.size());
-  PointLocatorUtils::FindClosestPoint query;
-  query._DataSet  = dataset;
-  query._Sample   = sample;
-  query._Features = features;
-  query._Locator  = this;
-  query._Index    = &index;
-  query._Dist2    = dist2;
-  parallel_for(blocked_range<int>(0, static_cast<int>(index.size())), query);
+  // ---------------------------------------------------------------------------
+  // Using Kd tree
+  Array<double> points;
+  PointLocatorUtils::GetFeatureVectors::Run(dataset, sample, features, _PointDimension, points);
+  Array<int> index(n);
+  if (dist2) dist2->resize(n);
+  _Tree.FindClosestPoint(n, points.data(), index.data(), dist2 ? dist2->data() : NULL);
   return index;
 }
 
@@ -587,62 +703,10 @@ Array<int> PointLocator::FindClosestNPoints(int k, double *point, Array<double>
 #endif
 
   // ---------------------------------------------------------------------------
-  // Brute force
-  struct Comp
-  {
-    bool operator()(const Pair<double, int> &a, const Pair<double, int> &b)
-    {
-      return a.first > b.first;
-    }
-  } comp;
-
-  double *p = Allocate<double>(_PointDimension);
-  Array<Pair<double, int> > dists(_NumberOfPoints);
-  for (int i = 0; i < _NumberOfPoints; ++i) {
-    int idx = GetPointIndex(_DataSet, _Sample, i);
-    GetPoint(p, _DataSet, idx, &_Features);
-    dists[i] = MakePair(Distance2BetweenPoints(point, p, _PointDimension), idx);
-  }
-  make_heap(dists.begin(), dists.end(), comp);
-  Array<int> indices(k);
-  for (int i = 0; i < k; ++i) {
-    Pair<double, int> &min = dists.front();
-    if (dist2) (*dist2)[i] = min.first;
-    indices[i] = min.second;
-    pop_heap(dists.begin(), dists.end(), comp);
-    dists.pop_back();
-  }
-  Deallocate(p);
-  return indices;
+  // Using Kd tree
+  return _Tree.FindClosestNPoints(k, point, dist2);
 }
 
-// -----------------------------------------------------------------------------
-namespace PointLocatorUtils {
-struct FindClosestNPoints
-{
-  vtkPointSet                     *_DataSet;
-  const Array<int>                *_Sample;
-  const PointLocator::FeatureList *_Features;
-  PointLocator                    *_Locator;
-  Array<Array<int> >              *_Indices;
-  Array<Array<double> >           *_Dist2;
-  int                              _K;
-
-  void operator ()(const blocked_range<int> &idx) const
-  {
-    if (_Dist2) {
-      for (int i = idx.begin(); i != idx.end(); ++i) {
-        (*_Indices)[i] = _Locator->FindClosestNPoints(_K, _DataSet, _Sample, i, _Features, &((*_Dist2)[i]));
-      }
-    } else {
-      for (int i = idx.begin(); i != idx.end(); ++i) {
-        (*_Indices)[i] = _Locator->FindClosestNPoints(_K, _DataSet, _Sample, i, _Features);
-      }
-    }
-  }
-};
-} // namespace PointLocatorUtils
-
 // -----------------------------------------------------------------------------
 Array<Array<int> > PointLocator
 ::FindClosestNPoints(int k, vtkPointSet *dataset, const Array<int> *sample,
@@ -656,23 +720,39 @@ Array<Array<int> > PointLocator
     exit(1);
   }
 
+  const int n = GetNumberOfPoints(dataset, sample);
+
+  // ---------------------------------------------------------------------------
+  // Using VTK
+  if (_VtkLocator) {
+    Array<Array<int> > indices(n);
+    if (dist2) dist2->resize(n);
+    PointLocatorUtils::FindClosestNPoints query;
+    query._DataSet  = dataset;
+    query._Sample   = sample;
+    query._Features = features;
+    query._Locator  = this;
+    query._Indices  = &indices;
+    query._Dist2    = dist2;
+    query._K        = k;
+    parallel_for(blocked_range<int>(0, n), query);
+    return indices;
+  }
+
+  // ---------------------------------------------------------------------------
+  // Using FLANN
 #ifdef HAVE_FLANN
-  if (!_VtkLocator && _FlannLocator) {
+  if (_FlannLocator) {
     return _FlannLocator->FindClosestNPoints(k, dataset, sample, features, dist2);
   }
 #endif
 
-  Array<Array<int> > indices(GetNumberOfPoints(dataset, sample));
-  if (dist2) dist2->resize(indices.size());
-  PointLocatorUtils::FindClosestNPoints query;
-  query._DataSet  = dataset;
-  query._Sample   = sample;
-  query._Features = features;
-  query._Locator  = this;
-  query._Indices  = &indices;
-  query._Dist2    = dist2;
-  query._K        = k;
-  parallel_for(blocked_range<int>(0, static_cast<int>(indices.size())), query);
+  // ---------------------------------------------------------------------------
+  // Using Kd tree
+  Array<double> points;
+  PointLocatorUtils::GetFeatureVectors::Run(dataset, sample, features, _PointDimension, points);
+  Array<Array<int> > indices;
+  _Tree.FindClosestNPoints(k, n, points.data(), indices, dist2);
   return indices;
 }
 
@@ -711,66 +791,10 @@ Array<int> PointLocator
 #endif
 
   // ---------------------------------------------------------------------------
-  // Brute force
-  struct Comp
-  {
-    bool operator()(const Pair<double, int> &a, const Pair<double, int> &b)
-    {
-      return a.first > b.first;
-    }
-  } comp;
-
-  const double maxdist2 = radius * radius;
-  double *p = Allocate<double>(_PointDimension);
-  Array<Pair<double, int> > dists(_NumberOfPoints);
-  int idx, k = 0;
-  for (int i = 0; i < _NumberOfPoints; ++i) {
-    idx = GetPointIndex(_DataSet, _Sample, i);
-    GetPoint(p, _DataSet, idx, &_Features);
-    dists[i] = MakePair(Distance2BetweenPoints(point, p, _PointDimension), idx);
-    if (dists[i].first <= maxdist2) ++k;
-  }
-  make_heap(dists.begin(), dists.end(), comp);
-  Array<int> indices(k);
-  if (dist2) dist2->resize(k);
-  for (int i = 0; i < k; ++i) {
-    Pair<double, int> &min = dists.front();
-    if (dist2) (*dist2)[i] = min.first;
-    indices[i] = min.second;
-    pop_heap(dists.begin(), dists.end(), comp);
-    dists.pop_back();
-  }
-  Deallocate(p);
-  return indices;
+  // Using Kd tree
+  return _Tree.FindPointsWithinRadius(radius, point, dist2);
 }
 
-// -----------------------------------------------------------------------------
-namespace PointLocatorUtils {
-struct FindPointsWithinRadius
-{
-  vtkPointSet                     *_DataSet;
-  const Array<int>                *_Sample;
-  const PointLocator::FeatureList *_Features;
-  PointLocator                    *_Locator;
-  Array<Array<int> >              *_Indices;
-  Array<Array<double> >           *_Dist2;
-  double                           _Radius;
-
-  void operator ()(const blocked_range<int> &idx) const
-  {
-    if (_Dist2) {
-      for (int i = idx.begin(); i != idx.end(); ++i) {
-        (*_Indices)[i] = _Locator->FindPointsWithinRadius(_Radius, _DataSet, _Sample, i, _Features, &((*_Dist2)[i]));
-      }
-    } else {
-      for (int i = idx.begin(); i != idx.end(); ++i) {
-        (*_Indices)[i] = _Locator->FindPointsWithinRadius(_Radius, _DataSet, _Sample, i, _Features);
-      }
-    }
-  }
-};
-} // namespace PointLocatorUtils
-
 // -----------------------------------------------------------------------------
 Array<Array<int> > PointLocator
 ::FindPointsWithinRadius(double radius, vtkPointSet           *dataset,
@@ -781,23 +805,39 @@ Array<Array<int> > PointLocator
   mirtkAssert(GetPointDimension(dataset, features) == _PointDimension,
               "Query points must have same dimension as feature points");
 
+  const int n = GetNumberOfPoints(dataset, sample);
+
+  // ---------------------------------------------------------------------------
+  // Using VTK
+  if (_VtkLocator) {
+    Array<Array<int> > indices(n);
+    if (dist2) dist2->resize(n);
+    PointLocatorUtils::FindPointsWithinRadius query;
+    query._DataSet  = dataset;
+    query._Sample   = sample;
+    query._Features = features;
+    query._Locator  = this;
+    query._Indices  = &indices;
+    query._Dist2    = dist2;
+    query._Radius   = radius;
+    parallel_for(blocked_range<int>(0, n), query);
+    return indices;
+  }
+
+  // ---------------------------------------------------------------------------
+  // Using FLANN
 #ifdef HAVE_FLANN
-  if (!_VtkLocator && _FlannLocator) {
+  if (_FlannLocator) {
     return _FlannLocator->FindPointsWithinRadius(radius, dataset, sample, features, dist2);
   }
 #endif
 
-  Array<Array<int> > indices(GetNumberOfPoints(dataset, sample));
-  if (dist2) dist2->resize(indices.size());
-  PointLocatorUtils::FindPointsWithinRadius query;
-  query._DataSet  = dataset;
-  query._Sample   = sample;
-  query._Features = features;
-  query._Locator  = this;
-  query._Indices  = &indices;
-  query._Dist2    = dist2;
-  query._Radius   = radius;
-  parallel_for(blocked_range<int>(0, static_cast<int>(indices.size())), query);
+  // ---------------------------------------------------------------------------
+  // Using Kd tree
+  Array<double> points;
+  PointLocatorUtils::GetFeatureVectors::Run(dataset, sample, features, _PointDimension, points);
+  Array<Array<int> > indices;
+  _Tree.FindPointsWithinRadius(radius, n, points.data(), indices, dist2);
   return indices;
 }
 
@@ -56,7 +56,7 @@ namespace mirtk {
 namespace RegisteredPointSetUtils {
 
 /// Type of interpolator used to interpolate dense displacement field
-typedef GenericLinearInterpolateImageFunction<GenericImage<double> > DisplacementInterpolator;
+typedef GenericLinearInterpolateImageFunction<RegisteredPointSet::DisplacementImageType> DisplacementInterpolator;
 
 // -----------------------------------------------------------------------------
 /// Copy VTK points to MIRTK point set
@@ -783,7 +783,7 @@ void RegisteredPointSet::Update(bool force)
       MIRTK_DEBUG_TIMING(7, "transforming points");
     } else if (_Transformation->RequiresCachingOfDisplacements() && _Domain) {
       MIRTK_START_TIMING();
-      if (!_Displacement) _Displacement = new GenericImage<double>();
+      if (!_Displacement) _Displacement = new DisplacementImageType();
       _Displacement->Initialize(_Domain, 3);
       _Transformation->Displacement(*_Displacement, _Time, _InputTime);
       DisplacementInterpolator disp;
@@ -27,12 +27,9 @@
 #include "mirtk/Profiling.h"
 #include "mirtk/PointLocator.h"
 #include "mirtk/SparseMatrix.h"
-#include "mirtk/VtkMath.h"
 
 #include "vtkSmartPointer.h"
-#include "vtkIdList.h"
 #include "vtkPointSet.h"
-#include "vtkOctreePointLocator.h"
 
 
 namespace mirtk {
@@ -48,13 +45,13 @@ namespace RobustPointMatchUtils {
 // -----------------------------------------------------------------------------
 class SquaredDistance
 {
-  vtkSmartPointer<vtkPointSet>           _Target;
-  const Array<int>                      *_Sample;
-  vtkSmartPointer<vtkOctreePointLocator> _Source;
-  int                                    _Num;
-  double                                 _Max;
-  double                                 _Sum, _Sum2;
-  int                                    _Cnt;
+  vtkSmartPointer<vtkPointSet> _Target;
+  const Array<int>            *_Sample;
+  PointLocator                *_Source;
+  int                          _Num;
+  double                       _Max;
+  double                       _Sum, _Sum2;
+  int                          _Cnt;
 
 public:
 
@@ -79,18 +76,17 @@ public:
 
   void operator()(const blocked_range<int> &re)
   {
-    double p1[3], p2[3], dist2 = .0;
-    vtkSmartPointer<vtkIdList> ids = vtkSmartPointer<vtkIdList>::New();
+    double p1[3], dist2 = .0;
+    Array<double> dists;
     for (int r = re.begin(); r != re.end(); ++r) {
       _Target->GetPoint(PointCorrespondence::GetPointIndex(_Target, _Sample, r), p1);
-      _Source->FindClosestNPoints(_Num, p1, ids);
-      for (vtkIdType i = 0; i < ids->GetNumberOfIds(); ++i) {
-        _Source->GetDataSet()->GetPoint(ids->GetId(i), p2);
-        dist2 = vtkMath::Distance2BetweenPoints(p1, p2);
+      _Source->FindClosestNPoints(_Num, p1, &dists);
+      for (size_t i = 0; i < dists.size(); ++i) {
+        dist2  = dists[i];
         _Sum  += dist2;
         _Sum2 += dist2 * dist2;
       }
-      _Cnt += static_cast<int>(ids->GetNumberOfIds());
+      _Cnt += static_cast<int>(dists.size());
       // Note: ids are sorted from closest to farthest
       if (dist2 > _Max) _Max = dist2;
     }
@@ -108,9 +104,8 @@ public:
     _Num    = num;
     _Target = target;
     _Sample = sample;
-    _Source = vtkSmartPointer<vtkOctreePointLocator>::New();
-    _Source->SetDataSet(source);
-    _Source->BuildLocator();
+    unique_ptr<PointLocator> locator(PointLocator::New(source));
+    _Source = locator.get();
     blocked_range<int> range(0, m);
     parallel_reduce(range, *this);
     _Target = NULL;
@@ -147,7 +142,7 @@ class CalculateCorrespondenceWeights
   double                    _Temperature;
   double                    _VarianceOfFeatures;
   WeightMatrix::Entries    *_CorrWeights;
-  vtkAbstractPointLocator  *_Locator;
+  PointLocator             *_Locator;
 
   CalculateCorrespondenceWeights() {}
 
@@ -173,20 +168,21 @@ public:
   void operator()(const blocked_range<int> &re) const
   {
     WeightMatrix::Entries::iterator weight;
-    vtkSmartPointer<vtkIdList> ids = vtkSmartPointer<vtkIdList>::New();
+    Array<int>    ids;
+    Array<double> dists;
     double *p1 = Allocate<double>(_NumberOfFeatures); // spatial + optional extra features
     double *p2 = Allocate<double>(_NumberOfFeatures);
     for (int i = re.begin(); i != re.end(); ++i) {
       PointCorrespondence::GetPoint(p1, _Target, _TargetSample, i, _TargetFeatures);
-      _Locator->FindPointsWithinRadius(_MaxDist, p1, ids);
-      if (ids->GetNumberOfIds() > 0) {
-        _CorrWeights[i].resize(_CorrWeights[i].size() + ids->GetNumberOfIds());
-        weight = _CorrWeights[i].end() - ids->GetNumberOfIds();
-        for (vtkIdType j = 0; j < ids->GetNumberOfIds(); ++j, ++weight) {
-          PointCorrespondence::GetPoint(p2, _Source, _SourceSample, ids->GetId(j), _SourceFeatures);
-          weight->first  = PointCorrespondence::GetPointIndex(_Source, _SourceSample, ids->GetId(j));
-          weight->second = exp(- vtkMath::Distance2BetweenPoints(p1, p2) / _Temperature);
+      ids = _Locator->FindPointsWithinRadius(_MaxDist, p1, &dists);
+      if (!ids.empty()) {
+        _CorrWeights[i].resize(_CorrWeights[i].size() + ids.size());
+        weight = _CorrWeights[i].end() - ids.size();
+        for (size_t j = 0; j < ids.size(); ++j, ++weight) {
+          weight->first  = PointCorrespondence::GetPointIndex(_Source, _SourceSample, ids[j]);
+          weight->second = exp(- dists[j] / _Temperature);
           if (_NumberOfFeatures > 3) {
+            PointCorrespondence::GetPoint(p2, _Source, _SourceSample, ids[j], _SourceFeatures);
             weight->second *= exp(- PointCorrespondence::Distance2BetweenPoints(p1+3, p2+3, _NumberOfFeatures-3) / _VarianceOfFeatures);
           }
         }
@@ -238,13 +234,8 @@ public:
     body._Temperature        = temperature;
     body._VarianceOfFeatures = var_of_features;
     body._CorrWeights        = corrw;
-    vtkSmartPointer<vtkOctreePointLocator> locator;
-    vtkSmartPointer<vtkPointSet>           dataset;
-    dataset = PointCorrespondence::GetPointSet(source, source_sample);
-    locator = vtkSmartPointer<vtkOctreePointLocator>::New();
-    locator->SetDataSet(dataset);
-    locator->BuildLocator();
-    body._Locator = locator;
+    unique_ptr<PointLocator> locator(PointLocator::New(source->PointSet(), source_sample));
+    body._Locator = locator.get();
     parallel_for(blocked_range<int>(0, m), body);
     for (int i = 0; i < m; ++i) sort(corrw[i].begin(), corrw[i].end());
     MIRTK_DEBUG_TIMING(7, "calculating weight for each pair of points");
@@ -23,7 +23,6 @@
 #include "mirtk/Math.h"
 #include "mirtk/Triangle.h"
 #include "mirtk/PointSetUtils.h"
-#include "mirtk/PointLocator.h"
 #include "mirtk/Parallel.h"
 #include "mirtk/Profiling.h"
 #include "mirtk/VtkMath.h"
@@ -37,8 +36,6 @@
 #include "vtkFloatArray.h"
 #include "vtkUnsignedCharArray.h"
 
-#include "vtkAbstractPointLocator.h"
-#include "vtkOctreePointLocator.h"
 #include "vtkIntersectionPolyDataFilter.h"
 
 
@@ -118,14 +115,13 @@ class FindCollisions
   typedef SurfaceCollisions::CollisionsArray    CollisionsArray;
   typedef SurfaceCollisions::CollisionInfo      CollisionInfo;
 
-  SurfaceCollisions       *_Filter;
-  vtkAbstractPointLocator *_Locator;
-  IntersectionsArray      *_Intersections;
-  CollisionsArray         *_Collisions;
-  double                   _MaxRadius;
-  double                   _MinFrontfaceDistance;
-  double                   _MinBackfaceDistance;
-  double                   _MinAngleCos;
+  SurfaceCollisions             *_Filter;
+  const BoundingVolumeHierarchy *_Hierarchy;
+  IntersectionsArray            *_Intersections;
+  CollisionsArray               *_Collisions;
+  double                         _MinFrontfaceDistance;
+  double                         _MinBackfaceDistance;
+  double                         _MinAngleCos;
 
   /// Check whether point c is on the "left" of the line defined by a and b
   inline int IsLeft(const double a[2], const double b[2], const double c[2]) const
@@ -142,23 +138,21 @@ public:
     vtkDataArray *mask      = _Filter->Mask();
     vtkPolyData  *surface   = _Filter->Output();
     vtkDataArray *center    = _Filter->GetCenterArray();
-    vtkDataArray *radius    = _Filter->GetRadiusArray();
     vtkDataArray *coll_type = _Filter->GetCollisionTypeArray();
 
     const bool   coll_test    = (_MinFrontfaceDistance > .0 || _MinBackfaceDistance > .0);
     const double min_distance = max(_MinFrontfaceDistance, _MinBackfaceDistance);
-    const double R            = _MaxRadius + 1.1 * min_distance;
+    const double min_radius   = _Filter->MinSearchRadius();
+    const double max_radius   = _Filter->MaxSearchRadius();
 
     double         tri1[3][3], tri2[3][3], tri1_2D[3][2], tri2_2D[3][2];
-    double         n1[3], n2[3], p1[3], p2[3], r1, c1[3], v[3], search_radius, dot;
+    double         n1[3], n2[3], p1[3], p2[3], c1[3], v[3], dot;
+    double         box_min[3], box_max[3];
     int            tri12[3], i1, i2, shared_vertex1, shared_vertex2, coplanar, s1, s2;
-    vtkIdType      npts, *pts1, *pts2, *cells, cellId1, cellId2;
-    unsigned short ncells;
+    vtkIdType      npts, *pts1, *pts2, cellId1, cellId2;
     CollisionInfo  collision;
     CollisionType  type;
-
-    vtkSmartPointer<vtkIdList> ptIds   = vtkSmartPointer<vtkIdList>::New();
-    vtkSmartPointer<vtkIdList> cellIds = vtkSmartPointer<vtkIdList>::New();
+    Array<int>     cellIds;
 
     for (cellId1 = re.begin(); cellId1 != re.end(); ++cellId1) {
 
@@ -177,24 +171,23 @@ public:
       surface->GetPoint(pts1[2], tri1[2]);
       vtkTriangle::ComputeNormal(tri1[0], tri1[1], tri1[2], n1);
 
-      // Get bounding sphere
+      // Get center of bounding sphere
       center->GetTuple(cellId1, c1);
-      r1 = radius->GetComponent(cellId1, 0);
-
-      // Find other triangles within search radius
-      search_radius = min(max(_Filter->MinSearchRadius(), r1 + R), _Filter->MaxSearchRadius());
-      _Locator->FindPointsWithinRadius(search_radius, c1, ptIds);
-      cellIds->Reset();
-      for (vtkIdType i = 0; i < ptIds->GetNumberOfIds(); ++i) {
-        surface->GetPointCells(ptIds->GetId(i), ncells, cells);
-        for (unsigned short j = 0; j < ncells; ++j) {
-          if (cells[j] != cellId1) cellIds->InsertUniqueId(cells[j]);
-        }
+
+      // Find other triangles whose bounding box is within the minimum
+      // distance of the bounding box of this triangle
+      for (int d = 0; d < 3; ++d) {
+        box_min[d] = min(tri1[0][d], min(tri1[1][d], tri1[2][d])) - min_distance;
+        box_max[d] = max(tri1[0][d], max(tri1[1][d], tri1[2][d])) + min_distance;
+        box_min[d] = max(min(box_min[d], c1[d] - min_radius), c1[d] - max_radius);
+        box_max[d] = min(max(box_max[d], c1[d] + min_radius), c1[d] + max_radius);
       }
+      _Hierarchy->FindCellsInBox(box_min, box_max, cellIds);
 
       // Check for collisions between this triangle and the found nearby triangles
-      for (vtkIdType i = 0; i < cellIds->GetNumberOfIds(); ++i) {
-        cellId2 = cellIds->GetId(i);
+      for (size_t i = 0; i < cellIds.size(); ++i) {
+        cellId2 = cellIds[i];
+        if (cellId2 == cellId1) continue;
 
         // Get vertex positions of nearby candidate triangle
         surface->GetCellPoints(cellId2, npts, pts2);
@@ -364,21 +357,16 @@ public:
   }
 
   /// Find collision and self-intersections
-  static void Run(SurfaceCollisions  *filter,
-                  IntersectionsArray *intersections,
-                  CollisionsArray    *collisions)
+  static void Run(SurfaceCollisions             *filter,
+                  const BoundingVolumeHierarchy *hierarchy,
+                  IntersectionsArray            *intersections,
+                  CollisionsArray               *collisions)
   {
-    vtkDataArray *radius = filter->GetRadiusArray();
-    vtkSmartPointer<vtkAbstractPointLocator> locator;
-    locator = vtkSmartPointer<vtkOctreePointLocator>::New();
-    locator->SetDataSet(filter->Output());
-    locator->BuildLocator();
     FindCollisions body;
     body._Filter               = filter;
-    body._Locator              = locator;
+    body._Hierarchy            = hierarchy;
     body._Intersections        = intersections;
     body._Collisions           = collisions;
-    body._MaxRadius            = radius->GetRange(0)[1];
     body._MinAngleCos          = cos(filter->MaxAngle() * rad_per_deg);
     body._MinFrontfaceDistance = filter->MinFrontfaceDistance();
     body._MinBackfaceDistance  = filter->MinBackfaceDistance();
@@ -537,6 +525,9 @@ void SurfaceCollisions::Initialize()
   if (_StoreCollisionDetails && (_FrontfaceCollisionTest || _BackfaceCollisionTest)) {
     _Collisions.resize(_Output->GetNumberOfCells());
   }
+
+  // Refit bounding volume hierarchy of previous run when only points moved
+  _Hierarchy.Update(_Output);
 }
 
 // -----------------------------------------------------------------------------
@@ -549,8 +540,9 @@ void SurfaceCollisions::Run()
   }
   if (_Output->GetNumberOfCells() > 0) {
     MIRTK_START_TIMING();
-    FindCollisions::Run(this, _StoreIntersectionDetails ? &_Intersections : NULL,
-                              _StoreCollisionDetails    ? &_Collisions    : NULL);
+    FindCollisions::Run(this, &_Hierarchy,
+                        _StoreIntersectionDetails ? &_Intersections : NULL,
+                        _StoreCollisionDetails    ? &_Collisions    : NULL);
     MIRTK_DEBUG_TIMING(5, "finding collisions");
   }
 }
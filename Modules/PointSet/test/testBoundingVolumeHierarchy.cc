@@ -0,0 +1,223 @@
+/*
+ * Medical Image Registration ToolKit (MIRTK)
+ *
+ * Copyright 2026 Imperial College London
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mirtk/BoundingVolumeHierarchy.h"
+
+#include "mirtk/Math.h"
+#include "mirtk/Array.h"
+#include "mirtk/Random.h"
+
+#include "vtkSmartPointer.h"
+#include "vtkPoints.h"
+#include "vtkCellArray.h"
+#include "vtkPolyData.h"
+#include "vtkGenericCell.h"
+#include "vtkCellLocator.h"
+
+#include "gtest/gtest.h"
+
+#include <random>
+
+using namespace mirtk;
+
+
+// =============================================================================
+// Auxiliaries
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+vtkSmartPointer<vtkPolyData> RandomTriangles(mt19937 &rng, int npoints, int ncells, bool distinct = false)
+{
+  std::uniform_real_distribution<double> coord(.0, 10.0);
+  std::uniform_int_distribution<int>     ptId(0, npoints - 1);
+  vtkSmartPointer<vtkPoints>    points = vtkSmartPointer<vtkPoints>::New();
+  vtkSmartPointer<vtkCellArray> polys  = vtkSmartPointer<vtkCellArray>::New();
+  points->SetNumberOfPoints(npoints);
+  for (int i = 0; i < npoints; ++i) {
+    points->SetPoint(i, coord(rng), coord(rng), coord(rng));
+  }
+  vtkIdType pts[3];
+  for (int i = 0; i < ncells; ++i) {
+    do {
+      pts[0] = ptId(rng), pts[1] = ptId(rng), pts[2] = ptId(rng);
+    } while (distinct && (pts[0] == pts[1] || pts[1] == pts[2] || pts[2] == pts[0]));
+    polys->InsertNextCell(3, pts);
+  }
+  vtkSmartPointer<vtkPolyData> surface = vtkSmartPointer<vtkPolyData>::New();
+  surface->SetPoints(points);
+  surface->SetPolys(polys);
+  return surface;
+}
+
+// -----------------------------------------------------------------------------
+void BruteForceCellsInBox(vtkPolyData *surface, const double min[3], const double max[3], Array<int> &cells)
+{
+  double bounds[6];
+  cells.clear();
+  for (vtkIdType cellId = 0; cellId < surface->GetNumberOfCells(); ++cellId) {
+    surface->GetCellBounds(cellId, bounds);
+    if (bounds[0] <= max[0] && min[0] <= bounds[1] &&
+        bounds[2] <= max[1] && min[1] <= bounds[3] &&
+        bounds[4] <= max[2] && min[2] <= bounds[5]) {
+      cells.push_back(static_cast<int>(cellId));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+double BruteForceIntersectWithLine(vtkPolyData *surface, double p0[3], double p1[3], double tol, vtkIdType &cellId)
+{
+  vtkSmartPointer<vtkGenericCell> cell = vtkSmartPointer<vtkGenericCell>::New();
+  double t, tmin = numeric_limits<double>::infinity(), x[3], pcoords[3];
+  int    subId;
+  cellId = -1;
+  for (vtkIdType i = 0; i < surface->GetNumberOfCells(); ++i) {
+    surface->GetCell(i, cell);
+    if (cell->IntersectWithLine(p0, p1, tol, t, x, pcoords, subId) && t < tmin) {
+      tmin = t, cellId = i;
+    }
+  }
+  return tmin;
+}
+
+// =============================================================================
+// Tests
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+TEST(BoundingVolumeHierarchy, FindCellsInBox)
+{
+  mt19937 rng(42);
+  std::uniform_real_distribution<double> coord(.0, 10.0), width(.0, 2.0);
+  vtkSmartPointer<vtkPolyData> surface = RandomTriangles(rng, 1000, 2000);
+  BoundingVolumeHierarchy bvh;
+  bvh.Initialize(surface);
+  ASSERT_EQ(2000, bvh.NumberOfCells());
+  double min[3], max[3];
+  Array<int> cells, expected;
+  for (int i = 0; i < 100; ++i) {
+    for (int d = 0; d < 3; ++d) {
+      min[d] = coord(rng);
+      max[d] = min[d] + width(rng);
+    }
+    bvh.FindCellsInBox(min, max, cells);
+    BruteForceCellsInBox(surface, min, max, expected);
+    ASSERT_EQ(expected, cells);
+  }
+}
+
+// -----------------------------------------------------------------------------
+TEST(BoundingVolumeHierarchy, Refit)
+{
+  mt19937 rng(7);
+  std::uniform_real_distribution<double> coord(.0, 10.0), width(.0, 2.0), shift(-.5, .5);
+  vtkSmartPointer<vtkPolyData> surface = RandomTriangles(rng, 500, 1000);
+  BoundingVolumeHierarchy bvh;
+  bvh.Initialize(surface);
+  const size_t nnodes = bvh.Nodes().size();
+  vtkPoints *points = surface->GetPoints();
+  double p[3];
+  for (vtkIdType ptId = 0; ptId < points->GetNumberOfPoints(); ++ptId) {
+    points->GetPoint(ptId, p);
+    p[0] += shift(rng), p[1] += shift(rng), p[2] += shift(rng);
+    points->SetPoint(ptId, p);
+  }
+  points->Modified();
+  bvh.Update(surface);
+  ASSERT_EQ(nnodes, bvh.Nodes().size());
+  double min[3], max[3];
+  Array<int> cells, expected;
+  for (int i = 0; i < 100; ++i) {
+    for (int d = 0; d < 3; ++d) {
+      min[d] = coord(rng);
+      max[d] = min[d] + width(rng);
+    }
+    bvh.FindCellsInBox(min, max, cells);
+    BruteForceCellsInBox(surface, min, max, expected);
+    ASSERT_EQ(expected, cells);
+  }
+}
+
+// -----------------------------------------------------------------------------
+TEST(BoundingVolumeHierarchy, FindClosestPoint)
+{
+  mt19937 rng(13);
+  std::uniform_real_distribution<double> coord(-2.0, 12.0);
+  vtkSmartPointer<vtkPolyData> surface = RandomTriangles(rng, 1000, 2000, true);
+  BoundingVolumeHierarchy bvh;
+  bvh.Initialize(surface);
+  vtkSmartPointer<vtkCellLocator> locator = vtkSmartPointer<vtkCellLocator>::New();
+  locator->SetDataSet(surface);
+  locator->BuildLocator();
+  const int n = 500;
+  Array<double> x(3 * n), p(3 * n), dist2(n);
+  Array<int>    cellIds(n);
+  for (int i = 0; i < 3 * n; ++i) x[i] = coord(rng);
+  bvh.FindClosestPoints(n, x.data(), p.data(), cellIds.data(), dist2.data());
+  double q[3], d2;
+  vtkIdType cellId;
+  int       subId;
+  for (int i = 0; i < n; ++i) {
+    locator->FindClosestPoint(x.data() + 3 * i, q, cellId, subId, d2);
+    EXPECT_NEAR(d2, dist2[i], 1e-9);
+    EXPECT_NEAR(d2, pow(p[3*i] - x[3*i], 2) + pow(p[3*i+1] - x[3*i+1], 2) + pow(p[3*i+2] - x[3*i+2], 2), 1e-9);
+    ASSERT_GE(cellIds[i], 0);
+    ASSERT_LT(cellIds[i], bvh.NumberOfCells());
+  }
+}
+
+// -----------------------------------------------------------------------------
+TEST(BoundingVolumeHierarchy, IntersectWithLine)
+{
+  mt19937 rng(21);
+  std::uniform_real_distribution<double> coord(.0, 10.0), dir(-3.0, 3.0);
+  vtkSmartPointer<vtkPolyData> surface = RandomTriangles(rng, 1000, 2000, true);
+  BoundingVolumeHierarchy bvh;
+  bvh.Initialize(surface);
+  const double tol = 1e-6;
+  const int    n   = 500;
+  Array<double> p0(3 * n), p1(3 * n), t(n), x(3 * n);
+  Array<int>    cellIds(n);
+  for (int i = 0; i < 3 * n; ++i) {
+    p0[i] = coord(rng);
+    p1[i] = p0[i] + dir(rng);
+  }
+  bvh.IntersectWithLines(n, p0.data(), p1.data(), tol, t.data(), x.data(), cellIds.data());
+  vtkIdType cellId;
+  int       nhits = 0;
+  for (int i = 0; i < n; ++i) {
+    const double tmin = BruteForceIntersectWithLine(surface, p0.data() + 3 * i, p1.data() + 3 * i, tol, cellId);
+    ASSERT_EQ(static_cast<int>(cellId), cellIds[i]);
+    if (cellId != -1) {
+      EXPECT_NEAR(tmin, t[i], 1e-9);
+      ++nhits;
+    }
+  }
+  EXPECT_GT(nhits, 0);
+}
+
+// =============================================================================
+// Main
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
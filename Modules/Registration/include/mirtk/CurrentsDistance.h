@@ -22,6 +22,8 @@
 
 #include "mirtk/PointSetDistance.h"
 
+#include "mirtk/Array.h"
+
 #include "vtkSmartPointer.h"
 #include "vtkPointSet.h"
 #include "vtkPolyData.h"
@@ -43,6 +45,25 @@ class CurrentsDistance : public PointSetDistance
 {
   mirtkEnergyTermMacro(CurrentsDistance, EM_CurrentsDistance);
 
+  // ---------------------------------------------------------------------------
+  // Types
+public:
+
+  /// Uniform grid of current elements used to evaluate truncated kernel sums
+  ///
+  /// The size of the grid cells is at least the kernel cutoff radius such
+  /// that all elements within this radius of a point are in the 3x3x3 grid
+  /// cells around it. The elements are sorted by grid cell in raster order.
+  struct CellList
+  {
+    double        _Origin[3]; ///< Lower bounds of first grid cell
+    double        _CellSize;  ///< Size of grid cells
+    int           _Size[3];   ///< Number of grid cells in each dimension
+    Array<int>    _Offsets;   ///< Offset of first element of each grid cell and end offset
+    Array<int>    _Index;     ///< Index of element in current, sorted by grid cell
+    Array<double> _Data;      ///< Center and weight vector of each element, sorted by grid cell
+  };
+
   // ---------------------------------------------------------------------------
   // Attributes
 
@@ -55,12 +76,22 @@ class CurrentsDistance : public PointSetDistance
   /// Sigma value of currents kernel
   mirtkPublicAttributeMacro(double, Sigma);
 
+  /// Radius of kernel support in units of sigma beyond which kernel values
+  /// are neglected, i.e., a larger value increases accuracy and runtime
+  mirtkPublicAttributeMacro(double, KernelCutoff);
+
   /// Whether to ensure symmetry of currents dot product
   mirtkPublicAttributeMacro(bool, Symmetric);
 
   /// Sum of squared norm of fixed (i.e., untransformed) data set(s)
   mirtkAttributeMacro(double, TargetNormSquared);
 
+  /// Cell list of target current elements
+  mirtkAttributeMacro(CellList, TargetCells);
+
+  /// Cell list of source current elements
+  mirtkAttributeMacro(CellList, SourceCells);
+
   // ---------------------------------------------------------------------------
   // Currents representation
 protected:
@@ -71,6 +102,12 @@ protected:
   /// Convert surface mesh to current
   static vtkSmartPointer<vtkPolyData> SurfaceToCurrent(vtkPolyData *);
 
+  /// Sort elements of current into cell list with given minimum cell size
+  ///
+  /// The memory of the cell list is reused when only the positions of the
+  /// current elements changed since the cell list was last updated.
+  static void UpdateCellList(vtkPolyData *, double, CellList &);
+
   // ---------------------------------------------------------------------------
   // Construction/Destruction
 public:
@@ -91,7 +91,7 @@ public:
   typedef ResampledImageType::VoxelType           VoxelType;
 
   /// Type of cached displacement field
-  typedef GenericImage<double>                    DisplacementImageType;
+  typedef RegisteredImage::DisplacementImageType  DisplacementImageType;
 
   /// Structure storing information about transformation instance
   struct TransformationInfo
@@ -24,6 +24,7 @@
 
 #include "mirtk/Histogram2D.h"
 #include "mirtk/Parallel.h"
+#include "mirtk/Array.h"
 
 
 namespace mirtk {
@@ -82,6 +83,45 @@ public:
   /// Number of histogram bins for source image intensities
   mirtkPublicAttributeMacro(int, NumberOfSourceBins);
 
+  /// Whether to fill the joint histogram using pre-quantized target intensities
+  /// and a pool of block-private integer histograms which are reused across
+  /// updates and merged in a fixed tree order. When disabled, the joint histogram
+  /// is filled by a parallel_reduce which re-bins both intensities of each voxel.
+  mirtkPublicAttributeMacro(bool, QuantizedHistogramFill);
+
+protected:
+
+  /// Histogram bin indices of untransformed target image intensities
+  ///
+  /// Entries corresponding to voxels which are excluded from the similarity
+  /// evaluation independent of the current transformation are set to -1.
+  /// This array is empty when the target image is being transformed.
+  Array<int> _TargetBins;
+
+  /// Pool of block-private integer joint histograms
+  Array<int> _HistogramPool;
+
+  /// Number of voxel blocks / integer joint histograms in pool
+  int _NumberOfHistogramBlocks;
+
+  /// Number of integer histogram bins per block including padding
+  int _HistogramPoolStride;
+
+  /// Joint histogram bin indices of voxels in region passed to Exclude
+  ///
+  /// The samples of the excluded region are only removed from the joint
+  /// histogram by the subsequent Include call of the same region, which
+  /// updates only the bins of voxels whose joint bin index has changed.
+  Array<int> _ExcludedBins;
+
+  /// Image region passed to Exclude, i.e., [i1, i2) x [j1, j2) x [k1, k2)
+  int _ExcludedRegion[6];
+
+  /// Whether samples of excluded region are yet to be removed
+  bool _ExclusionPending;
+
+public:
+
   /// Copy attributes of this class from another instance
   void CopyAttributes(const HistogramImageSimilarity &);
 
@@ -124,6 +164,28 @@ public:
 
   // ---------------------------------------------------------------------------
   // Evaluation
+protected:
+
+  /// Quantize intensities of untransformed target image
+  void QuantizeTargetIntensities();
+
+  /// Fill joint histogram of raw samples using the quantized histogram fill
+  void FillQuantizedHistogram();
+
+  /// Compute joint histogram bin indices of voxels within image region
+  ///
+  /// \param[in]  region Image region.
+  /// \param[out] bins   Joint bin index of each voxel in the region, where
+  ///                    voxels excluded from the evaluation are set to -1.
+  void ComputeJointBins(const blocked_range3d<int> &region, int *bins) const;
+
+  /// Remove samples of pending excluded region from joint histogram
+  void RemoveExcludedSamples();
+
+  /// Select subset of voxels and update quantized target intensities
+  virtual void SampleVoxels();
+
+public:
 
   /// Update moving image and internal state of similarity measure
   virtual void Update(bool = true);
@@ -55,6 +55,14 @@ namespace mirtk {
  * the IsForeground member function to decide whether or not to consider
  * a given voxel of the grid on which the registered images are defined.
  *
+ * When a voxel sampling method is set, the similarity is only evaluated at
+ * a random subset of the foreground voxels and the moving image is only
+ * resampled at these voxels. A new subset is drawn each time the optimizer
+ * converged and calls Upgrade. Similarity measures which require the moving
+ * image intensities in a neighborhood of each voxel must disable sampling.
+ * Transformations which require dense displacements, such as velocity fields
+ * integrated by scaling and squaring, are still evaluated at all voxels.
+ *
  * \note The similarity measure owns the registered input images and may thus
  *       modify these to improve the runtime of each Update step.
  */
@@ -75,6 +83,15 @@ public:
   /// Type of similarity gradient components
   typedef GradientImageType::VoxelType         GradientType;
 
+  /// Enumeration of voxel sampling methods
+  enum SamplingMethod
+  {
+    NoSampling,         ///< Evaluate similarity at all foreground voxels
+    RandomSampling,     ///< Uniformly random subset of foreground voxels
+    StratifiedSampling, ///< Random subset of foreground voxels drawn separately for each cell of a regular grid
+    GradientSampling    ///< Random subset with probability proportional to image gradient magnitude
+  };
+
   // ---------------------------------------------------------------------------
   // Attributes
 
@@ -121,6 +138,29 @@ public:
   /// Scheme for Difference Measures in Deformable Registration. In ICCV 2011.
   mirtkPublicAttributeMacro(double, NodeBasedPreconditioning);
 
+  /// Method used to select the subset of voxels at which similarity is evaluated
+  ///
+  /// Dense displacements of transformations which require these, such as
+  /// velocity fields integrated by scaling and squaring, are still computed
+  /// for all voxels, i.e., sampling then only reduces the cost of resampling.
+  mirtkPublicAttributeMacro(enum SamplingMethod, SamplingMethod);
+
+  /// Expected fraction of foreground voxels at which similarity is evaluated
+  ///
+  /// A value greater or equal to one disables the voxel sampling.
+  mirtkPublicAttributeMacro(double, SamplingFraction);
+
+  /// Seed of pseudo-random number generator used for voxel sampling
+  ///
+  /// When negative, the generator is seeded by a random device.
+  mirtkPublicAttributeMacro(int, SamplingSeed);
+
+  /// Mask of currently sampled voxels or nullptr if all voxels are used
+  mirtkReadOnlyComponentMacro(BinaryImage, SampleMask);
+
+  /// Number of times that voxels were sampled since initialization
+  mirtkAttributeMacro(int, NumberOfSamplings);
+
   /// Skip initialization of target image
   mirtkPublicAttributeMacro(bool, SkipTargetInitialization);
 
@@ -169,6 +209,9 @@ public:
   /// Initialize similarity measure once input and parameters have been set
   virtual void Initialize();
 
+  /// Whether similarity is evaluated at a random subset of voxels only
+  bool IsSampling() const;
+
   /// Release input target image
   void ReleaseTarget();
 
@@ -196,6 +239,14 @@ public:
   /// Update moving input image(s) and internal state of similarity measure
   virtual void Update(bool = true);
 
+  /// Draw new voxel samples after the optimization has converged
+  ///
+  /// \returns Whether a new subset of voxels was selected.
+  virtual bool Upgrade();
+
+  /// Get registered images which are modified upon update or evaluation
+  virtual bool Dependencies(Array<const void *> &) const;
+
   /// Whether to evaluate similarity at specified voxel
   bool IsForeground(int) const;
 
@@ -232,6 +283,19 @@ public:
 
 protected:
 
+  /// Voxel sampling weights computed from the image gradient magnitude
+  Array<double> _SampleWeight;
+
+  /// Whether voxel can be sampled, irrespective of the moving image intensity
+  bool IsSampleCandidate(int) const;
+
+  /// Select subset of foreground voxels at which similarity is evaluated
+  ///
+  /// The registered images must have been updated at all voxels before
+  /// the first call. The moving images are only updated at the sampled
+  /// voxels afterwards.
+  virtual void SampleVoxels();
+
   /// Multiply voxel-wise similarity gradient by transformed image gradient
   ///
   /// This function is intended for use by subclass implementations to compute
@@ -415,11 +479,19 @@ public:
 // Inline definitions
 ////////////////////////////////////////////////////////////////////////////////
 
+// -----------------------------------------------------------------------------
+inline bool ImageSimilarity::IsSampling() const
+{
+  return _SamplingMethod != NoSampling && _SamplingFraction < 1.0;
+}
+
 // -----------------------------------------------------------------------------
 inline bool ImageSimilarity::IsForeground(int idx) const
 {
   // Never evaluate similarity outside explicitly specified domain
   if (_Mask && !_Mask->Get(idx)) return false;
+  // Skip voxels which are not in the current subset of samples
+  if (_SampleMask && !_SampleMask->Get(idx)) return false;
   // If both images are transformed (symmetric registration)...
   if (_Target->Transformation() && _Source->Transformation()) {
     // ... evaluate within union of foreground regions
@@ -444,6 +516,8 @@ inline bool ImageSimilarity::IsForeground(int i, int j, int k) const
 {
   // Never evaluate similarity outside explicitly specified domain
   if (_Mask && !_Mask->Get(i, j, k)) return false;
+  // Skip voxels which are not in the current subset of samples
+  if (_SampleMask && !_SampleMask->Get(i, j, k)) return false;
   // If both images are transformed (symmetric registration)...
   if (_Target->Transformation() && _Source->Transformation()) {
     // ... evaluate within union of foreground regions
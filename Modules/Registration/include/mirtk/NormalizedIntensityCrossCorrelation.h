@@ -108,7 +108,7 @@ private:
   // Construction/Destruction
 
   /// Create 1D Gaussian kernel with given standard deviation
-  static RealImage *CreateGaussianKernel(double);
+  static KernelImage *CreateGaussianKernel(double);
 
   /// Reset local window kernel
   virtual void ClearKernel();
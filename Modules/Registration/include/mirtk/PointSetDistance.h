@@ -126,6 +126,9 @@ public:
   /// Update moving input points and internal state of distance measure
   virtual void Update(bool = true);
 
+  /// Get registered point sets which are modified upon update or evaluation
+  virtual bool Dependencies(Array<const void *> &) const;
+
 protected:
 
   /// Compute non-parametric gradient w.r.t points of given data set
@@ -78,9 +78,34 @@ private:
   /// Scheme for Difference Measures in Deformable Registration. In ICCV 2011.
   mirtkPublicAttributeMacro(double, Preconditioning);
 
+  /// Whether to update and evaluate independent energy terms concurrently
+  ///
+  /// When enabled, the active energy terms are divided into groups of terms
+  /// which modify common objects upon update or evaluation, such as a shared
+  /// registered image (see EnergyTerm::Dependencies). The terms of a group are
+  /// processed one after the other, while different groups are processed in
+  /// parallel. The gradient of each term is evaluated in a separate buffer
+  /// and these are summed up in the order of the energy terms afterwards.
+  /// The result is independent of the scheduling of the groups, but it is
+  /// not bitwise identical to the serial evaluation. Terms which accumulate
+  /// their gradient contributions, e.g., of each voxel, add these to a zero
+  /// initialized buffer instead of the sum of the preceding terms, which
+  /// changes the order of the floating-point additions.
+  ///
+  /// Log messages of energy terms are only broadcast by the calling thread
+  /// after all groups were processed, in the order of the energy terms.
+  mirtkPublicAttributeMacro(bool, ConcurrentTerms);
+
   /// Forward events of energy terms to observers of the energy function
   EventDelegate _EventDelegate;
 
+  /// Log messages of each energy term received while terms are processed
+  /// concurrently, i.e., which have yet to be broadcast by the calling thread
+  Array<Array<string> > _DeferredLog;
+
+  /// Whether to defer log messages of energy terms
+  bool _DeferLog;
+
   // ---------------------------------------------------------------------------
   // Construction/Destruction
 private:
@@ -128,6 +153,27 @@ public:
   /// Get the n-th energy term
   EnergyTerm *Term(int);
 
+protected:
+
+  /// Divide active energy terms into groups which can be processed concurrently
+  ///
+  /// \param[out] groups   Indices of energy terms which must be processed
+  ///                      sequentially in the order given by each group.
+  /// \param[in]  gradient Whether to group terms for gradient evaluation.
+  ///                      Sparsity constraints are excluded in this case.
+  void GroupTerms(Array<Array<int> > &groups, bool gradient = false) const;
+
+  /// Defer log messages of energy terms until BroadcastDeferredLog is called
+  void DeferLog();
+
+  /// Broadcast deferred log messages of energy terms in the calling thread
+  void BroadcastDeferredLog();
+
+  /// Forward log messages of energy terms or defer them if requested
+  void ForwardEvent(Observable *, Event, const void *);
+
+public:
+
   // ---------------------------------------------------------------------------
   // Settings
 
@@ -33,12 +33,7 @@
 #include "vtkFloatArray.h"
 #include "vtkPolyData.h"
 #include "vtkPointData.h"
-// Due to a bug in vtkKdTreePointLocator, calling BuildLocator
-// is not sufficient to make FindClosestPoint thread-safe as it does
-// not call vtkBSPIntersections::BuildRegionsList
-// (cf. http://www.vtk.org/Bug/view.php?id=15206 ).
-// Therefore, use Octree instead of Kd-tree in the meantime.
-#include "vtkOctreePointLocator.h"
+#include "vtkIdList.h"
 
 
 namespace mirtk {
@@ -57,6 +52,7 @@ CurrentsDistance::CurrentsDistance(const char *name, double weight)
 :
   PointSetDistance(name, weight),
   _Sigma(-0.05),
+  _KernelCutoff(2.5),
   _Symmetric(true),
   _TargetNormSquared(.0)
 {
@@ -66,7 +62,12 @@ CurrentsDistance::CurrentsDistance(const char *name, double weight)
 CurrentsDistance::CurrentsDistance(const CurrentsDistance &other)
 :
   PointSetDistance(other),
-  _TargetNormSquared(other._TargetNormSquared)
+  _Sigma(other._Sigma),
+  _KernelCutoff(other._KernelCutoff),
+  _Symmetric(other._Symmetric),
+  _TargetNormSquared(other._TargetNormSquared),
+  _TargetCells(other._TargetCells),
+  _SourceCells(other._SourceCells)
 {
   if (other._TargetCurrent) {
     _TargetCurrent = vtkSmartPointer<vtkPolyData>::New();
@@ -82,7 +83,12 @@ CurrentsDistance::CurrentsDistance(const CurrentsDistance &other)
 CurrentsDistance &CurrentsDistance::operator =(const CurrentsDistance &other)
 {
   PointSetDistance::operator =(other);
+  _Sigma             = other._Sigma;
+  _KernelCutoff      = other._KernelCutoff;
+  _Symmetric         = other._Symmetric;
   _TargetNormSquared = other._TargetNormSquared;
+  _TargetCells       = other._TargetCells;
+  _SourceCells       = other._SourceCells;
   if (other._TargetCurrent) {
     _TargetCurrent = vtkSmartPointer<vtkPolyData>::New();
     _TargetCurrent->DeepCopy(other._TargetCurrent);
@@ -165,67 +171,158 @@ vtkSmartPointer<vtkPolyData> CurrentsDistance::ToCurrent(vtkPointSet *data)
   return SurfaceToCurrent(surface);
 }
 
+// -----------------------------------------------------------------------------
+/// Squared Euclidean distance between two points
+static inline double Distance2(const double a[3], const double b[3])
+{
+  const double dx = a[0] - b[0];
+  const double dy = a[1] - b[1];
+  const double dz = a[2] - b[2];
+  return dx * dx + dy * dy + dz * dz;
+}
+
+// -----------------------------------------------------------------------------
+/// Get index of grid cell containing the given point
+static inline int CellIndex(const CurrentsDistance::CellList &grid, const double p[3])
+{
+  int i[3];
+  for (int d = 0; d < 3; ++d) {
+    i[d] = static_cast<int>((p[d] - grid._Origin[d]) / grid._CellSize);
+    if      (i[d] < 0)              i[d] = 0;
+    else if (i[d] >= grid._Size[d]) i[d] = grid._Size[d] - 1;
+  }
+  return (i[2] * grid._Size[1] + i[1]) * grid._Size[0] + i[0];
+}
+
+// -----------------------------------------------------------------------------
+/// Get ranges of cell list elements in the 3x3x3 grid cells around a point
+///
+/// Because the elements are sorted in raster order of the grid cells, the
+/// elements of adjacent grid cells along the first dimension are contiguous.
+///
+/// \returns Number of non-empty element index ranges.
+static inline int NeighborRanges(const CurrentsDistance::CellList &grid,
+                                 const double p[3], int begin[9], int end[9])
+{
+  int    lo[3], hi[3], cell, n = 0;
+  double t;
+  for (int d = 0; d < 3; ++d) {
+    t = floor((p[d] - grid._Origin[d]) / grid._CellSize);
+    if (t < -1.0 || t > grid._Size[d]) return 0;
+    lo[d] = max(0, static_cast<int>(t) - 1);
+    hi[d] = min(grid._Size[d] - 1, static_cast<int>(t) + 1);
+  }
+  for (int k = lo[2]; k <= hi[2]; ++k)
+  for (int j = lo[1]; j <= hi[1]; ++j) {
+    cell     = (k * grid._Size[1] + j) * grid._Size[0];
+    begin[n] = grid._Offsets[cell + lo[0]];
+    end  [n] = grid._Offsets[cell + hi[0] + 1];
+    if (begin[n] < end[n]) ++n;
+  }
+  return n;
+}
+
+// -----------------------------------------------------------------------------
+void CurrentsDistance::UpdateCellList(vtkPolyData *current, double radius, CellList &grid)
+{
+  MIRTK_START_TIMING();
+
+  vtkPoints    *centers = current->GetPoints();
+  vtkDataArray *weights = current->GetPointData()->GetArray("normals");
+  if (!weights) weights = current->GetPointData()->GetArray("segments");
+  if (!weights) weights = current->GetPointData()->GetArray("weights");
+  const int n = static_cast<int>(centers->GetNumberOfPoints());
+
+  // Choose size of grid cells such that the number of cells is in the order
+  // of the number of elements even when the kernel radius is very small
+  double bounds[6] = {.0, .0, .0, .0, .0, .0};
+  if (n > 0) centers->GetBounds(bounds);
+  const double max_cells = 8.0 * n + 1.0;
+  double ncells;
+  grid._CellSize = radius;
+  while (true) {
+    ncells = 1.0;
+    for (int d = 0; d < 3; ++d) {
+      ncells *= floor((bounds[2*d+1] - bounds[2*d]) / grid._CellSize) + 1.0;
+    }
+    if (ncells <= max_cells) break;
+    grid._CellSize *= 1.01 * pow(ncells / max_cells, 1.0 / 3.0);
+  }
+  for (int d = 0; d < 3; ++d) {
+    grid._Origin[d] = bounds[2*d];
+    grid._Size  [d] = static_cast<int>(floor((bounds[2*d+1] - bounds[2*d]) / grid._CellSize)) + 1;
+  }
+
+  // Sort elements by grid cell using counting sort
+  Array<int> &offsets = grid._Offsets;
+  offsets.assign(static_cast<int>(ncells) + 1, 0);
+  double c[3], w[3];
+  int    cell;
+  for (int i = 0; i < n; ++i) {
+    centers->GetPoint(i, c);
+    cell = CellIndex(grid, c);
+    ++offsets[cell + 1];
+  }
+  for (size_t i = 1; i < offsets.size(); ++i) {
+    offsets[i] += offsets[i - 1];
+  }
+  grid._Index.resize(n);
+  grid._Data .resize(6 * n);
+  for (int i = 0; i < n; ++i) {
+    // In case of point clouds, the weights array contains scalar tuples only,
+    // i.e., GetTuple does not change the second and third component of w.
+    // The dot product of two weight vectors is thus equal to the scalar
+    // product of the point weights.
+    w[0] = 1.0, w[1] = w[2] = .0;
+    centers->GetPoint(i, c);
+    if (weights) weights->GetTuple(i, w);
+    cell = CellIndex(grid, c);
+    const int j = offsets[cell]++;
+    double *data = grid._Data.data() + 6 * j;
+    data[0] = c[0], data[1] = c[1], data[2] = c[2];
+    data[3] = w[0], data[4] = w[1], data[5] = w[2];
+    grid._Index[j] = i;
+  }
+  for (size_t i = offsets.size() - 1; i > 0; --i) {
+    offsets[i] = offsets[i - 1];
+  }
+  offsets[0] = 0;
+
+  MIRTK_DEBUG_TIMING(3, "update of currents cell list");
+}
+
 // -----------------------------------------------------------------------------
 class CurrentsDistanceDotProduct
 {
 private:
 
-  vtkPoints               *_CentersA;
-  vtkFloatArray           *_WeightsA;
-  vtkPoints               *_CentersB;
-  vtkFloatArray           *_WeightsB;
-  vtkAbstractPointLocator *_LocatorB;
-  double                   _Variance;
-  double                   _Radius;
-  vtkDataArray            *_Value;
-  double                   _Sum;
+  typedef CurrentsDistance::CellList CellList;
+
+  const CellList *_CellsA;
+  const CellList *_CellsB;
+  double          _Variance;
+  double          _Radius2;
+  vtkDataArray   *_Value;
+  double          _Sum;
 
 public:
 
-  CurrentsDistanceDotProduct(double sigma)
+  CurrentsDistanceDotProduct(double sigma, double cutoff)
   :
-    _CentersA(NULL), _WeightsA(NULL),
-    _CentersB(NULL), _WeightsB(NULL), _LocatorB(NULL),
-    _Variance(sigma * sigma), _Radius(2.5 * sigma),
+    _CellsA(NULL), _CellsB(NULL),
+    _Variance(sigma * sigma), _Radius2(pow(cutoff * sigma, 2)),
     _Value(NULL), _Sum(.0)
   {}
 
-  inline double Evaluate(vtkPolyData *a, vtkPolyData *b, vtkDataArray *value = NULL)
+  inline double Evaluate(const CellList &a, const CellList &b, vtkDataArray *value = NULL)
   {
     MIRTK_START_TIMING();
-    // Get centers of n-currents
-    _CentersA = a->GetPoints();
-    _CentersB = b->GetPoints();
-    // Get normals of 2-currents (i.e., surfaces)
-    _WeightsA = vtkFloatArray::SafeDownCast(a->GetPointData()->GetArray("normals"));
-    _WeightsB = vtkFloatArray::SafeDownCast(b->GetPointData()->GetArray("normals"));
-    // Get segments of 1-currents (i.e., curves)
-    if (!_WeightsA && !_WeightsB) {
-      _WeightsA = vtkFloatArray::SafeDownCast(a->GetPointData()->GetArray("segments"));
-      _WeightsB = vtkFloatArray::SafeDownCast(b->GetPointData()->GetArray("segments"));
-    } else if ((_WeightsA && !_WeightsB) || (!_WeightsA && _WeightsB)) {
-      cerr << "Cannot compute inner product between different types of currents" << endl;
-      exit(1);
-    }
-    // Get weights of 0-currents (i.e., points)
-    if (!_WeightsA && !_WeightsB) {
-      _WeightsA = vtkFloatArray::SafeDownCast(a->GetPointData()->GetArray("weights"));
-      _WeightsB = vtkFloatArray::SafeDownCast(b->GetPointData()->GetArray("weights"));
-    } else if ((_WeightsA && !_WeightsB) || (!_WeightsA && _WeightsB)) {
-      cerr << "Cannot compute inner product between different types of currents" << endl;
-      exit(1);
-    }
-    // Initialize point locator
-    _LocatorB = vtkOctreePointLocator::New();
-    _LocatorB->SetDataSet(b);
-    _LocatorB->BuildLocator();
-    // Evaluate inner product
-    _Value = value;
-    _Sum   = .0;
-    blocked_range<vtkIdType> cellsA(0, _CentersA->GetNumberOfPoints());
-    parallel_reduce(cellsA, *this);
-    // Free point locator
-    _LocatorB->Delete(), _LocatorB = NULL;
+    _CellsA = &a;
+    _CellsB = &b;
+    _Value  = value;
+    _Sum    = .0;
+    blocked_range<int> elemsA(0, static_cast<int>(a._Index.size()));
+    parallel_reduce(elemsA, *this);
     MIRTK_DEBUG_TIMING(3, "evaluation of dot product of currents");
     return _Sum;
   }
@@ -234,13 +331,10 @@ public:
 
   CurrentsDistanceDotProduct(CurrentsDistanceDotProduct &other, split)
   :
-    _CentersA(other._CentersA),
-    _WeightsA(other._WeightsA),
-    _CentersB(other._CentersB),
-    _WeightsB(other._WeightsB),
-    _LocatorB(other._LocatorB),
+    _CellsA  (other._CellsA),
+    _CellsB  (other._CellsB),
     _Variance(other._Variance),
-    _Radius  (other._Radius),
+    _Radius2 (other._Radius2),
     _Value   (other._Value),
     _Sum     (.0)
   {}
@@ -250,31 +344,27 @@ public:
     _Sum += other._Sum;
   }
 
-  inline double EvaluateKernel(double ca[3], double cb[3])
+  void operator ()(const blocked_range<int> &re)
   {
-    return exp(- vtkMath::Distance2BetweenPoints(ca, cb) / _Variance);
-  }
-
-  void operator ()(const blocked_range<vtkIdType> &re)
-  {
-    vtkSmartPointer<vtkIdList> ids = vtkSmartPointer<vtkIdList>::New();
-    // In case of point clouds, the _Weights(A|B) arrays contain
-    // scalar tuples only, i.e., GetTuple does not change the second
-    // and third component of da and db, respectively. The dot product
-    // <da, db> is thus equal to the scalar product of the point weights.
-    double ca[3], cb[3], da[3] = {1.0, .0, .0}, db[3] = {1.0, .0, .0};
-    for (vtkIdType i = re.begin(); i != re.end(); ++i) {
-      _CentersA->GetPoint(i, ca);
-      _WeightsA->GetTuple(i, da);
-      _LocatorB->FindPointsWithinRadius(_Radius, ca, ids);
-      double value = .0;
-      for (vtkIdType k = 0; k < ids->GetNumberOfIds(); ++k) {
-        vtkIdType j = ids->GetId(k);
-        _CentersB->GetPoint(j, cb);
-        _WeightsB->GetTuple(j, db);
-        value += EvaluateKernel(ca, cb) * vtkMath::Dot(da, db);
+    int           begin[9], end[9], nranges;
+    double        d2, value;
+    const double *a = _CellsA->_Data.data() + 6 * re.begin(), *b;
+    for (int i = re.begin(); i != re.end(); ++i, a += 6) {
+      value   = .0;
+      nranges = NeighborRanges(*_CellsB, a, begin, end);
+      for (int r = 0; r < nranges; ++r) {
+        b = _CellsB->_Data.data() + 6 * begin[r];
+        for (int j = begin[r]; j != end[r]; ++j, b += 6) {
+          d2 = Distance2(a, b);
+          if (d2 <= _Radius2) {
+            value += exp(- d2 / _Variance) * (a[3] * b[3] + a[4] * b[4] + a[5] * b[5]);
+          }
+        }
+      }
+      if (_Value) {
+        const vtkIdType k = _CellsA->_Index[i];
+        _Value->SetTuple1(k, _Value->GetTuple1(k) + value);
       }
-      if (_Value) _Value->SetTuple1(i, _Value->GetTuple1(i) + value);
       _Sum += value;
     }
   }
@@ -285,73 +375,38 @@ class CurrentsDistanceGradient
 {
 private:
 
-  vtkPointSet             *_SurfaceA;
-  vtkPoints               *_CentersA;
-  vtkFloatArray           *_WeightsA;
-  vtkAbstractPointLocator *_LocatorA;
-  vtkPointSet             *_SurfaceB;
-  vtkPoints               *_CentersB;
-  vtkFloatArray           *_WeightsB;
-  vtkAbstractPointLocator *_LocatorB;
-  double                   _Variance;
-  double                   _Radius;
-  Vector3D<double>        *_Gradient;
+  typedef CurrentsDistance::CellList CellList;
+
+  vtkPointSet      *_SurfaceA;
+  const CellList   *_CellsA;
+  const CellList   *_CellsB;
+  double            _Variance;
+  double            _Radius2;
+  Vector3D<double> *_Gradient;
 
 public:
 
-  CurrentsDistanceGradient(double sigma)
+  CurrentsDistanceGradient(double sigma, double cutoff)
   :
-    _SurfaceA(NULL), _CentersA(NULL), _WeightsA(NULL), _LocatorA(NULL),
-    _SurfaceB(NULL), _CentersB(NULL), _WeightsB(NULL), _LocatorB(NULL),
-    _Variance(sigma * sigma), _Radius(2.5 * sigma), _Gradient(NULL)
+    _SurfaceA(NULL), _CellsA(NULL), _CellsB(NULL),
+    _Variance(sigma * sigma), _Radius2(pow(cutoff * sigma, 2)),
+    _Gradient(NULL)
   {}
 
-  inline void EvaluateGradient(vtkPointSet *sa, vtkPolyData *ca,
-                               vtkPointSet *sb, vtkPolyData *cb,
+  inline void EvaluateGradient(vtkPointSet *sa, const CellList &ca, const CellList &cb,
                                Vector3D<double> *g)
   {
     MIRTK_START_TIMING();
     _SurfaceA = sa;
-    _SurfaceB = sb;
-    // Get centers of n-currents
-    _CentersA = ca->GetPoints();
-    _CentersB = cb->GetPoints();
-    // Get normals of 2-currents (i.e., surfaces)
-    _WeightsA = vtkFloatArray::SafeDownCast(ca->GetPointData()->GetArray("normals"));
-    _WeightsB = vtkFloatArray::SafeDownCast(cb->GetPointData()->GetArray("normals"));
-    // Get segments of 1-currents (i.e., curves)
-    if (!_WeightsA && !_WeightsB) {
-      _WeightsA = vtkFloatArray::SafeDownCast(ca->GetPointData()->GetArray("segments"));
-      _WeightsB = vtkFloatArray::SafeDownCast(cb->GetPointData()->GetArray("segments"));
-    } else if ((_WeightsA && !_WeightsB) || (!_WeightsA && _WeightsB)) {
-      cerr << "Cannot compute inner product between different types of currents" << endl;
-      exit(1);
-    }
-    // Get weights of 0-currents (i.e., points)
-    if (!_WeightsA && !_WeightsB) {
-      _WeightsA = vtkFloatArray::SafeDownCast(ca->GetPointData()->GetArray("weights"));
-      _WeightsB = vtkFloatArray::SafeDownCast(cb->GetPointData()->GetArray("weights"));
-    } else if ((_WeightsA && !_WeightsB) || (!_WeightsA && _WeightsB)) {
-      cerr << "Cannot compute inner product between different types of currents" << endl;
-      exit(1);
-    }
-    // Initialize point locators
-    _LocatorA = vtkOctreePointLocator::New();
-    _LocatorA->SetDataSet(ca);
-    _LocatorA->BuildLocator();
-    _LocatorB = vtkOctreePointLocator::New();
-    _LocatorB->SetDataSet(cb);
-    _LocatorB->BuildLocator();
+    _CellsA   = &ca;
+    _CellsB   = &cb;
     // Evaluate gradient of currents distance measure
     _Gradient = g;
     for (int i = 0; i < _SurfaceA->GetNumberOfPoints(); ++i) {
       _Gradient[i]._x = _Gradient[i]._y = _Gradient[i]._z = .0;
     }
-    blocked_range<vtkIdType> cellsA(0, _SurfaceA->GetNumberOfCells());
-    parallel_reduce(cellsA, *this);
-    // Free point locators
-    _LocatorA->Delete(), _LocatorA = NULL;
-    _LocatorB->Delete(), _LocatorB = NULL;
+    blocked_range<int> elemsA(0, static_cast<int>(ca._Index.size()));
+    parallel_reduce(elemsA, *this);
     MIRTK_DEBUG_TIMING(3, "evaluation of gradient of currents distance");
   }
 
@@ -360,30 +415,20 @@ public:
   CurrentsDistanceGradient(CurrentsDistanceGradient &other)
   :
     _SurfaceA(other._SurfaceA),
-    _CentersA(other._CentersA),
-    _WeightsA(other._WeightsA),
-    _LocatorA(other._LocatorA),
-    _SurfaceB(other._SurfaceB),
-    _CentersB(other._CentersB),
-    _WeightsB(other._WeightsB),
-    _LocatorB(other._LocatorB),
+    _CellsA  (other._CellsA),
+    _CellsB  (other._CellsB),
     _Variance(other._Variance),
-    _Radius  (other._Radius),
+    _Radius2 (other._Radius2),
     _Gradient(other._Gradient)
   {}
 
   CurrentsDistanceGradient(CurrentsDistanceGradient &lhs, split)
   :
     _SurfaceA(lhs._SurfaceA),
-    _CentersA(lhs._CentersA),
-    _WeightsA(lhs._WeightsA),
-    _LocatorA(lhs._LocatorA),
-    _SurfaceB(lhs._SurfaceB),
-    _CentersB(lhs._CentersB),
-    _WeightsB(lhs._WeightsB),
-    _LocatorB(lhs._LocatorB),
+    _CellsA  (lhs._CellsA),
+    _CellsB  (lhs._CellsB),
     _Variance(lhs._Variance),
-    _Radius  (lhs._Radius)
+    _Radius2 (lhs._Radius2)
   {
     CAllocate(_Gradient, _SurfaceA->GetNumberOfPoints());
   }
@@ -396,17 +441,35 @@ public:
     Deallocate(rhs._Gradient);
   }
 
-  inline double EvaluateKernel(double ca[3], double cb[3])
+  /// Sum kernel weighted normals and kernel gradients of elements within cutoff radius
+  inline void EvaluateKernelSum(const CellList &grid, const double c1[3],
+                                double kw[3], double dk[3][3]) const
   {
-    return exp(- vtkMath::Distance2BetweenPoints(ca, cb) / _Variance);
-  }
-
-  inline void EvaluateKernelGradient(double g[3], double ca[3], double cb[3])
-  {
-    const double w = -2.0 * EvaluateKernel(ca, cb) / _Variance;
-    g[0] = w * (ca[0] - cb[0]);
-    g[1] = w * (ca[1] - cb[1]);
-    g[2] = w * (ca[2] - cb[2]);
+    int           begin[9], end[9], nranges;
+    double        d2, w, g[3];
+    const double *c2;
+    memset(kw, 0, 3 * sizeof(double));
+    memset(dk, 0, 9 * sizeof(double));
+    nranges = NeighborRanges(grid, c1, begin, end);
+    for (int r = 0; r < nranges; ++r) {
+      c2 = grid._Data.data() + 6 * begin[r];
+      for (int j = begin[r]; j != end[r]; ++j, c2 += 6) {
+        d2 = Distance2(c1, c2);
+        if (d2 <= _Radius2) {
+          const double *n2 = c2 + 3;
+          w    = exp(- d2 / _Variance);
+          g[0] = -2.0 * w / _Variance * (c1[0] - c2[0]);
+          g[1] = -2.0 * w / _Variance * (c1[1] - c2[1]);
+          g[2] = -2.0 * w / _Variance * (c1[2] - c2[2]);
+          for (int d = 0; d < 3; ++d) {
+            kw   [d] += w    * n2[d];
+            dk[0][d] += g[0] * n2[d];
+            dk[1][d] += g[1] * n2[d];
+            dk[2][d] += g[2] * n2[d];
+          }
+        }
+      }
+    }
   }
 
   inline void Add(Vector3D<double> &v, double g[3])
@@ -414,23 +477,23 @@ public:
     v._x += g[0], v._y += g[1], v._z += g[2];
   }
 
-  void operator ()(const blocked_range<vtkIdType> &re)
+  void operator ()(const blocked_range<int> &re)
   {
-    vtkIdType j, i1, i2, i3;       // vertex indices
+    vtkIdType i, i1, i2, i3;       // cell and vertex indices
     double    v1[3], v2[3], v3[3]; // vertex coordinates
     double    e1[3], e2[3], e3[3]; // edge vectors
-    double    c1[3], c2[3];        // center coordinates
-    double    n1[3], n2[3];        // surface normals
-    double    kws[3], dks[3][3], kwt[3], dkt[3][3], kw[3];
-    double    w, g[3];
+    double    kws[3], dks[3][3], kwt[3], dkt[3][3], kw[3], g[3];
 
     const double _2over3 = 2.0 / 3.0;
 
     vtkSmartPointer<vtkIdList> ids = vtkSmartPointer<vtkIdList>::New();
 
-    // Loop over transformed triangles
-    for (vtkIdType i = re.begin(); i != re.end(); ++i) {
+    // Loop over transformed triangles in order of cell list
+    const double *c1 = _CellsA->_Data.data() + 6 * re.begin();
+    for (int k = re.begin(); k != re.end(); ++k, c1 += 6) {
+      const double *n1 = c1 + 3;
       // Get vertex indices
+      i = _CellsA->_Index[k];
       _SurfaceA->GetCellPoints(i, ids);
       i1 = ids->GetId(0);
       i2 = ids->GetId(1);
@@ -442,45 +505,12 @@ public:
       _SurfaceA->GetPoint(i1, v1);
       _SurfaceA->GetPoint(i2, v2);
       _SurfaceA->GetPoint(i3, v3);
-      // Get center and normal
-      _CentersA->GetPoint(i, c1);
-      _WeightsA->GetTuple(i, n1);
       // Compute kds = KtauS and dks = gradKtauS.transpose()
       // (cf. Deformetrica 2.0 OrientedSurfaceMesh::ComputeMatchGradient)
-      _LocatorA->FindPointsWithinRadius(_Radius, c1, ids);
-      memset(kws, 0, 3 * sizeof(double));
-      memset(dks, 0, 9 * sizeof(double));
-      for (vtkIdType k = 0; k < ids->GetNumberOfIds(); ++k) {
-        j = ids->GetId(k);
-        _CentersA->GetPoint(j, c2);
-        _WeightsA->GetTuple(j, n2);
-        w = EvaluateKernel(c1, c2);
-        EvaluateKernelGradient(g, c1, c2);
-        for (int d = 0; d < 3; ++d) {
-          kws   [d] += w    * n2[d];
-          dks[0][d] += g[0] * n2[d];
-          dks[1][d] += g[1] * n2[d];
-          dks[2][d] += g[2] * n2[d];
-        }
-      }
+      EvaluateKernelSum(*_CellsA, c1, kws, dks);
       // Compute kwt = KtauT and dkt = gradKtauT.transpose()
       // (cf. Deformetrica 2.0 OrientedSurfaceMesh::ComputeMatchGradient)
-      _LocatorB->FindPointsWithinRadius(_Radius, c1, ids);
-      memset(kwt, 0, 3 * sizeof(double));
-      memset(dkt, 0, 9 * sizeof(double));
-      for (vtkIdType k = 0; k < ids->GetNumberOfIds(); ++k) {
-        j = ids->GetId(k);
-        _CentersB->GetPoint(j, c2);
-        _WeightsB->GetTuple(j, n2);
-        w = EvaluateKernel(c1, c2);
-        EvaluateKernelGradient(g, c1, c2);
-        for (int d = 0; d < 3; ++d) {
-          kwt   [d] += w    * n2[d];
-          dkt[0][d] += g[0] * n2[d];
-          dkt[1][d] += g[1] * n2[d];
-          dkt[2][d] += g[2] * n2[d];
-        }
-      }
+      EvaluateKernelSum(*_CellsB, c1, kwt, dkt);
       // Add gradient
       for (int d = 0; d < 3; ++d) {
         e1[d] =  v3[d] -  v2[d];
@@ -521,19 +551,25 @@ void CurrentsDistance::Init()
     double rb = pow(vb * 3.0 / 4.0 / pi, (1.0/3.0));
     _Sigma = 0.5 * (ra + rb) * abs(_Sigma);
   }
+  if (_KernelCutoff <= .0) {
+    cerr << "CurrentsDistance::Initialize: Kernel cutoff must be positive!" << endl;
+    exit(1);
+  }
 
   // Get currents representation of input data sets
   _TargetCurrent = ToCurrent(_Target->InputPointSet());
   _SourceCurrent = ToCurrent(_Source->InputPointSet());
+  UpdateCellList(_TargetCurrent, _KernelCutoff * _Sigma, _TargetCells);
+  UpdateCellList(_SourceCurrent, _KernelCutoff * _Sigma, _SourceCells);
 
   // Compute squared norm of fixed current(s)
   _TargetNormSquared = .0;
-  CurrentsDistanceDotProduct dot_product(_Sigma);
+  CurrentsDistanceDotProduct dot_product(_Sigma, _KernelCutoff);
   if (!_Target->Transformation()) {
-    _TargetNormSquared += dot_product.Evaluate(_TargetCurrent, _TargetCurrent);
+    _TargetNormSquared += dot_product.Evaluate(_TargetCells, _TargetCells);
   }
   if (!_Source->Transformation()) {
-    _TargetNormSquared += dot_product.Evaluate(_SourceCurrent, _SourceCurrent);
+    _TargetNormSquared += dot_product.Evaluate(_SourceCells, _SourceCells);
   }
 }
 
@@ -565,6 +601,9 @@ bool CurrentsDistance::SetWithPrefix(const char *param, const char *value)
   if (strcmp(param, "Currents kernel width") == 0) {
     return FromString(value, _Sigma) && _Sigma != .0;
   }
+  if (strcmp(param, "Currents kernel cutoff") == 0) {
+    return FromString(value, _KernelCutoff) && _KernelCutoff > .0;
+  }
   if (strcmp(param, "Symmetric currents distance") == 0) {
     return FromString(value, _Symmetric);
   }
@@ -577,6 +616,9 @@ bool CurrentsDistance::SetWithoutPrefix(const char *param, const char *value)
   if (strcmp(param, "Kernel width") == 0) {
     return FromString(value, _Sigma) && _Sigma != .0;
   }
+  if (strcmp(param, "Kernel cutoff") == 0) {
+    return FromString(value, _KernelCutoff) && _KernelCutoff > .0;
+  }
   if (strcmp(param, "Symmetric") == 0) {
     return FromString(value, _Symmetric);
   }
@@ -587,8 +629,9 @@ bool CurrentsDistance::SetWithoutPrefix(const char *param, const char *value)
 ParameterList CurrentsDistance::Parameter() const
 {
   ParameterList params = PointSetDistance::Parameter();
-  InsertWithPrefix(params, "Kernel width", _Sigma);
-  InsertWithPrefix(params, "Symmetric",    _Symmetric);
+  InsertWithPrefix(params, "Kernel width",  _Sigma);
+  InsertWithPrefix(params, "Kernel cutoff", _KernelCutoff);
+  InsertWithPrefix(params, "Symmetric",     _Symmetric);
   return params;
 }
 
@@ -602,10 +645,12 @@ void CurrentsDistance::Update(bool)
   if (_Target->Transformation()) {
     _Target->Update();
     _TargetCurrent = ToCurrent(_Target->PointSet());
+    UpdateCellList(_TargetCurrent, _KernelCutoff * _Sigma, _TargetCells);
   }
   if (_Source->Transformation()) {
     _Source->Update();
     _SourceCurrent = ToCurrent(_Source->PointSet());
+    UpdateCellList(_SourceCurrent, _KernelCutoff * _Sigma, _SourceCells);
   }
 }
 
@@ -614,18 +659,18 @@ double CurrentsDistance::Evaluate()
 {
   MIRTK_START_TIMING();
   double d = _TargetNormSquared;
-  CurrentsDistanceDotProduct dot_product(_Sigma);
+  CurrentsDistanceDotProduct dot_product(_Sigma, _KernelCutoff);
   if (_Target->Transformation()) {
-    d += dot_product.Evaluate(_TargetCurrent, _TargetCurrent);
+    d += dot_product.Evaluate(_TargetCells, _TargetCells);
   }
   if (_Source->Transformation()) {
-    d += dot_product.Evaluate(_SourceCurrent, _SourceCurrent);
+    d += dot_product.Evaluate(_SourceCells, _SourceCells);
   }
   if (_Symmetric) {
-    d -= dot_product.Evaluate(_TargetCurrent, _SourceCurrent);
-    d -= dot_product.Evaluate(_SourceCurrent, _TargetCurrent);
+    d -= dot_product.Evaluate(_TargetCells, _SourceCells);
+    d -= dot_product.Evaluate(_SourceCells, _TargetCells);
   } else {
-    d -= 2.0 * dot_product.Evaluate(_TargetCurrent, _SourceCurrent);
+    d -= 2.0 * dot_product.Evaluate(_TargetCells, _SourceCells);
   }
   MIRTK_DEBUG_TIMING(2, "evaluation of currents distance");
   return d / ((_TargetCurrent->GetNumberOfPoints() + _SourceCurrent->GetNumberOfPoints()) / 2);
@@ -635,13 +680,12 @@ double CurrentsDistance::Evaluate()
 void CurrentsDistance::NonParametricGradient(const RegisteredPointSet *target,
                                              GradientType             *gradient)
 {
-  vtkPointSet *sa = _Target->PointSet();
-  vtkPolyData *ca = _TargetCurrent;
-  vtkPointSet *sb = _Source->PointSet();
-  vtkPolyData *cb = _SourceCurrent;
-  if (target == _Source) swap(sa, sb), swap(ca, cb);
-  CurrentsDistanceGradient d(_Sigma);
-  d.EvaluateGradient(sa, ca, sb, cb, gradient);
+  vtkPointSet    *sa = _Target->PointSet();
+  const CellList *ca = &_TargetCells;
+  const CellList *cb = &_SourceCells;
+  if (target == _Source) sa = _Source->PointSet(), swap(ca, cb);
+  CurrentsDistanceGradient d(_Sigma, _KernelCutoff);
+  d.EvaluateGradient(sa, *ca, *cb, gradient);
 }
 
 // =============================================================================
@@ -667,15 +711,15 @@ void CurrentsDistance::WriteDataSets(const char *p, const char *suffix, bool all
   if (_Target->Transformation() || all) {
     vtkSmartPointer<vtkFloatArray> dist;
     if (_Target->Transformation()) {
-      CurrentsDistanceDotProduct dot_product(_Sigma);
+      CurrentsDistanceDotProduct dot_product(_Sigma, _KernelCutoff);
       dist = vtkSmartPointer<vtkFloatArray>::New();
       dist->SetName("distance");
       dist->SetNumberOfComponents(1);
       dist->SetNumberOfTuples(_TargetCurrent->GetNumberOfPoints());
       dist->FillComponent(0, .0);
-      dot_product.Evaluate(_TargetCurrent, _SourceCurrent, dist);
+      dot_product.Evaluate(_TargetCells, _SourceCells, dist);
       NegateTuples1(dist);
-      dot_product.Evaluate(_TargetCurrent, _TargetCurrent, dist);
+      dot_product.Evaluate(_TargetCells, _TargetCells, dist);
     }
     snprintf(fname, sz, "%starget%s%s", prefix, suffix, _Target->DefaultExtension());
     _Target->Write(fname, NULL, dist);
@@ -684,15 +728,15 @@ void CurrentsDistance::WriteDataSets(const char *p, const char *suffix, bool all
   if (_Source->Transformation() || all) {
     vtkSmartPointer<vtkFloatArray> dist;
     if (_Source->Transformation()) {
-      CurrentsDistanceDotProduct dot_product(_Sigma);
+      CurrentsDistanceDotProduct dot_product(_Sigma, _KernelCutoff);
       dist = vtkSmartPointer<vtkFloatArray>::New();
       dist->SetName("distance");
       dist->SetNumberOfComponents(1);
       dist->SetNumberOfTuples(_SourceCurrent->GetNumberOfPoints());
       dist->FillComponent(0, .0);
-      dot_product.Evaluate(_SourceCurrent, _TargetCurrent, dist);
+      dot_product.Evaluate(_SourceCells, _TargetCells, dist);
       NegateTuples1(dist);
-      dot_product.Evaluate(_SourceCurrent, _SourceCurrent, dist);
+      dot_product.Evaluate(_SourceCells, _SourceCells, dist);
     }
     snprintf(fname, sz, "%ssource%s%s", prefix, suffix, _Source->DefaultExtension());
     _Source->Write(fname, NULL, dist);
@@ -2306,25 +2306,27 @@ void GenericRegistrationFilter::Write(const char *fname) const
 // -----------------------------------------------------------------------------
 void GenericRegistrationFilter::Run()
 {
-  MIRTK_START_TIMING();
-
-  // Guess parameters not specified by user
-  this->GuessParameter();
+  MIRTK_PROFILE_ZONE("registration");
+  const Transformation * const dofin = _InitialGuess;
+  {
+    MIRTK_PROFILE_ZONE("initialization of registration");
 
-  // Initialize image resolution pyramid
-  this->InitializePyramid();
-  this->InitializePointSets();
+    // Guess parameters not specified by user
+    this->GuessParameter();
 
-  // Make initial guess of transformation if none provided
-  const Transformation * const dofin = _InitialGuess;
-  if (!_InitialGuess) _InitialGuess = this->MakeInitialGuess();
+    // Initialize image resolution pyramid
+    this->InitializePyramid();
+    this->InitializePointSets();
 
-  MIRTK_DEBUG_TIMING(1, "initialization of registration");
+    // Make initial guess of transformation if none provided
+    if (!_InitialGuess) _InitialGuess = this->MakeInitialGuess();
+  }
 
   // For each transformation model (usually increasing number of DoFs)...
   Iteration model(0, static_cast<int>(_TransformationModel.size()));
   while (!model.End()) {
     _CurrentModel = _TransformationModel[model.Iter()];
+    MIRTK_PROFILE_ZONE(ToPrettyString(_CurrentModel) << " model");
 
     // Broadcast status message
     if (_TransformationModel.size() > 1) {
@@ -2351,8 +2353,6 @@ void GenericRegistrationFilter::Run()
 
   // Restore initial user guess
   _InitialGuess = dofin;
-
-  MIRTK_DEBUG_TIMING(1, "registration");
 }
 
 // -----------------------------------------------------------------------------
@@ -2363,7 +2363,7 @@ void GenericRegistrationFilter::MultiResolutionOptimization()
   Iteration level(_NumberOfLevels, 0);
   while (!level.End()) {
     _CurrentLevel = level.Iter();
-    MIRTK_START_TIMING();
+    MIRTK_PROFILE_ZONE("registration at level " << level.Iter());
 
     // Initialize registration at current resolution
     Broadcast(InitEvent, &level);
@@ -2371,14 +2371,16 @@ void GenericRegistrationFilter::MultiResolutionOptimization()
 
     // Solve registration problem by optimizing energy function
     Broadcast(StartEvent, &level);
-    _Optimizer->Run();
+    {
+      MIRTK_PROFILE_ZONE("optimization at level " << level.Iter());
+      _Optimizer->Run();
+    }
     Broadcast(EndEvent, &level);
 
     // Finalize registration at current resolution
     this->Finalize();
     Broadcast(FinishEvent, &level);
 
-    MIRTK_DEBUG_TIMING(2, "registration at level " << level.Iter());
     ++level;
   }
 }
@@ -2577,7 +2579,7 @@ void GenericRegistrationFilter::InitializePointSets()
 // -----------------------------------------------------------------------------
 void GenericRegistrationFilter::Initialize()
 {
-  MIRTK_START_TIMING();
+  MIRTK_PROFILE_ZONE("initialization of level " << _CurrentLevel);
 
   // Initialize output of sub-registration at current resolution
   this->InitializeOutput();
@@ -2587,8 +2589,6 @@ void GenericRegistrationFilter::Initialize()
 
   // Initialize optimizer of registration energy
   this->InitializeOptimizer();
-
-  MIRTK_DEBUG_TIMING(2, "initialization of level " << _CurrentLevel);
 }
 
 // -----------------------------------------------------------------------------
@@ -75,9 +75,12 @@ struct MultiplyGradientByHessian : public VoxelFunction
 class AddOtherPartialDerivatives
 {
 public:
+  typedef ImageSimilarity::GradientImageType GradientImageType;
+  typedef ImageSimilarity::GradientType      GradientType;
+
   const Transformation       *_Transformation;
-  const GenericImage<double> *_NPGradient;
-  const GenericImage<double> *_ImageGradient;
+  const GradientImageType    *_NPGradient;
+  const GradientImageType    *_ImageGradient;
   const WorldCoordsImage     *_Image2World;
   double                     *_Output;
   double                      _Weight;
@@ -158,13 +161,13 @@ public:
 
     Matrix dJdp; // Derivative of the Jacobian of transformation (w.r.t. world coordinates) w.r.t DoF
 
-    const double *gx = _NPGradient->Data(i1, j1, k1, 0);
-    const double *gy = _NPGradient->Data(i1, j1, k1, 1);
-    const double *gz = _NPGradient->Data(i1, j1, k1, 2);
+    const GradientType *gx = _NPGradient->Data(i1, j1, k1, 0);
+    const GradientType *gy = _NPGradient->Data(i1, j1, k1, 1);
+    const GradientType *gz = _NPGradient->Data(i1, j1, k1, 2);
 
-    const double *ix = _ImageGradient->Data(i1, j1, k1, 0);
-    const double *iy = _ImageGradient->Data(i1, j1, k1, 1);
-    const double *iz = _ImageGradient->Data(i1, j1, k1, 2);
+    const GradientType *ix = _ImageGradient->Data(i1, j1, k1, 0);
+    const GradientType *iy = _ImageGradient->Data(i1, j1, k1, 1);
+    const GradientType *iz = _ImageGradient->Data(i1, j1, k1, 2);
 
     // s1=1
     const int s2 =  _X - (i2 - i1);
@@ -251,9 +254,11 @@ template <class FreeFormTransformation>
 class AddOtherPartialDerivativesOfFFD
 {
 public:
+  typedef ImageSimilarity::GradientImageType GradientImageType;
+
   const FreeFormTransformation *_Transformation;
-  const GenericImage<double>   *_NPGradient;
-  const GenericImage<double>   *_ImageGradient;
+  const GradientImageType      *_NPGradient;
+  const GradientImageType      *_ImageGradient;
   double                       *_Output;
   double                        _Weight;
 
@@ -94,6 +94,266 @@ public:
 };
 
 
+// -----------------------------------------------------------------------------
+/// Maximum number of voxels processed at once by the quantized histogram fill
+const int MaxChunkSize = 256;
+
+// -----------------------------------------------------------------------------
+/// Linear mapping of intensity values to histogram bin indices
+///
+/// Equivalent to Histogram2D::ValToBinX/ValToBinY, but without the division
+/// and rounding function calls such that the loop over a chunk of intensities
+/// can be auto-vectorized by the compiler.
+struct IntensityToBin
+{
+  double _Offset;
+  double _Scale;
+  double _MaxBin;
+
+  IntensityToBin(double min, double max, double width, int nbins)
+  :
+    _Offset(min + .5 * width),
+    _Scale (static_cast<double>(nbins) / (max - min)),
+    _MaxBin(static_cast<double>(nbins - 1))
+  {}
+
+  void operator ()(const RegisteredImage::VoxelType *value, int *bin, int n) const
+  {
+    double x;
+    for (int i = 0; i < n; ++i) {
+      x = (static_cast<double>(value[i]) - _Offset) * _Scale;
+      x = (x > 0. ? x : 0.); // also maps NaN to first bin
+      x = (x < _MaxBin ? x : _MaxBin);
+      bin[i] = static_cast<int>(x + .5);
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Quantize intensities of untransformed target image
+///
+/// Voxels which are excluded from the similarity evaluation irrespective of
+/// the transformation of the source image are assigned bin index -1.
+class QuantizeTarget
+{
+  const HistogramImageSimilarity *_Similarity;
+  const IntensityToBin           *_ToBin;
+  int                            *_Bins;
+  bool                            _UseTargetMask;
+
+public:
+
+  QuantizeTarget(const HistogramImageSimilarity *sim, const IntensityToBin *to_bin, int *bins)
+  :
+    _Similarity(sim), _ToBin(to_bin), _Bins(bins)
+  {
+    // See ImageSimilarity::IsForeground, case of transformed source image
+    // without a foreground mask, where voxels outside the target foreground
+    // are excluded as well
+    _UseTargetMask = !_Similarity->Source()->HasMask();
+  }
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    const RegisteredImage *target  = _Similarity->Target();
+    const BinaryImage     *mask    = _Similarity->Mask();
+    const BinaryImage     *samples = _Similarity->SampleMask();
+    const int n = re.end() - re.begin();
+    (*_ToBin)(target->Data(re.begin()), _Bins + re.begin(), n);
+    for (int idx = re.begin(); idx != re.end(); ++idx) {
+      if ((mask    && !mask   ->Get(idx)) ||
+          (samples && !samples->Get(idx)) ||
+          (_UseTargetMask && !target->IsForeground(idx))) {
+        _Bins[idx] = -1;
+      }
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Fill block-private integer joint histograms
+///
+/// Each block of voxels is assigned its own integer histogram of the pool.
+/// The voxels of each block are processed in chunks, where the bin indices
+/// and foreground flags are first computed for all voxels of the chunk by
+/// vectorizable loops. Samples of excluded voxels are added to an extra
+/// bin which is ignored afterwards to avoid a conditional branch per voxel.
+class FillBlockHistograms
+{
+  const HistogramImageSimilarity *_Similarity;
+  const IntensityToBin           *_TargetToBin;
+  const IntensityToBin           *_SourceToBin;
+  const int                      *_TargetBins;
+  int                            *_Pool;
+  int                             _Stride;
+  int                             _NumberOfBlocks;
+  int                             _NumberOfBinsX;
+  int                             _ExcludedBin;
+
+public:
+
+  FillBlockHistograms(const HistogramImageSimilarity *sim,
+                      const IntensityToBin *target_to_bin,
+                      const IntensityToBin *source_to_bin,
+                      const int *target_bins, int *pool, int stride, int nblocks)
+  :
+    _Similarity(sim),
+    _TargetToBin(target_to_bin),
+    _SourceToBin(source_to_bin),
+    _TargetBins(target_bins),
+    _Pool(pool),
+    _Stride(stride),
+    _NumberOfBlocks(nblocks),
+    _NumberOfBinsX(sim->Samples()->NumberOfBinsX()),
+    _ExcludedBin(sim->Samples()->NumberOfBins())
+  {}
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    int tbin[MaxChunkSize];
+    int sbin[MaxChunkSize];
+    int fg  [MaxChunkSize];
+
+    const RegisteredImage *target = _Similarity->Target();
+    const RegisteredImage *source = _Similarity->Source();
+    const int nvox = _Similarity->NumberOfVoxels();
+
+    // Foreground of transformed source image when target image is not transformed
+    const bool   src_mask  = source->HasMask();
+    const bool   src_bgset = source->HasBackgroundValue();
+    const double src_bg    = source->GetBackgroundValueAsDouble();
+    const bool   src_bgnan = IsNaN(src_bg);
+
+    for (int b = re.begin(); b != re.end(); ++b) {
+      int * const hist = _Pool + b * _Stride;
+      memset(hist, 0, (_ExcludedBin + 1) * sizeof(int));
+      const int begin = static_cast<int>((static_cast<long>(nvox) *  b     ) / _NumberOfBlocks);
+      const int end   = static_cast<int>((static_cast<long>(nvox) * (b + 1)) / _NumberOfBlocks);
+      for (int idx = begin, n; idx < end; idx += n) {
+        n = min(MaxChunkSize, end - idx);
+        const RegisteredImage::VoxelType *src = source->Data(idx);
+        (*_SourceToBin)(src, sbin, n);
+        if (_TargetBins) {
+          const int *tgt = _TargetBins + idx;
+          if (src_mask) {
+            for (int i = 0; i < n; ++i) fg[i] = (tgt[i] >= 0 && source->IsForeground(idx + i));
+          } else if (!src_bgset) {
+            for (int i = 0; i < n; ++i) fg[i] = (tgt[i] >= 0);
+          } else if (src_bgnan) {
+            for (int i = 0; i < n; ++i) fg[i] = (tgt[i] >= 0) & (src[i] == src[i]);
+          } else {
+            for (int i = 0; i < n; ++i) fg[i] = (tgt[i] >= 0) & (src[i] != src_bg);
+          }
+          for (int i = 0; i < n; ++i) tbin[i] = (fg[i] ? tgt[i] : 0);
+        } else {
+          (*_TargetToBin)(target->Data(idx), tbin, n);
+          for (int i = 0; i < n; ++i) fg[i] = _Similarity->IsForeground(idx + i);
+        }
+        for (int i = 0; i < n; ++i) {
+          ++hist[fg[i] ? sbin[i] * _NumberOfBinsX + tbin[i] : _ExcludedBin];
+        }
+      }
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Merge pairs of block-private integer joint histograms
+///
+/// Used to reduce the histograms of the pool in a fixed binary tree order,
+/// where at each level the histogram of block b + step is added to the one
+/// of block b for each b that is a multiple of 2 * step.
+class JoinBlockHistograms
+{
+  int *_Pool;
+  int  _Stride;
+  int  _NumberOfBlocks;
+  int  _NumberOfBins;
+  int  _Step;
+
+public:
+
+  JoinBlockHistograms(int *pool, int stride, int nblocks, int nbins, int step)
+  :
+    _Pool(pool), _Stride(stride), _NumberOfBlocks(nblocks), _NumberOfBins(nbins), _Step(step)
+  {}
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    for (int p = re.begin(); p != re.end(); ++p) {
+      const int b = 2 * _Step * p;
+      if (b + _Step < _NumberOfBlocks) {
+        int       *l = _Pool +  b          * _Stride;
+        const int *r = _Pool + (b + _Step) * _Stride;
+        for (int i = 0; i < _NumberOfBins; ++i) l[i] += r[i];
+      }
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Compute joint histogram bin indices of voxels within image region
+class ComputeRegionBins
+{
+  const HistogramImageSimilarity *_Similarity;
+  const IntensityToBin           *_TargetToBin;
+  const IntensityToBin           *_SourceToBin;
+  const int                      *_TargetBins;
+  int                            *_Bins;
+  int                             _I1, _J1, _K1, _NX, _NY;
+
+public:
+
+  ComputeRegionBins(const HistogramImageSimilarity *sim,
+                    const IntensityToBin *target_to_bin,
+                    const IntensityToBin *source_to_bin,
+                    const int *target_bins,
+                    const blocked_range3d<int> &region, int *bins)
+  :
+    _Similarity(sim),
+    _TargetToBin(target_to_bin),
+    _SourceToBin(source_to_bin),
+    _TargetBins(target_bins),
+    _Bins(bins),
+    _I1(region.cols ().begin()),
+    _J1(region.rows ().begin()),
+    _K1(region.pages().begin()),
+    _NX(region.cols ().end() - region.cols().begin()),
+    _NY(region.rows ().end() - region.rows().begin())
+  {}
+
+  void operator ()(const blocked_range3d<int> &re) const
+  {
+    int tbin[MaxChunkSize];
+    int sbin[MaxChunkSize];
+
+    const RegisteredImage *target = _Similarity->Target();
+    const RegisteredImage *source = _Similarity->Source();
+    const int nbinsx = _Similarity->Samples()->NumberOfBinsX();
+
+    for (int k = re.pages().begin(); k != re.pages().end(); ++k)
+    for (int j = re.rows ().begin(); j != re.rows ().end(); ++j)
+    for (int i = re.cols ().begin(), n; i < re.cols().end(); i += n) {
+      n = min(MaxChunkSize, re.cols().end() - i);
+      int *bin = _Bins + ((k - _K1) * _NY + (j - _J1)) * _NX + (i - _I1);
+      const int idx = target->VoxelToIndex(i, j, k);
+      (*_SourceToBin)(source->Data(idx), sbin, n);
+      if (_TargetBins) {
+        const int *tgt = _TargetBins + idx;
+        for (int l = 0; l < n; ++l) {
+          bin[l] = (tgt[l] >= 0 && source->IsForeground(idx + l) ? sbin[l] * nbinsx + tgt[l] : -1);
+        }
+      } else {
+        (*_TargetToBin)(target->Data(idx), tbin, n);
+        for (int l = 0; l < n; ++l) {
+          bin[l] = (_Similarity->IsForeground(idx + l) ? sbin[l] * nbinsx + tbin[l] : -1);
+        }
+      }
+    }
+  }
+};
+
+
 } // namespace HistogramImageSimilarityUtils
 using namespace HistogramImageSimilarityUtils;
 
@@ -107,8 +367,13 @@ HistogramImageSimilarity::HistogramImageSimilarity(const char *name, double weig
   ImageSimilarity(name, weight),
   _Samples  (new JointHistogramType()), _SamplesOwner(true),
   _Histogram(nullptr),
+  _UseParzenWindow(true),
   _NumberOfTargetBins(0),
-  _NumberOfSourceBins(0)
+  _NumberOfSourceBins(0),
+  _QuantizedHistogramFill(true),
+  _NumberOfHistogramBlocks(0),
+  _HistogramPoolStride(0),
+  _ExclusionPending(false)
 {
 }
 
@@ -119,8 +384,16 @@ void HistogramImageSimilarity::CopyAttributes(const HistogramImageSimilarity &ot
   _Samples            = (other._SamplesOwner ? new JointHistogramType(*other._Samples) : other._Samples);
   _SamplesOwner       = other._SamplesOwner;
   _Histogram          = other._Histogram ? new JointHistogramType(*other._Histogram) : nullptr;
+  _UseParzenWindow    = other._UseParzenWindow;
   _NumberOfTargetBins = other._NumberOfTargetBins;
   _NumberOfSourceBins = other._NumberOfSourceBins;
+  _QuantizedHistogramFill = other._QuantizedHistogramFill;
+  _TargetBins.clear();
+  _HistogramPool.clear();
+  _NumberOfHistogramBlocks = 0;
+  _HistogramPoolStride     = 0;
+  _ExcludedBins.clear();
+  _ExclusionPending        = false;
 }
 
 // -----------------------------------------------------------------------------
@@ -168,6 +441,9 @@ bool HistogramImageSimilarity::SetWithPrefix(const char *param, const char *valu
   if (strcmp(param, "No. of source bins") == 0) {
     return FromString(value, _NumberOfSourceBins) && _NumberOfSourceBins > 0;
   }
+  if (strcmp(param, "Quantized histogram fill") == 0) {
+    return FromString(value, _QuantizedHistogramFill);
+  }
   return ImageSimilarity::SetWithPrefix(param, value);
 }
 
@@ -181,6 +457,7 @@ ParameterList HistogramImageSimilarity::Parameter() const
     Insert(params, "No. of target bins", _NumberOfTargetBins);
     Insert(params, "No. of source bins", _NumberOfSourceBins);
   }
+  Insert(params, "Quantized histogram fill", _QuantizedHistogramFill);
   return params;
 }
 
@@ -256,22 +533,109 @@ void HistogramImageSimilarity::Initialize()
 
   // Initialize joint histogram
   if (!_Histogram) _Histogram = new JointHistogramType(*_Samples);
+
+  // Target intensities are quantized upon first update
+  _TargetBins.clear();
+  _ExclusionPending = false;
+
+  // Allocate pool of integer histograms for quantized histogram fill
+  if (_QuantizedHistogramFill && _SamplesOwner) {
+    // Fixed number of blocks independent of the number of threads such that
+    // the result of the tree join does not depend on the task scheduling
+    const int nbins = _Samples->NumberOfBins();
+    _NumberOfHistogramBlocks = max(1, min(64, _NumberOfVoxels / 32768));
+    _NumberOfHistogramBlocks = max(1, min(_NumberOfHistogramBlocks, 4194304 / (nbins + 1)));
+    // Pad histograms to multiple of 64 bytes to avoid false sharing
+    _HistogramPoolStride = 16 * ((nbins + 16) / 16);
+    _HistogramPool.resize(static_cast<size_t>(_NumberOfHistogramBlocks) * _HistogramPoolStride);
+  } else {
+    _NumberOfHistogramBlocks = 0;
+    _HistogramPoolStride     = 0;
+    _HistogramPool.clear();
+  }
+}
+
+// -----------------------------------------------------------------------------
+void HistogramImageSimilarity::QuantizeTargetIntensities()
+{
+  // Only the common case of a fixed target image and transformed source image
+  // is optimized, see also ImageSimilarity::IsForeground
+  if (_Target->Transformation() || !_Source->Transformation()) {
+    _TargetBins.clear();
+  } else {
+    IntensityToBin to_bin(_Samples->MinX(), _Samples->MaxX(), _Samples->WidthX(),
+                          _Samples->NumberOfBinsX());
+    _TargetBins.resize(_NumberOfVoxels);
+    QuantizeTarget body(this, &to_bin, _TargetBins.data());
+    parallel_for(blocked_range<int>(0, _NumberOfVoxels, MaxChunkSize), body);
+  }
+}
+
+// -----------------------------------------------------------------------------
+void HistogramImageSimilarity::SampleVoxels()
+{
+  ImageSimilarity::SampleVoxels();
+  // Voxels which are not sampled are assigned target bin index -1
+  if (!_TargetBins.empty()) QuantizeTargetIntensities();
+}
+
+// -----------------------------------------------------------------------------
+void HistogramImageSimilarity::FillQuantizedHistogram()
+{
+  const int nbins   = _Samples->NumberOfBins();
+  const int nblocks = _NumberOfHistogramBlocks;
+  const int stride  = _HistogramPoolStride;
+  int * const pool  = _HistogramPool.data();
+
+  IntensityToBin target_to_bin(_Samples->MinX(), _Samples->MaxX(), _Samples->WidthX(),
+                               _Samples->NumberOfBinsX());
+  IntensityToBin source_to_bin(_Samples->MinY(), _Samples->MaxY(), _Samples->WidthY(),
+                               _Samples->NumberOfBinsY());
+
+  // Fill block-private histograms
+  const int *target_bins = (_TargetBins.empty() ? nullptr : _TargetBins.data());
+  FillBlockHistograms fill(this, &target_to_bin, &source_to_bin,
+                           target_bins, pool, stride, nblocks);
+  parallel_for(blocked_range<int>(0, nblocks, 1), fill);
+
+  // Merge histograms in fixed tree order
+  for (int step = 1; step < nblocks; step *= 2) {
+    const int npairs = (nblocks + 2 * step - 1) / (2 * step);
+    JoinBlockHistograms join(pool, stride, nblocks, nbins, step);
+    parallel_for(blocked_range<int>(0, npairs, 1), join);
+  }
+
+  // Copy integer bin counts to joint histogram of raw samples
+  JointHistogramType::BinType *bin = _Samples->RawPointer();
+  long nsamples = 0;
+  for (int i = 0; i < nbins; ++i) {
+    bin[i] = static_cast<JointHistogramType::BinType>(pool[i]);
+    nsamples += pool[i];
+  }
+  _Samples->NumberOfSamples(static_cast<JointHistogramType::BinType>(nsamples));
 }
 
 // -----------------------------------------------------------------------------
 void HistogramImageSimilarity::Update(bool gradient)
 {
   // Update base class and moving image(s)
+  const bool initial_update = _InitialUpdate;
   ImageSimilarity::Update(gradient);
 
   MIRTK_START_TIMING();
 
   // Update joint histogram
   if (_SamplesOwner) {
-    _Samples->Reset();
-    blocked_range<int> voxels(0, _NumberOfVoxels, _NumberOfVoxels / 8);
-    FillHistogram add(this, _Samples);
-    parallel_reduce(voxels, add);
+    _ExclusionPending = false;
+    if (_QuantizedHistogramFill && _NumberOfHistogramBlocks > 0) {
+      if (initial_update) QuantizeTargetIntensities();
+      FillQuantizedHistogram();
+    } else {
+      _Samples->Reset();
+      blocked_range<int> voxels(0, _NumberOfVoxels, _NumberOfVoxels / 8);
+      FillHistogram add(this, _Samples);
+      parallel_reduce(voxels, add);
+    }
   }
 
   // Smooth histogram
@@ -286,34 +650,112 @@ void HistogramImageSimilarity::Update(bool gradient)
 }
 
 // -----------------------------------------------------------------------------
-void HistogramImageSimilarity::Exclude(const blocked_range3d<int> &region)
+void HistogramImageSimilarity
+::ComputeJointBins(const blocked_range3d<int> &region, int *bins) const
 {
-  for (int k = region.pages().begin(); k < region.pages().end(); ++k)
-  for (int j = region.rows ().begin(); j < region.rows ().end(); ++j)
-  for (int i = region.cols ().begin(); i < region.cols ().end(); ++i) {
-    if (IsForeground(i, j, k)) {
-      _Samples->Delete(_Samples->ValToBinX(_Target->Get(i, j, k)),
-                       _Samples->ValToBinY(_Source->Get(i, j, k)));
+  IntensityToBin target_to_bin(_Samples->MinX(), _Samples->MaxX(), _Samples->WidthX(),
+                               _Samples->NumberOfBinsX());
+  IntensityToBin source_to_bin(_Samples->MinY(), _Samples->MaxY(), _Samples->WidthY(),
+                               _Samples->NumberOfBinsY());
+  const int *target_bins = (_TargetBins.empty() ? nullptr : _TargetBins.data());
+  ComputeRegionBins body(this, &target_to_bin, &source_to_bin, target_bins, region, bins);
+  parallel_for(region, body);
+}
+
+// -----------------------------------------------------------------------------
+void HistogramImageSimilarity::RemoveExcludedSamples()
+{
+  if (_ExclusionPending) {
+    JointHistogramType::BinType *samples = _Samples->RawPointer();
+    JointHistogramType::BinType  nsamples = _Samples->NumberOfSamples();
+    const int n = static_cast<int>(_ExcludedBins.size());
+    for (int idx = 0; idx < n; ++idx) {
+      if (_ExcludedBins[idx] >= 0) {
+        samples[_ExcludedBins[idx]] -= 1;
+        nsamples                    -= 1;
+      }
     }
+    _Samples->NumberOfSamples(nsamples);
+    _ExclusionPending = false;
   }
 }
 
+// -----------------------------------------------------------------------------
+void HistogramImageSimilarity::Exclude(const blocked_range3d<int> &region)
+{
+  // Remove samples of previous region if Include was not called in between
+  RemoveExcludedSamples();
+  // Remember joint bins of voxels in region, removed upon Include
+  const int nx = region.cols ().end() - region.cols ().begin();
+  const int ny = region.rows ().end() - region.rows ().begin();
+  const int nz = region.pages().end() - region.pages().begin();
+  if (nx <= 0 || ny <= 0 || nz <= 0) return;
+  _ExcludedBins.resize(static_cast<size_t>(nx) * ny * nz);
+  ComputeJointBins(region, _ExcludedBins.data());
+  _ExcludedRegion[0] = region.cols ().begin();
+  _ExcludedRegion[1] = region.cols ().end();
+  _ExcludedRegion[2] = region.rows ().begin();
+  _ExcludedRegion[3] = region.rows ().end();
+  _ExcludedRegion[4] = region.pages().begin();
+  _ExcludedRegion[5] = region.pages().end();
+  _ExclusionPending  = true;
+}
+
 // -----------------------------------------------------------------------------
 void HistogramImageSimilarity::Include(const blocked_range3d<int> &region)
 {
+  const int nx = region.cols ().end() - region.cols ().begin();
+  const int ny = region.rows ().end() - region.rows ().begin();
+  const int nz = region.pages().end() - region.pages().begin();
+  const int n  = (nx > 0 && ny > 0 && nz > 0 ? nx * ny * nz : 0);
+
+  // Unless region is the same as the one excluded before, remove all
+  // excluded samples first and add all samples of the included region
+  if (_ExclusionPending) {
+    if (_ExcludedRegion[0] != region.cols ().begin() ||
+        _ExcludedRegion[1] != region.cols ().end()   ||
+        _ExcludedRegion[2] != region.rows ().begin() ||
+        _ExcludedRegion[3] != region.rows ().end()   ||
+        _ExcludedRegion[4] != region.pages().begin() ||
+        _ExcludedRegion[5] != region.pages().end()) {
+      RemoveExcludedSamples();
+    }
+  }
+  if (n == 0 && !_ExclusionPending) return;
+
+  // Compute joint bins of voxels in updated region
+  Array<int> bins(n);
+  if (n > 0) ComputeJointBins(region, bins.data());
+
+  // Update only bins of voxels whose samples were changed
+  JointHistogramType::BinType *samples  = _Samples->RawPointer();
+  JointHistogramType::BinType  nsamples = _Samples->NumberOfSamples();
   bool changed = false;
-  for (int k = region.pages().begin(); k < region.pages().end(); ++k)
-  for (int j = region.rows ().begin(); j < region.rows ().end(); ++j)
-  for (int i = region.cols ().begin(); i < region.cols ().end(); ++i) {
-    if (IsForeground(i, j, k)) {
-      _Samples->Add(_Samples->ValToBinX(_Target->Get(i, j, k)),
-                    _Samples->ValToBinY(_Source->Get(i, j, k)));
-      changed = true;
+  if (_ExclusionPending) {
+    for (int idx = 0; idx < n; ++idx) {
+      const int &old_bin = _ExcludedBins[idx];
+      const int &new_bin = bins[idx];
+      if (old_bin != new_bin) {
+        if (old_bin >= 0) samples[old_bin] -= 1, nsamples -= 1;
+        if (new_bin >= 0) samples[new_bin] += 1, nsamples += 1;
+        changed = true;
+      }
+    }
+    _ExclusionPending = false;
+  } else {
+    for (int idx = 0; idx < n; ++idx) {
+      if (bins[idx] >= 0) {
+        samples[bins[idx]] += 1, nsamples += 1;
+        changed = true;
+      }
     }
   }
+  _Samples->NumberOfSamples(nsamples);
+
+  // Update joint histogram (see Update)
   if (changed) {
     _Histogram->Reset(*_Samples);
-    _Histogram->Smooth();
+    if (_UseParzenWindow) _Histogram->Smooth();
   }
 }
 
@@ -19,11 +19,13 @@
 
 #include "mirtk/ImageSimilarity.h"
 
+#include "mirtk/Array.h"
 #include "mirtk/Assert.h"
 #include "mirtk/Math.h"
 #include "mirtk/Memory.h"
 #include "mirtk/Parallel.h"
 #include "mirtk/Profiling.h"
+#include "mirtk/Random.h"
 #include "mirtk/VoxelFunction.h"
 #include "mirtk/MultiLevelTransformation.h"
 
@@ -287,6 +289,11 @@ ImageSimilarity::ImageSimilarity(const char *name, double weight)
   _UseApproximateGradient  (false),
   _VoxelWisePreconditioning(.0),
   _NodeBasedPreconditioning(.0),
+  _SamplingMethod          (NoSampling),
+  _SamplingFraction        (1.0),
+  _SamplingSeed            (0),
+  _SampleMask              (nullptr),
+  _NumberOfSamplings       (0),
   _SkipTargetInitialization(false),
   _SkipSourceInitialization(false),
   _InitialUpdate           (false)
@@ -314,11 +321,19 @@ void ImageSimilarity::CopyAttributes(const ImageSimilarity &other)
   Delete(_GradientWrtSource);
   Deallocate(_Gradient);
 
+  Delete(_SampleMask);
+  if (other._SampleMask) _SampleMask = new BinaryImage(*other._SampleMask);
+  _SampleWeight = other._SampleWeight;
+
   _Mask                     = other._Mask;
   _NumberOfVoxels           = other._NumberOfVoxels;
   _UseApproximateGradient   = other._UseApproximateGradient;
   _VoxelWisePreconditioning = other._VoxelWisePreconditioning;
   _NodeBasedPreconditioning = other._NodeBasedPreconditioning;
+  _SamplingMethod           = other._SamplingMethod;
+  _SamplingFraction         = other._SamplingFraction;
+  _SamplingSeed             = other._SamplingSeed;
+  _NumberOfSamplings        = other._NumberOfSamplings;
   _InitialUpdate            = other._InitialUpdate;
 }
 
@@ -330,7 +345,8 @@ ImageSimilarity::ImageSimilarity(const ImageSimilarity &other)
   _Source           (nullptr),
   _GradientWrtTarget(nullptr),
   _GradientWrtSource(nullptr),
-  _Gradient         (nullptr)
+  _Gradient         (nullptr),
+  _SampleMask       (nullptr)
 {
   CopyAttributes(other);
 }
@@ -353,6 +369,7 @@ ImageSimilarity::~ImageSimilarity()
   Delete(_GradientWrtTarget);
   Delete(_GradientWrtSource);
   Deallocate(_Gradient);
+  Delete(_SampleMask);
 }
 
 // =============================================================================
@@ -401,6 +418,10 @@ void ImageSimilarity::Initialize()
   }
   // Number of voxels per registered image
   _NumberOfVoxels = _Domain.NumberOfSpatialPoints();
+  // Voxels are sampled upon first Update when all voxels were updated
+  Delete(_SampleMask);
+  _SampleWeight.clear();
+  _NumberOfSamplings = 0;
 }
 
 // =============================================================================
@@ -437,6 +458,28 @@ bool ImageSimilarity::SetWithoutPrefix(const char *param, const char *value)
     _Source->HessianSigma(sigma);
     return true;
   }
+  if (strcmp(param, "Voxel sampling") == 0 ||
+      strcmp(param, "Voxel sampling method") == 0) {
+    const string method = ToLower(value);
+    if (method == "none" || method == "no" || method == "off") {
+      _SamplingMethod = NoSampling;
+    } else if (method == "random" || method == "uniform") {
+      _SamplingMethod = RandomSampling;
+    } else if (method == "stratified") {
+      _SamplingMethod = StratifiedSampling;
+    } else if (method == "gradient" || method == "gradient magnitude") {
+      _SamplingMethod = GradientSampling;
+    } else {
+      return false;
+    }
+    return true;
+  }
+  if (strcmp(param, "Voxel sampling fraction") == 0) {
+    return FromString(value, _SamplingFraction) && _SamplingFraction > .0;
+  }
+  if (strcmp(param, "Voxel sampling seed") == 0) {
+    return FromString(value, _SamplingSeed);
+  }
 
   return DataFidelity::SetWithoutPrefix(param, value);
 }
@@ -450,6 +493,16 @@ ParameterList ImageSimilarity::Parameter() const
   InsertWithPrefix(params, "Preconditioning (node-based)", _NodeBasedPreconditioning);
   InsertWithPrefix(params, "Blurring of image gradient",   _Target->GradientSigma());
   InsertWithPrefix(params, "Blurring of image hessian",    _Target->HessianSigma());
+  const char *method;
+  switch (_SamplingMethod) {
+    case RandomSampling:     method = "Random";     break;
+    case StratifiedSampling: method = "Stratified"; break;
+    case GradientSampling:   method = "Gradient";   break;
+    default:                 method = "None";       break;
+  }
+  InsertWithPrefix(params, "Voxel sampling",               method);
+  InsertWithPrefix(params, "Voxel sampling fraction",      _SamplingFraction);
+  InsertWithPrefix(params, "Voxel sampling seed",          _SamplingSeed);
   return params;
 }
 
@@ -460,15 +513,189 @@ ParameterList ImageSimilarity::Parameter() const
 // -----------------------------------------------------------------------------
 void ImageSimilarity::Update(bool gradient)
 {
+  // Moving images are only resampled at sampled voxels after the initial update
+  _Target->SampleMask(_InitialUpdate ? nullptr : _SampleMask);
+  _Source->SampleMask(_InitialUpdate ? nullptr : _SampleMask);
   if (_InitialUpdate || _Target->Transformation()) {
     _Target->Update(true, gradient, false, _InitialUpdate);
   }
   if (_InitialUpdate || _Source->Transformation()) {
     _Source->Update(true, gradient, false, _InitialUpdate);
   }
+  if (_InitialUpdate && this->IsSampling()) {
+    this->SampleVoxels();
+  }
   _InitialUpdate = false;
 }
 
+// -----------------------------------------------------------------------------
+bool ImageSimilarity::Upgrade()
+{
+  // Continue optimization with a new subset of voxels, where the registered
+  // images are updated at the new samples by the subsequent Update call
+  if (!_SampleMask) return false;
+  this->SampleVoxels();
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+bool ImageSimilarity::IsSampleCandidate(int idx) const
+{
+  // See IsForeground, but without checking the foreground of a moving
+  // image which is not updated at voxels that are not currently sampled
+  if (_Mask && !_Mask->Get(idx)) return false;
+  if (_Target->Transformation() && _Source->Transformation()) {
+    return true;
+  } else if (_Source->Transformation()) {
+    if (_Source->HasMask()) return _Source->IsForeground(idx);
+    return _Target->IsForeground(idx);
+  } else {
+    if (_Target->HasMask()) return _Target->IsForeground(idx);
+    return _Source->IsForeground(idx);
+  }
+}
+
+// -----------------------------------------------------------------------------
+void ImageSimilarity::SampleVoxels()
+{
+  MIRTK_START_TIMING();
+
+  const int nx = _Domain._x;
+  const int ny = _Domain._y;
+  const int nz = _Domain._z;
+
+  if (!_SampleMask) _SampleMask = new BinaryImage(_Domain, 1);
+  BinaryPixel *sample = _SampleMask->Data();
+
+  // Mark candidate voxels
+  int ncandidates = 0;
+  for (int idx = 0; idx < _NumberOfVoxels; ++idx) {
+    sample[idx] = static_cast<BinaryPixel>(IsSampleCandidate(idx));
+    if (sample[idx]) ++ncandidates;
+  }
+
+  // Initialize pseudo-random number generator
+  mt19937 rng;
+  if (_SamplingSeed < 0) {
+    random_device rd;
+    rng.seed(rd());
+  } else {
+    rng.seed(static_cast<unsigned int>(_SamplingSeed + _NumberOfSamplings));
+  }
+  uniform_real_distribution<double> uniform(.0, 1.0);
+
+  const double fraction = min(_SamplingFraction, 1.0);
+
+  switch (_SamplingMethod) {
+
+    // Select fixed number of candidates with equal probability
+    case RandomSampling: {
+      int m = iround(fraction * ncandidates);
+      for (int idx = 0, n = ncandidates; idx < _NumberOfVoxels; ++idx) {
+        if (sample[idx]) {
+          if (uniform(rng) * n >= m) sample[idx] = BinaryPixel(0);
+          else --m;
+          --n;
+        }
+      }
+    } break;
+
+    // Select candidates within each cell of a regular grid such that
+    // the number of samples per cell is proportional to its candidates
+    case StratifiedSampling: {
+      const int    dim  = (nz > 1 ? 3 : 2);
+      const int    size = max(1, static_cast<int>(ceil(pow(1.0 / fraction, 1.0 / dim))));
+      const int    sz   = (nz > 1 ? size : 1);
+      for (int k1 = 0; k1 < nz; k1 += sz)
+      for (int j1 = 0; j1 < ny; j1 += size)
+      for (int i1 = 0; i1 < nx; i1 += size) {
+        const int i2 = min(i1 + size, nx);
+        const int j2 = min(j1 + size, ny);
+        const int k2 = min(k1 + sz,   nz);
+        int n = 0;
+        for (int k = k1; k < k2; ++k)
+        for (int j = j1; j < j2; ++j)
+        for (int i = i1; i < i2; ++i) {
+          if (sample[(k * ny + j) * nx + i]) ++n;
+        }
+        if (n == 0) continue;
+        int m = static_cast<int>(fraction * n + uniform(rng));
+        for (int k = k1; k < k2; ++k)
+        for (int j = j1; j < j2; ++j)
+        for (int i = i1; i < i2; ++i) {
+          BinaryPixel &s = sample[(k * ny + j) * nx + i];
+          if (s) {
+            if (uniform(rng) * n >= m) s = BinaryPixel(0);
+            else --m;
+            --n;
+          }
+        }
+      }
+    } break;
+
+    // Select candidates with probability proportional to the gradient
+    // magnitude of the untransformed image, plus a constant such that
+    // homogeneous regions are still sampled sparsely
+    case GradientSampling: {
+      if (_SampleWeight.empty()) {
+        // Image intensities are not updated at unsampled voxels afterwards
+        const RegisteredImage *image = (_Target->Transformation() ? _Source : _Target);
+        const RegisteredImage::VoxelType *I = image->Data();
+        _SampleWeight.resize(_NumberOfVoxels, .0);
+        double gx, gy, gz;
+        int    idx, prev, next;
+        for (int k = 0; k < nz; ++k)
+        for (int j = 0; j < ny; ++j)
+        for (int i = 0; i < nx; ++i) {
+          idx = (k * ny + j) * nx + i;
+          if (!sample[idx]) continue;
+          prev = (i > 0      && sample[idx - 1] ? idx - 1 : idx);
+          next = (i < nx - 1 && sample[idx + 1] ? idx + 1 : idx);
+          gx   = (next - prev > 0 ? static_cast<double>(I[next] - I[prev]) / (next - prev) : .0);
+          prev = (j > 0      && sample[idx - nx] ? idx - nx : idx);
+          next = (j < ny - 1 && sample[idx + nx] ? idx + nx : idx);
+          gy   = (next - prev > 0 ? static_cast<double>(I[next] - I[prev]) * nx / (next - prev) : .0);
+          prev = (k > 0      && sample[idx - nx * ny] ? idx - nx * ny : idx);
+          next = (k < nz - 1 && sample[idx + nx * ny] ? idx + nx * ny : idx);
+          gz   = (next - prev > 0 ? static_cast<double>(I[next] - I[prev]) * nx * ny / (next - prev) : .0);
+          _SampleWeight[idx] = sqrt(gx * gx + gy * gy + gz * gz);
+        }
+        double sum = .0;
+        for (idx = 0; idx < _NumberOfVoxels; ++idx) sum += _SampleWeight[idx];
+        const double offset = (sum > .0 ? .1 * sum / ncandidates : 1.0);
+        for (idx = 0; idx < _NumberOfVoxels; ++idx) {
+          if (sample[idx]) _SampleWeight[idx] += offset;
+        }
+      }
+      double sum = .0;
+      for (int idx = 0; idx < _NumberOfVoxels; ++idx) {
+        if (sample[idx]) sum += _SampleWeight[idx];
+      }
+      const double scale = (sum > .0 ? fraction * ncandidates / sum : .0);
+      for (int idx = 0; idx < _NumberOfVoxels; ++idx) {
+        if (sample[idx] && uniform(rng) >= scale * _SampleWeight[idx]) {
+          sample[idx] = BinaryPixel(0);
+        }
+      }
+    } break;
+
+    default: break;
+  }
+
+  ++_NumberOfSamplings;
+
+  MIRTK_DEBUG_TIMING(2, "sampling of voxels");
+}
+
+// -----------------------------------------------------------------------------
+bool ImageSimilarity::Dependencies(Array<const void *> &deps) const
+{
+  deps.clear();
+  deps.push_back(_Target);
+  deps.push_back(_Source);
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 void ImageSimilarity::Exclude(const blocked_range3d<int> &)
 {
@@ -545,11 +772,24 @@ void ImageSimilarity::ApproximateGradient(RegisteredImage        *image,
   weight /= 2.0 * step;
   double a, b, value;
   int i1, j1, k1, i2, j2, k2, dof[3];
+  Array<VoxelType> intensities;
   for (int cp = 0; cp < ffd->NumberOfCPs(); ++cp) {
     if (ffd->IsActive(cp) &&
         ffd->BoundingBox(image, cp, i1, j1, k1, i2, j2, k2)) {
       blocked_range3d<int> region(k1, k2+1, j1, j2+1, i1, i2+1);
       ffd->IndexToDOFs(cp, dof[0], dof[1], dof[2]);
+      // Save intensities within support region of control point such that
+      // these do not need to be recomputed after each pair of perturbations,
+      // including the gradient and Hessian channels or further frames
+      const int nx = i2 - i1 + 1;
+      const int nt = image->T();
+      intensities.resize(static_cast<size_t>(nx) * (j2 - j1 + 1) * (k2 - k1 + 1) * nt);
+      VoxelType *saved = intensities.data();
+      for (int l = 0;  l <  nt; ++l)
+      for (int k = k1; k <= k2; ++k)
+      for (int j = j1; j <= j2; ++j, saved += nx) {
+        memcpy(saved, image->Data(i1, j, k, l), nx * sizeof(VoxelType));
+      }
       for (int i = 0; i < 3; ++i) {
         if (ffd->GetStatus(dof[i]) == Active) {
           value = ffd->Get(dof[i]);
@@ -568,7 +808,12 @@ void ImageSimilarity::ApproximateGradient(RegisteredImage        *image,
 
           ffd->Put(dof[i], value);
           this->Exclude(region);
-          image->Update(region);
+          saved = intensities.data();
+          for (int l = 0;  l <  nt; ++l)
+          for (int k = k1; k <= k2; ++k)
+          for (int j = j1; j <= j2; ++j, saved += nx) {
+            memcpy(image->Data(i1, j, k, l), saved, nx * sizeof(VoxelType));
+          }
           this->Include(region);
 
           gradient[dof[i]] += weight * (a - b);
@@ -685,7 +930,7 @@ void ImageSimilarity::EvaluateGradient(RegisteredImage    *image,
   if (!image->Transformation()) return;
   const int ndofs = image->Transformation()->NumberOfDOFs();
   // Directly update gradient if no node-based preconditioning is used
-  GradientType * const tmp_gradient = _Gradient;
+  double * const tmp_gradient = _Gradient;
   if (_NodeBasedPreconditioning <= .0) _Gradient = gradient;
   // Compute parametric gradient w.r.t. given transformed image
   if (_Gradient != gradient) {
@@ -30,7 +30,6 @@
 #include "mirtk/BinaryVoxelFunction.h"
 #include "mirtk/ScalarFunctionToImage.h"
 #include "mirtk/ConvolutionFunction.h"
-#include "mirtk/GenericImageIterator.h"
 #include "mirtk/ScalarGaussian.h"
 #include "mirtk/ObjectFactory.h"
 
@@ -59,6 +58,7 @@ mirtkAutoRegisterEnergyTermMacro(NormalizedIntensityCrossCorrelation);
 namespace NormalizedIntensityCrossCorrelationUtil {
 
 // Types
+typedef NormalizedIntensityCrossCorrelation::RealType  RealType;
 typedef NormalizedIntensityCrossCorrelation::RealImage RealImage;
 
 // -----------------------------------------------------------------------------
@@ -219,7 +219,7 @@ struct GenerateLNCCImage : public VoxelFunction
       (*cc) = -0.01; // i.e., background
     } else {
       if (*b >= .01 && *c >= .01) {
-        (*cc) = min(1.0, abs(*a) / ((*b) * (*c)));
+        (*cc) = min(1.0, static_cast<double>(abs(*a) / ((*b) * (*c))));
       } else if (*b < .01 && *c < .01) {
         (*cc) = 1.0; // i.e., both regions (approx.) constant-valued
       } else {
@@ -252,7 +252,7 @@ struct EvaluateLNCC : public VoxelReduction
   {
     if (!IsNaN(*a)) {
       if (*b >= .01 && *c >= .01) {
-        _Sum += min(1.0, abs(*a) / ((*b) * (*c)));
+        _Sum += min(1.0, static_cast<double>(abs(*a) / ((*b) * (*c))));
       } else if (*b < .01 && *c < .01) {
         _Sum += 1.0; // i.e., both regions (approx.) constant-valued
       }
@@ -265,7 +265,7 @@ struct EvaluateLNCC : public VoxelReduction
   {
     if (!IsNaN(*a)) {
       if (*b >= .01 && *c >= .01) {
-        _Sum += min(1.0, abs(*a) / ((*b) * (*c)));
+        _Sum += min(1.0, static_cast<double>(abs(*a) / ((*b) * (*c))));
       } else if (*b < .01 && *c < .01) {
         _Sum += 1.0; // i.e., both regions (approx.) constant-valued
       }
@@ -315,59 +315,6 @@ struct EvaluateLNCCGradient : public VoxelFunction
 // Kernel: Box window
 // -----------------------------------------------------------------------------
 
-// -----------------------------------------------------------------------------
-template <class VoxelType>
-struct UpdateBoxWindowLNCC : public VoxelFunction
-{
-  NormalizedIntensityCrossCorrelation *_This;
-
-  // ---------------------------------------------------------------------------
-  UpdateBoxWindowLNCC(NormalizedIntensityCrossCorrelation *_this)
-  :
-    _This(_this)
-  {}
-
-  // ---------------------------------------------------------------------------
-  void operator()(int i, int j, int k, int, const VoxelType *tgt, const VoxelType *src,
-                  VoxelType *a, VoxelType *b, VoxelType *c, VoxelType *s, VoxelType *t)
-  {
-    int    cnt  =  0;
-    double sumt = .0, sums = .0, sumss = .0, sumts = .0, sumtt = .0;
-
-    if (_This->IsForeground(i, j, k)) {
-      const Vector3D<int> &radius = _This->NeighborhoodRadius();
-      GenericImageIterator<VoxelType> _TargetNeighborhood(_This->Target());
-      GenericImageIterator<VoxelType> _SourceNeighborhood(_This->Source());
-      _TargetNeighborhood.SetNeighborhood(i, j, k, radius._x, radius._y, radius._z);
-      _SourceNeighborhood.SetNeighborhood(i, j, k, radius._x, radius._y, radius._z);
-      _TargetNeighborhood.GoToBegin();
-      _SourceNeighborhood.GoToBegin();
-      while (!_TargetNeighborhood.IsAtEnd()) {
-        sums  += _SourceNeighborhood.Value();
-        sumt  += _TargetNeighborhood.Value();
-        sumss += _SourceNeighborhood.Value() * _SourceNeighborhood.Value();
-        sumts += _TargetNeighborhood.Value() * _SourceNeighborhood.Value();
-        sumtt += _TargetNeighborhood.Value() * _TargetNeighborhood.Value();
-        ++_TargetNeighborhood;
-        ++_SourceNeighborhood;
-        ++cnt;
-      }
-    }
-
-    if (cnt) {
-      const double ms = sums / cnt;
-      const double mt = sumt / cnt;
-      *a = voxel_cast<VoxelType>(sumts - ms * sumt - mt * sums + cnt * ms * mt); // <T, S>
-      *b = voxel_cast<VoxelType>(sumss -       2.0 * ms * sums + cnt * ms * ms); // <S, S>
-      *c = voxel_cast<VoxelType>(sumtt -       2.0 * mt * sumt + cnt * mt * mt); // <T, T>
-      *s = voxel_cast<VoxelType>((*src) - ms);
-      *t = voxel_cast<VoxelType>((*tgt) - mt);
-    } else {
-      *a = *b = *c = *s = *t = voxel_cast<VoxelType>(.0);
-    }
-  }
-};
-
 // -----------------------------------------------------------------------------
 struct EvaluateBoxWindowLNCC : public VoxelReduction
 {
@@ -475,6 +422,252 @@ bool operator ==(const blocked_range3d<int> a, const blocked_range3d<int> &b)
          a.rows ().begin() == b.rows ().begin() && a.rows ().end() == b.rows ().end();
 }
 
+// -----------------------------------------------------------------------------
+/// Local sums of t, s, tt, ss, and ts within box windows along x, where t and
+/// s are the target and source intensities, respectively
+///
+/// The local sums of the image region are stored in separate arrays of the
+/// size of this region. They are computed for each row of the region using
+/// prefix sums, such that the cost per voxel is independent of the window size.
+/// Windows are clipped at the boundary of the region.
+struct ComputeBoxWindowSumsX
+{
+  typedef RegisteredImage::VoxelType InputType;
+
+  const InputType *_Target;
+  const InputType *_Source;
+  RealType * const *_Sum;
+  int _X, _Y;
+  int _I0, _J0, _K0;
+  int _NX, _NY;
+  int _Radius;
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    Array<double> prefix(5 * (_NX + 1));
+    double *pt  = prefix.data();
+    double *ps  = pt  + _NX + 1;
+    double *ptt = ps  + _NX + 1;
+    double *pss = ptt + _NX + 1;
+    double *pts = pss + _NX + 1;
+    pt[0] = ps[0] = ptt[0] = pss[0] = pts[0] = .0;
+    for (int row = re.begin(); row != re.end(); ++row) {
+      const int j = _J0 + row % _NY;
+      const int k = _K0 + row / _NY;
+      const int offset = (k * _Y + j) * _X + _I0;
+      const InputType *tgt = _Target + offset;
+      const InputType *src = _Source + offset;
+      for (int n = 0; n < _NX; ++n) {
+        const double t = static_cast<double>(tgt[n]);
+        const double s = static_cast<double>(src[n]);
+        pt [n+1] = pt [n] + t;
+        ps [n+1] = ps [n] + s;
+        ptt[n+1] = ptt[n] + t * t;
+        pss[n+1] = pss[n] + s * s;
+        pts[n+1] = pts[n] + t * s;
+      }
+      RealType *sum[5];
+      for (int m = 0; m < 5; ++m) sum[m] = _Sum[m] + row * _NX;
+      for (int n = 0; n < _NX; ++n) {
+        const int n1 = max(0, n - _Radius);
+        const int n2 = min(_NX, n + _Radius + 1);
+        sum[0][n] = static_cast<RealType>(pt [n2] - pt [n1]);
+        sum[1][n] = static_cast<RealType>(ps [n2] - ps [n1]);
+        sum[2][n] = static_cast<RealType>(ptt[n2] - ptt[n1]);
+        sum[3][n] = static_cast<RealType>(pss[n2] - pss[n1]);
+        sum[4][n] = static_cast<RealType>(pts[n2] - pts[n1]);
+      }
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Sum rows of 2D arrays within windows along y using running sums
+///
+/// Used to sum along the y axis of each slice, and along the z axis of each
+/// set of rows with equal y index, where \c _Stride is the number of elements
+/// between consecutive rows and \c _Step the offset from one slice (or set of
+/// rows) to the next.
+struct ComputeBoxWindowSumsY
+{
+  RealType * const *_Sum;
+  int _NX, _NY;
+  int _Stride;
+  int _Step;
+  int _Radius;
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    Array<double> acc (_NX);
+    Array<double> copy(static_cast<size_t>(_NX) * _NY);
+    for (int k = re.begin(); k != re.end(); ++k) {
+      for (int m = 0; m < 5; ++m) {
+        RealType *sum = _Sum[m] + k * _Step;
+        for (int j = 0; j < _NY; ++j) {
+          const RealType *row = sum + j * _Stride;
+          double         *cpy = copy.data() + j * _NX;
+          for (int i = 0; i < _NX; ++i) cpy[i] = static_cast<double>(row[i]);
+        }
+        for (int i = 0; i < _NX; ++i) acc[i] = .0;
+        for (int j = 0, j2 = min(_Radius, _NY - 1); j <= j2; ++j) {
+          const double *cpy = copy.data() + j * _NX;
+          for (int i = 0; i < _NX; ++i) acc[i] += cpy[i];
+        }
+        for (int j = 0; j < _NY; ++j) {
+          if (j > 0) {
+            const int j1 = j - _Radius - 1;
+            const int j2 = j + _Radius;
+            if (j1 >= 0) {
+              const double *cpy = copy.data() + j1 * _NX;
+              for (int i = 0; i < _NX; ++i) acc[i] -= cpy[i];
+            }
+            if (j2 < _NY) {
+              const double *cpy = copy.data() + j2 * _NX;
+              for (int i = 0; i < _NX; ++i) acc[i] += cpy[i];
+            }
+          }
+          RealType *row = sum + j * _Stride;
+          for (int i = 0; i < _NX; ++i) row[i] = static_cast<RealType>(acc[i]);
+        }
+      }
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Compute normalized inner products of box window LNCC from local sums
+struct EvaluateBoxWindowSums
+{
+  typedef RegisteredImage::VoxelType InputType;
+
+  const NormalizedIntensityCrossCorrelation *_This;
+  const InputType  *_Target;
+  const InputType  *_Source;
+  const RealType * const *_Sum;
+  RealType *_A, *_B, *_C, *_S, *_T;
+  int _X, _Y, _Z;
+  int _I0, _J0, _K0;
+  int _NX, _NY;
+  Vector3D<int> _Radius;
+
+  void operator ()(const blocked_range3d<int> &re) const
+  {
+    for (int k = re.pages().begin(); k != re.pages().end(); ++k) {
+      const int nk = min(_Z - 1, k + _Radius._z) - max(0, k - _Radius._z) + 1;
+      for (int j = re.rows().begin(); j != re.rows().end(); ++j) {
+        const int nj = min(_Y - 1, j + _Radius._y) - max(0, j - _Radius._y) + 1;
+        for (int i = re.cols().begin(); i != re.cols().end(); ++i) {
+          const int idx = (k * _Y + j) * _X + i;
+          if (_This->IsForeground(i, j, k)) {
+            const int ni  = min(_X - 1, i + _Radius._x) - max(0, i - _Radius._x) + 1;
+            const int cnt = ni * nj * nk;
+            const int n   = ((k - _K0) * _NY + (j - _J0)) * _NX + (i - _I0);
+            const double sumt  = static_cast<double>(_Sum[0][n]);
+            const double sums  = static_cast<double>(_Sum[1][n]);
+            const double sumtt = static_cast<double>(_Sum[2][n]);
+            const double sumss = static_cast<double>(_Sum[3][n]);
+            const double sumts = static_cast<double>(_Sum[4][n]);
+            const double ms = sums / cnt;
+            const double mt = sumt / cnt;
+            _A[idx] = voxel_cast<RealType>(sumts - ms * sumt - mt * sums + cnt * ms * mt); // <T, S>
+            _B[idx] = voxel_cast<RealType>(sumss -       2.0 * ms * sums + cnt * ms * ms); // <S, S>
+            _C[idx] = voxel_cast<RealType>(sumtt -       2.0 * mt * sumt + cnt * mt * mt); // <T, T>
+            _S[idx] = voxel_cast<RealType>(static_cast<double>(_Source[idx]) - ms);
+            _T[idx] = voxel_cast<RealType>(static_cast<double>(_Target[idx]) - mt);
+          } else {
+            _A[idx] = _B[idx] = _C[idx] = _S[idx] = _T[idx] = voxel_cast<RealType>(.0);
+          }
+        }
+      }
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Update normalized inner products of box window LNCC within image region
+///
+/// The local sums of t, s, tt, ss, and ts are computed separably using running
+/// sums along each dimension, such that the cost is independent of the window
+/// size. When the region is the entire image, the intermediate images a, b,
+/// c, s, and t themselves are used to store the local sums. Otherwise, these
+/// are stored in temporary buffers, even when the region extended by the
+/// window radius covers the entire image, because the values of the voxels
+/// outside the region must remain unmodified.
+void UpdateBoxWindowLNCC(const NormalizedIntensityCrossCorrelation *sim,
+                         const blocked_range3d<int> &region,
+                         RealImage *a, RealImage *b, RealImage *c, RealImage *s, RealImage *t)
+{
+  const ImageAttributes &attr   = a->Attributes();
+  const Vector3D<int>   &radius = sim->NeighborhoodRadius();
+
+  // Region of voxels within the box windows of the voxels of the given region
+  const blocked_range3d<int> domain(0, attr._z, 0, attr._y, 0, attr._x);
+  const blocked_range3d<int> input = ExtendedRegion(region, attr, radius);
+  const int i0 = input.cols ().begin(), nx = input.cols ().end() - i0;
+  const int j0 = input.rows ().begin(), ny = input.rows ().end() - j0;
+  const int k0 = input.pages().begin(), nz = input.pages().end() - k0;
+  if (nx <= 0 || ny <= 0 || nz <= 0) return;
+
+  // Memory for local sums of t, s, tt, ss, and ts
+  RealType *sum[5];
+  Array<RealType> memory;
+  if (region == domain) {
+    sum[0] = t->Data(), sum[1] = s->Data();
+    sum[2] = c->Data(), sum[3] = b->Data(), sum[4] = a->Data();
+  } else {
+    const size_t n = static_cast<size_t>(nx) * ny * nz;
+    memory.resize(5 * n);
+    for (int m = 0; m < 5; ++m) sum[m] = memory.data() + m * n;
+  }
+
+  // Sum along x
+  ComputeBoxWindowSumsX sumx;
+  sumx._Target = sim->Target()->Data();
+  sumx._Source = sim->Source()->Data();
+  sumx._Sum    = sum;
+  sumx._X      = attr._x,  sumx._Y  = attr._y;
+  sumx._I0     = i0, sumx._J0 = j0, sumx._K0 = k0;
+  sumx._NX     = nx, sumx._NY = ny;
+  sumx._Radius = radius._x;
+  parallel_for(blocked_range<int>(0, ny * nz), sumx);
+
+  // Sum along y within each slice
+  if (radius._y > 0 && ny > 1) {
+    ComputeBoxWindowSumsY sumy;
+    sumy._Sum    = sum;
+    sumy._NX     = nx, sumy._NY = ny;
+    sumy._Stride = nx;
+    sumy._Step   = nx * ny;
+    sumy._Radius = radius._y;
+    parallel_for(blocked_range<int>(0, nz), sumy);
+  }
+
+  // Sum along z within each set of rows with equal y index
+  if (radius._z > 0 && nz > 1) {
+    ComputeBoxWindowSumsY sumz;
+    sumz._Sum    = sum;
+    sumz._NX     = nx, sumz._NY = nz;
+    sumz._Stride = nx * ny;
+    sumz._Step   = nx;
+    sumz._Radius = radius._z;
+    parallel_for(blocked_range<int>(0, ny), sumz);
+  }
+
+  // Compute normalized inner products from local sums
+  EvaluateBoxWindowSums eval;
+  eval._This   = sim;
+  eval._Target = sim->Target()->Data();
+  eval._Source = sim->Source()->Data();
+  eval._Sum    = sum;
+  eval._A      = a->Data(), eval._B = b->Data(), eval._C = c->Data();
+  eval._S      = s->Data(), eval._T = t->Data();
+  eval._X      = attr._x, eval._Y = attr._y, eval._Z = attr._z;
+  eval._I0     = i0, eval._J0 = j0, eval._K0 = k0;
+  eval._NX     = nx, eval._NY = ny;
+  eval._Radius = radius;
+  parallel_for(region, eval);
+}
+
 // -----------------------------------------------------------------------------
 void GetMargin(const RealImage            *in,
                const blocked_range3d<int> &region1,
@@ -539,9 +732,9 @@ NormalizedIntensityCrossCorrelation
 :
   ImageSimilarity(other),
   _KernelType(other._KernelType),
-  _KernelX(other._KernelX ? new RealImage(*other._KernelX) : NULL),
-  _KernelY(other._KernelY ? new RealImage(*other._KernelY) : NULL),
-  _KernelZ(other._KernelZ ? new RealImage(*other._KernelZ) : NULL),
+  _KernelX(other._KernelX ? new KernelImage(*other._KernelX) : NULL),
+  _KernelY(other._KernelY ? new KernelImage(*other._KernelY) : NULL),
+  _KernelZ(other._KernelZ ? new KernelImage(*other._KernelZ) : NULL),
   _A      (other._A       ? new RealImage(*other._A      ) : NULL),
   _B      (other._B       ? new RealImage(*other._B      ) : NULL),
   _C      (other._C       ? new RealImage(*other._C      ) : NULL),
@@ -788,7 +981,7 @@ void NormalizedIntensityCrossCorrelation::ClearKernel()
 }
 
 // -----------------------------------------------------------------------------
-NormalizedIntensityCrossCorrelation::RealImage *
+NormalizedIntensityCrossCorrelation::KernelImage *
 NormalizedIntensityCrossCorrelation::CreateGaussianKernel(double sigma)
 {
   // Ignore sign of standard deviation parameter (negative --> voxel units)
@@ -798,11 +991,11 @@ NormalizedIntensityCrossCorrelation::CreateGaussianKernel(double sigma)
   ScalarGaussian func(sigma, 1, 1, 0, 0, 0);
 
   // Create filter kernel for 1D Gaussian function
-  const int  size   = 2 * static_cast<int>(3.0 * sigma) + 1;
-  RealImage *kernel = new RealImage(size, 1, 1);
+  const int    size   = 2 * static_cast<int>(3.0 * sigma) + 1;
+  KernelImage *kernel = new KernelImage(size, 1, 1);
 
   // Sample scalar function at discrete kernel positions
-  ScalarFunctionToImage<RealType> sampler;
+  ScalarFunctionToImage<RealPixel> sampler;
   sampler.Input (&func);
   sampler.Output(kernel);
   sampler.Run();
@@ -815,16 +1008,16 @@ void NormalizedIntensityCrossCorrelation
 ::ComputeWeightedAverage(const blocked_range3d<int> &region, RealImage *image)
 {
   // Average along x axis
-  ConvolveTruncatedForegroundInX<RealType> convX(image, _KernelX->Data(), _KernelX->X());
+  ConvolveTruncatedForegroundInX<RealPixel> convX(image, _KernelX->Data(), _KernelX->X());
   ParallelForEachVoxel(region, image, &_Temp, convX);
 
   // Average along y axis
-  ConvolveTruncatedForegroundInY<RealType> convY(image, _KernelY->Data(), _KernelY->X());
+  ConvolveTruncatedForegroundInY<RealPixel> convY(image, _KernelY->Data(), _KernelY->X());
   ParallelForEachVoxel(region, &_Temp, image, convY);
 
   // Average along z axis
   if (_KernelZ) {
-    ConvolveTruncatedForegroundInZ<RealType> convZ(image, _KernelZ->Data(), _KernelZ->X());
+    ConvolveTruncatedForegroundInZ<RealPixel> convZ(image, _KernelZ->Data(), _KernelZ->X());
     ParallelForEachVoxel(region, image, &_Temp, convZ);
     ParallelForEachVoxel(BinaryVoxelFunction::Copy(), region, &_Temp, image);
   }
@@ -863,6 +1056,12 @@ void NormalizedIntensityCrossCorrelation::Initialize()
   // Clear previous kernel
   ClearKernel();
 
+  // Local statistics require the moving image intensities of all voxels
+  if (IsSampling()) {
+    Broadcast(LogEvent, "LNCC does not support voxel sampling, using all voxels\n");
+    _SamplingMethod = NoSampling;
+  }
+
   // Initialize base class
   ImageSimilarity::Initialize();
 
@@ -948,8 +1147,7 @@ void NormalizedIntensityCrossCorrelation::Update(bool gradient)
   if (_KernelType == BoxWindow) {
 
     // Compute dot products
-    UpdateBoxWindowLNCC<RealType> update(this);
-    ParallelForEachVoxel(domain, _Target, _Source, _A, _B, _C, _S, _T, update);
+    UpdateBoxWindowLNCC(this, domain, _A, _B, _C, _S, _T);
     // Evaluate LNCC value
     EvaluateBoxWindowLNCC cc;
     ParallelForEachVoxel(domain, _A, _B, _C, cc);
@@ -1018,8 +1216,7 @@ void NormalizedIntensityCrossCorrelation::Include(const blocked_range3d<int> &re
   if (_KernelType == BoxWindow) {
 
     // Compute dot products
-    UpdateBoxWindowLNCC<RealType> update(this);
-    ParallelForEachVoxel(region, _Target, _Source, _A, _B, _C, _S, _T, update);
+    UpdateBoxWindowLNCC(this, region, _A, _B, _C, _S, _T);
     // Add LNCC values for specified region
     EvaluateBoxWindowLNCC cc;
     ParallelForEachVoxel(region, _A, _B, _C, cc);
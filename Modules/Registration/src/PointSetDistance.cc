@@ -208,6 +208,15 @@ void PointSetDistance::Update(bool)
   _InitialUpdate = false;
 }
 
+// -----------------------------------------------------------------------------
+bool PointSetDistance::Dependencies(Array<const void *> &deps) const
+{
+  deps.clear();
+  deps.push_back(_Target);
+  deps.push_back(_Source);
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 void PointSetDistance
 ::ParametricGradient(const RegisteredPointSet *wrt_pset,
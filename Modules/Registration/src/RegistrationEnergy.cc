@@ -21,11 +21,13 @@
 
 #include "mirtk/Math.h"
 #include "mirtk/Memory.h"
+#include "mirtk/Algorithm.h"
 #include "mirtk/Parallel.h"
 #include "mirtk/Profiling.h"
 
 #include "mirtk/FreeFormTransformation.h"
 #include "mirtk/MultiLevelTransformation.h"
+#include "mirtk/BSplineFreeFormTransformationSV.h"
 
 #include "mirtk/SparsityConstraint.h"
 
@@ -142,6 +144,118 @@ public:
   }
 };
 
+// -----------------------------------------------------------------------------
+/// Update groups of energy terms concurrently
+class UpdateEnergyTerms
+{
+private:
+
+  EnergyTerm * const       *_Term;
+  const Array<Array<int> > &_Groups;
+  bool                      _Gradient;
+
+public:
+
+  /// Constructor
+  UpdateEnergyTerms(EnergyTerm * const *terms, const Array<Array<int> > &groups, bool gradient)
+  :
+    _Term(terms), _Groups(groups), _Gradient(gradient)
+  {}
+
+  /// Update energy terms of specified groups
+  void operator ()(const blocked_range<int> &re) const
+  {
+    for (int g = re.begin(); g != re.end(); ++g) {
+      for (size_t n = 0; n < _Groups[g].size(); ++n) {
+        EnergyTerm * const term = _Term[_Groups[g][n]];
+        MIRTK_PROFILE_ZONE("update of " << (term->Name().empty() ? term->NameOfClass() : term->Name().c_str()));
+        term->Update(_Gradient);
+        term->ResetValue(); // in case energy term does not do this
+      }
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Evaluate groups of energy terms concurrently
+class EvaluateEnergyTerms
+{
+private:
+
+  EnergyTerm * const       *_Term;
+  const Array<Array<int> > &_Groups;
+  double                   *_Value;
+  bool                      _Initial;
+
+public:
+
+  /// Constructor
+  EvaluateEnergyTerms(EnergyTerm * const *terms, const Array<Array<int> > &groups,
+                      double *values, bool initial = false)
+  :
+    _Term(terms), _Groups(groups), _Value(values), _Initial(initial)
+  {}
+
+  /// Evaluate energy terms of specified groups
+  void operator ()(const blocked_range<int> &re) const
+  {
+    for (int g = re.begin(); g != re.end(); ++g) {
+      for (size_t n = 0; n < _Groups[g].size(); ++n) {
+        const int i = _Groups[g][n];
+        _Value[i] = (_Initial ? _Term[i]->InitialValue() : _Term[i]->Value());
+      }
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+/// Evaluate gradients of groups of energy terms concurrently
+class EvaluateEnergyTermGradients
+{
+private:
+
+  EnergyTerm * const       *_Term;
+  const Array<Array<int> > &_Groups;
+  double * const           *_Gradient;
+  double                    _Step;
+  double                    _TotalWeight;
+
+public:
+
+  /// Constructor
+  ///
+  /// \param[in] terms    Energy terms.
+  /// \param[in] groups   Groups of energy terms to process sequentially.
+  /// \param[in] gradient Separate gradient buffer of each energy term.
+  /// \param[in] step     Step length for finite differences.
+  /// \param[in] W        Sum of energy term weights used to normalize the
+  ///                     gradient of each term or zero if not normalized.
+  EvaluateEnergyTermGradients(EnergyTerm * const *terms, const Array<Array<int> > &groups,
+                              double * const *gradient, double step, double W)
+  :
+    _Term(terms), _Groups(groups), _Gradient(gradient), _Step(step), _TotalWeight(W)
+  {}
+
+  /// Evaluate gradients of energy terms of specified groups
+  void operator ()(const blocked_range<int> &re) const
+  {
+    for (int g = re.begin(); g != re.end(); ++g) {
+      for (size_t n = 0; n < _Groups[g].size(); ++n) {
+        const int i = _Groups[g][n];
+        EnergyTerm * const term = _Term[i];
+        if (_TotalWeight) {
+          const double w = term->Weight();
+          term->Weight(w / _TotalWeight);
+          term->NormalizedGradient(_Gradient[i], _Step);
+          term->Weight(w);
+        } else {
+          term->Gradient(_Gradient[i], _Step);
+        }
+      }
+    }
+  }
+};
+
 // =============================================================================
 // Construction/Destruction
 // =============================================================================
@@ -151,10 +265,12 @@ RegistrationEnergy::RegistrationEnergy()
 :
   _Transformation    (NULL),
   _NormalizeGradients(false),
-  _Preconditioning   (.0)
+  _Preconditioning   (.0),
+  _ConcurrentTerms   (false),
+  _DeferLog          (false)
 {
   // Bind broadcast method to energy term events
-  _EventDelegate.Bind(LogEvent, MakeDelegate(this, &Observable::Broadcast));
+  _EventDelegate.Bind(LogEvent, MakeDelegate(this, &RegistrationEnergy::ForwardEvent));
 }
 
 // -----------------------------------------------------------------------------
@@ -282,6 +398,94 @@ EnergyTerm *RegistrationEnergy::Term(int i)
   return _Term[i];
 }
 
+// -----------------------------------------------------------------------------
+void RegistrationEnergy::GroupTerms(Array<Array<int> > &groups, bool gradient) const
+{
+  const int nterms = NumberOfTerms();
+
+  // The stationary velocity field model caches the derivative of the displacements
+  // w.r.t. its parameters upon first gradient evaluation after a change
+  const bool cache = gradient && dynamic_cast<const BSplineFreeFormTransformationSV *>(_Transformation);
+
+  // Collect shared objects modified by each active energy term. Terms which
+  // cannot be processed concurrently depend on this energy function instead.
+  Array<Array<const void *> > deps(nterms);
+  Array<int>                  label(nterms, -1);
+  for (int i = 0; i < nterms; ++i) {
+    if (_Term[i]->Weight() == .0) continue;
+    if (gradient && dynamic_cast<const SparsityConstraint *>(_Term[i])) continue;
+    if (!_Term[i]->Dependencies(deps[i])) deps[i].push_back(this);
+    if (cache) deps[i].push_back(_Transformation);
+    label[i] = i;
+  }
+
+  // Merge groups of terms which have a dependency in common
+  for (int i = 0; i < nterms; ++i) {
+    if (label[i] < 0) continue;
+    for (int j = 0; j < i; ++j) {
+      if (label[j] < 0 || label[j] == label[i]) continue;
+      for (size_t k = 0; k < deps[i].size(); ++k) {
+        if (std::find(deps[j].begin(), deps[j].end(), deps[i][k]) != deps[j].end()) {
+          const int old_label = label[j];
+          for (int n = 0; n <= i; ++n) {
+            if (label[n] == old_label) label[n] = label[i];
+          }
+          break;
+        }
+      }
+    }
+  }
+
+  // Indices of terms in each group in order of the first term of each group
+  groups.clear();
+  Array<int> group(nterms, -1);
+  for (int i = 0; i < nterms; ++i) {
+    if (label[i] < 0) continue;
+    int &g = group[label[i]];
+    if (g < 0) {
+      g = static_cast<int>(groups.size());
+      groups.push_back(Array<int>());
+    }
+    groups[g].push_back(i);
+  }
+}
+
+// -----------------------------------------------------------------------------
+void RegistrationEnergy::DeferLog()
+{
+  _DeferredLog.clear();
+  _DeferredLog.resize(_Term.size());
+  _DeferLog = true;
+}
+
+// -----------------------------------------------------------------------------
+void RegistrationEnergy::BroadcastDeferredLog()
+{
+  _DeferLog = false;
+  for (size_t i = 0; i < _DeferredLog.size(); ++i) {
+    for (size_t n = 0; n < _DeferredLog[i].size(); ++n) {
+      Broadcast(LogEvent, _DeferredLog[i][n].c_str());
+    }
+  }
+  _DeferredLog.clear();
+}
+
+// -----------------------------------------------------------------------------
+void RegistrationEnergy::ForwardEvent(Observable *obj, Event event, const void *data)
+{
+  // Each term is processed by only one thread at a time, such that messages
+  // can be appended to its own list of deferred messages without a lock
+  if (_DeferLog) {
+    for (size_t i = 0; i < _Term.size(); ++i) {
+      if (_Term[i] == obj) {
+        _DeferredLog[i].push_back(reinterpret_cast<const char *>(data));
+        return;
+      }
+    }
+  }
+  Broadcast(event, data);
+}
+
 // =============================================================================
 // Parameters
 // =============================================================================
@@ -294,6 +498,8 @@ bool RegistrationEnergy::Set(const char *name, const char *value)
     return FromString(value, _NormalizeGradients);
   } else if (strcmp(name, "Energy preconditioning") == 0) {
     return FromString(value, _Preconditioning);
+  } else if (strcmp(name, "Evaluate energy terms concurrently") == 0) {
+    return FromString(value, _ConcurrentTerms);
   }
   // Default length of gradient approximation steps
   if (strcmp(name, "Length of steps")         == 0 ||
@@ -317,6 +523,7 @@ ParameterList RegistrationEnergy::Parameter() const
   }
   Insert(params, "Normalize energy gradients (experimental)", ToString(_NormalizeGradients));
   Insert(params, "Energy preconditioning",                    ToString(_Preconditioning));
+  Insert(params, "Evaluate energy terms concurrently",        ToString(_ConcurrentTerms));
   return params;
 }
 
@@ -359,16 +566,26 @@ void RegistrationEnergy::Update(bool gradient)
   // to just use an external update handler which has a reference to all the
   // input moving images and updates them all at once in predefined order.
   if (_Transformation->Changed() || gradient) {
-    MIRTK_START_TIMING();
-    for (size_t i = 0; i < _Term.size(); ++i) {
-      if (_Term[i]->Weight() != .0) {
-        _Term[i]->Update(gradient);
-        _Term[i]->ResetValue(); // in case energy term does not do this
+    MIRTK_PROFILE_ZONE("update of energy function");
+    if (_ConcurrentTerms) {
+      Array<Array<int> > groups;
+      this->GroupTerms(groups);
+      UpdateEnergyTerms update(_Term.data(), groups, gradient);
+      DeferLog();
+      parallel_for(blocked_range<int>(0, static_cast<int>(groups.size()), 1), update);
+      BroadcastDeferredLog();
+    } else {
+      for (size_t i = 0; i < _Term.size(); ++i) {
+        if (_Term[i]->Weight() != .0) {
+          const string &name = _Term[i]->Name();
+          MIRTK_PROFILE_ZONE("update of " << (name.empty() ? _Term[i]->NameOfClass() : name.c_str()));
+          _Term[i]->Update(gradient);
+          _Term[i]->ResetValue(); // in case energy term does not do this
+        }
       }
     }
     // Mark transformation as unchanged
     _Transformation->Changed(false);
-    MIRTK_DEBUG_TIMING(3, "update of energy function");
   }
 }
 
@@ -437,11 +654,25 @@ double RegistrationEnergy::RawValue(int i)
 // -----------------------------------------------------------------------------
 double RegistrationEnergy::InitialValue()
 {
-  MIRTK_START_TIMING();
+  MIRTK_PROFILE_ZONE("initial evaluation of energy function");
+
+  Array<double> values(_Term.size(), .0);
+  if (_ConcurrentTerms) {
+    Array<Array<int> > groups;
+    this->GroupTerms(groups);
+    EvaluateEnergyTerms eval(_Term.data(), groups, values.data(), true);
+    DeferLog();
+    parallel_for(blocked_range<int>(0, static_cast<int>(groups.size()), 1), eval);
+    BroadcastDeferredLog();
+  } else {
+    for (size_t i = 0; i < _Term.size(); ++i) {
+      if (_Term[i]->Weight() != .0) values[i] = _Term[i]->InitialValue();
+    }
+  }
 
   double value, sum = .0;
   for (size_t i = 0; i < _Term.size(); ++i) {
-    value = (_Term[i]->Weight() != .0 ? _Term[i]->InitialValue() : .0);
+    value = values[i];
     if (IsNaN(value)) {
       string name = _Term[i]->Name();
       if (name.empty()) name = ToString(i + 1);
@@ -450,8 +681,6 @@ double RegistrationEnergy::InitialValue()
     }
     sum += value;
   }
-
-  MIRTK_DEBUG_TIMING(3, "initial evaluation of energy function");
   return sum;
 }
 
@@ -464,11 +693,25 @@ double RegistrationEnergy::InitialValue(int i)
 // -----------------------------------------------------------------------------
 double RegistrationEnergy::Value()
 {
-  MIRTK_START_TIMING();
+  MIRTK_PROFILE_ZONE("evaluation of energy function");
+
+  Array<double> values(_Term.size(), .0);
+  if (_ConcurrentTerms) {
+    Array<Array<int> > groups;
+    this->GroupTerms(groups);
+    EvaluateEnergyTerms eval(_Term.data(), groups, values.data(), false);
+    DeferLog();
+    parallel_for(blocked_range<int>(0, static_cast<int>(groups.size()), 1), eval);
+    BroadcastDeferredLog();
+  } else {
+    for (size_t i = 0; i < _Term.size(); ++i) {
+      if (_Term[i]->Weight() != .0) values[i] = _Term[i]->Value();
+    }
+  }
 
   double value, sum = .0;
   for (size_t i = 0; i < _Term.size(); ++i) {
-    value = (_Term[i]->Weight() != .0 ? _Term[i]->Value() : .0);
+    value = values[i];
     if (IsNaN(value)) {
       string name = _Term[i]->Name();
       if (name.empty()) name = ToString(i + 1);
@@ -477,8 +720,6 @@ double RegistrationEnergy::Value()
     }
     sum += value;
   }
-
-  MIRTK_DEBUG_TIMING(3, "evaluation of energy function");
   return sum;
 }
 
@@ -532,7 +773,7 @@ void RegistrationEnergy::NormalizeGradient(double *gradient)
 // -----------------------------------------------------------------------------
 void RegistrationEnergy::Gradient(double *gradient, double step, bool *sgn_chg)
 {
-  MIRTK_START_TIMING();
+  MIRTK_PROFILE_ZONE("evaluation of energy gradient");
 
   const int ndofs = _Transformation->NumberOfDOFs();
   SparsityConstraint *sparsity;
@@ -552,8 +793,8 @@ void RegistrationEnergy::Gradient(double *gradient, double step, bool *sgn_chg)
   // excl. sparsity constraint which has to be added last,
   // such that it can determine whether or not the sparsity
   // gradient changes the sign of the energy gradient.
+  double w, W = .0;
   if (_NormalizeGradients) {
-    double w, W = .0;
     for (size_t i = 0; i < _Term.size(); ++i) {
       sparsity = dynamic_cast<SparsityConstraint *>(_Term[i]);
       if (sparsity) continue;
@@ -563,6 +804,30 @@ void RegistrationEnergy::Gradient(double *gradient, double step, bool *sgn_chg)
       cerr << "RegistrationEnergy::Gradient: All energy terms have zero weight!" << endl;
       exit(1);
     }
+  }
+  if (_ConcurrentTerms) {
+    Array<Array<int> > groups;
+    this->GroupTerms(groups, true);
+    Array<double *> grad(_Term.size(), NULL);
+    for (size_t g = 0; g < groups.size(); ++g) {
+      for (size_t n = 0; n < groups[g].size(); ++n) {
+        grad[groups[g][n]] = CAllocate<double>(ndofs);
+      }
+    }
+    EvaluateEnergyTermGradients eval(_Term.data(), groups, grad.data(), step, W);
+    DeferLog();
+    parallel_for(blocked_range<int>(0, static_cast<int>(groups.size()), 1), eval);
+    BroadcastDeferredLog();
+    // Sum in the order of the terms such that the result does not depend on
+    // the scheduling of the groups. It may still differ from the serial
+    // evaluation in the last bits due to the different order of additions.
+    for (size_t i = 0; i < _Term.size(); ++i) {
+      if (grad[i]) {
+        for (int dof = 0; dof < ndofs; ++dof) gradient[dof] += grad[i][dof];
+        Deallocate(grad[i]);
+      }
+    }
+  } else if (_NormalizeGradients) {
     for (size_t i = 0; i < _Term.size(); ++i) {
       w = _Term[i]->Weight();
       if (w != .0) {
@@ -613,8 +878,6 @@ void RegistrationEnergy::Gradient(double *gradient, double step, bool *sgn_chg)
     }
   }
 #endif
-
-  MIRTK_DEBUG_TIMING(3, "evaluation of energy gradient");
 }
 
 // -----------------------------------------------------------------------------
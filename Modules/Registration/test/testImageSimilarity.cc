@@ -0,0 +1,183 @@
+/*
+ * Medical Image Registration ToolKit (MIRTK)
+ *
+ * Copyright 2026 Imperial College London
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include "mirtk/SumOfSquaredIntensityDifferences.h"
+
+#include "mirtk/GenericImage.h"
+#include "mirtk/RegisteredImage.h"
+#include "mirtk/RigidTransformation.h"
+
+using namespace mirtk;
+
+// ===========================================================================
+// Helper
+// ===========================================================================
+
+// ---------------------------------------------------------------------------
+/// Registered images and similarity term of which voxels are sampled
+struct SamplingTest : public ::testing::Test
+{
+  ImageAttributes                  _Attr;
+  GenericImage<double>             _TargetImage;
+  GenericImage<double>             _SourceImage;
+  BinaryImage                      _Mask;
+  RigidTransformation              _Transformation;
+  RegisteredImage                  _Target;
+  RegisteredImage                  _Source;
+  SumOfSquaredIntensityDifferences _Similarity;
+  int                              _NumberOfMaskedVoxels;
+
+  SamplingTest()
+  :
+    _Attr(40, 32, 24),
+    _TargetImage(_Attr),
+    _SourceImage(_Attr),
+    _Mask(_Attr),
+    _NumberOfMaskedVoxels(0)
+  {
+    for (int k = 0; k < _Attr._z; ++k)
+    for (int j = 0; j < _Attr._y; ++j)
+    for (int i = 0; i < _Attr._x; ++i) {
+      _TargetImage(i, j, k) = 1.0 + i + j * k;
+      _SourceImage(i, j, k) = 1.0 + j + i * k;
+      // Spherical region of interest, excluding an inner cube
+      const double x = i - .5 * _Attr._x;
+      const double y = j - .5 * _Attr._y;
+      const double z = k - .5 * _Attr._z;
+      const bool inside = (x * x + y * y + z * z < 144.0) &&
+                          !(fabs(x) < 4.0 && fabs(y) < 4.0 && fabs(z) < 4.0);
+      _Mask(i, j, k) = static_cast<BinaryPixel>(inside);
+      if (inside) ++_NumberOfMaskedVoxels;
+    }
+    _Target.InputImage(&_TargetImage);
+    _Source.InputImage(&_SourceImage);
+    _Source.Transformation(&_Transformation);
+    _Similarity.Target(&_Target);
+    _Similarity.Source(&_Source);
+    _Similarity.Domain(_Attr);
+    _Similarity.Mask(&_Mask);
+    _Similarity.SamplingFraction(.25);
+    _Similarity.SamplingSeed(7);
+  }
+
+  /// Initialize similarity and draw first voxel samples
+  void Sample(enum ImageSimilarity::SamplingMethod method)
+  {
+    _Similarity.SamplingMethod(method);
+    _Similarity.Initialize();
+    _Similarity.Update(false);
+  }
+
+  /// Number of sampled voxels
+  int NumberOfSamples() const
+  {
+    const BinaryImage *samples = _Similarity.SampleMask();
+    int n = 0;
+    for (int idx = 0; idx < samples->NumberOfVoxels(); ++idx) {
+      if (samples->Get(idx)) ++n;
+    }
+    return n;
+  }
+
+  /// Number of sampled voxels outside the mask
+  int NumberOfSamplesOutsideMask() const
+  {
+    const BinaryImage *samples = _Similarity.SampleMask();
+    int n = 0;
+    for (int idx = 0; idx < samples->NumberOfVoxels(); ++idx) {
+      if (samples->Get(idx) && !_Mask.Get(idx)) ++n;
+    }
+    return n;
+  }
+};
+
+// ===========================================================================
+// Tests
+// ===========================================================================
+
+// ---------------------------------------------------------------------------
+TEST_F(SamplingTest, NoSampling)
+{
+  Sample(ImageSimilarity::NoSampling);
+  EXPECT_FALSE(_Similarity.IsSampling());
+  EXPECT_TRUE(_Similarity.SampleMask() == nullptr);
+}
+
+// ---------------------------------------------------------------------------
+TEST_F(SamplingTest, RandomSampling)
+{
+  Sample(ImageSimilarity::RandomSampling);
+  ASSERT_TRUE(_Similarity.SampleMask() != nullptr);
+  EXPECT_EQ(iround(.25 * _NumberOfMaskedVoxels), NumberOfSamples());
+  EXPECT_EQ(0, NumberOfSamplesOutsideMask());
+  // New subset after upgrade, but with same number of samples
+  BinaryImage previous = *_Similarity.SampleMask();
+  EXPECT_TRUE(_Similarity.Upgrade());
+  EXPECT_EQ(iround(.25 * _NumberOfMaskedVoxels), NumberOfSamples());
+  EXPECT_EQ(0, NumberOfSamplesOutsideMask());
+  int ndiff = 0;
+  for (int idx = 0; idx < previous.NumberOfVoxels(); ++idx) {
+    if (previous.Get(idx) != _Similarity.SampleMask()->Get(idx)) ++ndiff;
+  }
+  EXPECT_GT(ndiff, 0);
+}
+
+// ---------------------------------------------------------------------------
+TEST_F(SamplingTest, RandomSamplingIsReproducible)
+{
+  Sample(ImageSimilarity::RandomSampling);
+  BinaryImage first = *_Similarity.SampleMask();
+  Sample(ImageSimilarity::RandomSampling);
+  const BinaryImage *second = _Similarity.SampleMask();
+  int ndiff = 0;
+  for (int idx = 0; idx < first.NumberOfVoxels(); ++idx) {
+    if (first.Get(idx) != second->Get(idx)) ++ndiff;
+  }
+  EXPECT_EQ(0, ndiff);
+}
+
+// ---------------------------------------------------------------------------
+TEST_F(SamplingTest, StratifiedSampling)
+{
+  Sample(ImageSimilarity::StratifiedSampling);
+  ASSERT_TRUE(_Similarity.SampleMask() != nullptr);
+  EXPECT_NEAR(.25, static_cast<double>(NumberOfSamples()) / _NumberOfMaskedVoxels, .02);
+  EXPECT_EQ(0, NumberOfSamplesOutsideMask());
+}
+
+// ---------------------------------------------------------------------------
+TEST_F(SamplingTest, GradientSampling)
+{
+  Sample(ImageSimilarity::GradientSampling);
+  ASSERT_TRUE(_Similarity.SampleMask() != nullptr);
+  EXPECT_NEAR(.25, static_cast<double>(NumberOfSamples()) / _NumberOfMaskedVoxels, .05);
+  EXPECT_EQ(0, NumberOfSamplesOutsideMask());
+}
+
+// ===========================================================================
+// Main
+// ===========================================================================
+
+// ---------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
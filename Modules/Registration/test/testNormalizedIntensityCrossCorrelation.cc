@@ -0,0 +1,229 @@
+/*
+ * Medical Image Registration ToolKit (MIRTK)
+ *
+ * Copyright 2026 Imperial College London
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include "mirtk/NormalizedIntensityCrossCorrelation.h"
+
+#include "mirtk/GenericImage.h"
+#include "mirtk/RegisteredImage.h"
+
+#include <random>
+
+using namespace mirtk;
+
+// ===========================================================================
+// Helper
+// ===========================================================================
+
+// ---------------------------------------------------------------------------
+/// LNCC with public access to its intermediate images
+class TestLNCC : public NormalizedIntensityCrossCorrelation
+{
+public:
+  using NormalizedIntensityCrossCorrelation::A;
+  using NormalizedIntensityCrossCorrelation::B;
+  using NormalizedIntensityCrossCorrelation::C;
+  using NormalizedIntensityCrossCorrelation::S;
+  using NormalizedIntensityCrossCorrelation::T;
+};
+
+// ---------------------------------------------------------------------------
+/// Box window LNCC of a random image pair with a mask
+struct BoxWindowLNCCTest : public ::testing::Test
+{
+  typedef NormalizedIntensityCrossCorrelation::RealImage RealImage;
+
+  ImageAttributes      _Attr;
+  GenericImage<double> _TargetImage;
+  GenericImage<double> _SourceImage;
+  BinaryImage          _Mask;
+  RegisteredImage      _Target;
+  RegisteredImage      _Source;
+  TestLNCC             _Similarity;
+
+  /// Subregion whose box windows cover the entire image
+  blocked_range3d<int> _Region;
+
+  BoxWindowLNCCTest()
+  :
+    _Attr(14, 12, 10),
+    _TargetImage(_Attr),
+    _SourceImage(_Attr),
+    _Mask(_Attr),
+    _Region(2, 8, 2, 10, 2, 12)
+  {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> noise(.0, 10.0);
+    for (int k = 0; k < _Attr._z; ++k)
+    for (int j = 0; j < _Attr._y; ++j)
+    for (int i = 0; i < _Attr._x; ++i) {
+      _TargetImage(i, j, k) = i + 2 * j + 3 * k + noise(rng);
+      _SourceImage(i, j, k) = 3 * i + j - k + noise(rng);
+      _Mask(i, j, k) = static_cast<BinaryPixel>(i + j + k > 3);
+    }
+    _Target.InputImage(&_TargetImage);
+    _Source.InputImage(&_SourceImage);
+    _Similarity.Target(&_Target);
+    _Similarity.Source(&_Source);
+    _Similarity.Domain(_Attr);
+    _Similarity.Mask(&_Mask);
+    _Similarity.SetKernelToBoxWindow(2, 2, 2, NormalizedIntensityCrossCorrelation::UNITS_Voxel);
+    _Similarity.Initialize();
+    _Similarity.Update(false);
+  }
+
+  /// Compute intermediate images of box window LNCC at a voxel as done
+  /// previously, i.e., by iterating over the voxels in its window
+  void ComputeMoments(int i, int j, int k, double m[5]) const
+  {
+    const Vector3D<int>    &r   = _Similarity.NeighborhoodRadius();
+    const RegisteredImage  *tgt = _Similarity.Target();
+    const RegisteredImage  *src = _Similarity.Source();
+    int    cnt  =  0;
+    double sumt = .0, sums = .0, sumss = .0, sumts = .0, sumtt = .0;
+    if (_Similarity.IsForeground(i, j, k)) {
+      for (int k2 = max(0, k - r._z); k2 <= min(_Attr._z - 1, k + r._z); ++k2)
+      for (int j2 = max(0, j - r._y); j2 <= min(_Attr._y - 1, j + r._y); ++j2)
+      for (int i2 = max(0, i - r._x); i2 <= min(_Attr._x - 1, i + r._x); ++i2) {
+        const double t = tgt->Get(i2, j2, k2);
+        const double s = src->Get(i2, j2, k2);
+        sumt += t, sums += s, sumtt += t * t, sumss += s * s, sumts += t * s;
+        ++cnt;
+      }
+    }
+    if (cnt) {
+      const double ms = sums / cnt;
+      const double mt = sumt / cnt;
+      m[0] = sumts - ms * sumt - mt * sums + cnt * ms * mt;
+      m[1] = sumss -       2.0 * ms * sums + cnt * ms * ms;
+      m[2] = sumtt -       2.0 * mt * sumt + cnt * mt * mt;
+      m[3] = src->Get(i, j, k) - ms;
+      m[4] = tgt->Get(i, j, k) - mt;
+    } else {
+      m[0] = m[1] = m[2] = m[3] = m[4] = .0;
+    }
+  }
+
+  /// Get intermediate images of box window LNCC at a voxel
+  void GetMoments(int i, int j, int k, double m[5])
+  {
+    m[0] = _Similarity.A()->Get(i, j, k);
+    m[1] = _Similarity.B()->Get(i, j, k);
+    m[2] = _Similarity.C()->Get(i, j, k);
+    m[3] = _Similarity.S()->Get(i, j, k);
+    m[4] = _Similarity.T()->Get(i, j, k);
+  }
+
+  /// Whether voxel is inside the given region
+  static bool IsInside(const blocked_range3d<int> &re, int i, int j, int k)
+  {
+    return re.cols ().begin() <= i && i < re.cols ().end() &&
+           re.rows ().begin() <= j && j < re.rows ().end() &&
+           re.pages().begin() <= k && k < re.pages().end();
+  }
+};
+
+/// Tolerance of moments which accounts for single-precision intermediate images
+static const double TOL = 1e-4;
+
+// ===========================================================================
+// Tests
+// ===========================================================================
+
+// ---------------------------------------------------------------------------
+TEST_F(BoxWindowLNCCTest, UpdateMatchesPerVoxelMoments)
+{
+  double m[5], expected[5];
+  for (int k = 0; k < _Attr._z; ++k)
+  for (int j = 0; j < _Attr._y; ++j)
+  for (int i = 0; i < _Attr._x; ++i) {
+    GetMoments(i, j, k, m);
+    ComputeMoments(i, j, k, expected);
+    for (int n = 0; n < 5; ++n) {
+      ASSERT_NEAR(expected[n], m[n], TOL * (1.0 + fabs(expected[n])))
+          << "moment " << n << " of voxel (" << i << ", " << j << ", " << k << ")";
+    }
+  }
+}
+
+// ---------------------------------------------------------------------------
+TEST_F(BoxWindowLNCCTest, ExcludeIncludeOfSubregion)
+{
+  RealImage a = *_Similarity.A(), b = *_Similarity.B(), c = *_Similarity.C();
+  RealImage s = *_Similarity.S(), t = *_Similarity.T();
+  _Similarity.ResetValue();
+  const double value = _Similarity.Value();
+  _Similarity.Exclude(_Region);
+  _Similarity.Include(_Region);
+  for (int k = 0; k < _Attr._z; ++k)
+  for (int j = 0; j < _Attr._y; ++j)
+  for (int i = 0; i < _Attr._x; ++i) {
+    ASSERT_NEAR(a(i, j, k), _Similarity.A()->Get(i, j, k), TOL * (1.0 + fabs(a(i, j, k))));
+    ASSERT_NEAR(b(i, j, k), _Similarity.B()->Get(i, j, k), TOL * (1.0 + fabs(b(i, j, k))));
+    ASSERT_NEAR(c(i, j, k), _Similarity.C()->Get(i, j, k), TOL * (1.0 + fabs(c(i, j, k))));
+    ASSERT_NEAR(s(i, j, k), _Similarity.S()->Get(i, j, k), TOL * (1.0 + fabs(s(i, j, k))));
+    ASSERT_NEAR(t(i, j, k), _Similarity.T()->Get(i, j, k), TOL * (1.0 + fabs(t(i, j, k))));
+  }
+  _Similarity.ResetValue();
+  EXPECT_NEAR(value, _Similarity.Value(), TOL);
+}
+
+// ---------------------------------------------------------------------------
+TEST_F(BoxWindowLNCCTest, IncludeOfModifiedSubregion)
+{
+  RealImage a = *_Similarity.A(), b = *_Similarity.B(), c = *_Similarity.C();
+  RealImage s = *_Similarity.S(), t = *_Similarity.T();
+  _Similarity.Exclude(_Region);
+  RegisteredImage *source = _Similarity.Source();
+  for (int k = _Region.pages().begin(); k < _Region.pages().end(); ++k)
+  for (int j = _Region.rows ().begin(); j < _Region.rows ().end(); ++j)
+  for (int i = _Region.cols ().begin(); i < _Region.cols ().end(); ++i) {
+    source->Put(i, j, k, .5 * source->Get(i, j, k) + .1);
+  }
+  _Similarity.Include(_Region);
+  double m[5], expected[5];
+  for (int k = 0; k < _Attr._z; ++k)
+  for (int j = 0; j < _Attr._y; ++j)
+  for (int i = 0; i < _Attr._x; ++i) {
+    GetMoments(i, j, k, m);
+    if (IsInside(_Region, i, j, k)) {
+      // Voxels of region are updated
+      ComputeMoments(i, j, k, expected);
+    } else {
+      // Voxels outside region are unmodified
+      expected[0] = a(i, j, k), expected[1] = b(i, j, k), expected[2] = c(i, j, k);
+      expected[3] = s(i, j, k), expected[4] = t(i, j, k);
+    }
+    for (int n = 0; n < 5; ++n) {
+      ASSERT_NEAR(expected[n], m[n], TOL * (1.0 + fabs(expected[n])))
+          << "moment " << n << " of voxel (" << i << ", " << j << ", " << k << ")";
+    }
+  }
+}
+
+// ===========================================================================
+// Main
+// ===========================================================================
+
+// ---------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -242,6 +242,33 @@ public:
   /// Transforms a single point using the local transformation component only
   virtual void LocalTransform(double &, double &, double &, double = 0, double = -1) const;
 
+  // Import other overloads
+  using FreeFormTransformation3D::Displacement;
+
+  /// Calculates the displacement vectors for a whole image domain
+  ///
+  /// For a 3D control point lattice, the voxels are processed row by row
+  /// and the cubic B-spline weights are evaluated exactly instead of using
+  /// the lookup table of the control point interpolator.
+  ///
+  /// \attention The displacements are computed at the positions after applying the
+  ///            current displacements at each voxel. These displacements are then
+  ///            added to the current displacements. Therefore, set the input
+  ///            displacements to zero if only interested in the displacements of
+  ///            this transformation at the voxel positions.
+  virtual void Displacement(GenericImage<double> &, double, double,
+                            const WorldCoordsImage * = NULL) const;
+
+  /// Calculates the displacement vectors for a whole image domain
+  ///
+  /// \attention The displacements are computed at the positions after applying the
+  ///            current displacements at each voxel. These displacements are then
+  ///            added to the current displacements. Therefore, set the input
+  ///            displacements to zero if only interested in the displacements of
+  ///            this transformation at the voxel positions.
+  virtual void Displacement(GenericImage<float> &, double, double = -1,
+                            const WorldCoordsImage * = NULL) const;
+
   /// Whether this transformation implements a more efficient update of a given
   /// displacement field given the desired change of a transformation parameter
   virtual bool CanModifyDisplacement(int = -1) const;
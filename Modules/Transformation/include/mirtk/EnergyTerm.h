@@ -164,6 +164,18 @@ public:
   /// \param[in,out] max      Maximum step length.
   virtual void GradientStep(const double *gradient, double &min, double &max) const;
 
+  /// Get shared objects which are modified upon update or evaluation
+  ///
+  /// Energy terms which do not have any of these objects in common may be
+  /// updated and evaluated concurrently by the registration energy function.
+  ///
+  /// \param[out] deps Shared objects modified by this energy term.
+  ///
+  /// \returns Whether this energy term may be processed concurrently with
+  ///          other terms which do not modify any of the objects in \p deps.
+  ///          By default, an energy term is processed after the other terms.
+  virtual bool Dependencies(Array<const void *> &deps) const;
+
 protected:
 
   /// Evaluate unweighted energy term
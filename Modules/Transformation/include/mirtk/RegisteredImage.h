@@ -33,6 +33,14 @@
 namespace mirtk {
 
 
+/// Voxel type of registered images, cached displacements, and image gradients
+#if MIRTK_USE_FLOAT_FOR_REGISTRATION
+typedef float  RegisteredPixel;
+#else
+typedef double RegisteredPixel;
+#endif
+
+
 /**
  * Registered image such as fixed target image or transformed source image
  *
@@ -67,14 +75,14 @@ namespace mirtk {
  * - t=8: Transformed 2nd order derivative w.r.t yz
  * - t=9: Transformed 2nd order derivative w.r.t zz
  */
-class RegisteredImage : public GenericImage<double>
+class RegisteredImage : public GenericImage<RegisteredPixel>
 {
   mirtkObjectMacro(RegisteredImage);
 
 public:
 
   // Do not override other base class overloads
-  using GenericImage<double>::ImageToWorld;
+  using GenericImage<RegisteredPixel>::ImageToWorld;
 
   // ---------------------------------------------------------------------------
   // Types
@@ -84,16 +92,16 @@ public:
   enum Channel { I = 0, Dx, Dy, Dz, Dxx, Dxy, Dxz, Dyx, Dyy, Dyz, Dzx, Dzy, Dzz };
 
   /// Type of untransformed input image
-  typedef GenericImage<double>   InputImageType;
+  typedef GenericImage<double>          InputImageType;
 
   /// Type of untransformed gradient image
-  typedef GenericImage<double>   GradientImageType;
+  typedef GenericImage<RegisteredPixel> GradientImageType;
 
   /// Type of untransformed Hessian image
-  typedef GenericImage<double>   HessianImageType;
+  typedef GenericImage<RegisteredPixel> HessianImageType;
 
   /// Type of cached displacement fields
-  typedef GenericImage<double>   DisplacementImageType;
+  typedef GenericImage<RegisteredPixel> DisplacementImageType;
 
   // ---------------------------------------------------------------------------
   // Attributes
@@ -162,6 +170,16 @@ public:
   /// false: Use derivative of interpolation kernel to evaluate image derivative
   mirtkPublicAttributeMacro(bool, PrecomputeDerivatives);
 
+  /// Mask of voxels at which the moving image is resampled upon update
+  ///
+  /// When set, the intensities and derivatives of other voxels are left
+  /// unchanged by an update of the transformed image. Voxels which are
+  /// not sampled must then be excluded from the similarity evaluation.
+  /// The transformation is only evaluated at the sampled voxels unless it
+  /// requires dense displacements, e.g., a velocity field integrated by
+  /// scaling and squaring, or when passive levels are cached.
+  mirtkPublicAggregateMacro(const BinaryImage, SampleMask);
+
 protected:
 
   /// Number of active levels
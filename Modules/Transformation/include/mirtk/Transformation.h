@@ -550,6 +550,27 @@ public:
   void ParametricGradient(const GenericImage<double> *, double *,
                           double = -1, double = 1) const;
 
+  /// Applies the chain rule to convert single-precision spatial non-parametric
+  /// gradient to a gradient w.r.t the parameters of this transformation.
+  ///
+  /// The gradient is converted to double precision before it is passed on to
+  /// the virtual ParametricGradient function of the transformation subclass.
+  void ParametricGradient(const GenericImage<float> *, double *,
+                          const WorldCoordsImage *,
+                          const WorldCoordsImage *,
+                          double = -1, double = 1) const;
+
+  /// Applies the chain rule to convert single-precision spatial non-parametric
+  /// gradient to a gradient w.r.t the parameters of this transformation.
+  void ParametricGradient(const GenericImage<float> *, double *,
+                          const WorldCoordsImage *,
+                          double = -1, double = 1) const;
+
+  /// Applies the chain rule to convert single-precision spatial non-parametric
+  /// gradient to a gradient w.r.t the parameters of this transformation.
+  void ParametricGradient(const GenericImage<float> *, double *,
+                          double = -1, double = 1) const;
+
   /// Applies the chain rule to convert spatial non-parametric gradient
   /// to a gradient w.r.t the parameters of this transformation.
   virtual void ParametricGradient(const GenericImage<double> **, int, double *,
@@ -1007,6 +1028,21 @@ inline void Transformation
   this->ParametricGradient(in, out, NULL, NULL, t0, w);
 }
 
+// -----------------------------------------------------------------------------
+inline void Transformation
+::ParametricGradient(const GenericImage<float> *in, double *out,
+                     const WorldCoordsImage *i2w, double t0, double w) const
+{
+  this->ParametricGradient(in, out, i2w, NULL, t0, w);
+}
+
+// -----------------------------------------------------------------------------
+inline void Transformation
+::ParametricGradient(const GenericImage<float> *in, double *out, double t0, double w) const
+{
+  this->ParametricGradient(in, out, NULL, NULL, t0, w);
+}
+
 // -----------------------------------------------------------------------------
 inline void Transformation
 ::ParametricGradient(const GenericImage<double> **in, int n, double *out,
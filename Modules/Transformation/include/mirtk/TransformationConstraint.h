@@ -88,6 +88,15 @@ public:
   /// Get parameter name/value pairs
   virtual ParameterList Parameter() const;
 
+  // ---------------------------------------------------------------------------
+  // Evaluation
+
+  /// Get shared objects which are modified upon update or evaluation
+  ///
+  /// A transformation constraint only reads the transformation parameters
+  /// and can therefore be evaluated concurrently with any other energy term.
+  virtual bool Dependencies(Array<const void *> &) const;
+
   // ---------------------------------------------------------------------------
   // Subclass helper
 protected:
@@ -22,6 +22,8 @@
 
 #include "mirtk/Math.h"
 #include "mirtk/Memory.h"
+#include "mirtk/Array.h"
+#include "mirtk/Parallel.h"
 #include "mirtk/Profiling.h"
 #include "mirtk/ImageToInterpolationCoefficients.h"
 
@@ -1112,6 +1114,226 @@ void BSplineFreeFormTransformation3D
   }
 }
 
+namespace BSplineFreeFormTransformation3DUtils {
+
+// -----------------------------------------------------------------------------
+/// Evaluate 3D B-spline FFD at displaced voxel positions row by row
+///
+/// The cubic B-spline weights are evaluated exactly. When the image rows are
+/// parallel to the first axis of the control point lattice and the row has
+/// not been displaced before, the lattice y and z coordinates are constant
+/// along the row. In this case, the control point coefficients are summed
+/// along the y and z axes only once per lattice column.
+template <class TReal>
+struct EvaluateDisplacementRows
+{
+  typedef BSplineFreeFormTransformation3D::Kernel         Kernel;
+  typedef BSplineFreeFormTransformation3D::CPImage        CPImage;
+  typedef BSplineFreeFormTransformation3D::CPExtrapolator Extrapolator;
+  typedef BSplineFreeFormTransformation3D::Vector         Vector;
+
+  const BSplineFreeFormTransformation3D *_Transformation;
+  const CPImage                         *_Coefficients;
+  const Extrapolator                    *_Extrapolator;
+  GenericImage<TReal>                   *_Displacement;
+  const WorldCoordsImage                *_WorldCoords;
+  double                                 _I2L[3][4]; ///< Voxel to lattice coordinates
+  double                                 _W2L[3][4]; ///< World to lattice coordinates
+  bool                                   _RowAligned;
+
+  /// Compute cubic B-spline weights for given lattice coordinate
+  static inline int Weights(double x, double w[4])
+  {
+    const int    i = ifloor(x);
+    const double t = x - i;
+    w[0] = Kernel::B0(t);
+    w[1] = Kernel::B1(t);
+    w[2] = Kernel::B2(t);
+    w[3] = Kernel::B3(t);
+    return i;
+  }
+
+  /// Get control point coefficient, extrapolating outside the lattice
+  inline Vector Coefficient(int i, int j, int k) const
+  {
+    if (_Coefficients->IsInside(i, j, k)) return _Coefficients->Get(i, j, k);
+    return _Extrapolator->Get(i, j, k);
+  }
+
+  /// Evaluate FFD at arbitrary lattice coordinates
+  inline Vector Evaluate(double x, double y, double z) const
+  {
+    double wx[4], wy[4], wz[4], wyz;
+    const int i = Weights(x, wx) - 1;
+    const int j = Weights(y, wy) - 1;
+    const int k = Weights(z, wz) - 1;
+    Vector v;
+    if (0 <= i && i + 3 < _Coefficients->X() &&
+        0 <= j && j + 3 < _Coefficients->Y() &&
+        0 <= k && k + 3 < _Coefficients->Z()) {
+      const int X  = _Coefficients->X();
+      const int XY = X * _Coefficients->Y();
+      const Vector *cp = _Coefficients->Data(i, j, k);
+      for (int c = 0; c < 4; ++c)
+      for (int b = 0; b < 4; ++b) {
+        const Vector *row = cp + c * XY + b * X;
+        wyz = wy[b] * wz[c];
+        v += (wx[0] * wyz) * row[0];
+        v += (wx[1] * wyz) * row[1];
+        v += (wx[2] * wyz) * row[2];
+        v += (wx[3] * wyz) * row[3];
+      }
+    } else if (_Extrapolator) {
+      for (int c = 0; c < 4; ++c)
+      for (int b = 0; b < 4; ++b) {
+        wyz = wy[b] * wz[c];
+        for (int a = 0; a < 4; ++a) {
+          v += (wx[a] * wyz) * Coefficient(i + a, j + b, k + c);
+        }
+      }
+    } else {
+      _Transformation->Evaluate(x, y, z);
+      v._x = x, v._y = y, v._z = z;
+    }
+    return v;
+  }
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    const int nx = _Displacement->X();
+    const int ny = _Displacement->Y();
+    const int nv = _Displacement->NumberOfSpatialVoxels();
+
+    Array<double> lx(nx), ly(nx), lz(nx);
+    Array<Vector> col;
+    double        u, v, w, wx[4], wy[4], wz[4];
+    Vector        d;
+
+    for (int row = re.begin(); row != re.end(); ++row) {
+      const int j = row % ny;
+      const int k = row / ny;
+      TReal *dx = _Displacement->Data(0, j, k);
+      TReal *dy = dx + nv;
+      TReal *dz = dy + nv;
+
+      // Lattice coordinates of displaced voxel positions
+      bool displaced = false;
+      if (_WorldCoords) {
+        const double *px = _WorldCoords->Data(0, j, k);
+        const double *py = px + nv;
+        const double *pz = py + nv;
+        for (int i = 0; i < nx; ++i) {
+          u = px[i] + static_cast<double>(dx[i]);
+          v = py[i] + static_cast<double>(dy[i]);
+          w = pz[i] + static_cast<double>(dz[i]);
+          lx[i] = _W2L[0][0] * u + _W2L[0][1] * v + _W2L[0][2] * w + _W2L[0][3];
+          ly[i] = _W2L[1][0] * u + _W2L[1][1] * v + _W2L[1][2] * w + _W2L[1][3];
+          lz[i] = _W2L[2][0] * u + _W2L[2][1] * v + _W2L[2][2] * w + _W2L[2][3];
+        }
+        displaced = true;
+      } else {
+        const double x0 = _I2L[0][1] * j + _I2L[0][2] * k + _I2L[0][3];
+        const double y0 = _I2L[1][1] * j + _I2L[1][2] * k + _I2L[1][3];
+        const double z0 = _I2L[2][1] * j + _I2L[2][2] * k + _I2L[2][3];
+        for (int i = 0; i < nx; ++i) {
+          u = static_cast<double>(dx[i]);
+          v = static_cast<double>(dy[i]);
+          w = static_cast<double>(dz[i]);
+          if (u != .0 || v != .0 || w != .0) displaced = true;
+          lx[i] = x0 + _I2L[0][0] * i + _W2L[0][0] * u + _W2L[0][1] * v + _W2L[0][2] * w;
+          ly[i] = y0 + _I2L[1][0] * i + _W2L[1][0] * u + _W2L[1][1] * v + _W2L[1][2] * w;
+          lz[i] = z0 + _I2L[2][0] * i + _W2L[2][0] * u + _W2L[2][1] * v + _W2L[2][2] * w;
+        }
+      }
+
+      if (_RowAligned && !displaced) {
+        // Sum coefficients along y and z for each lattice column of this row
+        const int cj = Weights(ly[0], wy) - 1;
+        const int ck = Weights(lz[0], wz) - 1;
+        const int c1 = ifloor(min(lx[0], lx[nx-1])) - 1;
+        const int c2 = ifloor(max(lx[0], lx[nx-1])) + 2;
+        col.resize(c2 - c1 + 1);
+        for (int ci = c1; ci <= c2; ++ci) {
+          Vector &s = col[ci - c1];
+          s = .0;
+          for (int c = 0; c < 4; ++c)
+          for (int b = 0; b < 4; ++b) {
+            s += (wy[b] * wz[c]) * Coefficient(ci, cj + b, ck + c);
+          }
+        }
+        // Sum column values along x for each voxel
+        for (int i = 0; i < nx; ++i) {
+          const Vector *s = col.data() + (Weights(lx[i], wx) - 1 - c1);
+          d = wx[0] * s[0] + wx[1] * s[1] + wx[2] * s[2] + wx[3] * s[3];
+          dx[i] += static_cast<TReal>(d._x);
+          dy[i] += static_cast<TReal>(d._y);
+          dz[i] += static_cast<TReal>(d._z);
+        }
+      } else {
+        for (int i = 0; i < nx; ++i) {
+          d = Evaluate(lx[i], ly[i], lz[i]);
+          dx[i] += static_cast<TReal>(d._x);
+          dy[i] += static_cast<TReal>(d._y);
+          dz[i] += static_cast<TReal>(d._z);
+        }
+      }
+    }
+  }
+
+  static void Run(const BSplineFreeFormTransformation3D *ffd,
+                  const CPImage *coeff, const Extrapolator *extrapolator,
+                  GenericImage<TReal> &disp, const WorldCoordsImage *i2w)
+  {
+    EvaluateDisplacementRows body;
+    body._Transformation = ffd;
+    body._Coefficients   = coeff;
+    body._Extrapolator   = extrapolator;
+    body._Displacement   = &disp;
+    body._WorldCoords    = i2w;
+    const Matrix &w2l = coeff->GetWorldToImageMatrix();
+    const Matrix  i2l = w2l * disp.GetImageToWorldMatrix();
+    for (int r = 0; r < 3; ++r)
+    for (int c = 0; c < 4; ++c) {
+      body._W2L[r][c] = w2l(r, c);
+      body._I2L[r][c] = i2l(r, c);
+    }
+    body._RowAligned = (extrapolator != NULL && fequal(i2l(1, 0), .0) && fequal(i2l(2, 0), .0));
+    parallel_for(blocked_range<int>(0, disp.Y() * disp.Z()), body);
+  }
+};
+
+} // namespace BSplineFreeFormTransformation3DUtils
+
+// -----------------------------------------------------------------------------
+void BSplineFreeFormTransformation3D
+::Displacement(GenericImage<double> &disp, double t, double t0, const WorldCoordsImage *i2w) const
+{
+  using namespace BSplineFreeFormTransformation3DUtils;
+  if (_z > 1 && disp.T() == 3 && (!i2w || (i2w->T() == 3 && i2w->X() == disp.X() &&
+                                          i2w->Y() == disp.Y() && i2w->Z() == disp.Z()))) {
+    MIRTK_START_TIMING();
+    EvaluateDisplacementRows<double>::Run(this, &_CPImage, _CPValue, disp, i2w);
+    MIRTK_DEBUG_TIMING(5, "evaluation of B-spline FFD displacements");
+  } else {
+    FreeFormTransformation3D::Displacement(disp, t, t0, i2w);
+  }
+}
+
+// -----------------------------------------------------------------------------
+void BSplineFreeFormTransformation3D
+::Displacement(GenericImage<float> &disp, double t, double t0, const WorldCoordsImage *i2w) const
+{
+  using namespace BSplineFreeFormTransformation3DUtils;
+  if (_z > 1 && disp.T() == 3 && (!i2w || (i2w->T() == 3 && i2w->X() == disp.X() &&
+                                          i2w->Y() == disp.Y() && i2w->Z() == disp.Z()))) {
+    MIRTK_START_TIMING();
+    EvaluateDisplacementRows<float>::Run(this, &_CPImage, _CPValue, disp, i2w);
+    MIRTK_DEBUG_TIMING(5, "evaluation of B-spline FFD displacements");
+  } else {
+    FreeFormTransformation3D::Displacement(disp, t, t0, i2w);
+  }
+}
+
 // =============================================================================
 // Derivatives
 // =============================================================================
@@ -1186,53 +1408,210 @@ double BSplineFreeFormTransformation3D
   return Bending3D(hessian);
 }
 
+namespace BSplineFreeFormTransformation3DUtils {
+
 // -----------------------------------------------------------------------------
-double BSplineFreeFormTransformation3D::BendingEnergy(bool incl_passive, bool wrt_world) const
+/// Evaluate bending energy of B-spline FFD at control points or image voxels
+///
+/// The 2nd order derivatives are computed by separable summation of the
+/// control point coefficients, first along x, then along y, and finally
+/// along z, using fixed-size arrays instead of Matrix objects.
+struct EvaluateBendingEnergy
 {
-  Matrix hessian[3];
-  double bending = .0;
-  int    nactive = 0;
-
-  for (int k = 0; k < _z; ++k)
-  for (int j = 0; j < _y; ++j)
-  for (int i = 0; i < _x; ++i) {
-    if (incl_passive || IsActive(i, j, k)) {
-      if (_z == 1) EvaluateHessian(hessian, i, j);
-      else         EvaluateHessian(hessian, i, j, k);
-      if (wrt_world) HessianToWorld(hessian);
-      bending += Bending3D(hessian);
-      ++nactive;
+  typedef BSplineFreeFormTransformation3D::Kernel         Kernel;
+  typedef BSplineFreeFormTransformation3D::CPImage        CPImage;
+  typedef BSplineFreeFormTransformation3D::CPExtrapolator Extrapolator;
+  typedef BSplineFreeFormTransformation3D::Vector         Vector;
+
+  const BSplineFreeFormTransformation3D *_Transformation;
+  const CPImage                         *_Coefficients;
+  const Extrapolator                    *_Extrapolator;
+  const ImageAttributes                 *_Domain; ///< Image domain or NULL for control points
+  bool                                   _IncludePassive;
+  bool                                   _WrtWorld;
+  double                                 _Sum;
+  int                                    _Num;
+
+  EvaluateBendingEnergy() : _Sum(.0), _Num(0) {}
+
+  EvaluateBendingEnergy(const EvaluateBendingEnergy &other, split)
+  :
+    _Transformation(other._Transformation),
+    _Coefficients(other._Coefficients),
+    _Extrapolator(other._Extrapolator),
+    _Domain(other._Domain),
+    _IncludePassive(other._IncludePassive),
+    _WrtWorld(other._WrtWorld),
+    _Sum(.0), _Num(0)
+  {}
+
+  void join(const EvaluateBendingEnergy &rhs)
+  {
+    _Sum += rhs._Sum;
+    _Num += rhs._Num;
+  }
+
+  /// Get control point coefficient, extrapolating outside the lattice
+  inline Vector Coefficient(int i, int j, int k) const
+  {
+    if (_Coefficients->IsInside(i, j, k)) return _Coefficients->Get(i, j, k);
+    return _Extrapolator->Get(i, j, k);
+  }
+
+  /// Compute 2nd order derivatives w.r.t. lattice coordinates
+  ///
+  /// \param[in]  i,j,k First control point of kernel support region.
+  /// \param[in]  wx,wy,wz B-spline weights and their 1st and 2nd derivatives.
+  /// \param[in]  n     Size of kernel support region along each dimension.
+  /// \param[out] d     Derivatives dxx, dxy, dxz, dyy, dyz, and dzz.
+  inline void Evaluate(int i, int j, int k, const double *wx[3],
+                       const double *wy[3], const double *wz[3], int n, Vector d[6]) const
+  {
+    Vector x[3], xy[6];
+    for (int l = 0; l < 6; ++l) d[l] = .0;
+    const int nz = (_Coefficients->Z() == 1 ? 1 : n);
+    if (nz == 1) k = 0;
+    const bool inside = (0 <= i && i + n - 1 < _Coefficients->X() &&
+                         0 <= j && j + n - 1 < _Coefficients->Y() &&
+                         0 <= k && k + nz - 1 < _Coefficients->Z());
+    for (int c = 0; c < nz; ++c) {
+      for (int l = 0; l < 6; ++l) xy[l] = .0;
+      for (int b = 0; b < n; ++b) {
+        x[0] = x[1] = x[2] = .0;
+        if (inside) {
+          const Vector *cp = _Coefficients->Data(i, j + b, k + c);
+          for (int a = 0; a < n; ++a) {
+            x[0] += wx[0][a] * cp[a];
+            x[1] += wx[1][a] * cp[a];
+            x[2] += wx[2][a] * cp[a];
+          }
+        } else {
+          Vector cp;
+          for (int a = 0; a < n; ++a) {
+            cp = (nz == 1 ? _Extrapolator->Get(i + a, j + b) : Coefficient(i + a, j + b, k + c));
+            x[0] += wx[0][a] * cp;
+            x[1] += wx[1][a] * cp;
+            x[2] += wx[2][a] * cp;
+          }
+        }
+        // Products of x and y weights required by the six derivatives
+        xy[0] += wy[0][b] * x[2];
+        xy[1] += wy[1][b] * x[1];
+        xy[2] += wy[0][b] * x[1];
+        xy[3] += wy[2][b] * x[0];
+        xy[4] += wy[1][b] * x[0];
+        xy[5] += wy[0][b] * x[0];
+      }
+      if (nz == 1) {
+        d[0] = xy[0], d[1] = xy[1], d[3] = xy[3];
+      } else {
+        d[0] += wz[0][c] * xy[0];
+        d[1] += wz[0][c] * xy[1];
+        d[2] += wz[1][c] * xy[2];
+        d[3] += wz[0][c] * xy[3];
+        d[4] += wz[1][c] * xy[4];
+        d[5] += wz[2][c] * xy[5];
+      }
+    }
+  }
+
+  /// Bending energy given 2nd order derivatives w.r.t. lattice coordinates
+  inline double Bending(Vector d[6]) const
+  {
+    if (_WrtWorld) {
+      _Transformation->HessianToWorld(d[0]._x, d[1]._x, d[2]._x, d[3]._x, d[4]._x, d[5]._x);
+      _Transformation->HessianToWorld(d[0]._y, d[1]._y, d[2]._y, d[3]._y, d[4]._y, d[5]._y);
+      _Transformation->HessianToWorld(d[0]._z, d[1]._z, d[2]._z, d[3]._z, d[4]._z, d[5]._z);
+    }
+    return         (d[0]._x * d[0]._x + d[3]._x * d[3]._x + d[5]._x * d[5]._x +
+                    d[0]._y * d[0]._y + d[3]._y * d[3]._y + d[5]._y * d[5]._y +
+                    d[0]._z * d[0]._z + d[3]._z * d[3]._z + d[5]._z * d[5]._z)
+           + 2.0 * (d[1]._x * d[1]._x + d[2]._x * d[2]._x + d[4]._x * d[4]._x +
+                    d[1]._y * d[1]._y + d[2]._y * d[2]._y + d[4]._y * d[4]._y +
+                    d[1]._z * d[1]._z + d[2]._z * d[2]._z + d[4]._z * d[4]._z);
+  }
+
+  void operator ()(const blocked_range<int> &re)
+  {
+    Vector d[6];
+    int    i, j, k;
+    if (_Domain) {
+      double x, y, z, wx[3][4], wy[3][4], wz[3][4];
+      const double *px[3] = {wx[0], wx[1], wx[2]};
+      const double *py[3] = {wy[0], wy[1], wy[2]};
+      const double *pz[3] = {wz[0], wz[1], wz[2]};
+      for (int idx = re.begin(); idx != re.end(); ++idx) {
+        _Domain->IndexToLattice(idx, i, j, k);
+        x = i, y = j, z = k;
+        _Domain->LatticeToWorld(x, y, z);
+        _Transformation->WorldToLattice(x, y, z);
+        i = Weights(x, wx), j = Weights(y, wy), k = Weights(z, wz);
+        Evaluate(i - 1, j - 1, k - 1, px, py, pz, 4, d);
+        _Sum += Bending(d);
+      }
+      _Num += re.end() - re.begin();
+    } else {
+      const double *w[3] = {
+        Kernel::LatticeWeights,
+        Kernel::LatticeWeights_I,
+        Kernel::LatticeWeights_II
+      };
+      for (int cp = re.begin(); cp != re.end(); ++cp) {
+        if (_IncludePassive || _Transformation->IsActive(cp)) {
+          _Transformation->IndexToLattice(cp, i, j, k);
+          Evaluate(i - 1, j - 1, k - 1, w, w, w, 3, d);
+          _Sum += Bending(d);
+          ++_Num;
+        }
+      }
     }
   }
 
-  if (nactive) bending /= nactive;
-  return bending;
+  /// Get B-spline weights and their derivatives for given lattice coordinate
+  static inline int Weights(double x, double w[3][4])
+  {
+    const int i = ifloor(x);
+    const int A = Kernel::VariableToIndex(x - i);
+    for (int a = 0; a < 4; ++a) {
+      w[0][a] = Kernel::LookupTable   [A][a];
+      w[1][a] = Kernel::LookupTable_I [A][a];
+      w[2][a] = Kernel::LookupTable_II[A][a];
+    }
+    return i;
+  }
+
+  static double Run(const BSplineFreeFormTransformation3D *ffd,
+                    const CPImage *coeff, const Extrapolator *extrapolator,
+                    const ImageAttributes *domain, bool incl_passive, bool wrt_world)
+  {
+    EvaluateBendingEnergy body;
+    body._Transformation = ffd;
+    body._Coefficients   = coeff;
+    body._Extrapolator   = extrapolator;
+    body._Domain         = domain;
+    body._IncludePassive = incl_passive;
+    body._WrtWorld       = wrt_world;
+    const int n = (domain ? domain->NumberOfSpatialPoints() : ffd->NumberOfCPs());
+    parallel_reduce(blocked_range<int>(0, n), body);
+    return (body._Num > 0 ? body._Sum / body._Num : .0);
+  }
+};
+
+} // namespace BSplineFreeFormTransformation3DUtils
+
+// -----------------------------------------------------------------------------
+double BSplineFreeFormTransformation3D::BendingEnergy(bool incl_passive, bool wrt_world) const
+{
+  using namespace BSplineFreeFormTransformation3DUtils;
+  return EvaluateBendingEnergy::Run(this, &_CPImage, _CPValue, NULL, incl_passive, wrt_world);
 }
 
 // -----------------------------------------------------------------------------
 double BSplineFreeFormTransformation3D
 ::BendingEnergy(const ImageAttributes &attr, double, bool wrt_world) const
 {
-  const int nvox = attr.NumberOfSpatialPoints();
-  if (nvox == 0) return .0;
-
-  double bending = .0;
-  double x, y, z;
-  Matrix hessian[3];
-
-  for (int k = 0; k < attr._z; ++k)
-  for (int j = 0; j < attr._y; ++j)
-  for (int i = 0; i < attr._x; ++i) {
-    x = i, y = j, z = k;
-    attr .LatticeToWorld(x, y, z);
-    this->WorldToLattice(x, y, z);
-    if (_z == 1) EvaluateHessian(hessian, x, y);
-    else         EvaluateHessian(hessian, x, y, z);
-    if (wrt_world) HessianToWorld(hessian);
-    bending += Bending3D(hessian);
-  }
-
-  return bending / nvox;
+  using namespace BSplineFreeFormTransformation3DUtils;
+  return EvaluateBendingEnergy::Run(this, &_CPImage, _CPValue, &attr, true, wrt_world);
 }
 
 
@@ -1373,15 +1752,66 @@ void Evaluate2ndOrderBSplineFFDDerivatives::InitializeLookupTable3D()
   initialized = true;
 }
 
+// -----------------------------------------------------------------------------
+/// Add derivative of bending energy w.r.t. the parameters of each control point
+///
+/// Each control point only modifies its own entries of the gradient vector,
+/// such that the control points can be processed in parallel.
+struct AddBendingEnergyGradient
+{
+  typedef BSplineFreeFormTransformation3D::Vector Vector;
+
+  const BSplineFreeFormTransformation3D *_Transformation;
+  const GenericImage<Vector>            *_Derivatives[6]; ///< 2nd order derivatives (dxx, dxy, [dxz,] dyy, [dyz, dzz])
+  const double                          *_Weights;        ///< Weights of derivatives in support region
+  int                                    _Stride;         ///< Number of weights per support region voxel
+  double                                *_Gradient;
+  double                                 _Weight;
+  bool                                   _IncludePassive;
+
+  void operator ()(const blocked_range<int> &re) const
+  {
+    const BSplineFreeFormTransformation3D *ffd = _Transformation;
+    const bool is2D = (ffd->Z() == 1);
+    const int  nd   = (is2D ? 3 : 6);
+    const int  nz   = (is2D ? 1 : 3);
+    int    ci, cj, ck, xdof, ydof, zdof;
+    Vector sum;
+    for (int cp = re.begin(); cp != re.end(); ++cp) {
+      if (_IncludePassive || ffd->IsActive(cp)) {
+        ffd->IndexToLattice(cp, ci, cj, ck);
+        if (is2D) ck = 0;
+        sum = .0;
+        // Loop over support region (3x3[x3]) of control point
+        //
+        // Note: Derivatives were evaluated on a lattice that has an
+        //       additional boundary margin of one voxel. Therefore,
+        //       indices i, j and k are shifted by an offset of +1.
+        const double *w = _Weights;
+        for (int k = ck; k < ck + nz; ++k)
+        for (int j = cj; j <= cj+2; ++j)
+        for (int i = ci; i <= ci+2; ++i, w += _Stride) {
+          for (int m = 0; m < nd; ++m) {
+            sum += _Derivatives[m]->Get(i, j, k) * w[m];
+          }
+        }
+        ffd->IndexToDOFs(cp, xdof, ydof, zdof);
+        _Gradient[xdof] += _Weight * sum._x;
+        _Gradient[ydof] += _Weight * sum._y;
+        _Gradient[zdof] += _Weight * sum._z;
+      }
+    }
+  }
+};
+
 } // namespace BSplineFreeFormTransformation3DUtils
 
 // -----------------------------------------------------------------------------
 void BSplineFreeFormTransformation3D::BendingEnergyGradient(double *gradient, double weight, bool incl_passive, bool wrt_world) const
 {
   using namespace BSplineFreeFormTransformation3DUtils;
-  
-  Vector sum;
-  int    m, n;
+
+  int m, n;
 
   MIRTK_START_TIMING();
 
@@ -1443,29 +1873,17 @@ void BSplineFreeFormTransformation3D::BendingEnergyGradient(double *gradient, do
     }
 
     // Compute derivative of bending energy w.r.t each control point
-    int xdof, ydof, zdof;
-    for (int cj = 0; cj < _y; ++cj)
-    for (int ci = 0; ci < _x; ++ci) {
-      if (incl_passive || IsActive(ci, cj)) {
-        sum = .0;
-        // Loop over support region (3x3) of control point
-        //
-        // Note: Derivatives were evaluated on a lattice that has an
-        //       additional boundary margin of one voxel. Therefore,
-        //       indices i and j are shifted by an offset of +1.
-        n = 0;
-        for (int j = cj; j <= cj+2; ++j)
-        for (int i = ci; i <= ci+2; ++i, ++n) {
-            sum += dxx(i, j) * w[n][0];
-            sum += dxy(i, j) * w[n][1];
-            sum += dyy(i, j) * w[n][2];
-        }
-        this->IndexToDOFs(this->LatticeToIndex(ci, cj), xdof, ydof, zdof);
-        gradient[xdof] += weight * sum._x;
-        gradient[ydof] += weight * sum._y;
-        gradient[zdof] += weight * sum._z;
-      }
-    }
+    AddBendingEnergyGradient body;
+    body._Transformation = this;
+    body._Derivatives[0] = &dxx;
+    body._Derivatives[1] = &dxy;
+    body._Derivatives[2] = &dyy;
+    body._Weights        = &w[0][0];
+    body._Stride         = 4;
+    body._Gradient       = gradient;
+    body._Weight         = weight;
+    body._IncludePassive = incl_passive;
+    parallel_for(blocked_range<int>(0, this->NumberOfCPs()), body);
 
   // ---------------------------------------------------------------------------
   // Bending energy of 3D FFD
@@ -1534,34 +1952,20 @@ void BSplineFreeFormTransformation3D::BendingEnergyGradient(double *gradient, do
     }
 
     // Compute derivative of bending energy w.r.t each control point
-    int xdof, ydof, zdof;
-    for (int ck = 0; ck < _z; ++ck)
-    for (int cj = 0; cj < _y; ++cj)
-    for (int ci = 0; ci < _x; ++ci) {
-      if (incl_passive || IsActive(ci, cj, ck)) {
-        sum = .0;
-        // Loop over support region (3x3x3) of control point
-        //
-        // Note: Derivatives were evaluated on a lattice that has an
-        //       additional boundary margin of one voxel. Therefore,
-        //       indices i, j and k are shifted by an offset of +1.
-        n = 0;
-        for (int k = ck; k <= ck+2; ++k)
-        for (int j = cj; j <= cj+2; ++j)
-        for (int i = ci; i <= ci+2; ++i, ++n) {
-          sum += dxx(i, j, k) * w[n][0];
-          sum += dxy(i, j, k) * w[n][1];
-          sum += dxz(i, j, k) * w[n][2];
-          sum += dyy(i, j, k) * w[n][3];
-          sum += dyz(i, j, k) * w[n][4];
-          sum += dzz(i, j, k) * w[n][5];
-        }
-        this->IndexToDOFs(this->LatticeToIndex(ci, cj, ck), xdof, ydof, zdof);
-        gradient[xdof] += weight * sum._x;
-        gradient[ydof] += weight * sum._y;
-        gradient[zdof] += weight * sum._z;
-      }
-    }
+    AddBendingEnergyGradient body;
+    body._Transformation = this;
+    body._Derivatives[0] = &dxx;
+    body._Derivatives[1] = &dxy;
+    body._Derivatives[2] = &dxz;
+    body._Derivatives[3] = &dyy;
+    body._Derivatives[4] = &dyz;
+    body._Derivatives[5] = &dzz;
+    body._Weights        = &w[0][0];
+    body._Stride         = 9;
+    body._Gradient       = gradient;
+    body._Weight         = weight;
+    body._IncludePassive = incl_passive;
+    parallel_for(blocked_range<int>(0, this->NumberOfCPs()), body);
 
   }
   MIRTK_DEBUG_TIMING(2, "bending gradient computation");
@@ -21,6 +21,7 @@
 
 #include "mirtk/Math.h"
 #include "mirtk/Algorithm.h" // transform
+#include "mirtk/Profiling.h"
 
 
 namespace mirtk {
@@ -191,6 +192,7 @@ void EnergyTerm::ResetInitialValue()
 double EnergyTerm::InitialValue()
 {
   if (IsNaN(_InitialValue)) {
+    MIRTK_PROFILE_ZONE("evaluation of " << (_Name.empty() ? this->NameOfClass() : _Name.c_str()));
     _InitialValue = _Value = (_Weight != .0 ? this->Evaluate() : .0);
   }
   return _InitialValue;
@@ -199,7 +201,10 @@ double EnergyTerm::InitialValue()
 // -----------------------------------------------------------------------------
 double EnergyTerm::Value()
 {
-  if (IsNaN(_Value))        _Value        = (_Weight != .0 ? this->Evaluate() : .0);
+  if (IsNaN(_Value)) {
+    MIRTK_PROFILE_ZONE("evaluation of " << (_Name.empty() ? this->NameOfClass() : _Name.c_str()));
+    _Value = (_Weight != .0 ? this->Evaluate() : .0);
+  }
   if (IsNaN(_InitialValue)) _InitialValue = _Value;
 
   double value = _Value;
@@ -235,13 +240,17 @@ void EnergyTerm::Gradient(double *gradient, double step)
     if (IsNaN(_InitialValue)) _InitialValue = this->InitialValue();
     if (_InitialValue != .0) weight /= abs(_InitialValue);
   }
-  if (weight != .0) this->EvaluateGradient(gradient, step, weight);
+  if (weight != .0) {
+    MIRTK_PROFILE_ZONE("gradient of " << (_Name.empty() ? this->NameOfClass() : _Name.c_str()));
+    this->EvaluateGradient(gradient, step, weight);
+  }
 }
 
 // -----------------------------------------------------------------------------
 void EnergyTerm::NormalizedGradient(double *gradient, double step)
 {
   if (_Weight != .0) {
+    MIRTK_PROFILE_ZONE("gradient of " << (_Name.empty() ? this->NameOfClass() : _Name.c_str()));
     const int ndofs = _Transformation->NumberOfDOFs();
     double *grad = CAllocate<double>(ndofs);
     this->EvaluateGradient(grad, step, 1.0);
@@ -258,6 +267,13 @@ void EnergyTerm::GradientStep(const double *, double &, double &) const
   // By default, step length range chosen by user/optimizer
 }
 
+// -----------------------------------------------------------------------------
+bool EnergyTerm::Dependencies(Array<const void *> &deps) const
+{
+  deps.clear();
+  return false;
+}
+
 // =============================================================================
 // Debugging
 // =============================================================================
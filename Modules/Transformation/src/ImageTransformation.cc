@@ -45,7 +45,7 @@ struct ApplyTransformation
   // ---------------------------------------------------------------------------
   // Attributes
   const BaseImage                *_Input;
-  const ImageFunction            *_Interpolator;
+  const InterpolateImageFunction *_Interpolator;
   const Transformation           *_Transformation;
   const InterpolateImageFunction *_DisplacementField;
   BaseImage                      *_Output;
@@ -138,53 +138,61 @@ struct ApplyTransformation
 
   // ---------------------------------------------------------------------------
   /// Applies the given transformation within given output region for frame _T
+  ///
+  /// The input image locations of the output voxels of each row which are
+  /// inside the field of view of the input are collected first, and the input
+  /// image is then interpolated at these locations by a single batch call.
   void operator() (const blocked_range3d<int> &r)
   {
-    double value, x, y, z, u, v, w, disp[3] = {.0, .0, .0};
+    const int n = r.cols().end() - r.cols().begin();
+    Array<int>    idx(n);
+    Array<double> px(n), py(n), pz(n), values(n);
+    double        x, y, z, u, v, w, disp[3] = {.0, .0, .0};
+    int           m;
 
     for (int k = r.pages().begin(); k != r.pages().end(); ++k)
-    for (int j = r.rows ().begin(); j != r.rows ().end(); ++j)
-    for (int i = r.cols ().begin(); i != r.cols ().end(); ++i) {
-      if (_Output->GetAsDouble(i, j, k, _OutputFrame) > _TargetPaddingValue) {
-        // Transform point into world coordinates
-        x = i, y = j, z = k;
-        _Output->ImageToWorld(x, y, z);
-        // Transform point
-        if (_DisplacementField) {
-          u = x, v = y, w = z;
-          _DisplacementField->WorldToImage  (u, v, w);
-          _DisplacementField->Evaluate(disp, u, v, w);
-          x += disp[0], y += disp[1], z += disp[2];
-        } else {
-          if (_Invert) {
-            if (!_Transformation->Inverse(x, y, z, _InputTime, _OutputTime)) {
-              ++_NumberOfSingularPoints;
-            }
+    for (int j = r.rows ().begin(); j != r.rows ().end(); ++j) {
+      m = 0;
+      for (int i = r.cols ().begin(); i != r.cols ().end(); ++i) {
+        if (_Output->GetAsDouble(i, j, k, _OutputFrame) > _TargetPaddingValue) {
+          // Transform point into world coordinates
+          x = i, y = j, z = k;
+          _Output->ImageToWorld(x, y, z);
+          // Transform point
+          if (_DisplacementField) {
+            u = x, v = y, w = z;
+            _DisplacementField->WorldToImage  (u, v, w);
+            _DisplacementField->Evaluate(disp, u, v, w);
+            x += disp[0], y += disp[1], z += disp[2];
           } else {
-            _Transformation->Transform(x, y, z, _InputTime, _OutputTime);
+            if (_Invert) {
+              if (!_Transformation->Inverse(x, y, z, _InputTime, _OutputTime)) {
+                ++_NumberOfSingularPoints;
+              }
+            } else {
+              _Transformation->Transform(x, y, z, _InputTime, _OutputTime);
+            }
           }
-        }
-        // Transform point into image coordinates
-        _Input->WorldToImage(x, y, z);
-        // Check whether transformed point is in FOV of input
-        if (-0.5 < x && x < static_cast<double>(_Input->X()) - 0.5 &&
-            -0.5 < y && y < static_cast<double>(_Input->Y()) - 0.5) {
-          if (_TwoD) {
-            value = _Interpolator->Evaluate(x, y, k, _InputFrame);
-            value = _ScaleFactor * Clamp(value) + _Offset;
-          } else if (-0.5 < z && z < static_cast<double>(_Input->Z()) - 0.5) {
-            value = _Interpolator->Evaluate(x, y, z, _InputFrame);
-            value = _ScaleFactor * Clamp(value) + _Offset;
-          } else {
-            value = _SourcePaddingValue;
+          // Transform point into image coordinates
+          _Input->WorldToImage(x, y, z);
+          // Check whether transformed point is in FOV of input
+          if (-0.5 < x && x < static_cast<double>(_Input->X()) - 0.5 &&
+              -0.5 < y && y < static_cast<double>(_Input->Y()) - 0.5) {
+            if (_TwoD) z = k;
+            if (_TwoD || (-0.5 < z && z < static_cast<double>(_Input->Z()) - 0.5)) {
+              idx[m] = i, px[m] = x, py[m] = y, pz[m] = z;
+              ++m;
+              continue;
+            }
           }
-        } else {
-          value = _SourcePaddingValue;
         }
-      } else {
-        value = _SourcePaddingValue;
+        _Output->PutAsDouble(i, j, k, _OutputFrame, _SourcePaddingValue);
+      }
+      // Interpolate input image at transformed points
+      _Interpolator->EvaluateBatch(values.data(), m, px.data(), py.data(), pz.data(), _InputFrame);
+      for (int l = 0; l < m; ++l) {
+        _Output->PutAsDouble(idx[l], j, k, _OutputFrame, _ScaleFactor * Clamp(values[l]) + _Offset);
       }
-      _Output->PutAsDouble(i, j, k, _OutputFrame, value);
     }
   }
 
@@ -225,7 +233,7 @@ struct ApplyTransformation
 struct ApplyHomogeneousTransformation
 {
   const BaseImage                 *_Input;
-  const ImageFunction             *_Interpolator;
+  const InterpolateImageFunction  *_Interpolator;
   const HomogeneousTransformation *_Transformation;
   BaseImage                       *_Output;
 
@@ -254,31 +262,33 @@ struct ApplyHomogeneousTransformation
   /// Applies the given transformation within given output region for frame _T
   void operator()(const blocked_range<int> &r) const
   {
-    double value;
+    const int n = _Output->X();
+    Array<int>    idx(n);
+    Array<double> px(n), py(n), pz(n), values(n);
+    int           m;
+
     HomogeneousTransformationIterator it(_Transformation);
     it.Initialize(_Output, _Input, .0, .0, static_cast<double>(r.begin()), _Invert);
     for (int k = r.begin(); k != r.end();     ++k, it.NextZ())
-    for (int j = 0;         j < _Output->Y(); ++j, it.NextY())
-    for (int i = 0;         i < _Output->X(); ++i, it.NextX()) {
-      if (_Output->GetAsDouble(i, j, k, _OutputFrame) > _TargetPaddingValue) {
-        if (-.5 < it._x && it._x < _Input->X() - .5 &&
-            -.5 < it._y && it._y < _Input->Y() - .5) {
-          if (_TwoD) {
-            value = _Interpolator->Evaluate(it._x, it._y, k, _InputFrame);
-            value = _ScaleFactor * Clamp(value) + _Offset;
-          } else if (-.5 < it._z && it._z < _Input->Z() - .5) {
-            value = _Interpolator->Evaluate(it._x, it._y, it._z, _InputFrame);
-            value = _ScaleFactor * Clamp(value) + _Offset;
-          } else {
-            value = _SourcePaddingValue;
+    for (int j = 0;         j < _Output->Y(); ++j, it.NextY()) {
+      m = 0;
+      for (int i = 0; i < n; ++i, it.NextX()) {
+        if (_Output->GetAsDouble(i, j, k, _OutputFrame) > _TargetPaddingValue) {
+          if (-.5 < it._x && it._x < _Input->X() - .5 &&
+              -.5 < it._y && it._y < _Input->Y() - .5) {
+            if (_TwoD || (-.5 < it._z && it._z < _Input->Z() - .5)) {
+              idx[m] = i, px[m] = it._x, py[m] = it._y, pz[m] = (_TwoD ? k : it._z);
+              ++m;
+              continue;
+            }
           }
-        } else {
-          value = _SourcePaddingValue;
         }
-      } else {
-      	value = _SourcePaddingValue;
+        _Output->PutAsDouble(i, j, k, _OutputFrame, _SourcePaddingValue);
+      }
+      _Interpolator->EvaluateBatch(values.data(), m, px.data(), py.data(), pz.data(), _InputFrame);
+      for (int l = 0; l < m; ++l) {
+        _Output->PutAsDouble(idx[l], j, k, _OutputFrame, _ScaleFactor * Clamp(values[l]) + _Offset);
       }
-      _Output->PutAsDouble(i, j, k, _OutputFrame, value);
     }
   }
 
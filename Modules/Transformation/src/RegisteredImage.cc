@@ -64,6 +64,7 @@ RegisteredImage::RegisteredImage()
   _GradientSigma         (.0),
   _HessianSigma          (.0),
   _PrecomputeDerivatives (false),
+  _SampleMask            (NULL),
   _NumberOfActiveLevels  (0),
   _NumberOfPassiveLevels (0)
 {
@@ -73,7 +74,7 @@ RegisteredImage::RegisteredImage()
 // -----------------------------------------------------------------------------
 RegisteredImage::RegisteredImage(const RegisteredImage &other)
 :
-  GenericImage<double>(other),
+  GenericImage<RegisteredPixel>(other),
   _InputImage            (other._InputImage),
   _InputGradient         (other._InputGradient  ? new GradientImageType(*other._InputGradient)  : NULL),
   _InputHessian          (other._InputHessian   ? new GradientImageType(*other._InputHessian)   : NULL),
@@ -94,6 +95,7 @@ RegisteredImage::RegisteredImage(const RegisteredImage &other)
   _GradientSigma         (other._GradientSigma),
   _HessianSigma          (other._HessianSigma),
   _PrecomputeDerivatives (other._PrecomputeDerivatives),
+  _SampleMask            (other._SampleMask),
   _NumberOfActiveLevels  (other._NumberOfActiveLevels),
   _NumberOfPassiveLevels (other._NumberOfPassiveLevels)
 {
@@ -103,7 +105,7 @@ RegisteredImage::RegisteredImage(const RegisteredImage &other)
 // -----------------------------------------------------------------------------
 RegisteredImage &RegisteredImage::operator =(const RegisteredImage &other)
 {
-  GenericImage<double>::operator =(other);
+  GenericImage<RegisteredPixel>::operator =(other);
   _InputImage             = other._InputImage;
   _InputGradient          = other._InputGradient  ? new GradientImageType(*other._InputGradient)  : NULL;
   _InputHessian           = other._InputHessian   ? new GradientImageType(*other._InputHessian)   : NULL;
@@ -124,6 +126,7 @@ RegisteredImage &RegisteredImage::operator =(const RegisteredImage &other)
   _GradientSigma          = other._GradientSigma;
   _HessianSigma           = other._HessianSigma;
   _PrecomputeDerivatives  = other._PrecomputeDerivatives;
+  _SampleMask             = other._SampleMask;
   _NumberOfActiveLevels   = other._NumberOfActiveLevels;
   _NumberOfPassiveLevels  = other._NumberOfPassiveLevels;
   memcpy(_Offset, other._Offset, 13 * sizeof(int));
@@ -136,7 +139,7 @@ RegisteredImage::~RegisteredImage()
   if (_ImageToWorld != _WorldCoordinates) delete _ImageToWorld;
   delete _FixedDisplacement;
   delete _Displacement;
-  if (_InputGradient != _InputImage) delete _InputGradient;
+  if (_InputGradient != static_cast<BaseImage *>(_InputImage)) delete _InputGradient;
   delete _InputHessian;
 }
 
@@ -164,7 +167,7 @@ void RegisteredImage::Initialize(const ImageAttributes &attr, int t)
     cerr << "RegisteredImage::Initialize: Number of registered image channels must be either 1, 4, 10 or 13" << endl;
     exit(1);
   }
-  GenericImage<double>::Initialize(attr, t);
+  GenericImage<RegisteredPixel>::Initialize(attr, t);
 
   // Set background value/foreground mask
   if (_InputImage->HasBackgroundValue()) {
@@ -236,6 +239,29 @@ void RegisteredImage::Initialize(const ImageAttributes &attr, int t)
   MIRTK_DEBUG_TIMING(4, "initialization of " << (_Transformation ? "moving" : "fixed") << " image");
 }
 
+// -----------------------------------------------------------------------------
+// Auxiliary functor which converts the (smoothed) input image to the voxel type
+// of the image derivatives; the image is used as is when the types are identical
+template <class TOut, class TIn>
+struct ConvertInputImage
+{
+  static TOut *Run(TIn *image, const TIn *input)
+  {
+    TOut *output = new TOut(*image);
+    if (image != input) delete image;
+    return output;
+  }
+};
+
+template <class TImage>
+struct ConvertInputImage<TImage, TImage>
+{
+  static TImage *Run(TImage *image, const TImage *)
+  {
+    return image;
+  }
+};
+
 // -----------------------------------------------------------------------------
 void RegisteredImage::ComputeInputGradient(double sigma)
 {
@@ -265,8 +291,10 @@ void RegisteredImage::ComputeInputGradient(double sigma)
   if (_PrecomputeDerivatives) {
     // Compute image gradient using finite differences
     typedef GradientImageFilter<GradientImageType::VoxelType> FilterType;
+    GradientImageType *input;
+    input = ConvertInputImage<GradientImageType, InputImageType>::Run(blurred_image, _InputImage);
     FilterType filter(FilterType::GRADIENT_VECTOR);
-    filter.Input (blurred_image);
+    filter.Input (input);
     filter.Output(_InputGradient ? _InputGradient : new GradientImageType);
     // Note that even though the original IRTK nreg2 implementation did divide
     // the image gradient initially by the voxel size, the similarity gradient
@@ -284,11 +312,11 @@ void RegisteredImage::ComputeInputGradient(double sigma)
     _InputGradient = filter.Output();
     _InputGradient->PutTSize(.0);
     _InputGradient->PutBackgroundValueAsDouble(.0);
-    if (blurred_image != _InputImage) delete blurred_image;
+    if (input != static_cast<BaseImage *>(_InputImage)) delete input;
     MIRTK_DEBUG_TIMING(5, "computation of 1st order image derivatives");
   } else {
-    delete _InputGradient;
-    _InputGradient = blurred_image;
+    if (_InputGradient != static_cast<BaseImage *>(_InputImage)) delete _InputGradient;
+    _InputGradient = ConvertInputImage<GradientImageType, InputImageType>::Run(blurred_image, _InputImage);
     MIRTK_DEBUG_TIMING(5, "low-pass filtering of image for 1st order derivatives");
   }
 }
@@ -321,8 +349,10 @@ void RegisteredImage::ComputeInputHessian(double sigma)
   }
   // Compute 2nd order image derivatives using finite differences
   typedef HessianImageFilter<HessianImageType::VoxelType> FilterType;
+  HessianImageType *input;
+  input = ConvertInputImage<HessianImageType, InputImageType>::Run(blurred_image, _InputImage);
   FilterType filter(FilterType::HESSIAN_MATRIX);
-  filter.Input(blurred_image);
+  filter.Input(input);
   filter.Output(_InputHessian ? _InputHessian : new HessianImageType);
   filter.UseVoxelSize  (true);
   filter.UseOrientation(true);
@@ -333,7 +363,7 @@ void RegisteredImage::ComputeInputHessian(double sigma)
   _InputHessian = filter.Output();
   _InputHessian->PutTSize(.0);
   _InputHessian->PutBackgroundValueAsDouble(.0);
-  if (blurred_image != _InputImage) delete blurred_image;
+  if (input != static_cast<BaseImage *>(_InputImage)) delete input;
   MIRTK_DEBUG_TIMING(5, "computation of 2nd order image derivatives");
 }
 
@@ -345,7 +375,8 @@ void RegisteredImage::ComputeInputHessian(double sigma)
 // Base class of voxel transformation functors
 struct Transformer
 {
-  typedef WorldCoordsImage::VoxelType CoordType;
+  typedef WorldCoordsImage::VoxelType                     CoordType;
+  typedef RegisteredImage::DisplacementImageType::VoxelType DisplacementType;
 
   /// Constructor
   Transformer()
@@ -386,7 +417,7 @@ struct Transformer
   }
 
   /// Transform output voxel using pre-computed world coordinates and displacements
-  void operator ()(double &x, double &y, double &z, const CoordType *wc, const double *dx)
+  void operator ()(double &x, double &y, double &z, const CoordType *wc, const DisplacementType *dx)
   {
     x = wc[_x] + dx[_x];
     y = wc[_y] + dx[_y];
@@ -416,7 +447,7 @@ struct DefaultTransformer : public Transformer
 
   /// As this transformer is only used when no fixed transformation is cached,
   /// this overloaded operator should never be invoked
-  void operator ()(double &, double &, double &, const CoordType *, const double *, const double *)
+  void operator ()(double &, double &, double &, const CoordType *, const DisplacementType *, const DisplacementType *)
   {
     cerr << "RegisteredImage::DefaultTransformer used even though _FixedDisplacement assumed to be NULL ?!?" << endl;
     exit(1);
@@ -430,7 +461,7 @@ struct AdditiveTransformer : public Transformer
   using Transformer::operator();
 
   /// Transform output voxel using pre-computed world coordinates and displacements
-  void operator ()(double &x, double &y, double &z, const CoordType *wc, const double *d1, const double *d2)
+  void operator ()(double &x, double &y, double &z, const CoordType *wc, const DisplacementType *d1, const DisplacementType *d2)
   {
     x = wc[_x] + d1[_x] + d2[_x];
     y = wc[_y] + d1[_y] + d2[_y];
@@ -450,7 +481,7 @@ struct FluidTransformer : public Transformer
   /// Because fluid composition of displacement fields would require interpolation,
   /// let Transformation::Displacement handle the fluid composition already when
   /// computing the second displacement field.
-  void operator ()(double &x, double &y, double &z, const CoordType *wc, const double *, const double *dx)
+  void operator ()(double &x, double &y, double &z, const CoordType *wc, const DisplacementType *, const DisplacementType *dx)
   {
     x = wc[_x] + dx[_x];
     y = wc[_y] + dx[_y];
@@ -484,14 +515,14 @@ struct FixedTransformer : public Transformer
   }
 
   /// Transform output voxel using pre-computed world coordinates and displacements
-  void operator ()(double &x, double &y, double &z, const CoordType *wc, const double *dx)
+  void operator ()(double &x, double &y, double &z, const CoordType *wc, const DisplacementType *dx)
   {
     Transformer::operator()(x, y, z, wc, dx);
   }
 
   /// As this transformer is only used when no transformation is set,
   /// this overloaded operator should never be invoked
-  void operator ()(double &, double &, double &, const CoordType *, const double *, const double *)
+  void operator ()(double &, double &, double &, const CoordType *, const DisplacementType *, const DisplacementType *)
   {
     cerr << "RegisteredImage::FixedTransformer(..., d1, d2) used even though _Transformation assumed to be NULL ?!?" << endl;
     exit(1);
@@ -578,6 +609,10 @@ void New(ImageGradientFunction *&f, const BaseImage *image,
 template <class IntensityFunction, class GradientFunction, class HessianFunction>
 class Interpolator
 {
+public:
+
+  typedef RegisteredImage::VoxelType VoxelType;
+
 protected:
 
   IntensityFunction *_IntensityFunction;
@@ -725,31 +760,35 @@ public:
   /// Interpolate input intensity function
   ///
   /// \return The interpolation mode, i.e., result of inside/outside domain check.
-  int InterpolateIntensity(double x, double y, double z, double *o)
+  int InterpolateIntensity(double x, double y, double z, VoxelType *o)
   {
+    double v;
     // Check if location is inside image domain
     int mode = InterpolationMode(x, y, z, false);
     if (mode == 1) {
       // Either interpolate using the input padding value to exclude background
       if (_InterpolateWithPadding) {
-        *o = _IntensityFunction->EvaluateWithPaddingInside(x, y, z);
+        v = _IntensityFunction->EvaluateWithPaddingInside(x, y, z);
       // or simply ignore the input background value as done by nreg2
       } else {
-        *o = _IntensityFunction->EvaluateInside(x, y, z);
+        v = _IntensityFunction->EvaluateInside(x, y, z);
       }
       // Set background to output padding value
-      if (*o == _IntensityFunction->DefaultValue()) {
-        *o = _PaddingValue;
+      if (v == _IntensityFunction->DefaultValue()) {
+        *o = static_cast<VoxelType>(_PaddingValue);
         if (_InterpolateWithPadding) return -1;
+        return mode;
+      }
       // Rescale foreground to desired [min, max] range
-      } else if (_RescaleSlope != 1.0 || _RescaleIntercept != .0) {
-        *o = (*o) * _RescaleSlope + _RescaleIntercept;
-        if      (*o < _MinIntensity) *o = _MinIntensity;
-        else if (*o > _MaxIntensity) *o = _MaxIntensity;
+      if (_RescaleSlope != 1.0 || _RescaleIntercept != .0) {
+        v = v * _RescaleSlope + _RescaleIntercept;
+        if      (v < _MinIntensity) v = _MinIntensity;
+        else if (v > _MaxIntensity) v = _MaxIntensity;
       }
+      *o = static_cast<VoxelType>(v);
     // Otherwise, set output intensity to outside value
     } else {
-      *o = _PaddingValue;
+      *o = static_cast<VoxelType>(_PaddingValue);
     }
     // Pass inside/outside check result on to derivative interpolation
     // functions such that these boundary checks are only done once.
@@ -758,17 +797,19 @@ public:
   }
 
   /// Interpolate 1st order derivatives of input intensity function
-  void InterpolateGradient(double x, double y, double z, double *o, int mode = 0)
+  void InterpolateGradient(double x, double y, double z, VoxelType *o, int mode = 0)
   {
+    double v[3];
     o += _NumberOfVoxels;
     switch (mode) {
       // Inside
       case 1:
         if (_InterpolateWithPadding) {
-          _GradientFunction->EvaluateWithPaddingInside(o, x, y, z, _NumberOfVoxels);
+          _GradientFunction->EvaluateWithPaddingInside(v, x, y, z);
         } else {
-          _GradientFunction->EvaluateInside(o, x, y, z, _NumberOfVoxels);
+          _GradientFunction->EvaluateInside(v, x, y, z);
         }
+        for (int c = 0; c < 3; ++c, o += _NumberOfVoxels) *o = static_cast<VoxelType>(v[c]);
         break;
       // Outside/Boundary
       default: for (int c = 1; c <= 3; ++c, o += _NumberOfVoxels) *o = .0;
@@ -776,17 +817,19 @@ public:
   }
 
   /// Interpolate 2nd order derivatives of input intensity function
-  void InterpolateHessian(double x, double y, double z, double *o, int mode = 0)
+  void InterpolateHessian(double x, double y, double z, VoxelType *o, int mode = 0)
   {
+    double v[9];
     o += 4 * _NumberOfVoxels;
     switch (mode) {
       // Inside
       case 1:
         if (_InterpolateWithPadding) {
-          _HessianFunction->EvaluateWithPaddingInside(o, x, y, z, _NumberOfVoxels);
+          _HessianFunction->EvaluateWithPaddingInside(v, x, y, z);
         } else {
-          _HessianFunction->EvaluateInside(o, x, y, z, _NumberOfVoxels);
+          _HessianFunction->EvaluateInside(v, x, y, z);
         }
+        for (int c = 4; c < _NumberOfChannels; ++c, o += _NumberOfVoxels) *o = static_cast<VoxelType>(v[c-4]);
         break;
       // Outside/Boundary
       default: for (int c = 4; c < _NumberOfChannels; ++c, o += _NumberOfVoxels) *o = .0;
@@ -799,7 +842,7 @@ public:
 template <class IntensityFunction, class GradientFunction, class HessianFunction>
 struct IntensityInterpolator : public Interpolator<IntensityFunction, GradientFunction, HessianFunction>
 {
-  void operator()(double x, double y, double z, double *o)
+  void operator()(double x, double y, double z, RegisteredImage::VoxelType *o)
   {
     this->InterpolateIntensity(x, y, z, o);
   }
@@ -810,7 +853,7 @@ struct IntensityInterpolator : public Interpolator<IntensityFunction, GradientFu
 template <class IntensityFunction, class GradientFunction, class HessianFunction>
 struct GradientInterpolator : public Interpolator<IntensityFunction, GradientFunction, HessianFunction>
 {
-  void operator()(double x, double y, double z, double *o)
+  void operator()(double x, double y, double z, RegisteredImage::VoxelType *o)
   {
     int mode = this->InterpolationMode  (x, y, z);
     this           ->InterpolateGradient(x, y, z, o, mode);
@@ -822,7 +865,7 @@ struct GradientInterpolator : public Interpolator<IntensityFunction, GradientFun
 template <class IntensityFunction, class GradientFunction, class HessianFunction>
 struct HessianInterpolator : public Interpolator<IntensityFunction, GradientFunction, HessianFunction>
 {
-  void operator()(double x, double y, double z, double *o)
+  void operator()(double x, double y, double z, RegisteredImage::VoxelType *o)
   {
     int mode = this->InterpolationMode (x, y, z);
     this           ->InterpolateHessian(x, y, z, o, mode);
@@ -834,7 +877,7 @@ struct HessianInterpolator : public Interpolator<IntensityFunction, GradientFunc
 template <class IntensityFunction, class GradientFunction, class HessianFunction>
 struct IntensityAndGradientInterpolator : public Interpolator<IntensityFunction, GradientFunction, HessianFunction>
 {
-  void operator()(double x, double y, double z, double *o)
+  void operator()(double x, double y, double z, RegisteredImage::VoxelType *o)
   {
     int mode = this->InterpolateIntensity(x, y, z, o);
     this           ->InterpolateGradient (x, y, z, o, mode);
@@ -846,7 +889,7 @@ struct IntensityAndGradientInterpolator : public Interpolator<IntensityFunction,
 template <class IntensityFunction, class GradientFunction, class HessianFunction>
 struct IntensityAndHessianInterpolator : public Interpolator<IntensityFunction, GradientFunction, HessianFunction>
 {
-  void operator()(double x, double y, double z, double *o)
+  void operator()(double x, double y, double z, RegisteredImage::VoxelType *o)
   {
     int mode = this->InterpolateIntensity(x, y, z, o);
     this           ->InterpolateHessian  (x, y, z, o, mode);
@@ -858,7 +901,7 @@ struct IntensityAndHessianInterpolator : public Interpolator<IntensityFunction,
 template <class IntensityFunction, class GradientFunction, class HessianFunction>
 struct GradientAndHessianInterpolator : public Interpolator<IntensityFunction, GradientFunction, HessianFunction>
 {
-  void operator()(double x, double y, double z, double *o)
+  void operator()(double x, double y, double z, RegisteredImage::VoxelType *o)
   {
     int mode = this->InterpolationMode  (x, y, z);
     this           ->InterpolateGradient(x, y, z, o, mode);
@@ -871,7 +914,7 @@ struct GradientAndHessianInterpolator : public Interpolator<IntensityFunction, G
 template <class IntensityFunction, class GradientFunction, class HessianFunction>
 struct IntensityAndGradientAndHessianInterpolator : public Interpolator<IntensityFunction, GradientFunction, HessianFunction>
 {
-  void operator()(double x, double y, double z, double *o)
+  void operator()(double x, double y, double z, RegisteredImage::VoxelType *o)
   {
     int mode = this->InterpolateIntensity(x, y, z, o);
     this           ->InterpolateGradient (x, y, z, o, mode);
@@ -886,10 +929,14 @@ struct UpdateFunction : public VoxelFunction
 {
 private:
 
-  typedef typename Transformer::CoordType CoordType;
+  typedef typename Transformer::CoordType        CoordType;
+  typedef typename Transformer::DisplacementType DisplacementType;
+  typedef RegisteredImage::VoxelType             VoxelType;
 
-  Transformer  _Transform;
-  Interpolator _Interpolate;
+  Transformer        _Transform;
+  Interpolator       _Interpolate;
+  const BinaryPixel *_Sampled;
+  int                _X, _Y;
 
 public:
 
@@ -901,38 +948,51 @@ public:
                  RegisteredImage      *o,
                  double omin = numeric_limits<double>::quiet_NaN(),
                  double omax = numeric_limits<double>::quiet_NaN())
+  :
+    _Sampled(o->SampleMask() ? o->SampleMask()->Data() : NULL),
+    _X(o->X()), _Y(o->Y())
   {
     _Transform  .Initialize(o, f, t);
     _Interpolate.Initialize(o, f, g, h, omin, omax);
   }
 
+  /// Whether voxel is not sampled and thus not to be updated
+  bool Skip(int i, int j, int k) const
+  {
+    return _Sampled && !_Sampled[(k * _Y + j) * _X + i];
+  }
+
   /// Resample input without pre-computed maps
-  void operator ()(int i, int j, int k, int, double *o)
+  void operator ()(int i, int j, int k, int, VoxelType *o)
   {
+    if (Skip(i, j, k)) return;
     double x = i, y = j, z = k;
     _Transform  (x, y, z);
     _Interpolate(x, y, z, o);
   }
 
   /// Resample input using pre-computed world coordinates
-  void operator ()(int i, int j, int k, int, const CoordType *wc, double *o)
+  void operator ()(int i, int j, int k, int, const CoordType *wc, VoxelType *o)
   {
+    if (Skip(i, j, k)) return;
     double x = i, y = j, z = k;
     _Transform  (x, y, z, wc);
     _Interpolate(x, y, z, o);
   }
 
   /// Resample input using pre-computed world coordinates and displacements
-  void operator ()(int i, int j, int k, int, const CoordType *wc, const double *dx, double *o)
+  void operator ()(int i, int j, int k, int, const CoordType *wc, const DisplacementType *dx, VoxelType *o)
   {
+    if (Skip(i, j, k)) return;
     double x = i, y = j, z = k;
     _Transform  (x, y, z, wc, dx);
     _Interpolate(x, y, z, o);
   }
 
   /// Resample input using pre-computed world coordinates and additive displacements
-  void operator ()(int i, int j, int k, int, const CoordType *wc, const double *d1, const double *d2, double *o)
+  void operator ()(int i, int j, int k, int, const CoordType *wc, const DisplacementType *d1, const DisplacementType *d2, VoxelType *o)
   {
+    if (Skip(i, j, k)) return;
     double x = i, y = j, z = k;
     _Transform  (x, y, z, wc, d1, d2);
     _Interpolate(x, y, z, o);
@@ -1047,7 +1107,7 @@ void RegisteredImage::Update1(const blocked_range3d<int> &region,
     // TODO: Use also some HessianInterpolatorType
     #define _update_using(InterpolatorType, GradientInterpolatorType)          \
       Update2<Transformer, InterpolatorType<InputImageType>,                   \
-                           GradientInterpolatorType<InputImageType>,           \
+                           GradientInterpolatorType<GradientImageType>,        \
                            InterpolatorType<HessianImageType> >                \
           (region, intensity, gradient, hessian)
     // Instantiate image functions for commonly used interpolation methods
@@ -1150,8 +1210,13 @@ void RegisteredImage::Update(const blocked_range3d<int> &region,
 
       // For some transformations, it is faster to compute the displacements
       // all at once such as those which are represented by velocity fields.
-      const bool cache = _CacheDisplacement || _Transformation->RequiresCachingOfDisplacements();
+      // When only a subset of voxels is resampled, the optional cache is not
+      // used such that the transformation is only evaluated at these voxels.
+      // Displacements required by the transformation are still dense.
+      const bool cache = _Transformation->RequiresCachingOfDisplacements() ||
+                         (_CacheDisplacement && (!_SampleMask || _FixedDisplacement));
       if (cache && !_Displacement) _Displacement = new DisplacementImageType();
+      if (!cache) Delete(_Displacement);
 
       // If we pre-computed the fixed displacement of the passive MFFD levels
       const MultiLevelTransformation *mffd;
@@ -1768,15 +1768,16 @@ public:
 
     // Calculate parametric gradient
     //
-    // FIXME: In case of affine registration with NMI as image similarity measure,
-    //        the parallel reduction seems to introduce numeric differences in
-    //        the summation of the individual gradient contributions. This
-    //        results in different results depending on the split of the image
-    //        domain into smaller pieces.
-    //        https://gitlab.doc.ic.ac.uk/BioMedIA/MIRTK/issues/31
-    blocked_range3d<int> voxels(0, _Z, 0, _Y, 0, _X);
-//    parallel_reduce(voxels, *this);
-    this->operator()(voxels);
+    // Note: A parallel_reduce introduces numeric differences in the summation
+    //       of the individual gradient contributions depending on the split of
+    //       the image domain into smaller pieces, which in case of affine
+    //       registration with NMI as image similarity measure results in
+    //       different results for different numbers of threads.
+    //       https://gitlab.doc.ic.ac.uk/BioMedIA/MIRTK/issues/31
+    //       The deterministic reduction splits the domain into fixed blocks
+    //       of image rows and sums the partial gradients in fixed order.
+    blocked_range3d<int> voxels(0, _Z, 1, 0, _Y, 1, 0, _X, _X);
+    mirtk::parallel_deterministic_reduce(voxels, *this);
   }
 
 }; // TransformationParametricGradientBody
@@ -1867,6 +1868,16 @@ void Transformation::ParametricGradient(const GenericImage<double> *in, double *
   MIRTK_DEBUG_TIMING(2, "parametric gradient computation");
 }
 
+// -----------------------------------------------------------------------------
+void Transformation::ParametricGradient(const GenericImage<float> *in, double *out,
+                                        const WorldCoordsImage *i2w,
+                                        const WorldCoordsImage *wc,
+                                        double t0, double w) const
+{
+  GenericImage<double> gradient(*in);
+  this->ParametricGradient(&gradient, out, i2w, wc, t0, w);
+}
+
 // -----------------------------------------------------------------------------
 void Transformation::ParametricGradient(const PointSet &pos, const Vector3D<double> *in,
                                         double *out, double t, double t0, double w) const
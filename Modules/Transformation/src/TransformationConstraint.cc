@@ -113,5 +113,16 @@ ParameterList TransformationConstraint::Parameter() const
   return params;
 }
 
+// =============================================================================
+// Evaluation
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+bool TransformationConstraint::Dependencies(Array<const void *> &deps) const
+{
+  deps.clear();
+  return true;
+}
+
 
 } // namespace mirtk
@@ -0,0 +1,308 @@
+/*
+ * Medical Image Registration ToolKit (MIRTK)
+ *
+ * Copyright 2026 Imperial College London
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include "mirtk/Math.h"
+#include "mirtk/GenericImage.h"
+#include "mirtk/BSplineFreeFormTransformation3D.h"
+
+#include <random>
+
+using namespace mirtk;
+
+// ===========================================================================
+// Helper
+// ===========================================================================
+
+/// Tolerance of displacement comparison which accounts for the lookup table
+/// of cubic B-spline weights used by the per-point evaluation
+static const double TOL = 5e-3;
+
+// ---------------------------------------------------------------------------
+/// Create FFD with random control point displacements in [-1, 1] mm
+///
+/// The lattice has a control point spacing of 5 mm and covers a cube
+/// of 40 mm side length centered at the world origin.
+void make_random_ffd(BSplineFreeFormTransformation3D &ffd, unsigned int seed)
+{
+  ImageAttributes domain(41, 41, 41);
+  ffd.Initialize(domain, 5.0, 5.0, 5.0);
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+  for (int dof = 0; dof < ffd.NumberOfDOFs(); ++dof) {
+    ffd.Put(dof, uniform(rng));
+  }
+}
+
+// ---------------------------------------------------------------------------
+/// Image domain whose voxels do not coincide with the control points
+ImageAttributes make_domain(int nx, int ny, int nz, double angle = .0)
+{
+  ImageAttributes attr(nx, ny, nz, 1.13, 1.07, 1.21);
+  attr._xorigin =  .37;
+  attr._yorigin = -.21;
+  attr._zorigin =  .53;
+  attr._xaxis[0] =  cos(angle), attr._xaxis[1] = sin(angle), attr._xaxis[2] = .0;
+  attr._yaxis[0] = -sin(angle), attr._yaxis[1] = cos(angle), attr._yaxis[2] = .0;
+  return attr;
+}
+
+// ---------------------------------------------------------------------------
+/// Fill displacement field with random vectors in [-r, r] mm
+template <class TReal>
+void fill_random(GenericImage<TReal> &disp, double r, unsigned int seed)
+{
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<double> uniform(-r, r);
+  for (int idx = 0; idx < disp.NumberOfVoxels(); ++idx) {
+    disp.Put(idx, static_cast<TReal>(uniform(rng)));
+  }
+}
+
+// ---------------------------------------------------------------------------
+/// Mean bending energy evaluated at each active control point separately
+double pointwise_bending_energy(const BSplineFreeFormTransformation3D &ffd,
+                                bool incl_passive, bool wrt_world)
+{
+  double x, y, z, bending = .0;
+  int    n = 0;
+  for (int k = 0; k < ffd.Z(); ++k)
+  for (int j = 0; j < ffd.Y(); ++j)
+  for (int i = 0; i < ffd.X(); ++i) {
+    if (incl_passive || ffd.IsActive(i, j, k)) {
+      x = i, y = j, z = k;
+      ffd.LatticeToWorld(x, y, z);
+      bending += ffd.BendingEnergy(x, y, z, .0, -1.0, wrt_world);
+      ++n;
+    }
+  }
+  return (n > 0 ? bending / n : .0);
+}
+
+// ---------------------------------------------------------------------------
+/// Mean bending energy evaluated at each voxel separately
+double pointwise_bending_energy(const BSplineFreeFormTransformation3D &ffd,
+                                const ImageAttributes &attr, bool wrt_world)
+{
+  double x, y, z, bending = .0;
+  for (int k = 0; k < attr._z; ++k)
+  for (int j = 0; j < attr._y; ++j)
+  for (int i = 0; i < attr._x; ++i) {
+    x = i, y = j, z = k;
+    attr.LatticeToWorld(x, y, z);
+    bending += ffd.BendingEnergy(x, y, z, .0, -1.0, wrt_world);
+  }
+  return bending / attr.NumberOfSpatialPoints();
+}
+
+// ---------------------------------------------------------------------------
+/// Compare dense displacements to those evaluated at each voxel separately
+///
+/// \param[in] ffd    Free-form deformation.
+/// \param[in] disp0  Initial displacements.
+/// \param[in] disp   Displacements computed by ffd.Displacement from \p disp0.
+template <class TReal>
+void expect_pointwise_displacement(const BSplineFreeFormTransformation3D &ffd,
+                                   const GenericImage<TReal> &disp0,
+                                   const GenericImage<TReal> &disp)
+{
+  double x, y, z, u, v, w;
+  int nfail = 0;
+  for (int k = 0; k < disp.Z(); ++k)
+  for (int j = 0; j < disp.Y(); ++j)
+  for (int i = 0; i < disp.X(); ++i) {
+    x = i, y = j, z = k;
+    disp.ImageToWorld(x, y, z);
+    x += disp0(i, j, k, 0);
+    y += disp0(i, j, k, 1);
+    z += disp0(i, j, k, 2);
+    u = x, v = y, w = z;
+    ffd.LocalDisplacement(u, v, w);
+    u += disp0(i, j, k, 0);
+    v += disp0(i, j, k, 1);
+    w += disp0(i, j, k, 2);
+    if (fabs(disp(i, j, k, 0) - u) > TOL ||
+        fabs(disp(i, j, k, 1) - v) > TOL ||
+        fabs(disp(i, j, k, 2) - w) > TOL) {
+      if (++nfail <= 10) {
+        ADD_FAILURE() << "Displacement of voxel (" << i << ", " << j << ", " << k << ") is ("
+                      << disp(i, j, k, 0) << ", " << disp(i, j, k, 1) << ", " << disp(i, j, k, 2)
+                      << "), expected (" << u << ", " << v << ", " << w << ")";
+      }
+    }
+  }
+  EXPECT_EQ(0, nfail);
+}
+
+// ===========================================================================
+// Tests
+// ===========================================================================
+
+// ---------------------------------------------------------------------------
+TEST(BSplineFreeFormTransformation3D, DisplacementOfRowAlignedDomain)
+{
+  BSplineFreeFormTransformation3D ffd;
+  make_random_ffd(ffd, 42);
+  GenericImage<double> disp0(make_domain(25, 22, 19), 3), disp;
+  disp = disp0;
+  ffd.Displacement(disp);
+  expect_pointwise_displacement(ffd, disp0, disp);
+}
+
+// ---------------------------------------------------------------------------
+TEST(BSplineFreeFormTransformation3D, DisplacementOfRotatedDomain)
+{
+  BSplineFreeFormTransformation3D ffd;
+  make_random_ffd(ffd, 7);
+  GenericImage<double> disp0(make_domain(17, 18, 15, .35), 3), disp;
+  disp = disp0;
+  ffd.Displacement(disp);
+  expect_pointwise_displacement(ffd, disp0, disp);
+}
+
+// ---------------------------------------------------------------------------
+TEST(BSplineFreeFormTransformation3D, DisplacementAtDisplacedPositions)
+{
+  BSplineFreeFormTransformation3D ffd;
+  make_random_ffd(ffd, 13);
+  GenericImage<double> disp0(make_domain(25, 22, 19), 3), disp;
+  fill_random(disp0, 1.0, 17);
+  disp = disp0;
+  ffd.Displacement(disp, .0, -1.0);
+  expect_pointwise_displacement(ffd, disp0, disp);
+}
+
+// ---------------------------------------------------------------------------
+TEST(BSplineFreeFormTransformation3D, DisplacementWithWorldCoordinates)
+{
+  BSplineFreeFormTransformation3D ffd;
+  make_random_ffd(ffd, 23);
+  GenericImage<double> disp0(make_domain(17, 18, 15, .35), 3), disp;
+  fill_random(disp0, 1.0, 29);
+  WorldCoordsImage i2w;
+  disp0.ImageToWorld(i2w);
+  disp = disp0;
+  ffd.Displacement(disp, .0, -1.0, &i2w);
+  expect_pointwise_displacement(ffd, disp0, disp);
+}
+
+// ---------------------------------------------------------------------------
+TEST(BSplineFreeFormTransformation3D, SinglePrecisionDisplacement)
+{
+  BSplineFreeFormTransformation3D ffd;
+  make_random_ffd(ffd, 31);
+  GenericImage<float> disp0(make_domain(25, 22, 19), 3), disp;
+  fill_random(disp0, 1.0, 37);
+  disp = disp0;
+  ffd.Displacement(disp, .0, -1.0);
+  expect_pointwise_displacement(ffd, disp0, disp);
+}
+
+// ---------------------------------------------------------------------------
+TEST(BSplineFreeFormTransformation3D, BendingEnergyOnLattice)
+{
+  BSplineFreeFormTransformation3D ffd;
+  make_random_ffd(ffd, 41);
+  for (int k = 0; k < ffd.Z(); ++k)
+  for (int j = 0; j < ffd.Y(); ++j)
+  for (int i = 0; i < ffd.X(); ++i) {
+    if ((i + 2 * j + 3 * k) % 5 == 0) ffd.PutStatus(i, j, k, Passive, Passive, Passive);
+  }
+  for (int wrt_world = 0; wrt_world < 2; ++wrt_world)
+  for (int incl_passive = 0; incl_passive < 2; ++incl_passive) {
+    const double expected = pointwise_bending_energy(ffd, incl_passive != 0, wrt_world != 0);
+    EXPECT_NEAR(expected, ffd.BendingEnergy(incl_passive != 0, wrt_world != 0), 1e-9 * expected)
+        << "incl_passive=" << incl_passive << ", wrt_world=" << wrt_world;
+  }
+}
+
+// ---------------------------------------------------------------------------
+TEST(BSplineFreeFormTransformation3D, BendingEnergyOn2DLattice)
+{
+  BSplineFreeFormTransformation3D ffd;
+  ffd.Initialize(ImageAttributes(41, 41), 5.0, 5.0);
+  std::mt19937 rng(43);
+  std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+  for (int dof = 0; dof < ffd.NumberOfDOFs(); ++dof) {
+    ffd.Put(dof, uniform(rng));
+  }
+  ASSERT_EQ(1, ffd.Z());
+  for (int wrt_world = 0; wrt_world < 2; ++wrt_world) {
+    const double expected = pointwise_bending_energy(ffd, true, wrt_world != 0);
+    EXPECT_NEAR(expected, ffd.BendingEnergy(true, wrt_world != 0), 1e-9 * expected);
+  }
+}
+
+// ---------------------------------------------------------------------------
+TEST(BSplineFreeFormTransformation3D, BendingEnergyOnDomain)
+{
+  BSplineFreeFormTransformation3D ffd;
+  make_random_ffd(ffd, 47);
+  const ImageAttributes attr = make_domain(21, 19, 17, .35);
+  for (int wrt_world = 0; wrt_world < 2; ++wrt_world) {
+    const double expected = pointwise_bending_energy(ffd, attr, wrt_world != 0);
+    EXPECT_NEAR(expected, ffd.BendingEnergy(attr, -1.0, wrt_world != 0), 1e-9 * expected);
+  }
+}
+
+// ---------------------------------------------------------------------------
+TEST(BSplineFreeFormTransformation3D, BendingEnergyGradient)
+{
+  // Bending energy is quadratic in the parameters, such that central
+  // differences are exact up to rounding errors. Only control points whose
+  // support region is inside the lattice are compared, because the gradient
+  // also accounts for the bending at the lattice boundary.
+  BSplineFreeFormTransformation3D ffd;
+  make_random_ffd(ffd, 53);
+  const double h = .1;
+  Array<double> gradient(ffd.NumberOfDOFs());
+  for (int wrt_world = 0; wrt_world < 2; ++wrt_world) {
+    fill(gradient.begin(), gradient.end(), .0);
+    ffd.BendingEnergyGradient(gradient.data(), 1.0, false, wrt_world != 0);
+    for (int k = 2; k < ffd.Z() - 2; k += 2)
+    for (int j = 2; j < ffd.Y() - 2; j += 3)
+    for (int i = 2; i < ffd.X() - 2; i += 2) {
+      int dof[3];
+      ffd.IndexToDOFs(ffd.LatticeToIndex(i, j, k), dof[0], dof[1], dof[2]);
+      for (int c = 0; c < 3; ++c) {
+        const double value = ffd.Get(dof[c]);
+        ffd.Put(dof[c], value + h);
+        const double e1 = ffd.BendingEnergy(false, wrt_world != 0);
+        ffd.Put(dof[c], value - h);
+        const double e2 = ffd.BendingEnergy(false, wrt_world != 0);
+        ffd.Put(dof[c], value);
+        const double expected = (e1 - e2) / (2.0 * h);
+        EXPECT_NEAR(expected, gradient[dof[c]], 1e-6 * (1.0 + fabs(expected)))
+            << "control point (" << i << ", " << j << ", " << k << "), component " << c
+            << ", wrt_world=" << wrt_world;
+      }
+    }
+  }
+}
+
+// ===========================================================================
+// Main
+// ===========================================================================
+
+// ---------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}